@@ -0,0 +1,59 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+import CryptoKit
+import Foundation
+
+/**
+ Seals and opens buffers with AES-GCM, for `ORKEncryptedFileHandle`.
+ 
+ A sealed buffer is the 12-byte nonce, followed by the ciphertext and the 16-byte tag. Each call to
+ `seal` uses a new random nonce.
+ */
+@objc(ORKAESGCMCipher)
+public final class ORKAESGCMCipher: NSObject {
+    
+    /// Returns `plaintext` encrypted and authenticated together with `additionalData`.
+    @objc(sealData:key:additionalData:error:)
+    public static func seal(_ plaintext: Data, key: Data, additionalData: Data) throws -> Data {
+        let sealedBox = try AES.GCM.seal(plaintext, using: SymmetricKey(data: key), authenticating: additionalData)
+        guard let combined = sealedBox.combined else {
+            throw CryptoKitError.incorrectParameterSize
+        }
+        return combined
+    }
+    
+    /// Returns the plaintext of a sealed buffer, or throws if it or `additionalData` were modified.
+    @objc(openData:key:additionalData:error:)
+    public static func open(_ sealed: Data, key: Data, additionalData: Data) throws -> Data {
+        let sealedBox = try AES.GCM.SealedBox(combined: sealed)
+        return try AES.GCM.open(sealedBox, using: SymmetricKey(data: key), authenticating: additionalData)
+    }
+}
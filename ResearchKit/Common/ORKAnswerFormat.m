@@ -51,6 +51,14 @@
 @import MapKit;
 @import Contacts;
 
+// Color and image choices expose only readonly properties and return self from -copyWithZone:, so
+// equal choices decoded from different archives can share one instance. Text choices are not
+// interned because their `image` is readwrite.
+#define ORK_INTERN_AFTER_DECODING \
+- (id)awakeAfterUsingCoder:(NSCoder *)aDecoder { \
+    return ORKInternedObject(self); \
+}
+
 NSString *const EmailValidationRegularExpressionPattern = @"^[A-Z0-9a-z._%+-]+@[A-Za-z0-9.-]+\\.[A-Za-z]{2,6}$";
 
 id ORKNullAnswerValue(void) {
@@ -1480,6 +1488,8 @@ NSArray<Class> *ORKAllowableValueClasses(void) {
     ORK_ENCODE_BOOL(aCoder, exclusive);
 }
 
+ORK_INTERN_AFTER_DECODING
+
 - (BOOL)shouldShowDontKnowButton {
     return NO;
 }
@@ -1707,6 +1717,8 @@ NSArray<Class> *ORKAllowableValueClasses(void) {
     ORK_ENCODE_IMAGE(aCoder, selectedStateImage);
 }
 
+ORK_INTERN_AFTER_DECODING
+
 - (BOOL)shouldShowDontKnowButton {
     return NO;
 }
@@ -62,6 +62,17 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)dataLoggerByteCountsDidChange:(ORKDataLogger *)dataLogger;
 
+/**
+ Tells the delegate that the encrypted current log file was cut back to its last intact chunk,
+ because a write to it was interrupted, for example when the app was terminated.
+ 
+ The samples written after that chunk are lost.
+ 
+ @param dataLogger  The data logger providing the notification.
+ @param fileUrl     The URL of the current log file.
+ */
+- (void)dataLogger:(ORKDataLogger *)dataLogger recoveredInterruptedLogFile:(NSURL *)fileUrl;
+
 @end
 
 
@@ -159,6 +170,28 @@ ORK_CLASS_AVAILABLE
 /// The file protection mode to use for newly created files.
 @property (assign) ORKFileProtectionMode fileProtectionMode;
 
+/**
+ The key used to encrypt log files, or `nil` to write them unencrypted.
+ 
+ When a key is set, log files are written through an `ORKEncryptedFileHandle`, so their contents
+ never reach the disk in plaintext. Read a finished log with
+ `+[ORKEncryptedFileHandle dataWithContentsOfURL:key:error:]`. A current log file that cannot be
+ opened with the key is rolled over, and logging continues in a new file. An encrypted current log file
+is also rolled over when the key is `nil`, so that plaintext is never appended to it.
+ 
+ The initial value is the value of `defaultEncryptionKey` when the data logger is created.
+ */
+@property (copy, nullable) NSData *encryptionKey;
+
+/**
+ The encryption key given to data loggers when they are created.
+ 
+ Setting this key encrypts the logs of the recorders that write through a data logger, such as the
+ accelerometer, device motion, location, and touch recorders. Get a key that persists between launches
+ with `+[ORKEncryptedFileHandle encryptionKeyFromKeychainForKey:error:]`.
+ */
+@property (class, copy, nullable) NSData *defaultEncryptionKey;
+
 /// The prefix on the log file names.
 @property (copy, readonly) NSString *logName;
 
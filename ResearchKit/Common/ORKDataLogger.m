@@ -31,7 +31,9 @@
 
 #import "ORKDataLogger.h"
 
+#import "ORKEncryptedFileHandle.h"
 #import "ORKHelpers_Internal.h"
+#include <os/lock.h>
 #include <sys/xattr.h>
 
 
@@ -43,6 +45,9 @@ static const unsigned long long ORKDataLoggerManagerDefaultLogFileSize = 1024 *
 
 static NSString *const ORKDataLoggerManagerConfigurationFilename = @".ORKDataLoggerManagerConfiguration";
 
+static NSData *ORKDataLoggerDefaultEncryptionKey = nil;
+static os_unfair_lock ORKDataLoggerDefaultEncryptionKeyLock = OS_UNFAIR_LOCK_INIT;
+
 
 @interface ORKDataLogger ()
 
@@ -462,6 +467,20 @@ static NSInteger _ORKJSON_terminatorLength = 0;
     BOOL _directoryDirty;
 }
 
++ (NSData *)defaultEncryptionKey {
+    os_unfair_lock_lock(&ORKDataLoggerDefaultEncryptionKeyLock);
+    NSData *key = ORKDataLoggerDefaultEncryptionKey;
+    os_unfair_lock_unlock(&ORKDataLoggerDefaultEncryptionKeyLock);
+    return key;
+}
+
++ (void)setDefaultEncryptionKey:(NSData *)defaultEncryptionKey {
+    NSData *key = [defaultEncryptionKey copy];
+    os_unfair_lock_lock(&ORKDataLoggerDefaultEncryptionKeyLock);
+    ORKDataLoggerDefaultEncryptionKey = key;
+    os_unfair_lock_unlock(&ORKDataLoggerDefaultEncryptionKeyLock);
+}
+
 + (ORKDataLogger *)JSONDataLoggerWithDirectory:(NSURL *)url logName:(NSString *)logName delegate:(id<ORKDataLoggerDelegate>)delegate {
     return [[ORKDataLogger alloc] initWithDirectory:url logName:logName fileExtension:@"json" formatter:[ORKJSONLogFormatter new] delegate:delegate];
 }
@@ -497,6 +516,7 @@ static NSInteger _ORKJSON_terminatorLength = 0;
         self.logFormatter = formatter;
         self.delegate = delegate;
         self.fileProtectionMode = ORKFileProtectionNone;
+        self.encryptionKey = [ORKDataLogger defaultEncryptionKey];
         _oldLogsPrefix = [_logName stringByAppendingString:@"-"];
         _fileExtension = fileExtension;
         _observer = [[ORKObjectObserver alloc] initWithObject:self keys:@[@"maximumCurrentLogFileLifetime", @"maximumCurrentLogFileSize"] selector:@selector(fileSizeLimitsDidChange)];
@@ -787,6 +807,30 @@ static NSInteger _ORKJSON_terminatorLength = 0;
     } error:errorOut];
 }
 
+- (NSFileHandle *)queue_openFileHandleForWritingToURL:(NSURL *)url error:(NSError **)errorOut {
+    NSData *encryptionKey = self.encryptionKey;
+    if (encryptionKey) {
+        ORKEncryptedFileHandle *fileHandle = [ORKEncryptedFileHandle fileHandleForWritingToURL:url key:encryptionKey error:errorOut];
+        if (fileHandle.recoveredFromInterruptedWrite) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                id<ORKDataLoggerDelegate> delegate = self.delegate;
+                if ([delegate respondsToSelector:@selector(dataLogger:recoveredInterruptedLogFile:)]) {
+                    [delegate dataLogger:self recoveredInterruptedLogFile:url];
+                }
+            });
+        }
+        return fileHandle;
+    }
+    if ([ORKEncryptedFileHandle isEncryptedFileAtURL:url]) {
+        // Appending plaintext would overwrite the end of the encrypted log; fail so that it is rolled over.
+        if (errorOut != NULL) {
+            *errorOut = [NSError errorWithDomain:ORKErrorDomain code:ORKErrorInvalidObject userInfo:@{NSDebugDescriptionErrorKey: @"The log file is encrypted and no encryption key is set"}];
+        }
+        return nil;
+    }
+    return [NSFileHandle fileHandleForWritingToURL:url error:errorOut];
+}
+
 - (NSFileHandle *)queue_makeFileHandleWithError:(NSError **)errorOut {
     NSFileManager *fileManager = [NSFileManager defaultManager];
     NSURL *url = [self currentLogFileURL];
@@ -799,7 +843,7 @@ static NSInteger _ORKJSON_terminatorLength = 0;
     
     NSFileHandle *fileHandle = nil;
     if (!createNewFile) {
-        fileHandle = [NSFileHandle fileHandleForWritingToURL:url error:errorOut];
+        fileHandle = [self queue_openFileHandleForWritingToURL:url error:errorOut];
         if (!fileHandle) {
             // Assume it's because we can't open the file, perhaps for security reasons.
             // Close and rename the log.
@@ -817,7 +861,7 @@ static NSInteger _ORKJSON_terminatorLength = 0;
             }
             return nil;
         }
-        fileHandle = [NSFileHandle fileHandleForWritingToURL:[self currentLogFileURL] error:errorOut];
+        fileHandle = [self queue_openFileHandleForWritingToURL:[self currentLogFileURL] error:errorOut];
         if (!fileHandle) {
             [fileManager removeItemAtURL:url error:nil];
             return nil;
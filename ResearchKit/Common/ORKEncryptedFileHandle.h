@@ -0,0 +1,119 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A file handle that encrypts a file in fixed-size chunks with AES-GCM as data is written.
+ 
+ The handle presents the plaintext to its callers: offsets, lengths, seeking and truncation all refer to
+ plaintext bytes, so it can stand in for a plain `NSFileHandle` in code such as `ORKLogFormatter`. Only
+ the chunks that a write touches are encrypted again, and reads decrypt only the chunks they need.
+ 
+ Each file has its own random key, stored in the file header sealed with the key passed in. Chunks are
+ sealed with their index, and the last chunk is also marked as final, so chunks that are modified,
+ reordered, or removed from the end of the file are detected when they are read.
+ 
+ Methods that fail raise `NSFileHandleOperationException`, like those of `NSFileHandle`; the variants
+ that take an error parameter return the error instead. A file handle is not thread safe.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKEncryptedFileHandle : NSFileHandle
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithFileDescriptor:(int)fd closeOnDealloc:(BOOL)closeopt NS_UNAVAILABLE;
+
+/**
+ Returns the 256-bit key stored in the keychain under the given key, creating and storing a random
+ key first if there is none.
+ 
+ @param key     The key under which `ORKKeychainWrapper` stores the encryption key.
+ @param error   The error that occurred, if any.
+ */
++ (nullable NSData *)encryptionKeyFromKeychainForKey:(NSString *)key error:(NSError * _Nullable *)error;
+
+/**
+ Returns a handle for writing to an existing file, positioned at its beginning.
+ 
+ An empty file is initialized as an encrypted file with no content; otherwise the file must have been
+ written by an `ORKEncryptedFileHandle` with the same key. If an earlier write was interrupted and left
+ the file without a valid final chunk, the file is cut back to the last chunk that authenticates.
+ 
+ @param url     The URL of the file.
+ @param key     A 128-, 192- or 256-bit key.
+ @param error   The error that occurred, if any.
+ */
++ (nullable instancetype)fileHandleForWritingToURL:(NSURL *)url key:(NSData *)key error:(NSError * _Nullable *)error;
+
+/**
+ Returns a handle for reading an encrypted file, positioned at its beginning.
+ 
+ @param url     The URL of the file.
+ @param key     The key the file was written with.
+ @param error   The error that occurred, if any.
+ */
++ (nullable instancetype)fileHandleForReadingFromURL:(NSURL *)url key:(NSData *)key error:(NSError * _Nullable *)error;
+
+/**
+ Returns the decrypted contents of an encrypted file.
+ 
+ @param url     The URL of the file.
+ @param key     The key the file was written with.
+ @param error   The error that occurred, if any.
+ */
++ (nullable NSData *)dataWithContentsOfURL:(NSURL *)url key:(NSData *)key error:(NSError * _Nullable *)error;
+
+/// Returns whether the file at the given URL starts with the header of an encrypted file.
++ (BOOL)isEncryptedFileAtURL:(NSURL *)url;
+
+/// The number of plaintext bytes in each chunk.
+@property (nonatomic, readonly) NSUInteger chunkSize;
+
+/// The number of plaintext bytes in the file.
+@property (nonatomic, readonly) unsigned long long length;
+
+/**
+ Whether opening the file for writing cut it back to the last chunk that authenticates, because an
+ earlier write was interrupted.
+ 
+ A file that was cut back is readable again, so readers can no longer tell that data was lost at its
+ end; check this property to find out.
+ */
+@property (nonatomic, readonly) BOOL recoveredFromInterruptedWrite;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,658 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKEncryptedFileHandle.h"
+
+#import "ORKErrors.h"
+#import "ORKHelpers_Internal.h"
+#import "ORKKeychainWrapper.h"
+#import "ResearchKit/ResearchKit-Swift.h"
+
+#import <Security/Security.h>
+
+#include <fcntl.h>
+#include <libkern/OSByteOrder.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+/*
+ File layout, with integers stored little-endian:
+ 
+ Preamble (16 bytes): "ORKE", version, chunk size, reserved (0).
+ File key: the random per-file key, sealed with the caller's key and the preamble as additional data.
+ Chunks: each chunk of plaintext sealed with the file key. Every chunk but the last holds `chunkSize`
+ bytes. The additional data of a chunk is its index and whether it is the last chunk, and a file
+ always has a last chunk, even when it is empty.
+ */
+static const char ORKEncryptedFileMagic[4] = {'O', 'R', 'K', 'E'};
+static const uint32_t ORKEncryptedFileVersion = 1;
+static const uint32_t ORKEncryptedFileDefaultChunkSize = 4096;
+static const uint32_t ORKEncryptedFileMaximumChunkSize = 1 << 24;
+static const NSUInteger ORKEncryptedFilePreambleLength = 16;
+static const NSUInteger ORKEncryptedFileKeyLength = 32;
+// The nonce and tag that ORKAESGCMCipher adds to each sealed buffer.
+static const NSUInteger ORKEncryptedFileSealOverhead = 12 + 16;
+static const NSUInteger ORKEncryptedFileHeaderLength = ORKEncryptedFilePreambleLength + ORKEncryptedFileKeyLength + ORKEncryptedFileSealOverhead;
+
+static NSError *ORKEncryptedFileError(NSString *description, NSError *underlyingError) {
+    NSMutableDictionary *userInfo = [NSMutableDictionary dictionaryWithObject:description forKey:NSDebugDescriptionErrorKey];
+    userInfo[NSUnderlyingErrorKey] = underlyingError;
+    return [NSError errorWithDomain:ORKErrorDomain code:ORKErrorInvalidObject userInfo:userInfo];
+}
+
+static BOOL ORKEncryptedFileSetPOSIXError(NSError **errorOut) {
+    if (errorOut != NULL) {
+        *errorOut = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+    }
+    return NO;
+}
+
+static void ORKEncryptedFileRaise(NSError *error) {
+    @throw [NSException exceptionWithName:NSFileHandleOperationException reason:error.description userInfo:@{NSUnderlyingErrorKey: error}];
+}
+
+static NSData *ORKEncryptedFilePreamble(uint32_t chunkSize) {
+    uint32_t words[3] = {OSSwapHostToLittleInt32(ORKEncryptedFileVersion), OSSwapHostToLittleInt32(chunkSize), 0};
+    NSMutableData *preamble = [NSMutableData dataWithBytes:ORKEncryptedFileMagic length:sizeof(ORKEncryptedFileMagic)];
+    [preamble appendBytes:words length:sizeof(words)];
+    return preamble;
+}
+
+static NSData *ORKEncryptedFileChunkAdditionalData(unsigned long long index, BOOL final) {
+    uint8_t bytes[9];
+    OSWriteLittleInt64(bytes, 0, index);
+    bytes[8] = final ? 1 : 0;
+    return [NSData dataWithBytes:bytes length:sizeof(bytes)];
+}
+
+static unsigned long long ORKEncryptedFileChunkCount(unsigned long long length, NSUInteger chunkSize) {
+    return MAX(1ULL, (length + chunkSize - 1) / chunkSize);
+}
+
+
+@implementation ORKEncryptedFileHandle {
+    int _fd;
+    BOOL _writable;
+    NSData *_fileKey;
+    unsigned long long _offset;
+    
+    // The plaintext of the last chunk, which appends modify.
+    NSMutableData *_lastChunk;
+}
+
++ (NSData *)encryptionKeyFromKeychainForKey:(NSString *)key error:(NSError **)errorOut {
+    NSError *error = nil;
+    id storedKey = [ORKKeychainWrapper objectForKey:key error:&error];
+    if ([storedKey isKindOfClass:[NSData class]] && ((NSData *)storedKey).length == ORKEncryptedFileKeyLength) {
+        return storedKey;
+    }
+    if (storedKey || !(error.code == errSecItemNotFound && [error.domain isEqualToString:NSOSStatusErrorDomain])) {
+        if (errorOut != NULL) {
+            *errorOut = error ? : ORKEncryptedFileError(@"The keychain item is not an encryption key", nil);
+        }
+        return nil;
+    }
+    
+    NSMutableData *newKey = [NSMutableData dataWithLength:ORKEncryptedFileKeyLength];
+    OSStatus status = SecRandomCopyBytes(kSecRandomDefault, newKey.length, newKey.mutableBytes);
+    if (status != errSecSuccess) {
+        if (errorOut != NULL) {
+            *errorOut = [NSError errorWithDomain:NSOSStatusErrorDomain code:status userInfo:nil];
+        }
+        return nil;
+    }
+    if (![ORKKeychainWrapper setObject:newKey forKey:key error:errorOut]) {
+        return nil;
+    }
+    return [newKey copy];
+}
+
++ (instancetype)fileHandleForWritingToURL:(NSURL *)url key:(NSData *)key error:(NSError **)errorOut {
+    return [[self alloc] initWithURL:url key:key writable:YES error:errorOut];
+}
+
++ (instancetype)fileHandleForReadingFromURL:(NSURL *)url key:(NSData *)key error:(NSError **)errorOut {
+    return [[self alloc] initWithURL:url key:key writable:NO error:errorOut];
+}
+
++ (NSData *)dataWithContentsOfURL:(NSURL *)url key:(NSData *)key error:(NSError **)errorOut {
+    ORKEncryptedFileHandle *fileHandle = [self fileHandleForReadingFromURL:url key:key error:errorOut];
+    NSData *data = [fileHandle readDataToEndOfFileAndReturnError:errorOut];
+    [fileHandle closeAndReturnError:nil];
+    return data;
+}
+
++ (BOOL)isEncryptedFileAtURL:(NSURL *)url {
+    int fd = open(url.fileSystemRepresentation, O_RDONLY);
+    if (fd < 0) {
+        return NO;
+    }
+    char magic[sizeof(ORKEncryptedFileMagic)];
+    ssize_t count = pread(fd, magic, sizeof(magic), 0);
+    close(fd);
+    return count == sizeof(magic) && memcmp(magic, ORKEncryptedFileMagic, sizeof(magic)) == 0;
+}
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithFileDescriptor:(int)fd closeOnDealloc:(BOOL)closeopt {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithURL:(NSURL *)url key:(NSData *)key writable:(BOOL)writable error:(NSError **)errorOut {
+    self = [super init];
+    if (self) {
+        _writable = writable;
+        _fd = open(url.fileSystemRepresentation, writable ? O_RDWR : O_RDONLY);
+        if (_fd < 0) {
+            ORKEncryptedFileSetPOSIXError(errorOut);
+            return nil;
+        }
+        
+        struct stat fileStatus;
+        if (fstat(_fd, &fileStatus) != 0) {
+            ORKEncryptedFileSetPOSIXError(errorOut);
+            return nil;
+        }
+        
+        BOOL success = NO;
+        if (fileStatus.st_size == 0 && writable) {
+            success = [self initializeFileWithKey:key error:errorOut];
+        } else {
+            success = [self readHeaderWithKey:key fileSize:(unsigned long long)fileStatus.st_size error:errorOut];
+        }
+        if (!success) {
+            return nil;
+        }
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_fd >= 0) {
+        close(_fd);
+    }
+}
+
+- (int)fileDescriptor {
+    return _fd;
+}
+
+#pragma mark - Chunks
+
+- (unsigned long long)fileOffsetOfChunkAtIndex:(unsigned long long)index {
+    return ORKEncryptedFileHeaderLength + index * (_chunkSize + ORKEncryptedFileSealOverhead);
+}
+
+- (BOOL)initializeFileWithKey:(NSData *)key error:(NSError **)errorOut {
+    NSMutableData *fileKey = [NSMutableData dataWithLength:ORKEncryptedFileKeyLength];
+    OSStatus status = SecRandomCopyBytes(kSecRandomDefault, fileKey.length, fileKey.mutableBytes);
+    if (status != errSecSuccess) {
+        if (errorOut != NULL) {
+            *errorOut = [NSError errorWithDomain:NSOSStatusErrorDomain code:status userInfo:nil];
+        }
+        return NO;
+    }
+    
+    NSData *preamble = ORKEncryptedFilePreamble(ORKEncryptedFileDefaultChunkSize);
+    NSData *sealedKey = [ORKAESGCMCipher sealData:fileKey key:key additionalData:preamble error:errorOut];
+    if (!sealedKey) {
+        return NO;
+    }
+    NSMutableData *header = [preamble mutableCopy];
+    [header appendData:sealedKey];
+    if (![self writeBytes:header atFileOffset:0 error:errorOut]) {
+        return NO;
+    }
+    
+    _chunkSize = ORKEncryptedFileDefaultChunkSize;
+    _fileKey = [fileKey copy];
+    _lastChunk = [NSMutableData data];
+    _length = 0;
+    return [self writeChunk:_lastChunk atIndex:0 final:YES error:errorOut];
+}
+
+- (BOOL)readHeaderWithKey:(NSData *)key fileSize:(unsigned long long)fileSize error:(NSError **)errorOut {
+    NSData *header = nil;
+    if (fileSize >= ORKEncryptedFileHeaderLength) {
+        header = [self readBytesAtFileOffset:0 length:ORKEncryptedFileHeaderLength error:errorOut];
+        if (!header) {
+            return NO;
+        }
+    }
+    const uint8_t *bytes = header.bytes;
+    if (!header || memcmp(bytes, ORKEncryptedFileMagic, sizeof(ORKEncryptedFileMagic)) != 0) {
+        if (errorOut != NULL) {
+            *errorOut = ORKEncryptedFileError(@"Not an encrypted file", nil);
+        }
+        return NO;
+    }
+    uint32_t version = OSReadLittleInt32(bytes, 4);
+    uint32_t chunkSize = OSReadLittleInt32(bytes, 8);
+    if (version != ORKEncryptedFileVersion || chunkSize == 0 || chunkSize > ORKEncryptedFileMaximumChunkSize) {
+        if (errorOut != NULL) {
+            *errorOut = ORKEncryptedFileError([NSString stringWithFormat:@"Unsupported encrypted file version %u or chunk size %u", version, chunkSize], nil);
+        }
+        return NO;
+    }
+    
+    NSError *error = nil;
+    NSData *preamble = [header subdataWithRange:NSMakeRange(0, ORKEncryptedFilePreambleLength)];
+    NSData *sealedKey = [header subdataWithRange:NSMakeRange(ORKEncryptedFilePreambleLength, header.length - ORKEncryptedFilePreambleLength)];
+    _fileKey = [ORKAESGCMCipher openData:sealedKey key:key additionalData:preamble error:&error];
+    if (!_fileKey) {
+        if (errorOut != NULL) {
+            *errorOut = ORKEncryptedFileError(@"The file was encrypted with a different key", error);
+        }
+        return NO;
+    }
+    _chunkSize = chunkSize;
+    
+    // Work out the length from the file size, then check it by opening the last chunk as final.
+    unsigned long long stride = _chunkSize + ORKEncryptedFileSealOverhead;
+    unsigned long long bodySize = fileSize - ORKEncryptedFileHeaderLength;
+    unsigned long long chunkCount = (bodySize + stride - 1) / stride;
+    unsigned long long lastChunkSize = chunkCount > 0 ? bodySize - (chunkCount - 1) * stride : 0;
+    NSError *lastChunkError = nil;
+    NSData *lastChunk = nil;
+    if (lastChunkSize < ORKEncryptedFileSealOverhead || (chunkCount > 1 && lastChunkSize == ORKEncryptedFileSealOverhead)) {
+        lastChunkError = ORKEncryptedFileError(@"The encrypted file is truncated", nil);
+    } else {
+        lastChunk = [self openChunkAtIndex:chunkCount - 1 length:(NSUInteger)(lastChunkSize - ORKEncryptedFileSealOverhead) final:YES error:&lastChunkError];
+    }
+    if (!lastChunk) {
+        // Only the writer repairs the file; readers still treat a missing final chunk as truncation.
+        if (_writable) {
+            return [self recoverFromInterruptedWriteWithChunkCount:chunkCount error:errorOut];
+        }
+        if (errorOut != NULL) {
+            *errorOut = lastChunkError;
+        }
+        return NO;
+    }
+    _lastChunk = [lastChunk mutableCopy];
+    _length = (chunkCount - 1) * _chunkSize + lastChunk.length;
+    return YES;
+}
+
+/*
+ An append that is interrupted can leave the file without a valid final chunk: it reseals the old last
+ chunk as non-final before writing the chunks after it, and any chunk it was writing may be torn. The
+ chunks before the ones being written are untouched, so fall back to the last chunk that authenticates,
+ drop everything after it and, if it was sealed as non-final, reseal it as the final chunk. If no chunk
+ authenticates, the write started in the first chunk and the file falls back to being empty.
+ */
+- (BOOL)recoverFromInterruptedWriteWithChunkCount:(unsigned long long)chunkCount error:(NSError **)errorOut {
+    unsigned long long index = chunkCount;
+    NSData *chunk = nil;
+    BOOL final = NO;
+    while (!chunk && index-- > 0) {
+        chunk = [self openChunkAtIndex:index length:_chunkSize final:YES error:NULL];
+        final = (chunk != nil);
+        if (!chunk) {
+            chunk = [self openChunkAtIndex:index length:_chunkSize final:NO error:NULL];
+        }
+    }
+    if (!chunk) {
+        index = 0;
+        chunk = [NSData data];
+        final = NO;
+    }
+    
+    _lastChunk = [chunk mutableCopy];
+    _length = index * _chunkSize + chunk.length;
+    _recoveredFromInterruptedWrite = YES;
+    ORK_Log_Error("Recovered an encrypted file interrupted during a write, keeping %llu bytes", _length);
+    if (ftruncate(_fd, (off_t)([self fileOffsetOfChunkAtIndex:index] + chunk.length + ORKEncryptedFileSealOverhead)) != 0) {
+        return ORKEncryptedFileSetPOSIXError(errorOut);
+    }
+    return final || [self writeChunk:_lastChunk atIndex:index final:YES error:errorOut];
+}
+
+- (NSData *)readBytesAtFileOffset:(unsigned long long)fileOffset length:(NSUInteger)length error:(NSError **)errorOut {
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    NSUInteger count = 0;
+    while (count < length) {
+        ssize_t result = pread(_fd, (uint8_t *)data.mutableBytes + count, length - count, (off_t)(fileOffset + count));
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result < 0) {
+            ORKEncryptedFileSetPOSIXError(errorOut);
+            return nil;
+        }
+        if (result == 0) {
+            if (errorOut != NULL) {
+                *errorOut = ORKEncryptedFileError(@"The encrypted file is truncated", nil);
+            }
+            return nil;
+        }
+        count += (NSUInteger)result;
+    }
+    return data;
+}
+
+- (BOOL)writeBytes:(NSData *)data atFileOffset:(unsigned long long)fileOffset error:(NSError **)errorOut {
+    NSUInteger count = 0;
+    while (count < data.length) {
+        ssize_t result = pwrite(_fd, (const uint8_t *)data.bytes + count, data.length - count, (off_t)(fileOffset + count));
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result < 0) {
+            return ORKEncryptedFileSetPOSIXError(errorOut);
+        }
+        count += (NSUInteger)result;
+    }
+    return YES;
+}
+
+- (NSData *)openChunkAtIndex:(unsigned long long)index length:(NSUInteger)length final:(BOOL)final error:(NSError **)errorOut {
+    NSData *sealedChunk = [self readBytesAtFileOffset:[self fileOffsetOfChunkAtIndex:index] length:length + ORKEncryptedFileSealOverhead error:errorOut];
+    if (!sealedChunk) {
+        return nil;
+    }
+    NSError *error = nil;
+    NSData *chunk = [ORKAESGCMCipher openData:sealedChunk key:_fileKey additionalData:ORKEncryptedFileChunkAdditionalData(index, final) error:&error];
+    if (!chunk && errorOut != NULL) {
+        *errorOut = ORKEncryptedFileError([NSString stringWithFormat:@"Chunk %llu of the encrypted file failed authentication", index], error);
+    }
+    return chunk;
+}
+
+- (BOOL)writeChunk:(NSData *)chunk atIndex:(unsigned long long)index final:(BOOL)final error:(NSError **)errorOut {
+    NSData *sealedChunk = [ORKAESGCMCipher sealData:chunk key:_fileKey additionalData:ORKEncryptedFileChunkAdditionalData(index, final) error:errorOut];
+    return sealedChunk && [self writeBytes:sealedChunk atFileOffset:[self fileOffsetOfChunkAtIndex:index] error:errorOut];
+}
+
+- (NSData *)chunkAtIndex:(unsigned long long)index error:(NSError **)errorOut {
+    if (index == ORKEncryptedFileChunkCount(_length, _chunkSize) - 1) {
+        return _lastChunk;
+    }
+    return [self openChunkAtIndex:index length:_chunkSize final:NO error:errorOut];
+}
+
+// Replaces plaintext from `offset`, which must not be past the end, and seals each chunk it touches.
+- (BOOL)replaceBytesFromOffset:(unsigned long long)offset withData:(NSData *)data error:(NSError **)errorOut {
+    if (data.length == 0) {
+        return YES;
+    }
+    unsigned long long end = offset + data.length;
+    unsigned long long newLength = MAX(_length, end);
+    unsigned long long oldLastIndex = ORKEncryptedFileChunkCount(_length, _chunkSize) - 1;
+    unsigned long long newLastIndex = ORKEncryptedFileChunkCount(newLength, _chunkSize) - 1;
+    unsigned long long firstIndex = offset / _chunkSize;
+    unsigned long long lastIndex = (end - 1) / _chunkSize;
+    
+    if (oldLastIndex < firstIndex && ![self writeChunk:_lastChunk atIndex:oldLastIndex final:NO error:errorOut]) {
+        return NO;
+    }
+    for (unsigned long long index = firstIndex; index <= lastIndex; index++) {
+        NSMutableData *chunk = nil;
+        if (index <= oldLastIndex) {
+            NSData *existingChunk = [self chunkAtIndex:index error:errorOut];
+            if (!existingChunk) {
+                return NO;
+            }
+            chunk = [existingChunk mutableCopy];
+        } else {
+            chunk = [NSMutableData data];
+        }
+        
+        unsigned long long chunkStart = index * _chunkSize;
+        NSUInteger from = (NSUInteger)(MAX(offset, chunkStart) - chunkStart);
+        NSUInteger to = (NSUInteger)(MIN(end, chunkStart + _chunkSize) - chunkStart);
+        if (chunk.length < to) {
+            chunk.length = to;
+        }
+        [chunk replaceBytesInRange:NSMakeRange(from, to - from) withBytes:(const uint8_t *)data.bytes + (chunkStart + from - offset)];
+        if (![self writeChunk:chunk atIndex:index final:(index == newLastIndex) error:errorOut]) {
+            return NO;
+        }
+        if (index == newLastIndex) {
+            _lastChunk = chunk;
+        }
+    }
+    _length = newLength;
+    return YES;
+}
+
+- (BOOL)checkOpenForWriting:(BOOL)writing error:(NSError **)errorOut {
+    if (_fd < 0 || (writing && !_writable)) {
+        if (errorOut != NULL) {
+            *errorOut = [NSError errorWithDomain:NSPOSIXErrorDomain code:EBADF userInfo:nil];
+        }
+        return NO;
+    }
+    return YES;
+}
+
+#pragma mark - NSFileHandle
+
+- (NSData *)readDataUpToLength:(NSUInteger)length error:(NSError **)errorOut {
+    if (![self checkOpenForWriting:NO error:errorOut]) {
+        return nil;
+    }
+    NSMutableData *data = [NSMutableData data];
+    while (data.length < length && _offset < _length) {
+        unsigned long long index = _offset / _chunkSize;
+        NSData *chunk = [self chunkAtIndex:index error:errorOut];
+        if (!chunk) {
+            return nil;
+        }
+        NSUInteger from = (NSUInteger)(_offset - index * _chunkSize);
+        NSUInteger count = MIN(chunk.length - from, length - data.length);
+        [data appendBytes:(const uint8_t *)chunk.bytes + from length:count];
+        _offset += count;
+    }
+    return data;
+}
+
+- (NSData *)readDataToEndOfFileAndReturnError:(NSError **)errorOut {
+    return [self readDataUpToLength:NSUIntegerMax error:errorOut];
+}
+
+- (BOOL)writeData:(NSData *)data error:(NSError **)errorOut {
+    if (![self checkOpenForWriting:YES error:errorOut]) {
+        return NO;
+    }
+    unsigned long long offset = _offset;
+    if (offset > _length) {
+        // Writing past the end fills the gap with zeros, as it would in a plain file.
+        NSMutableData *paddedData = [NSMutableData dataWithLength:(NSUInteger)(offset - _length)];
+        [paddedData appendData:data];
+        data = paddedData;
+        offset = _length;
+    }
+    if (![self replaceBytesFromOffset:offset withData:data error:errorOut]) {
+        return NO;
+    }
+    _offset = offset + data.length;
+    return YES;
+}
+
+- (BOOL)getOffset:(unsigned long long *)offsetInFile error:(NSError **)errorOut {
+    if (![self checkOpenForWriting:NO error:errorOut]) {
+        return NO;
+    }
+    *offsetInFile = _offset;
+    return YES;
+}
+
+- (BOOL)seekToEndReturningOffset:(unsigned long long *)offsetInFile error:(NSError **)errorOut {
+    if (![self checkOpenForWriting:NO error:errorOut]) {
+        return NO;
+    }
+    _offset = _length;
+    if (offsetInFile != NULL) {
+        *offsetInFile = _offset;
+    }
+    return YES;
+}
+
+- (BOOL)seekToOffset:(unsigned long long)offset error:(NSError **)errorOut {
+    if (![self checkOpenForWriting:NO error:errorOut]) {
+        return NO;
+    }
+    _offset = offset;
+    return YES;
+}
+
+- (BOOL)truncateAtOffset:(unsigned long long)offset error:(NSError **)errorOut {
+    if (![self checkOpenForWriting:YES error:errorOut]) {
+        return NO;
+    }
+    if (offset > _length) {
+        NSData *zeros = [NSMutableData dataWithLength:(NSUInteger)(offset - _length)];
+        if (![self replaceBytesFromOffset:_length withData:zeros error:errorOut]) {
+            return NO;
+        }
+    } else if (offset < _length) {
+        unsigned long long lastIndex = ORKEncryptedFileChunkCount(offset, _chunkSize) - 1;
+        NSData *existingChunk = [self chunkAtIndex:lastIndex error:errorOut];
+        if (!existingChunk) {
+            return NO;
+        }
+        NSMutableData *chunk = [[existingChunk subdataWithRange:NSMakeRange(0, (NSUInteger)(offset - lastIndex * _chunkSize))] mutableCopy];
+        // Truncate before resealing: if the reseal is interrupted, the torn last chunk is recovered like
+        // an interrupted append, whereas a final chunk sealed first would be left in the middle of the file.
+        if (ftruncate(_fd, (off_t)([self fileOffsetOfChunkAtIndex:lastIndex] + ORKEncryptedFileSealOverhead + chunk.length)) != 0) {
+            return ORKEncryptedFileSetPOSIXError(errorOut);
+        }
+        if (![self writeChunk:chunk atIndex:lastIndex final:YES error:errorOut]) {
+            return NO;
+        }
+        _lastChunk = chunk;
+        _length = offset;
+    }
+    _offset = offset;
+    return YES;
+}
+
+- (BOOL)synchronizeAndReturnError:(NSError **)errorOut {
+    if (![self checkOpenForWriting:NO error:errorOut]) {
+        return NO;
+    }
+    if (_writable && fsync(_fd) != 0) {
+        return ORKEncryptedFileSetPOSIXError(errorOut);
+    }
+    return YES;
+}
+
+- (BOOL)closeAndReturnError:(NSError **)errorOut {
+    if (![self checkOpenForWriting:NO error:errorOut]) {
+        return NO;
+    }
+    int result = close(_fd);
+    _fd = -1;
+    return result == 0 || ORKEncryptedFileSetPOSIXError(errorOut);
+}
+
+// The methods that raise on failure, which ORKLogFormatter uses.
+
+- (NSData *)availableData {
+    return [self readDataToEndOfFile];
+}
+
+- (NSData *)readDataToEndOfFile {
+    return [self readDataOfLength:NSUIntegerMax];
+}
+
+- (NSData *)readDataOfLength:(NSUInteger)length {
+    NSError *error = nil;
+    NSData *data = [self readDataUpToLength:length error:&error];
+    if (!data) {
+        ORKEncryptedFileRaise(error);
+    }
+    return data;
+}
+
+- (void)writeData:(NSData *)data {
+    NSError *error = nil;
+    if (![self writeData:data error:&error]) {
+        ORKEncryptedFileRaise(error);
+    }
+}
+
+- (unsigned long long)offsetInFile {
+    unsigned long long offset = 0;
+    NSError *error = nil;
+    if (![self getOffset:&offset error:&error]) {
+        ORKEncryptedFileRaise(error);
+    }
+    return offset;
+}
+
+- (unsigned long long)seekToEndOfFile {
+    unsigned long long offset = 0;
+    NSError *error = nil;
+    if (![self seekToEndReturningOffset:&offset error:&error]) {
+        ORKEncryptedFileRaise(error);
+    }
+    return offset;
+}
+
+- (void)seekToFileOffset:(unsigned long long)offset {
+    NSError *error = nil;
+    if (![self seekToOffset:offset error:&error]) {
+        ORKEncryptedFileRaise(error);
+    }
+}
+
+- (void)truncateFileAtOffset:(unsigned long long)offset {
+    NSError *error = nil;
+    if (![self truncateAtOffset:offset error:&error]) {
+        ORKEncryptedFileRaise(error);
+    }
+}
+
+- (void)synchronizeFile {
+    NSError *error = nil;
+    if (![self synchronizeAndReturnError:&error]) {
+        ORKEncryptedFileRaise(error);
+    }
+}
+
+- (void)closeFile {
+    NSError *error = nil;
+    if (![self closeAndReturnError:&error]) {
+        ORKEncryptedFileRaise(error);
+    }
+}
+
+@end
@@ -37,6 +37,7 @@
 #import "ORKTypes.h"
 
 #import <CoreText/CoreText.h>
+#include <os/lock.h>
 
 BOOL ORKLoggingEnabled = YES;
 
@@ -94,6 +95,25 @@ id ORKFindInArrayByKey(NSArray *array, NSString *key, id value) {
     return nil;
 }
 
+id ORKInternedObject(id object) {
+    if (object == nil) {
+        return nil;
+    }
+    static os_unfair_lock lock = OS_UNFAIR_LOCK_INIT;
+    static NSHashTable *table = nil;
+    os_unfair_lock_lock(&lock);
+    if (table == nil) {
+        table = [NSHashTable weakObjectsHashTable];
+    }
+    id interned = [table member:object];
+    if (interned == nil) {
+        [table addObject:object];
+        interned = object;
+    }
+    os_unfair_lock_unlock(&lock);
+    return interned;
+}
+
 NSString *ORKStringFromDateISO8601(NSDate *date) {
     static NSDateFormatter *formatter = nil;
     static dispatch_once_t onceToken;
@@ -171,6 +171,10 @@ UIColor *ORKRGBA(uint32_t x, CGFloat alpha);
 
 _Nullable id ORKFindInArrayByKey(NSArray *array, NSString *key, id value);
 
+// Returns a live instance equal to `object`, or `object` itself if there is none.
+// Only for immutable objects whose -copyWithZone: returns self. Thread-safe; holds instances weakly.
+ORK_EXTERN id ORKInternedObject(id object);
+
 NSString *ORKSignatureStringFromDate(NSDate *date);
 
 NSURL *ORKCreateRandomBaseURL(void);
@@ -158,6 +158,15 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, readonly) double frequency;
 
+/**
+ A Boolean value indicating whether the tremor spectrum of the acceleration is computed on device
+ while recording. The default value is `NO`.
+ 
+ When the value is `YES`, the recorder also reports an `ORKTremorSpectrumResult` object with the
+ same identifier as its file results, through `recorder:didCompleteWithSummaryResults:`.
+ */
+@property (nonatomic, assign) BOOL analyzesTremor;
+
 /**
  Returns an initialized accelerometer recorder configuration using the specified frequency.
  
@@ -317,6 +326,24 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, readonly) double frequency;
 
+/**
+ A Boolean value indicating whether gait and balance measures are computed on device while
+ recording. The default value is `NO`.
+ 
+ When the value is `YES`, the recorder also reports an `ORKGaitSummaryResult` object with the
+ same identifier as its file results, through `recorder:didCompleteWithSummaryResults:`.
+ */
+@property (nonatomic, assign) BOOL analyzesGait;
+
+/**
+ A Boolean value indicating whether the tremor spectrum of the user acceleration is computed on
+ device while recording. The default value is `NO`.
+ 
+ When the value is `YES`, the recorder also reports an `ORKTremorSpectrumResult` object with the
+ same identifier as its file results, through `recorder:didCompleteWithSummaryResults:`.
+ */
+@property (nonatomic, assign) BOOL analyzesTremor;
+
 /**
  Returns an initialized device motion recorder configuration using the specified frequency.
  
@@ -513,6 +540,24 @@ ORK_CLASS_AVAILABLE
 @end
 #endif 
 
+/**
+ An enumeration of the encodings the streaming audio recorders can use when writing
+ audio to disk in fixed-duration chunks.
+ */
+typedef NS_ENUM(NSInteger, ORKAudioChunkEncoding) {
+    /// Audio is not chunked. The streaming audio recorder writes a single uncompressed file.
+    ORKAudioChunkEncodingNone = 0,
+    
+    /// Each chunk is written as uncompressed linear PCM in a WAVE container.
+    ORKAudioChunkEncodingLinearPCM,
+    
+    /// Each chunk is written losslessly using Apple Lossless (ALAC) in an MPEG-4 container.
+    ORKAudioChunkEncodingAppleLossless,
+    
+    /// Each chunk is written using AAC in an MPEG-4 container.
+    ORKAudioChunkEncodingAAC
+} ORK_ENUM_AVAILABLE;
+
 /**
  A configuration object that records streaming audio data during an active step.
  
@@ -573,6 +618,93 @@ ORK_CLASS_AVAILABLE
  */
 - (instancetype)initWithCoder:(NSCoder *)aDecoder NS_DESIGNATED_INITIALIZER;
 
+/**
+ The encoding used to write the recorded audio in fixed-duration chunks.
+ 
+ When the value is `ORKAudioChunkEncodingNone`, the recorder writes a single uncompressed WAVE file.
+ Otherwise, audio is encoded on a background queue and rolled over to a new file every `chunkDuration`
+ seconds, or when the file reaches `rollingFileSizeThreshold` bytes, whichever comes first. Each chunk
+ is returned as a separate `ORKFileResult` object.
+ 
+ If the encoder falls behind, incoming audio is dropped rather than buffered without bound. The number
+ of dropped frames is included in the `userInfo` of each file result under the `droppedFrameCount` key.
+ 
+ The default value is `ORKAudioChunkEncodingNone`.
+ */
+@property (nonatomic, assign) ORKAudioChunkEncoding chunkEncoding;
+
+/**
+ The duration, in seconds, of each chunk written when `chunkEncoding` is not `ORKAudioChunkEncodingNone`.
+ 
+ If the value is 0, chunks roll over only when they reach `rollingFileSizeThreshold`. The default value is 0.
+ */
+@property (nonatomic, assign) NSTimeInterval chunkDuration;
+
+@end
+
+
+/**
+ A configuration object that extracts acoustic features from the microphone during an active step,
+ without storing the audio itself.
+ 
+ An `ORKAcousticFeatureRecorderConfiguration` generates a recorder that analyses audio in real time
+ and logs one JSON object per analysis frame containing the frame's energy, zero-crossing rate,
+ spectral centroid, spectral flatness, pitch, and voicing strength. Summary features, such as mean
+ pitch, jitter, shimmer, and pause statistics, are included in the `userInfo` of the resulting
+ `ORKFileResult` object under the `acousticFeatureSummary` key, and the number of audio frames dropped
+ because analysis fell behind under the `droppedFrameCount` key.
+ 
+ To use a recorder, include its configuration in the `recorderConfigurations` property
+ of an `ORKActiveStep` object, include that step in a task, and present it with
+ a task view controller.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKAcousticFeatureRecorderConfiguration : ORKRecorderConfiguration
+
+/**
+ Returns an initialized acoustic feature recorder configuration.
+ 
+ @param identifier          The unique identifier of the recorder configuration.
+ 
+ @return An initialized acoustic feature recorder configuration.
+ */
+- (instancetype)initWithIdentifier:(NSString *)identifier;
+
+/**
+ Returns an initialized acoustic feature recorder configuration.
+ 
+ @param identifier      The unique identifier of the recorder configuration.
+ @param outputDirectory The url to the directory in which all output file data should be written (if producing `ORKFileResult` instances).
+ 
+ @return An initialized acoustic feature recorder configuration.
+ */
+- (instancetype)initWithIdentifier:(NSString *)identifier
+                   outputDirectory:(nullable NSURL *)outputDirectory;
+
+/**
+ Returns an initialized acoustic feature recorder configuration.
+ 
+ This method is the designated initializer.
+ 
+ @param identifier      The unique identifier of the recorder configuration.
+ @param outputDirectory The url to the directory in which all output file data should be written (if producing `ORKFileResult` instances).
+ @param rollingFileSizeThreshold The file-size threshold in bytes used to determine when data is rolled over to multiple files as data is being written. If the value is 0, data is written to only one file and not rolled over to multiple files.
+ 
+ @return An initialized acoustic feature recorder configuration.
+ */
+- (instancetype)initWithIdentifier:(NSString *)identifier
+                   outputDirectory:(nullable NSURL *)outputDirectory
+          rollingFileSizeThreshold:(size_t)rollingFileSizeThreshold NS_DESIGNATED_INITIALIZER;
+
+/**
+ Returns a new acoustic feature recorder configuration initialized from data in the given unarchiver.
+ 
+ @param aDecoder    Coder from which to initialize the acoustic feature recorder configuration.
+ 
+ @return A new acoustic feature recorder configuration.
+ */
+- (instancetype)initWithCoder:(NSCoder *)aDecoder NS_DESIGNATED_INITIALIZER;
+
 @end
 
 /**
@@ -604,6 +736,18 @@ need to implement it.
  */
 - (void)recorder:(ORKRecorder *)recorder didFailWithError:(NSError *)error;
 
+@optional
+/**
+ Tells the delegate that the recorder has computed summary results on device, such as an
+ `ORKGaitSummaryResult` object.
+ 
+ This method is called when recording is stopped, before `recorder:didCompleteWithResults:`.
+ 
+ @param recorder        The generating recorder object.
+ @param results         The summary results.
+ */
+- (void)recorder:(ORKRecorder *)recorder didCompleteWithSummaryResults:(NSArray<ORKResult *> *)results;
+
 @end
 
 
@@ -277,6 +277,13 @@
     }
 }
 
+- (void)reportSummaryResults:(NSArray<ORKResult *> *)results {
+    id<ORKRecorderDelegate> localDelegate = self.delegate;
+    if (results.count != 0 && [localDelegate respondsToSelector:@selector(recorder:didCompleteWithSummaryResults:)]) {
+        [localDelegate recorder:self didCompleteWithSummaryResults:results];
+    }
+}
+
 - (void)reportFileResultsWithFiles:(NSArray<NSURL *> *)fileUrls error:(NSError *)error {
     id<ORKRecorderDelegate> localDelegate = self.delegate;
     if (fileUrls.count != 0 && !error) {
@@ -292,7 +299,6 @@
                 
                 [fileResults addObject:fileResult];
             }
-            
             [localDelegate recorder:self didCompleteWithResults:fileResults];
             
             // Point future recording at a new directory
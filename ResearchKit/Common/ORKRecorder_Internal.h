@@ -54,6 +54,12 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)reportFileResultsWithFiles:(NSArray<NSURL *> *)fileUrls error:(nullable NSError *)error;
 
+/**
+ Reports results computed on device to the delegate, if it implements
+ `recorder:didCompleteWithSummaryResults:`. Call before `reportFileResultsWithFiles:error:`.
+ */
+- (void)reportSummaryResults:(NSArray<ORKResult *> *)results;
+
 - (nullable NSURL *)recordingDirectoryURL;
 
 @end
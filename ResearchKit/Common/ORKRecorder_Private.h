@@ -192,6 +192,18 @@ ORK_CLASS_AVAILABLE
 
 @property (nonatomic, assign) BOOL bypassAudioEngineStart;
 
+/**
+ The encoding used to write streamed audio to disk in fixed-duration chunks.
+ 
+ The default value is `ORKAudioChunkEncodingNone`, in which case the streamer only forwards buffers to its delegate.
+ */
+@property (nonatomic, assign) ORKAudioChunkEncoding chunkEncoding;
+
+/**
+ The duration, in seconds, of each chunk written when `chunkEncoding` is not `ORKAudioChunkEncodingNone`.
+ */
+@property (nonatomic, assign) NSTimeInterval chunkDuration;
+
 @end
 
 NS_ASSUME_NONNULL_END
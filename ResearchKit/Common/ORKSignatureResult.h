@@ -30,6 +30,7 @@
 
 
 #import <ResearchKit/ORKResult.h>
+#import <ResearchKit/ORKStrokeData.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -43,6 +44,14 @@ NS_ASSUME_NONNULL_BEGIN
 ORK_CLASS_AVAILABLE
 @interface ORKSignatureResult : ORKResult
 
+/**
+ The strokes of the signature, in the compact binary stroke format.
+ 
+ When present, this is the canonical representation of the signature, and the
+ `signatureImage` and `signaturePath` properties are reconstructed from it on demand.
+ */
+@property (nonatomic, copy, nullable) ORKStrokeData *strokeData;
+
 /**
  The signature image generated by this step.
  */
@@ -35,7 +35,11 @@
 #import "ORKHelpers_Internal.h"
 
 
-@implementation ORKSignatureResult
+@implementation ORKSignatureResult {
+    // Reconstructed from `strokeData` when no image or path was provided explicitly.
+    UIImage *_strokeDataSignatureImage;
+    NSArray<UIBezierPath *> *_strokeDataSignaturePath;
+}
 
 - (instancetype)initWithIdentifier:(NSString *)identifier
                     signatureImage:(UIImage *)signatureImage
@@ -48,10 +52,47 @@
     return self;
 }
 
+- (instancetype)initWithIdentifier:(NSString *)identifier
+                        strokeData:(ORKStrokeData *)strokeData {
+    self = [super initWithIdentifier:identifier];
+    if (self) {
+        _strokeData = [strokeData copy];
+    }
+    return self;
+}
+
+- (void)setStrokeData:(ORKStrokeData *)strokeData {
+    _strokeData = [strokeData copy];
+    _strokeDataSignatureImage = nil;
+    _strokeDataSignaturePath = nil;
+}
+
+- (UIImage *)signatureImage {
+    if (_signatureImage == nil && _strokeData != nil) {
+        if (_strokeDataSignatureImage == nil) {
+            _strokeDataSignatureImage = [_strokeData imageWithLineColor:[UIColor blackColor]];
+        }
+        return _strokeDataSignatureImage;
+    }
+    return _signatureImage;
+}
+
+- (NSArray<UIBezierPath *> *)signaturePath {
+    if (_signaturePath == nil && _strokeData != nil) {
+        if (_strokeDataSignaturePath == nil) {
+            _strokeDataSignaturePath = [_strokeData bezierPaths];
+        }
+        return _strokeDataSignaturePath;
+    }
+    return _signaturePath;
+}
+
 - (void)encodeWithCoder:(NSCoder *)aCoder {
     [super encodeWithCoder:aCoder];
+    // Only explicitly provided images and paths are encoded; those reconstructed from the stroke data are not.
     ORK_ENCODE_IMAGE(aCoder, signatureImage);
     ORK_ENCODE_OBJ(aCoder, signaturePath);
+    ORK_ENCODE_OBJ(aCoder, strokeData);
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
@@ -59,6 +100,7 @@
     if (self) {
         ORK_DECODE_IMAGE(aDecoder, signatureImage);
         ORK_DECODE_OBJ_ARRAY(aDecoder, signaturePath, UIBezierPath);
+        ORK_DECODE_OBJ_CLASS(aDecoder, strokeData, ORKStrokeData);
     }
     return self;
 }
@@ -68,7 +110,7 @@
 }
 
 - (NSUInteger)hash {
-    return super.hash ^ self.signatureImage.hash ^ self.signaturePath.hash;
+    return super.hash ^ _signatureImage.hash ^ _signaturePath.hash ^ _strokeData.hash;
 }
 
 - (BOOL)isEqual:(id)object {
@@ -76,14 +118,18 @@
     
     __typeof(self) castObject = object;
     return (isParentSame &&
-            ORKEqualObjects(self.signatureImage, castObject.signatureImage) &&
-            ORKEqualObjects(self.signaturePath, castObject.signaturePath));
+            ORKEqualObjects(_signatureImage, castObject->_signatureImage) &&
+            ORKEqualObjects(_signaturePath, castObject->_signaturePath) &&
+            ORKEqualObjects(self.strokeData, castObject.strokeData));
 }
 
 - (instancetype)copyWithZone:(NSZone *)zone {
     ORKSignatureResult *result = [super copyWithZone:zone];
     result->_signatureImage = [_signatureImage copy];
     result->_signaturePath = ORKArrayCopyObjects(_signaturePath);
+    result->_strokeData = _strokeData;
+    result->_strokeDataSignatureImage = _strokeDataSignatureImage;
+    result->_strokeDataSignaturePath = _strokeDataSignaturePath;
     return result;
 }
 
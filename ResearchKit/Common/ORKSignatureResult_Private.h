@@ -40,6 +40,9 @@ NS_ASSUME_NONNULL_BEGIN
                     signatureImage:(UIImage *)signatureImage
                      signaturePath:(NSArray <UIBezierPath *> *)signaturePath;
 
+- (instancetype)initWithIdentifier:(NSString *)identifier
+                        strokeData:(ORKStrokeData *)strokeData;
+
 @end
 
 NS_ASSUME_NONNULL_END
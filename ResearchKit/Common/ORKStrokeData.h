@@ -0,0 +1,132 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <UIKit/UIKit.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ One sample of a stroke.
+ */
+typedef struct {
+    /// The location of the touch, in points in the drawing's coordinate space.
+    CGPoint location;
+    /// The normalized pressure of the touch, between 0 and 1, which scales the line width variation.
+    CGFloat pressure;
+    /// The time of the sample, in seconds since the first sample of the drawing.
+    NSTimeInterval timestamp;
+} ORKStrokePoint;
+
+/**
+ The `ORKStrokeData` class stores handwritten strokes, such as a signature or a freehand drawing,
+ in a compact binary form.
+ 
+ Each stroke is a sequence of points with a pressure and a timestamp. Locations are quantized to
+ 0.1 point, pressures to 0.001, and timestamps to 1 millisecond; each value is stored as the
+ variable-length difference from the previous point. A typical signature takes a few kilobytes.
+ 
+ Bezier paths and images are reconstructed from the points on demand, with the line width of each
+ segment varying with the pressure as it did when the strokes were drawn.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKStrokeData : NSObject <NSCopying, NSSecureCoding>
+
+/**
+ Returns stroke data with no strokes.
+ */
+- (instancetype)init;
+
+/**
+ Returns stroke data decoded from its binary representation, or `nil` if the data is not valid.
+ 
+ @param data    The binary representation, as returned by the `data` property.
+ */
+- (nullable instancetype)initWithData:(NSData *)data NS_DESIGNATED_INITIALIZER;
+
+/**
+ The binary representation of the strokes.
+ */
+@property (nonatomic, copy, readonly) NSData *data;
+
+/**
+ The size of the drawing area, in points.
+ */
+@property (nonatomic, readonly) CGSize canvasSize;
+
+/**
+ The line width drawn at zero pressure, in points.
+ */
+@property (nonatomic, readonly) CGFloat lineWidth;
+
+/**
+ The line width added at full pressure, in points.
+ */
+@property (nonatomic, readonly) CGFloat lineWidthVariation;
+
+/**
+ The number of strokes.
+ */
+@property (nonatomic, readonly) NSUInteger strokeCount;
+
+/**
+ Returns the number of points of a stroke.
+ 
+ @param strokeIndex     The index of the stroke.
+ */
+- (NSUInteger)numberOfPointsInStrokeAtIndex:(NSUInteger)strokeIndex;
+
+/**
+ Calls a block with each point of a stroke, in order.
+ 
+ @param strokeIndex     The index of the stroke.
+ @param block           The block to call with each point.
+ */
+- (void)enumeratePointsInStrokeAtIndex:(NSUInteger)strokeIndex usingBlock:(void (NS_NOESCAPE ^)(ORKStrokePoint point, BOOL *stop))block;
+
+/**
+ Returns Bezier paths that draw the strokes, smoothed through the midpoints of consecutive points.
+ 
+ A stroke is split into several paths where its line width changes.
+ */
+- (NSArray<UIBezierPath *> *)bezierPaths;
+
+/**
+ Returns an image of the strokes at the canvas size, at scale 1, on a transparent background.
+ 
+ @param lineColor   The color of the strokes.
+ */
+- (UIImage *)imageWithLineColor:(UIColor *)lineColor;
+
+@end
+
+NS_ASSUME_NONNULL_END
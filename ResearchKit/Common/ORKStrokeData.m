@@ -0,0 +1,473 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKStrokeData_Private.h"
+
+#import "ORKHelpers_Internal.h"
+
+
+static const uint8_t ORKStrokeDataMagic[4] = { 'O', 'R', 'K', 'S' };
+static const uint8_t ORKStrokeDataVersion = 1;
+
+// Quantization steps of the stored values.
+static const double ORKStrokeDataLocationScale = 10;        // 0.1 pt
+static const double ORKStrokeDataPressureScale = 1000;      // 0.001
+static const double ORKStrokeDataTimestampScale = 1000;     // 1 ms
+static const double ORKStrokeDataLineWidthScale = 100;      // 0.01 pt
+
+// Reconstructed paths change line width in steps of this size, as the drawing views do.
+static const CGFloat ORKStrokeDataLineWidthStep = 0.25;
+
+// Quantized values of a point; deltas between consecutive points, across strokes, are stored.
+typedef struct {
+    int64_t x;
+    int64_t y;
+    int64_t pressure;
+    int64_t timestamp;
+} ORKStrokeDataState;
+
+typedef struct {
+    NSUInteger offset;
+    NSUInteger pointCount;
+    ORKStrokeDataState initialState;
+} ORKStrokeDataStrokeInfo;
+
+static void ORKStrokeDataAppendVarint(NSMutableData *data, uint64_t value) {
+    uint8_t bytes[10];
+    NSUInteger length = 0;
+    while (value >= 0x80) {
+        bytes[length++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    bytes[length++] = (uint8_t)value;
+    [data appendBytes:bytes length:length];
+}
+
+static void ORKStrokeDataAppendSignedVarint(NSMutableData *data, int64_t value) {
+    ORKStrokeDataAppendVarint(data, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+static BOOL ORKStrokeDataReadVarint(const uint8_t *bytes, NSUInteger length, NSUInteger *offset, uint64_t *value) {
+    uint64_t result = 0;
+    for (NSUInteger shift = 0; shift < 64; shift += 7) {
+        if (*offset >= length) {
+            return NO;
+        }
+        uint8_t byte = bytes[(*offset)++];
+        result |= (uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return YES;
+        }
+    }
+    return NO;
+}
+
+static BOOL ORKStrokeDataReadSignedVarint(const uint8_t *bytes, NSUInteger length, NSUInteger *offset, int64_t *value) {
+    uint64_t encoded = 0;
+    if (!ORKStrokeDataReadVarint(bytes, length, offset, &encoded)) {
+        return NO;
+    }
+    *value = (int64_t)(encoded >> 1) ^ -(int64_t)(encoded & 1);
+    return YES;
+}
+
+static int64_t ORKStrokeDataQuantize(double value, double scale) {
+    return (int64_t)llround(value * scale);
+}
+
+static ORKStrokeDataState ORKStrokeDataStateForPoint(ORKStrokePoint point) {
+    CGFloat pressure = MIN(MAX(point.pressure, 0), 1);
+    return (ORKStrokeDataState){
+        .x = ORKStrokeDataQuantize(point.location.x, ORKStrokeDataLocationScale),
+        .y = ORKStrokeDataQuantize(point.location.y, ORKStrokeDataLocationScale),
+        .pressure = ORKStrokeDataQuantize(pressure, ORKStrokeDataPressureScale),
+        .timestamp = ORKStrokeDataQuantize(point.timestamp, ORKStrokeDataTimestampScale)
+    };
+}
+
+static ORKStrokePoint ORKStrokeDataPointForState(ORKStrokeDataState state) {
+    return (ORKStrokePoint){
+        .location = CGPointMake(state.x / ORKStrokeDataLocationScale, state.y / ORKStrokeDataLocationScale),
+        .pressure = state.pressure / ORKStrokeDataPressureScale,
+        .timestamp = state.timestamp / ORKStrokeDataTimestampScale
+    };
+}
+
+static NSData *ORKStrokeDataEncode(CGSize canvasSize, CGFloat lineWidth, CGFloat lineWidthVariation, NSUInteger strokeCount, NSData *strokes) {
+    NSMutableData *data = [NSMutableData dataWithCapacity:strokes.length + 24];
+    [data appendBytes:ORKStrokeDataMagic length:sizeof(ORKStrokeDataMagic)];
+    [data appendBytes:&ORKStrokeDataVersion length:1];
+    ORKStrokeDataAppendVarint(data, (uint64_t)MAX(ORKStrokeDataQuantize(canvasSize.width, ORKStrokeDataLocationScale), 0));
+    ORKStrokeDataAppendVarint(data, (uint64_t)MAX(ORKStrokeDataQuantize(canvasSize.height, ORKStrokeDataLocationScale), 0));
+    ORKStrokeDataAppendVarint(data, (uint64_t)MAX(ORKStrokeDataQuantize(lineWidth, ORKStrokeDataLineWidthScale), 0));
+    ORKStrokeDataAppendVarint(data, (uint64_t)MAX(ORKStrokeDataQuantize(lineWidthVariation, ORKStrokeDataLineWidthScale), 0));
+    ORKStrokeDataAppendVarint(data, strokeCount);
+    [data appendData:strokes];
+    return data;
+}
+
+
+@implementation ORKStrokeData {
+    NSData *_strokeInfo;
+}
+
+- (instancetype)init {
+    return [self initWithData:ORKStrokeDataEncode(CGSizeZero, 0, 0, 0, [NSData data])];
+}
+
+- (instancetype)initWithData:(NSData *)data {
+    ORKThrowInvalidArgumentExceptionIfNil(data);
+    self = [super init];
+    if (self) {
+        _data = [data copy];
+        if (![self parseData]) {
+            return nil;
+        }
+    }
+    return self;
+}
+
+// Validates the data, and indexes the strokes so that each can be decoded on its own.
+- (BOOL)parseData {
+    const uint8_t *bytes = _data.bytes;
+    NSUInteger length = _data.length;
+    NSUInteger offset = sizeof(ORKStrokeDataMagic) + 1;
+    if (length < offset ||
+        memcmp(bytes, ORKStrokeDataMagic, sizeof(ORKStrokeDataMagic)) != 0 ||
+        bytes[sizeof(ORKStrokeDataMagic)] != ORKStrokeDataVersion) {
+        return NO;
+    }
+    
+    uint64_t header[5];
+    for (NSUInteger index = 0; index < 5; index++) {
+        if (!ORKStrokeDataReadVarint(bytes, length, &offset, &header[index])) {
+            return NO;
+        }
+    }
+    _canvasSize = CGSizeMake(header[0] / ORKStrokeDataLocationScale, header[1] / ORKStrokeDataLocationScale);
+    _lineWidth = header[2] / ORKStrokeDataLineWidthScale;
+    _lineWidthVariation = header[3] / ORKStrokeDataLineWidthScale;
+    uint64_t strokeCount = header[4];
+    // Each stroke takes at least one byte.
+    if (strokeCount > length - offset) {
+        return NO;
+    }
+    
+    NSMutableData *strokeInfo = [NSMutableData dataWithLength:(NSUInteger)strokeCount * sizeof(ORKStrokeDataStrokeInfo)];
+    ORKStrokeDataStrokeInfo *infos = strokeInfo.mutableBytes;
+    ORKStrokeDataState state = {0};
+    for (NSUInteger strokeIndex = 0; strokeIndex < strokeCount; strokeIndex++) {
+        uint64_t pointCount = 0;
+        if (!ORKStrokeDataReadVarint(bytes, length, &offset, &pointCount) || pointCount > length - offset) {
+            return NO;
+        }
+        infos[strokeIndex] = (ORKStrokeDataStrokeInfo){ .offset = offset, .pointCount = (NSUInteger)pointCount, .initialState = state };
+        for (uint64_t pointIndex = 0; pointIndex < pointCount; pointIndex++) {
+            int64_t deltas[4];
+            for (NSUInteger component = 0; component < 4; component++) {
+                if (!ORKStrokeDataReadSignedVarint(bytes, length, &offset, &deltas[component])) {
+                    return NO;
+                }
+            }
+            state.x += deltas[0];
+            state.y += deltas[1];
+            state.pressure += deltas[2];
+            state.timestamp += deltas[3];
+        }
+    }
+    if (offset != length) {
+        return NO;
+    }
+    _strokeCount = (NSUInteger)strokeCount;
+    _strokeInfo = strokeInfo;
+    return YES;
+}
+
++ (instancetype)strokeDataWithBezierPaths:(NSArray<UIBezierPath *> *)paths
+                               canvasSize:(CGSize)canvasSize
+                                lineWidth:(CGFloat)lineWidth
+                       lineWidthVariation:(CGFloat)lineWidthVariation {
+    ORKStrokeDataBuilder *builder = [[ORKStrokeDataBuilder alloc] initWithLineWidth:lineWidth lineWidthVariation:lineWidthVariation];
+    builder.canvasSize = canvasSize;
+    for (UIBezierPath *path in paths) {
+        CGFloat pressure = lineWidthVariation > 0 ? (path.lineWidth - lineWidth) / lineWidthVariation : 0;
+        __block BOOL beginsStroke = YES;
+        CGPathApplyWithBlock(path.CGPath, ^(const CGPathElement *element) {
+            NSInteger endPointIndex;
+            switch (element->type) {
+                case kCGPathElementMoveToPoint:
+                case kCGPathElementAddLineToPoint:
+                    endPointIndex = 0;
+                    break;
+                case kCGPathElementAddQuadCurveToPoint:
+                    endPointIndex = 1;
+                    break;
+                case kCGPathElementAddCurveToPoint:
+                    endPointIndex = 2;
+                    break;
+                case kCGPathElementCloseSubpath:
+                default:
+                    return;
+            }
+            ORKStrokePoint point = { .location = element->points[endPointIndex], .pressure = pressure, .timestamp = 0 };
+            if (beginsStroke) {
+                [builder beginStrokeWithPoint:point];
+                beginsStroke = NO;
+            } else {
+                [builder addPoint:point];
+            }
+        });
+    }
+    return [builder strokeData];
+}
+
+- (const ORKStrokeDataStrokeInfo *)infoForStrokeAtIndex:(NSUInteger)strokeIndex {
+    if (strokeIndex >= _strokeCount) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Stroke index %@ beyond bounds [0 .. %@]", @(strokeIndex), @((NSInteger)_strokeCount - 1)]
+                                     userInfo:nil];
+    }
+    return &((const ORKStrokeDataStrokeInfo *)_strokeInfo.bytes)[strokeIndex];
+}
+
+- (NSUInteger)numberOfPointsInStrokeAtIndex:(NSUInteger)strokeIndex {
+    return [self infoForStrokeAtIndex:strokeIndex]->pointCount;
+}
+
+- (void)enumeratePointsInStrokeAtIndex:(NSUInteger)strokeIndex usingBlock:(void (NS_NOESCAPE ^)(ORKStrokePoint, BOOL *))block {
+    const ORKStrokeDataStrokeInfo *info = [self infoForStrokeAtIndex:strokeIndex];
+    const uint8_t *bytes = _data.bytes;
+    NSUInteger length = _data.length;
+    NSUInteger offset = info->offset;
+    ORKStrokeDataState state = info->initialState;
+    BOOL stop = NO;
+    for (NSUInteger pointIndex = 0; pointIndex < info->pointCount && !stop; pointIndex++) {
+        int64_t deltas[4];
+        for (NSUInteger component = 0; component < 4; component++) {
+            // Validated when the data was parsed.
+            ORKStrokeDataReadSignedVarint(bytes, length, &offset, &deltas[component]);
+        }
+        state.x += deltas[0];
+        state.y += deltas[1];
+        state.pressure += deltas[2];
+        state.timestamp += deltas[3];
+        block(ORKStrokeDataPointForState(state), &stop);
+    }
+}
+
+- (CGFloat)lineWidthForPressure:(CGFloat)pressure {
+    CGFloat width = _lineWidth + pressure * _lineWidthVariation;
+    return round(width / ORKStrokeDataLineWidthStep) * ORKStrokeDataLineWidthStep;
+}
+
+- (UIBezierPath *)pathWithLineWidth:(CGFloat)lineWidth {
+    UIBezierPath *path = [UIBezierPath bezierPath];
+    path.lineCapStyle = kCGLineCapRound;
+    path.lineJoinStyle = kCGLineJoinRound;
+    path.lineWidth = lineWidth;
+    return path;
+}
+
+static CGPoint ORKStrokeDataMidPoint(CGPoint p1, CGPoint p2) {
+    return CGPointMake((p1.x + p2.x) * 0.5, (p1.y + p2.y) * 0.5);
+}
+
+- (NSArray<UIBezierPath *> *)bezierPaths {
+    NSMutableArray<UIBezierPath *> *paths = [NSMutableArray new];
+    for (NSUInteger strokeIndex = 0; strokeIndex < _strokeCount; strokeIndex++) {
+        __block UIBezierPath *path = nil;
+        __block ORKStrokePoint previousPoint;
+        __block CGPoint previousMidPoint;
+        [self enumeratePointsInStrokeAtIndex:strokeIndex usingBlock:^(ORKStrokePoint point, BOOL *stop) {
+            if (path == nil) {
+                path = [self pathWithLineWidth:[self lineWidthForPressure:point.pressure]];
+                [path moveToPoint:point.location];
+                // A dot, so that a single tap is visible.
+                [path addArcWithCenter:point.location radius:0.1 startAngle:0.0 endAngle:2.0 * M_PI clockwise:YES];
+                previousMidPoint = point.location;
+            } else {
+                CGFloat lineWidth = [self lineWidthForPressure:point.pressure];
+                if (lineWidth != path.lineWidth) {
+                    [paths addObject:path];
+                    path = [self pathWithLineWidth:lineWidth];
+                    [path moveToPoint:previousMidPoint];
+                }
+                CGPoint midPoint = ORKStrokeDataMidPoint(previousPoint.location, point.location);
+                [path addQuadCurveToPoint:midPoint controlPoint:previousPoint.location];
+                previousMidPoint = midPoint;
+            }
+            previousPoint = point;
+        }];
+        if (path) {
+            [path addLineToPoint:previousPoint.location];
+            [paths addObject:path];
+        }
+    }
+    return [paths copy];
+}
+
+- (UIImage *)imageWithLineColor:(UIColor *)lineColor {
+    CGSize size = (_canvasSize.width == 0 || _canvasSize.height == 0) ? CGSizeMake(1, 1) : _canvasSize;
+    UIGraphicsBeginImageContext(size);
+    [lineColor setStroke];
+    for (UIBezierPath *path in [self bezierPaths]) {
+        [path stroke];
+    }
+    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    return image;
+}
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    ORK_ENCODE_OBJ(aCoder, data);
+}
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+    NSData *data = [aDecoder decodeObjectOfClass:[NSData class] forKey:@ORK_STRINGIFY(data)];
+    if (data == nil) {
+        return nil;
+    }
+    return [self initWithData:data];
+}
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+    // Immutable.
+    return self;
+}
+
+- (BOOL)isEqual:(id)object {
+    if ([self class] != [object class]) {
+        return NO;
+    }
+    
+    __typeof(self) castObject = object;
+    return ORKEqualObjects(self.data, castObject.data);
+}
+
+- (NSUInteger)hash {
+    return self.data.hash;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; strokes: %@; canvas: %@; bytes: %@>", self.class.description, self, @(self.strokeCount), NSStringFromCGSize(self.canvasSize), @(self.data.length)];
+}
+
+@end
+
+
+@implementation ORKStrokeDataBuilder {
+    NSMutableData *_strokes;
+    NSUInteger _closedStrokeCount;
+    NSMutableData *_openStroke;
+    NSUInteger _openStrokePointCount;
+    ORKStrokeDataState _state;
+}
+
+- (instancetype)initWithLineWidth:(CGFloat)lineWidth lineWidthVariation:(CGFloat)lineWidthVariation {
+    self = [super init];
+    if (self) {
+        _lineWidth = lineWidth;
+        _lineWidthVariation = lineWidthVariation;
+        _strokes = [NSMutableData new];
+        _openStroke = [NSMutableData new];
+    }
+    return self;
+}
+
+- (NSUInteger)strokeCount {
+    return _closedStrokeCount + (_openStrokePointCount > 0 ? 1 : 0);
+}
+
+- (void)closeStroke {
+    if (_openStrokePointCount > 0) {
+        ORKStrokeDataAppendVarint(_strokes, _openStrokePointCount);
+        [_strokes appendData:_openStroke];
+        _closedStrokeCount += 1;
+    }
+    _openStroke.length = 0;
+    _openStrokePointCount = 0;
+}
+
+- (void)beginStrokeWithPoint:(ORKStrokePoint)point {
+    [self closeStroke];
+    [self addPoint:point];
+}
+
+- (void)addPoint:(ORKStrokePoint)point {
+    ORKStrokeDataState state = ORKStrokeDataStateForPoint(point);
+    ORKStrokeDataAppendSignedVarint(_openStroke, state.x - _state.x);
+    ORKStrokeDataAppendSignedVarint(_openStroke, state.y - _state.y);
+    ORKStrokeDataAppendSignedVarint(_openStroke, state.pressure - _state.pressure);
+    ORKStrokeDataAppendSignedVarint(_openStroke, state.timestamp - _state.timestamp);
+    _state = state;
+    _openStrokePointCount += 1;
+    _lastTimestamp = point.timestamp;
+}
+
+- (void)appendStrokesFromStrokeData:(ORKStrokeData *)strokeData {
+    for (NSUInteger strokeIndex = 0; strokeIndex < strokeData.strokeCount; strokeIndex++) {
+        __block BOOL beginsStroke = YES;
+        [strokeData enumeratePointsInStrokeAtIndex:strokeIndex usingBlock:^(ORKStrokePoint point, BOOL *stop) {
+            if (beginsStroke) {
+                [self beginStrokeWithPoint:point];
+                beginsStroke = NO;
+            } else {
+                [self addPoint:point];
+            }
+        }];
+    }
+}
+
+- (void)removeAllStrokes {
+    _strokes.length = 0;
+    _closedStrokeCount = 0;
+    _openStroke.length = 0;
+    _openStrokePointCount = 0;
+    _state = (ORKStrokeDataState){0};
+    _lastTimestamp = 0;
+}
+
+- (ORKStrokeData *)strokeData {
+    NSMutableData *strokes = [_strokes mutableCopy];
+    if (_openStrokePointCount > 0) {
+        ORKStrokeDataAppendVarint(strokes, _openStrokePointCount);
+        [strokes appendData:_openStroke];
+    }
+    NSData *data = ORKStrokeDataEncode(_canvasSize, _lineWidth, _lineWidthVariation, self.strokeCount, strokes);
+    return [[ORKStrokeData alloc] initWithData:data];
+}
+
+@end
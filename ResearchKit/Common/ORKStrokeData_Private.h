@@ -0,0 +1,94 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <ResearchKit/ORKStrokeData.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ORKStrokeData ()
+
+/**
+ Returns stroke data approximating existing Bezier paths, such as paths archived before strokes
+ were recorded as points.
+ 
+ Each path becomes one stroke through the end points of its elements. The pressure is derived
+ from the line width of the path, and timestamps are zero.
+ */
++ (instancetype)strokeDataWithBezierPaths:(NSArray<UIBezierPath *> *)paths
+                               canvasSize:(CGSize)canvasSize
+                                lineWidth:(CGFloat)lineWidth
+                       lineWidthVariation:(CGFloat)lineWidthVariation;
+
+@end
+
+
+/**
+ Records strokes point by point as they are drawn, and encodes them into `ORKStrokeData`.
+ */
+@interface ORKStrokeDataBuilder : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithLineWidth:(CGFloat)lineWidth lineWidthVariation:(CGFloat)lineWidthVariation NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic) CGSize canvasSize;
+
+@property (nonatomic, readonly) CGFloat lineWidth;
+
+@property (nonatomic, readonly) CGFloat lineWidthVariation;
+
+@property (nonatomic, readonly) NSUInteger strokeCount;
+
+/**
+ The timestamp of the last point added, or 0 if there is none.
+ */
+@property (nonatomic, readonly) NSTimeInterval lastTimestamp;
+
+- (void)beginStrokeWithPoint:(ORKStrokePoint)point;
+
+/**
+ Adds a point to the current stroke, or starts a stroke if there is none.
+ */
+- (void)addPoint:(ORKStrokePoint)point;
+
+/**
+ Adds every stroke of existing stroke data after the strokes recorded so far.
+ */
+- (void)appendStrokesFromStrokeData:(ORKStrokeData *)strokeData;
+
+- (void)removeAllStrokes;
+
+- (ORKStrokeData *)strokeData;
+
+@end
+
+NS_ASSUME_NONNULL_END
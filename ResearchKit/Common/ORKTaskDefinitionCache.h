@@ -0,0 +1,89 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKOrderedTask;
+
+/**
+ A cache of decoded task definitions, for apps that ship archived tasks in their bundle.
+ 
+ The first request for an archive decodes it with secure coding and keeps the decoded task as a
+ prototype, keyed by a SHA-256 hash of the archive's contents. Later requests for the same contents
+ skip decoding and return a copy of the prototype. Copies are independent tasks, but they share
+ immutable objects such as text choices with the prototype.
+ 
+ Cached prototypes are released automatically under memory pressure. A cache may be used from any thread.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKTaskDefinitionCache : NSObject
+
+/**
+ Returns the cache shared by the app.
+ */
++ (instancetype)sharedCache;
+
+/**
+ Returns a task decoded from the given keyed archive.
+ 
+ @param data        A keyed archive whose root object is an `ORKOrderedTask` or one of its subclasses.
+ @param error       If the archive could not be decoded, an `NSError` object indicating the reason for the
+                    failure.
+ 
+ @return A task, or `nil` if the archive could not be decoded.
+ */
+- (nullable ORKOrderedTask *)orderedTaskWithArchivedData:(NSData *)data error:(NSError * _Nullable *)error;
+
+/**
+ Returns a task decoded from the keyed archive at the given file URL.
+ 
+ The file is mapped rather than read into memory when possible.
+ 
+ @param url         The file URL of a keyed archive whose root object is an `ORKOrderedTask`.
+ @param error       If the file could not be read or decoded, an `NSError` object indicating the reason
+                    for the failure.
+ 
+ @return A task, or `nil` if the file could not be read or decoded.
+ */
+- (nullable ORKOrderedTask *)orderedTaskWithContentsOfURL:(NSURL *)url error:(NSError * _Nullable *)error;
+
+/**
+ Removes all cached task definitions.
+ */
+- (void)removeAllTasks;
+
+@end
+
+NS_ASSUME_NONNULL_END
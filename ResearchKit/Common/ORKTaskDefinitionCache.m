@@ -0,0 +1,97 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKTaskDefinitionCache.h"
+
+#import "ORKOrderedTask.h"
+
+#import <CommonCrypto/CommonDigest.h>
+
+
+static NSData *ORKTaskDefinitionCacheKeyForData(NSData *data) {
+    CC_SHA256_CTX context;
+    CC_SHA256_Init(&context);
+    [data enumerateByteRangesUsingBlock:^(const void *bytes, NSRange byteRange, BOOL *stop) {
+        CC_SHA256_Update(&context, bytes, (CC_LONG)byteRange.length);
+    }];
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256_Final(digest, &context);
+    return [NSData dataWithBytes:digest length:sizeof(digest)];
+}
+
+@implementation ORKTaskDefinitionCache {
+    NSCache<NSData *, ORKOrderedTask *> *_prototypes;
+}
+
++ (instancetype)sharedCache {
+    static ORKTaskDefinitionCache *sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [[ORKTaskDefinitionCache alloc] init];
+    });
+    return sharedCache;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _prototypes = [[NSCache alloc] init];
+        _prototypes.name = @"ORKTaskDefinitionCache";
+    }
+    return self;
+}
+
+- (ORKOrderedTask *)orderedTaskWithArchivedData:(NSData *)data error:(NSError **)error {
+    NSData *key = ORKTaskDefinitionCacheKeyForData(data);
+    ORKOrderedTask *prototype = [_prototypes objectForKey:key];
+    if (prototype == nil) {
+        prototype = [NSKeyedUnarchiver unarchivedObjectOfClass:[ORKOrderedTask class] fromData:data error:error];
+        if (prototype == nil) {
+            return nil;
+        }
+        [_prototypes setObject:prototype forKey:key];
+    }
+    return [prototype copy];
+}
+
+- (ORKOrderedTask *)orderedTaskWithContentsOfURL:(NSURL *)url error:(NSError **)error {
+    NSData *data = [NSData dataWithContentsOfURL:url options:NSDataReadingMappedIfSafe error:error];
+    if (data == nil) {
+        return nil;
+    }
+    return [self orderedTaskWithArchivedData:data error:error];
+}
+
+- (void)removeAllTasks {
+    [_prototypes removeAllObjects];
+}
+
+@end
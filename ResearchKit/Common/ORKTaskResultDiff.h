@@ -0,0 +1,104 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKStepResult;
+@class ORKTaskResult;
+
+/**
+ The changes between two snapshots of the same task run's result.
+ 
+ Use a diff to send the progress of a long task incrementally: compute the diff between the
+ last snapshot that was sent and the current one, send the diff, and apply it to the copy of the
+ last snapshot on the other side. Diffs support secure coding and `ORKESerializer`.
+ 
+ Step results are matched by identifier, and so are the child results within each step result.
+ A diff holds only the step results that were added or changed. For a step result that was already
+ in the base snapshot, it holds only the child results that were added or changed.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKTaskResultDiff : NSObject <NSSecureCoding, NSCopying>
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns the changes that turn one snapshot of a task result into a later one.
+ 
+ @param baseResult  The earlier snapshot, or `nil` to include all of `taskResult`.
+ @param taskResult  The later snapshot, of the same task run as `baseResult`.
+ */
++ (instancetype)diffFromTaskResult:(nullable ORKTaskResult *)baseResult toTaskResult:(ORKTaskResult *)taskResult;
+
+/**
+ Returns an empty diff for a task run.
+ */
+- (instancetype)initWithTaskIdentifier:(NSString *)identifier taskRunUUID:(NSUUID *)taskRunUUID NS_DESIGNATED_INITIALIZER;
+
+- (nullable instancetype)initWithCoder:(NSCoder *)aDecoder NS_DESIGNATED_INITIALIZER;
+
+/// The identifier of the task.
+@property (nonatomic, copy, readonly) NSString *identifier;
+
+/// The task run the snapshots belong to.
+@property (nonatomic, copy, readonly) NSUUID *taskRunUUID;
+
+/// The start date of the later snapshot.
+@property (nonatomic, copy, readonly, nullable) NSDate *startDate;
+
+/// The end date of the later snapshot.
+@property (nonatomic, copy, readonly, nullable) NSDate *endDate;
+
+/// The step results that were added or changed, holding only their added or changed child results.
+@property (nonatomic, copy, readonly, nullable) NSArray<ORKStepResult *> *stepResults;
+
+/// The identifiers of the step results that were removed.
+@property (nonatomic, copy, readonly, nullable) NSArray<NSString *> *removedStepResultIdentifiers;
+
+/// The identifiers of the child results that were removed, keyed by the identifier of their step result.
+@property (nonatomic, copy, readonly, nullable) NSDictionary<NSString *, NSArray<NSString *> *> *removedChildResultIdentifiers;
+
+/**
+ Returns a new task result with the changes applied to a copy of the given snapshot.
+ 
+ @param baseResult  The snapshot the diff was computed from, or `nil` if it was computed from `nil`.
+ @param error       If `baseResult` belongs to a different task run, an `ORKErrorInvalidObject` error.
+ */
+- (nullable ORKTaskResult *)taskResultByApplyingToTaskResult:(nullable ORKTaskResult *)baseResult error:(NSError * _Nullable *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,289 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKTaskResultDiff.h"
+
+#import "ORKCollectionResult.h"
+#import "ORKErrors.h"
+#import "ORKHelpers_Internal.h"
+
+
+static BOOL ORKResultUnchanged(ORKResult *baseResult, ORKResult *result) {
+    // Result hashes are cheap and follow isEqual:, so most changed results are told apart without
+    // comparing their contents. A hash that misses equality only makes the diff larger.
+    return baseResult == result || (baseResult.hash == result.hash && [baseResult isEqual:result]);
+}
+
+static NSDictionary<NSString *, NSNumber *> *ORKIndexesByIdentifier(NSArray<ORKResult *> *results) {
+    NSMutableDictionary<NSString *, NSNumber *> *indexes = [NSMutableDictionary dictionaryWithCapacity:results.count];
+    for (NSUInteger index = 0; index < results.count; index++) {
+        NSString *identifier = results[index].identifier;
+        if (identifier == nil || indexes[identifier] != nil) {
+            return nil;
+        }
+        indexes[identifier] = @(index);
+    }
+    return indexes;
+}
+
+/*
+ Finds the results that were added or changed, and the identifiers of the results that were removed.
+ Applying these keeps the remaining base results in place and appends the added ones, so this
+ returns NO when that would not reproduce `results`: when identifiers repeat, or when results were
+ reordered or inserted before existing ones. The caller then replaces every result instead.
+ */
+static BOOL ORKDiffResults(NSArray<ORKResult *> *baseResults,
+                           NSArray<ORKResult *> *results,
+                           NSMutableIndexSet *changedIndexes,
+                           NSMutableArray<NSString *> *removedIdentifiers) {
+    NSDictionary<NSString *, NSNumber *> *baseIndexes = ORKIndexesByIdentifier(baseResults);
+    NSDictionary<NSString *, NSNumber *> *indexes = ORKIndexesByIdentifier(results);
+    if (baseIndexes == nil || indexes == nil) {
+        return NO;
+    }
+    
+    NSUInteger keptCount = 0;
+    for (ORKResult *baseResult in baseResults) {
+        NSNumber *index = indexes[baseResult.identifier];
+        if (index == nil) {
+            [removedIdentifiers addObject:baseResult.identifier];
+            continue;
+        }
+        if (index.unsignedIntegerValue != keptCount) {
+            return NO;
+        }
+        if (!ORKResultUnchanged(baseResult, results[keptCount])) {
+            [changedIndexes addIndex:keptCount];
+        }
+        keptCount += 1;
+    }
+    [changedIndexes addIndexesInRange:NSMakeRange(keptCount, results.count - keptCount)];
+    return YES;
+}
+
+static NSArray<NSString *> *ORKIdentifiersOfResults(NSArray<ORKResult *> *results) {
+    NSMutableArray<NSString *> *identifiers = [NSMutableArray arrayWithCapacity:results.count];
+    for (ORKResult *result in results) {
+        if (result.identifier != nil) {
+            [identifiers addObject:result.identifier];
+        }
+    }
+    return identifiers;
+}
+
+/*
+ Removes the results with the given identifiers, then replaces each remaining result that has the
+ identifier of a result in `changedResults`, and appends the others. Results appended here are never
+ replaced, so repeated identifiers in `changedResults` are all kept.
+ */
+static NSArray<ORKResult *> *ORKApplyResults(NSArray<ORKResult *> *baseResults,
+                                             NSArray<ORKResult *> *changedResults,
+                                             NSArray<NSString *> *removedIdentifiers,
+                                             ORKResult *(^merge)(ORKResult *baseResult, ORKResult *changedResult)) {
+    NSSet<NSString *> *removed = [NSSet setWithArray:removedIdentifiers ? : @[]];
+    NSMutableArray<ORKResult *> *results = [NSMutableArray arrayWithCapacity:baseResults.count + changedResults.count];
+    NSMutableDictionary<NSString *, NSNumber *> *keptIndexes = [NSMutableDictionary dictionary];
+    for (ORKResult *baseResult in baseResults) {
+        if (baseResult.identifier != nil && [removed containsObject:baseResult.identifier]) {
+            continue;
+        }
+        if (baseResult.identifier != nil && keptIndexes[baseResult.identifier] == nil) {
+            keptIndexes[baseResult.identifier] = @(results.count);
+        }
+        [results addObject:baseResult];
+    }
+    for (ORKResult *changedResult in changedResults) {
+        NSNumber *index = changedResult.identifier ? keptIndexes[changedResult.identifier] : nil;
+        if (index != nil) {
+            NSUInteger keptIndex = index.unsignedIntegerValue;
+            results[keptIndex] = merge(results[keptIndex], changedResult);
+        } else {
+            [results addObject:[changedResult copy]];
+        }
+    }
+    return results;
+}
+
+
+@implementation ORKTaskResultDiff
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithTaskIdentifier:(NSString *)identifier taskRunUUID:(NSUUID *)taskRunUUID {
+    self = [super init];
+    if (self) {
+        _identifier = [identifier copy];
+        _taskRunUUID = [taskRunUUID copy];
+    }
+    return self;
+}
+
++ (instancetype)diffFromTaskResult:(ORKTaskResult *)baseResult toTaskResult:(ORKTaskResult *)taskResult {
+    if (baseResult != nil && !ORKEqualObjects(baseResult.taskRunUUID, taskResult.taskRunUUID)) {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException
+                                       reason:@"The task results belong to different task runs"
+                                     userInfo:nil];
+    }
+    ORKTaskResultDiff *diff = [[ORKTaskResultDiff alloc] initWithTaskIdentifier:taskResult.identifier taskRunUUID:taskResult.taskRunUUID];
+    diff->_startDate = [taskResult.startDate copy];
+    diff->_endDate = [taskResult.endDate copy];
+    
+    NSArray<ORKResult *> *baseStepResults = baseResult.results ? : @[];
+    NSArray<ORKResult *> *stepResults = taskResult.results ? : @[];
+    NSMutableIndexSet *changedIndexes = [NSMutableIndexSet indexSet];
+    NSMutableArray<NSString *> *removedIdentifiers = [NSMutableArray array];
+    if (!ORKDiffResults(baseStepResults, stepResults, changedIndexes, removedIdentifiers)) {
+        [changedIndexes removeAllIndexes];
+        [changedIndexes addIndexesInRange:NSMakeRange(0, stepResults.count)];
+        removedIdentifiers = [ORKIdentifiersOfResults(baseStepResults) mutableCopy];
+        baseStepResults = @[];
+    }
+    
+    NSDictionary<NSString *, NSNumber *> *baseIndexes = ORKIndexesByIdentifier(baseStepResults) ? : @{};
+    NSMutableArray<ORKStepResult *> *changedStepResults = [NSMutableArray arrayWithCapacity:changedIndexes.count];
+    NSMutableDictionary<NSString *, NSArray<NSString *> *> *removedChildIdentifiers = [NSMutableDictionary dictionary];
+    [changedIndexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+        ORKStepResult *stepResult = (ORKStepResult *)stepResults[index];
+        NSNumber *baseIndex = baseIndexes[stepResult.identifier];
+        ORKStepResult *changedStepResult = [stepResult copy];
+        if (baseIndex != nil) {
+            NSArray<ORKResult *> *baseChildren = ((ORKStepResult *)baseStepResults[baseIndex.unsignedIntegerValue]).results ? : @[];
+            NSArray<ORKResult *> *children = changedStepResult.results ? : @[];
+            NSMutableIndexSet *changedChildIndexes = [NSMutableIndexSet indexSet];
+            NSMutableArray<NSString *> *removedChildren = [NSMutableArray array];
+            if (ORKDiffResults(baseChildren, children, changedChildIndexes, removedChildren)) {
+                changedStepResult.results = [children objectsAtIndexes:changedChildIndexes];
+            } else {
+                removedChildren = [ORKIdentifiersOfResults(baseChildren) mutableCopy];
+            }
+            if (removedChildren.count > 0) {
+                removedChildIdentifiers[stepResult.identifier] = removedChildren;
+            }
+        }
+        [changedStepResults addObject:changedStepResult];
+    }];
+    
+    diff->_stepResults = [changedStepResults copy];
+    diff->_removedStepResultIdentifiers = [removedIdentifiers copy];
+    diff->_removedChildResultIdentifiers = [removedChildIdentifiers copy];
+    return diff;
+}
+
+- (ORKTaskResult *)taskResultByApplyingToTaskResult:(ORKTaskResult *)baseResult error:(NSError **)error {
+    if (baseResult != nil && (!ORKEqualObjects(baseResult.identifier, _identifier) || !ORKEqualObjects(baseResult.taskRunUUID, _taskRunUUID))) {
+        if (error) {
+            *error = [NSError errorWithDomain:ORKErrorDomain
+                                         code:ORKErrorInvalidObject
+                                     userInfo:@{NSDebugDescriptionErrorKey: @"The diff belongs to a different task run."}];
+        }
+        return nil;
+    }
+    ORKTaskResult *taskResult = baseResult ? [baseResult copy] : [[ORKTaskResult alloc] initWithTaskIdentifier:_identifier taskRunUUID:_taskRunUUID outputDirectory:nil];
+    taskResult.startDate = [_startDate copy];
+    taskResult.endDate = [_endDate copy];
+    
+    NSDictionary<NSString *, NSArray<NSString *> *> *removedChildIdentifiers = _removedChildResultIdentifiers;
+    taskResult.results = ORKApplyResults(taskResult.results, _stepResults, _removedStepResultIdentifiers, ^ORKResult *(ORKResult *baseStepResult, ORKResult *changedStepResult) {
+        ORKStepResult *stepResult = [changedStepResult copy];
+        stepResult.results = ORKApplyResults(((ORKStepResult *)baseStepResult).results,
+                                             ((ORKStepResult *)changedStepResult).results,
+                                             removedChildIdentifiers[changedStepResult.identifier],
+                                             ^ORKResult *(__unused ORKResult *baseChild, ORKResult *changedChild) { return [changedChild copy]; });
+        return stepResult;
+    });
+    return taskResult;
+}
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    ORK_ENCODE_OBJ(aCoder, identifier);
+    ORK_ENCODE_OBJ(aCoder, taskRunUUID);
+    ORK_ENCODE_OBJ(aCoder, startDate);
+    ORK_ENCODE_OBJ(aCoder, endDate);
+    ORK_ENCODE_OBJ(aCoder, stepResults);
+    ORK_ENCODE_OBJ(aCoder, removedStepResultIdentifiers);
+    ORK_ENCODE_OBJ(aCoder, removedChildResultIdentifiers);
+}
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+    self = [super init];
+    if (self) {
+        ORK_DECODE_OBJ_CLASS(aDecoder, identifier, NSString);
+        ORK_DECODE_OBJ_CLASS(aDecoder, taskRunUUID, NSUUID);
+        ORK_DECODE_OBJ_CLASS(aDecoder, startDate, NSDate);
+        ORK_DECODE_OBJ_CLASS(aDecoder, endDate, NSDate);
+        ORK_DECODE_OBJ_ARRAY(aDecoder, stepResults, ORKStepResult);
+        ORK_DECODE_OBJ_ARRAY(aDecoder, removedStepResultIdentifiers, NSString);
+        _removedChildResultIdentifiers = (NSDictionary *)[aDecoder decodeObjectOfClasses:[NSSet setWithObjects:[NSDictionary class], [NSArray class], [NSString class], nil]
+                                                                                  forKey:@"removedChildResultIdentifiers"];
+    }
+    return self;
+}
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+    ORKTaskResultDiff *diff = [[[self class] allocWithZone:zone] initWithTaskIdentifier:_identifier taskRunUUID:_taskRunUUID];
+    diff->_startDate = [_startDate copy];
+    diff->_endDate = [_endDate copy];
+    diff->_stepResults = ORKArrayCopyObjects(_stepResults);
+    diff->_removedStepResultIdentifiers = [_removedStepResultIdentifiers copy];
+    diff->_removedChildResultIdentifiers = [_removedChildResultIdentifiers copy];
+    return diff;
+}
+
+- (BOOL)isEqual:(id)object {
+    if ([self class] != [object class]) {
+        return NO;
+    }
+    
+    __typeof(self) castObject = object;
+    return (ORKEqualObjects(self.identifier, castObject.identifier)
+            && ORKEqualObjects(self.taskRunUUID, castObject.taskRunUUID)
+            && ORKEqualObjects(self.startDate, castObject.startDate)
+            && ORKEqualObjects(self.endDate, castObject.endDate)
+            && ORKEqualObjects(self.stepResults, castObject.stepResults)
+            && ORKEqualObjects(self.removedStepResultIdentifiers, castObject.removedStepResultIdentifiers)
+            && ORKEqualObjects(self.removedChildResultIdentifiers, castObject.removedChildResultIdentifiers));
+}
+
+- (NSUInteger)hash {
+    return _identifier.hash ^ _taskRunUUID.hash ^ _startDate.hash ^ _endDate.hash ^ _stepResults.hash ^ _removedStepResultIdentifiers.hash ^ _removedChildResultIdentifiers.hash;
+}
+
+@end
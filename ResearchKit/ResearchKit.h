@@ -69,6 +69,7 @@
 #import <ResearchKit/ORKOrderedTask.h>
 #import <ResearchKit/ORKNavigableOrderedTask.h>
 #import <ResearchKit/ORKStepNavigationRule.h>
+#import <ResearchKit/ORKTaskDefinitionCache.h>
 
 #import <ResearchKit/ORKAnswerFormat.h>
 #import <ResearchKit/ORKHealthAnswerFormat.h>
@@ -80,9 +81,11 @@
 #import <ResearchKit/ORKPasscodeResult.h>
 #import <ResearchKit/ORKQuestionResult.h>
 #import <ResearchKit/ORKSignatureResult.h>
+#import <ResearchKit/ORKStrokeData.h>
 #import <ResearchKit/ORKVideoInstructionStepResult.h>
 #import <ResearchKit/ORKWebViewStepResult.h>
 #import <ResearchKit/ORKResultPredicate.h>
+#import <ResearchKit/ORKTaskResultDiff.h>
 
 #import <ResearchKit/ORKRecorder.h>
 
@@ -39,6 +39,7 @@
 #import <ResearchKit/ORKConsentSection_Private.h>
 #import <ResearchKit/ORKDataLogger.h>
 #import <ResearchKit/ORKDevice_Private.h>
+#import <ResearchKit/ORKEncryptedFileHandle.h>
 #import <ResearchKit/ORKErrors.h>
 #import <ResearchKit/ORKHelpers_Internal.h>
 #import <ResearchKit/ORKHelpers_Private.h>
@@ -53,5 +54,6 @@
 #import <ResearchKit/ORKSkin_Private.h>
 #import <ResearchKit/ORKStepNavigationRule_Private.h>
 #import <ResearchKit/ORKStep_Private.h>
+#import <ResearchKit/ORKStrokeData_Private.h>
 #import <ResearchKit/ORKTypes_Private.h>
 #import <ResearchKit/ORKWebViewStepResult_Private.h>
@@ -34,6 +34,7 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @class ORKFileResult;
+@class ORKStrokeData;
 
 
 /**
@@ -54,6 +55,11 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, copy, nullable) NSArray <UIBezierPath *> *path;
 
+/**
+ The strokes drawn by the user, in the compact binary stroke format.
+ */
+@property (nonatomic, copy, nullable) ORKStrokeData *strokeData;
+
 /**
  The file result for the image generated during the step.
  */
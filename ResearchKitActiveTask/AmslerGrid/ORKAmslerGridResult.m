@@ -34,12 +34,14 @@
 #import "ORKHelpers_Internal.h"
 
 #import <ResearchKit/ORKFileResult.h>
+#import <ResearchKit/ORKStrokeData.h>
 
 @implementation ORKAmslerGridResult
 
 - (void)encodeWithCoder:(NSCoder *)aCoder {
     [super encodeWithCoder:aCoder];
     ORK_ENCODE_OBJ(aCoder, path);
+    ORK_ENCODE_OBJ(aCoder, strokeData);
     ORK_ENCODE_ENUM(aCoder, eyeSide);
     ORK_ENCODE_OBJ(aCoder, imageFileResult);
     ORK_ENCODE_OBJ(aCoder, drawingPathFileResult);
@@ -49,6 +51,7 @@
     self = [super initWithCoder:aDecoder];
     if (self) {
         ORK_DECODE_OBJ_ARRAY(aDecoder, path, UIBezierPath);
+        ORK_DECODE_OBJ_CLASS(aDecoder, strokeData, ORKStrokeData);
         ORK_DECODE_ENUM(aDecoder, eyeSide);
         ORK_DECODE_OBJ_CLASS(aDecoder, imageFileResult, ORKFileResult);
         ORK_DECODE_OBJ_CLASS(aDecoder, drawingPathFileResult, ORKFileResult);
@@ -61,7 +64,7 @@
 }
 
 - (NSUInteger)hash {
-    return super.hash ^ self.path.hash ^ self.imageFileResult.hash ^ self.drawingPathFileResult.hash;
+    return super.hash ^ self.path.hash ^ self.strokeData.hash ^ self.imageFileResult.hash ^ self.drawingPathFileResult.hash;
 }
 
 - (BOOL)isEqual:(id)object {
@@ -70,6 +73,7 @@
     __typeof(self) castObject = object;
     return (isParentSame &&
             ORKEqualObjects(self.path, castObject.path) &&
+            ORKEqualObjects(self.strokeData, castObject.strokeData) &&
             ORKEqualObjects(self.imageFileResult, castObject.imageFileResult) &&
             ORKEqualObjects(self.drawingPathFileResult, castObject.drawingPathFileResult) &&
             (self.eyeSide == castObject.eyeSide));
@@ -78,6 +82,7 @@
 - (instancetype)copyWithZone:(NSZone *)zone {
     ORKAmslerGridResult *result = [super copyWithZone:zone];
     result->_path = ORKArrayCopyObjects(_path);
+    result->_strokeData = _strokeData;
     result->_eyeSide = _eyeSide;
     result->_imageFileResult = _imageFileResult;
     result->_drawingPathFileResult = _drawingPathFileResult;
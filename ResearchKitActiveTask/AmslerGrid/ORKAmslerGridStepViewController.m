@@ -193,6 +193,7 @@ NSString * const PATHS_ARRAY_STORAGE_ERROR = @"Failed to store paths array to fi
         // construct the ORKAmslerGridResult
         ORKAmslerGridResult *amslerGridResult = [[ORKAmslerGridResult alloc] initWithIdentifier:self.step.identifier];
         amslerGridResult.path = _freehandDrawingView.freehandDrawingPath;
+        amslerGridResult.strokeData = _freehandDrawingView.freehandDrawingStrokeData;
         amslerGridResult.eyeSide = [self amslerGridStep].eyeSide;
         amslerGridResult.imageFileResult = imageFileResult;
         amslerGridResult.drawingPathFileResult = drawingPathFileResult;
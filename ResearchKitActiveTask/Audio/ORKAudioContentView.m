@@ -77,6 +77,7 @@ static const CGFloat ORKAudioStepContentRecordButtonVerticalSpacing = 20.0;
 
 @implementation ORKAudioContentView {
     NSMutableArray *_samples;
+    float _lastSample;
     UIColor *_keyColor;
     ORKRecordButton *_recordButton;
     BOOL _checkAudioLevel;
@@ -251,8 +252,10 @@ static const CGFloat ORKAudioStepContentRecordButtonVerticalSpacing = 20.0;
 
 - (void)setAlertThreshold:(CGFloat)alertThreshold {
     _alertThreshold = alertThreshold;
+    // The metering view redraws the samples in its ring buffer with the new threshold. Setting its samples
+    // here would replace them with _samples, which -addSample: no longer updates.
     _graphView.alertThreshold = alertThreshold;
-    [self updateGraphSamples];
+    [self updateAlertLabelHidden];
 }
 
 - (void)setTimeLeft:(NSTimeInterval)timeLeft {
@@ -281,10 +284,8 @@ static const CGFloat ORKAudioStepContentRecordButtonVerticalSpacing = 20.0;
 }
 
 - (void)updateAlertLabelHidden {
-    NSNumber *sample = _samples.lastObject;
-    
     if (_checkAudioLevel) {
-        BOOL show = (!_finished && (sample.doubleValue > _alertThreshold)) || _failed;
+        BOOL show = (!_finished && (_lastSample > _alertThreshold)) || _failed;
         
         if (_alertLabel.hidden && show) {
             UIAccessibilityPostNotification(UIAccessibilityAnnouncementNotification, _alertLabel.text);
@@ -295,24 +296,21 @@ static const CGFloat ORKAudioStepContentRecordButtonVerticalSpacing = 20.0;
 
 - (void)setSamples:(NSArray *)samples {
     _samples = [samples mutableCopy];
+    _lastSample = [_samples.lastObject floatValue];
     [self updateGraphSamples];
 }
 
 - (void)addSample:(NSNumber *)sample {
     NSAssert(sample != nil, @"Sample should be non-nil");
-    if (!_samples) {
-        _samples = [NSMutableArray array];
-    }
-    [_samples addObject:sample];
-    // Try to keep around 250 samples
-    if (_samples.count > 500) {
-        _samples = [[_samples subarrayWithRange:(NSRange){250, _samples.count - 250}] mutableCopy];
-    }
-    [self updateGraphSamples];
+    // The metering view keeps its own ring buffer and redraws at display cadence.
+    _lastSample = sample.floatValue;
+    [_graphView appendSamples:&_lastSample count:1];
+    [self updateAlertLabelHidden];
 }
 
 - (void)removeAllSamples {
     _samples = nil;
+    _lastSample = 0;
     [self updateGraphSamples];
 }
 
@@ -42,6 +42,10 @@ extern NSArray<NSNumber *> * ORKLastNSamples(NSArray<NSNumber *> *samples, NSInt
 
 - (void)setAlertThreshold:(float)threshold;
 
+@optional
+// Appends samples without rebuilding the whole sample array. Safe to call from any thread.
+- (void)appendSamples:(const float *)samples count:(NSUInteger)count;
+
 @end
 
 @protocol ORKAudioMeteringDisplay
@@ -29,7 +29,7 @@
  */
 
 #import "ORKAudioMeteringView.h"
-#import "ORKAudioGraphView.h"
+#import "ORKAudioWaveformView.h"
 
 NSArray<NSNumber *> * ORKLastNSamples(NSArray<NSNumber *> *samples, NSInteger limit) {
     
@@ -74,8 +74,7 @@ NSArray<NSNumber *> * ORKLastNSamples(NSArray<NSNumber *> *samples, NSInteger li
 
 - (void)configureMeteringView {
     if (!_meteringView) {
-        [self setMeteringView:[[ORKAudioGraphView alloc] init]];
-
+        [self setMeteringView:[[ORKAudioWaveformView alloc] init]];
     }
 }
 
@@ -111,6 +110,12 @@ NSArray<NSNumber *> * ORKLastNSamples(NSArray<NSNumber *> *samples, NSInteger li
     [_meteringView setAlertThreshold:threshold];
 }
 
+- (void)appendSamples:(const float *)samples count:(NSUInteger)count {
+    if ([_meteringView respondsToSelector:@selector(appendSamples:count:)]) {
+        [_meteringView appendSamples:samples count:count];
+    }
+}
+
 #pragma mark - ORKAudioMeteringDisplay
 
 - (void)setMeterColor:(UIColor *)meterColor {
@@ -0,0 +1,397 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKAudioWaveformView.h"
+#import "ORKSkin.h"
+#import "ORKHelpers_Internal.h"
+
+#include <os/lock.h>
+#include <stdatomic.h>
+
+static const CGFloat ValueLineWidth = 4.5;
+static const CGFloat ValueLineMargin = 1.5;
+static const CGFloat GraphHeight = 150.0;
+static const NSInteger ORKAudioWaveformFramesPerSecond = 30;
+
+// Enough columns for the widest supported screen.
+#define ORKAudioWaveformCapacity 512
+
+// Breaks the retain cycle between the view and its display link.
+@interface ORKAudioWaveformDisplayLinkTarget : NSObject
+
+- (instancetype)initWithHandler:(void (^)(void))handler;
+- (void)fire;
+
+@end
+
+@implementation ORKAudioWaveformDisplayLinkTarget {
+    void (^_handler)(void);
+}
+
+- (instancetype)initWithHandler:(void (^)(void))handler {
+    self = [super init];
+    if (self) {
+        _handler = [handler copy];
+    }
+    return self;
+}
+
+- (void)fire {
+    _handler();
+}
+
+@end
+
+
+@interface ORKAudioWaveformView ()
+
+@property (nonatomic, assign) float alertThreshold;
+@property (nonatomic, strong) UIColor *meterColor;
+@property (nonatomic, strong, nullable) UIColor *alertColor;
+
+@end
+
+@implementation ORKAudioWaveformView {
+    // Written from any thread, drained on the main thread.
+    os_unfair_lock _pendingLock;
+    float _pending[ORKAudioWaveformCapacity];
+    NSUInteger _pendingHead;
+    NSUInteger _pendingCount;
+    atomic_bool _displayLinkIdle;
+    
+    // Main thread only.
+    float _history[ORKAudioWaveformCapacity];
+    NSUInteger _historyHead;
+    NSUInteger _historyCount;
+    CADisplayLink *_displayLink;
+    CGContextRef _bitmap;
+    CGFloat _bitmapScale;
+    BOOL _needsFullRedraw;
+}
+
+- (instancetype)initWithFrame:(CGRect)frame {
+    self = [super initWithFrame:frame];
+    if (self) {
+        _pendingLock = OS_UNFAIR_LOCK_INIT;
+        atomic_init(&_displayLinkIdle, true);
+        _meterColor = [UIColor lightGrayColor];
+        _needsFullRedraw = YES;
+        [self setUpConstraints];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    [_displayLink invalidate];
+    CGContextRelease(_bitmap);
+}
+
+- (void)setUpConstraints {
+    NSLayoutConstraint *heightConstraint = [NSLayoutConstraint constraintWithItem:self
+                                                                        attribute:NSLayoutAttributeHeight
+                                                                        relatedBy:NSLayoutRelationEqual
+                                                                           toItem:nil
+                                                                        attribute:NSLayoutAttributeNotAnAttribute
+                                                                       multiplier:1.0
+                                                                         constant:GraphHeight];
+    heightConstraint.priority = UILayoutPriorityFittingSizeLevel;
+    
+    [NSLayoutConstraint activateConstraints:@[heightConstraint]];
+}
+
+#pragma mark - Display link
+
+- (void)didMoveToWindow {
+    [super didMoveToWindow];
+    if (self.window) {
+        if (!_displayLink) {
+            ORKWeakTypeOf(self) weakSelf = self;
+            _displayLink = [CADisplayLink displayLinkWithTarget:[[ORKAudioWaveformDisplayLinkTarget alloc] initWithHandler:^{
+                [weakSelf displayLinkDidFire];
+            }] selector:@selector(fire)];
+            _displayLink.preferredFramesPerSecond = ORKAudioWaveformFramesPerSecond;
+            [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+        }
+        _needsFullRedraw = YES;
+        [self scheduleDisplayLink];
+    } else {
+        [_displayLink invalidate];
+        _displayLink = nil;
+        atomic_store(&_displayLinkIdle, true);
+    }
+}
+
+- (void)scheduleDisplayLink {
+    atomic_store(&_displayLinkIdle, false);
+    _displayLink.paused = NO;
+}
+
+- (void)displayLinkDidFire {
+    float batch[ORKAudioWaveformCapacity];
+    NSUInteger batchCount = 0;
+    
+    os_unfair_lock_lock(&_pendingLock);
+    NSUInteger start = (_pendingHead + ORKAudioWaveformCapacity - _pendingCount) % ORKAudioWaveformCapacity;
+    for (NSUInteger index = 0; index < _pendingCount; index++) {
+        batch[batchCount++] = _pending[(start + index) % ORKAudioWaveformCapacity];
+    }
+    _pendingCount = 0;
+    if (batchCount == 0 && !_needsFullRedraw) {
+        // Nothing to draw; sleep until the next append wakes us up.
+        _displayLink.paused = YES;
+        atomic_store(&_displayLinkIdle, true);
+    }
+    os_unfair_lock_unlock(&_pendingLock);
+    
+    for (NSUInteger index = 0; index < batchCount; index++) {
+        _history[_historyHead] = batch[index];
+        _historyHead = (_historyHead + 1) % ORKAudioWaveformCapacity;
+        _historyCount = MIN(_historyCount + 1, ORKAudioWaveformCapacity);
+    }
+    
+    [self renderNewSampleCount:batchCount];
+}
+
+#pragma mark - Rendering
+
+- (CGColorRef)resolvedCGColor:(UIColor *)color {
+    return [color resolvedColorWithTraitCollection:self.traitCollection].CGColor;
+}
+
+- (BOOL)prepareBitmap {
+    CGSize size = self.bounds.size;
+    CGFloat scale = self.window.screen.scale ?: 1.0;
+    size_t width = (size_t)ceil(size.width * scale);
+    size_t height = (size_t)ceil(size.height * scale);
+    if (width == 0 || height == 0) {
+        return NO;
+    }
+    
+    if (_bitmap && CGBitmapContextGetWidth(_bitmap) == width && CGBitmapContextGetHeight(_bitmap) == height && _bitmapScale == scale) {
+        return YES;
+    }
+    
+    CGContextRelease(_bitmap);
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    _bitmap = CGBitmapContextCreate(NULL, width, height, 8, 0, colorSpace, kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Host);
+    CGColorSpaceRelease(colorSpace);
+    if (!_bitmap) {
+        return NO;
+    }
+    
+    // Draw in points with a UIKit-style flipped coordinate system.
+    CGContextTranslateCTM(_bitmap, 0, height);
+    CGContextScaleCTM(_bitmap, scale, -scale);
+    _bitmapScale = scale;
+    _needsFullRedraw = YES;
+    return YES;
+}
+
+- (void)fillBackgroundInRect:(CGRect)rect {
+    UIColor *backgroundColor = ORKNeedWideScreenDesign(self) ? ORKColor(ORKiPadBackgroundViewColorKey) : ORKColor(ORKBackgroundColorKey);
+    CGContextSetFillColorWithColor(_bitmap, [self resolvedCGColor:backgroundColor]);
+    CGContextFillRect(_bitmap, rect);
+    
+    CGRect bounds = self.bounds;
+    CGFloat midY = CGRectGetMidY(bounds);
+    CGContextSaveGState(_bitmap);
+    {
+        CGContextClipToRect(_bitmap, rect);
+        CGContextSetLineWidth(_bitmap, 1.0 / _bitmapScale);
+        CGContextSetStrokeColorWithColor(_bitmap, [self resolvedCGColor:_meterColor]);
+        // The dash period matches the column step, so shifted content stays aligned with newly drawn dashes.
+        CGFloat lengths[2] = {3, 3};
+        CGContextSetLineDash(_bitmap, 0, lengths, 2);
+        CGContextMoveToPoint(_bitmap, 0, midY);
+        CGContextAddLineToPoint(_bitmap, CGRectGetMaxX(bounds), midY);
+        CGContextStrokePath(_bitmap);
+    }
+    CGContextRestoreGState(_bitmap);
+}
+
+// Draws the `count` most recent samples as columns ending at the right edge.
+- (void)drawColumnsForMostRecentSampleCount:(NSUInteger)count {
+    CGRect bounds = self.bounds;
+    CGFloat midY = CGRectGetMidY(bounds);
+    CGFloat halfHeight = bounds.size.height / 2;
+    CGFloat lineStep = ValueLineMargin + ValueLineWidth;
+    
+    CGMutablePathRef normalPath = CGPathCreateMutable();
+    CGMutablePathRef alertPath = CGPathCreateMutable();
+    CGFloat x = CGRectGetMaxX(bounds) - lineStep / 2;
+    for (NSUInteger age = 0; age < count && x >= 0; age++) {
+        float value = _history[(_historyHead + ORKAudioWaveformCapacity - 1 - age) % ORKAudioWaveformCapacity];
+        CGMutablePathRef path = (value > _alertThreshold && _alertColor) ? alertPath : normalPath;
+        CGPathMoveToPoint(path, NULL, x, midY - value * halfHeight);
+        CGPathAddLineToPoint(path, NULL, x, midY + value * halfHeight);
+        x -= lineStep;
+    }
+    
+    CGContextSaveGState(_bitmap);
+    {
+        CGContextSetLineWidth(_bitmap, ValueLineWidth);
+        CGContextSetLineCap(_bitmap, kCGLineCapRound);
+        
+        CGContextAddPath(_bitmap, normalPath);
+        CGContextSetStrokeColorWithColor(_bitmap, [self resolvedCGColor:_meterColor]);
+        CGContextStrokePath(_bitmap);
+        
+        if (_alertColor) {
+            CGContextAddPath(_bitmap, alertPath);
+            CGContextSetStrokeColorWithColor(_bitmap, [self resolvedCGColor:_alertColor]);
+            CGContextStrokePath(_bitmap);
+        }
+    }
+    CGContextRestoreGState(_bitmap);
+    
+    CGPathRelease(normalPath);
+    CGPathRelease(alertPath);
+}
+
+- (void)renderNewSampleCount:(NSUInteger)newCount {
+    if (![self prepareBitmap]) {
+        return;
+    }
+    
+    CGRect bounds = self.bounds;
+    CGFloat lineStep = ValueLineMargin + ValueLineWidth;
+    size_t width = CGBitmapContextGetWidth(_bitmap);
+    size_t shiftPixels = (size_t)llround(newCount * lineStep * _bitmapScale);
+    
+    if (_needsFullRedraw || shiftPixels >= width) {
+        _needsFullRedraw = NO;
+        [self fillBackgroundInRect:bounds];
+        [self drawColumnsForMostRecentSampleCount:_historyCount];
+    } else if (newCount > 0) {
+        size_t height = CGBitmapContextGetHeight(_bitmap);
+        size_t bytesPerRow = CGBitmapContextGetBytesPerRow(_bitmap);
+        size_t bytesPerPixel = CGBitmapContextGetBitsPerPixel(_bitmap) / 8;
+        uint8_t *data = CGBitmapContextGetData(_bitmap);
+        for (size_t row = 0; row < height; row++) {
+            uint8_t *rowData = data + row * bytesPerRow;
+            memmove(rowData, rowData + shiftPixels * bytesPerPixel, (width - shiftPixels) * bytesPerPixel);
+        }
+        
+        CGRect newColumns = CGRectMake(CGRectGetMaxX(bounds) - shiftPixels / _bitmapScale, CGRectGetMinY(bounds), shiftPixels / _bitmapScale, bounds.size.height);
+        [self fillBackgroundInRect:newColumns];
+        [self drawColumnsForMostRecentSampleCount:newCount];
+    } else {
+        return;
+    }
+    
+    CGImageRef image = CGBitmapContextCreateImage(_bitmap);
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    self.layer.contents = (__bridge id)image;
+    self.layer.contentsScale = _bitmapScale;
+    [CATransaction commit];
+    CGImageRelease(image);
+}
+
+- (void)setNeedsFullRedraw {
+    _needsFullRedraw = YES;
+    [self scheduleDisplayLink];
+}
+
+- (void)layoutSubviews {
+    [super layoutSubviews];
+    [self setNeedsFullRedraw];
+}
+
+- (void)traitCollectionDidChange:(UITraitCollection *)previousTraitCollection {
+    [super traitCollectionDidChange:previousTraitCollection];
+    [self setNeedsFullRedraw];
+}
+
+#pragma mark - Sample ingestion
+
+- (void)appendSamples:(const float *)samples count:(NSUInteger)count {
+    if (count == 0) {
+        return;
+    }
+    
+    os_unfair_lock_lock(&_pendingLock);
+    // Only the newest samples can ever be on screen, so older ones are simply overwritten.
+    for (NSUInteger index = 0; index < count; index++) {
+        _pending[_pendingHead] = samples[index];
+        _pendingHead = (_pendingHead + 1) % ORKAudioWaveformCapacity;
+    }
+    _pendingCount = MIN(_pendingCount + count, ORKAudioWaveformCapacity);
+    os_unfair_lock_unlock(&_pendingLock);
+    
+    bool expected = true;
+    if (atomic_compare_exchange_strong(&_displayLinkIdle, &expected, false)) {
+        ORKWeakTypeOf(self) weakSelf = self;
+        void (^wake)(void) = ^{
+            [weakSelf scheduleDisplayLink];
+        };
+        if ([NSThread isMainThread]) {
+            wake();
+        } else {
+            dispatch_async(dispatch_get_main_queue(), wake);
+        }
+    }
+}
+
+#pragma mark - ORKAudioMetering
+
+- (void)setSamples:(NSArray<NSNumber *> *)samples {
+    os_unfair_lock_lock(&_pendingLock);
+    _pendingCount = 0;
+    os_unfair_lock_unlock(&_pendingLock);
+    
+    NSUInteger count = MIN(samples.count, ORKAudioWaveformCapacity);
+    NSUInteger offset = samples.count - count;
+    for (NSUInteger index = 0; index < count; index++) {
+        _history[index] = samples[offset + index].floatValue;
+    }
+    _historyHead = count % ORKAudioWaveformCapacity;
+    _historyCount = count;
+    [self setNeedsFullRedraw];
+}
+
+- (void)setAlertThreshold:(float)threshold {
+    _alertThreshold = threshold;
+    [self setNeedsFullRedraw];
+}
+
+#pragma mark - ORKAudioMeteringDisplay
+
+- (void)setMeterColor:(UIColor *)meterColor {
+    _meterColor = [meterColor copy];
+    [self setNeedsFullRedraw];
+}
+
+- (void)setAlertColor:(UIColor *)alertColor {
+    _alertColor = [alertColor copy];
+    [self setNeedsFullRedraw];
+}
+
+@end
@@ -63,7 +63,7 @@ NSString * const ORKActiveStepViewAccessibilityIdentifier = @"ORKActiveStepView"
     ORKActiveStepView *_activeStepView;
     ORKActiveStepTimer *_activeStepTimer;
 
-    NSArray<ORKFileResult *> *_recorderResults;
+    NSArray<ORKResult *> *_recorderResults;
     
     SystemSoundID _alertSound;
     NSURL *_alertSoundURL;
@@ -544,6 +544,11 @@ NSString * const ORKActiveStepViewAccessibilityIdentifier = @"ORKActiveStepView"
     [self notifyDelegateOnResultChange];
 }
 
+- (void)recorder:(ORKRecorder *)recorder didCompleteWithSummaryResults:(NSArray<ORKResult *> *)results {
+    _recorderResults = [_recorderResults arrayByAddingObjectsFromArray:results];
+    [self notifyDelegateOnResultChange];
+}
+
 - (void)recorder:(ORKRecorder *)recorder didFailWithError:(NSError *)error {
     if (error) {
         ORKStrongTypeOf(self.delegate) strongDelegate = self.delegate;
@@ -39,6 +39,7 @@
 #import <ResearchKitActiveTask/ORKPSATResult.h>
 #import <ResearchKitActiveTask/ORKRangeOfMotionResult.h>
 #import <ResearchKitActiveTask/ORKReactionTimeResult.h>
+#import <ResearchKitActiveTask/ORKResponseStatistics.h>
 #import <ResearchKitActiveTask/ORKSpatialSpanMemoryResult.h>
 #import <ResearchKitActiveTask/ORKSpeechInNoiseResult.h>
 #import <ResearchKitActiveTask/ORKSpeechRecognitionResult.h>
@@ -54,3 +55,4 @@
 #import <ResearchKitActiveTask/ORKTouchAbilityTapResult.h>
 #import <ResearchKitActiveTask/ORKTowerOfHanoiResult.h>
 #import <ResearchKitActiveTask/ORKTrailmakingResult.h>
+#import <ResearchKitActiveTask/ORKTrialPlanResult.h>
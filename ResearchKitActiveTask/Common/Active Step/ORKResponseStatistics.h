@@ -0,0 +1,116 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The `ORKResponseStatistics` class summarizes the response times of a timed active task.
+ 
+ The summary is accumulated as the task proceeds, one response at a time, so it is available
+ without reprocessing the samples of the result. The tapping interval task summarizes the intervals
+ between successive taps on the buttons; the reaction time, normalized reaction time, Stroop, and
+ PSAT tasks summarize the time taken to respond to each stimulus.
+ 
+ All times are in seconds. Percentiles are estimated to within 1% of the exact value.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKResponseStatistics : NSObject <NSCopying, NSSecureCoding>
+
+/**
+ The number of response times summarized.
+ */
+@property (nonatomic, assign) NSInteger count;
+
+/**
+ The mean response time.
+ */
+@property (nonatomic, assign) double mean;
+
+/**
+ The sample standard deviation of the response times.
+ */
+@property (nonatomic, assign) double standardDeviation;
+
+/**
+ The coefficient of variation of the response times, that is the standard deviation divided by the mean.
+ 
+ For the tapping interval task, this is the inter-tap interval variability.
+ */
+@property (nonatomic, assign) double coefficientOfVariation;
+
+/**
+ The shortest response time.
+ */
+@property (nonatomic, assign) double minimum;
+
+/**
+ The longest response time.
+ */
+@property (nonatomic, assign) double maximum;
+
+/**
+ The median response time.
+ */
+@property (nonatomic, assign) double median;
+
+/**
+ The 10th percentile of the response times, representative of the fastest responses.
+ */
+@property (nonatomic, assign) double percentile10;
+
+/**
+ The 90th percentile of the response times, representative of the slowest responses.
+ */
+@property (nonatomic, assign) double percentile90;
+
+/**
+ The number of erroneous responses.
+ 
+ These are taps outside the buttons in the tapping interval task, responses before the stimulus in
+ the reaction time tasks, and incorrect answers in the Stroop and PSAT tasks.
+ */
+@property (nonatomic, assign) NSInteger errorCount;
+
+/**
+ The number of stimuli without a response.
+ 
+ These are timed out attempts in the reaction time tasks, and additions without an answer in the
+ PSAT task. The tapping interval and Stroop tasks have no lapses.
+ */
+@property (nonatomic, assign) NSInteger lapseCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,118 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKResponseStatistics.h"
+
+#import "ORKHelpers_Internal.h"
+
+
+@implementation ORKResponseStatistics
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    ORK_ENCODE_INTEGER(aCoder, count);
+    ORK_ENCODE_DOUBLE(aCoder, mean);
+    ORK_ENCODE_DOUBLE(aCoder, standardDeviation);
+    ORK_ENCODE_DOUBLE(aCoder, coefficientOfVariation);
+    ORK_ENCODE_DOUBLE(aCoder, minimum);
+    ORK_ENCODE_DOUBLE(aCoder, maximum);
+    ORK_ENCODE_DOUBLE(aCoder, median);
+    ORK_ENCODE_DOUBLE(aCoder, percentile10);
+    ORK_ENCODE_DOUBLE(aCoder, percentile90);
+    ORK_ENCODE_INTEGER(aCoder, errorCount);
+    ORK_ENCODE_INTEGER(aCoder, lapseCount);
+}
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+    self = [super init];
+    if (self) {
+        ORK_DECODE_INTEGER(aDecoder, count);
+        ORK_DECODE_DOUBLE(aDecoder, mean);
+        ORK_DECODE_DOUBLE(aDecoder, standardDeviation);
+        ORK_DECODE_DOUBLE(aDecoder, coefficientOfVariation);
+        ORK_DECODE_DOUBLE(aDecoder, minimum);
+        ORK_DECODE_DOUBLE(aDecoder, maximum);
+        ORK_DECODE_DOUBLE(aDecoder, median);
+        ORK_DECODE_DOUBLE(aDecoder, percentile10);
+        ORK_DECODE_DOUBLE(aDecoder, percentile90);
+        ORK_DECODE_INTEGER(aDecoder, errorCount);
+        ORK_DECODE_INTEGER(aDecoder, lapseCount);
+    }
+    return self;
+}
+
+- (BOOL)isEqual:(id)object {
+    if ([self class] != [object class]) {
+        return NO;
+    }
+    
+    __typeof(self) castObject = object;
+    return ((self.count == castObject.count) &&
+            (self.mean == castObject.mean) &&
+            (self.standardDeviation == castObject.standardDeviation) &&
+            (self.coefficientOfVariation == castObject.coefficientOfVariation) &&
+            (self.minimum == castObject.minimum) &&
+            (self.maximum == castObject.maximum) &&
+            (self.median == castObject.median) &&
+            (self.percentile10 == castObject.percentile10) &&
+            (self.percentile90 == castObject.percentile90) &&
+            (self.errorCount == castObject.errorCount) &&
+            (self.lapseCount == castObject.lapseCount));
+}
+
+- (NSUInteger)hash {
+    return @(self.mean).hash ^ @(self.median).hash ^ self.count ^ self.errorCount ^ self.lapseCount;
+}
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+    ORKResponseStatistics *statistics = [[[self class] allocWithZone:zone] init];
+    statistics.count = self.count;
+    statistics.mean = self.mean;
+    statistics.standardDeviation = self.standardDeviation;
+    statistics.coefficientOfVariation = self.coefficientOfVariation;
+    statistics.minimum = self.minimum;
+    statistics.maximum = self.maximum;
+    statistics.median = self.median;
+    statistics.percentile10 = self.percentile10;
+    statistics.percentile90 = self.percentile90;
+    statistics.errorCount = self.errorCount;
+    statistics.lapseCount = self.lapseCount;
+    return statistics;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; count: %@; mean: %@; sd: %@; cv: %@; median: %@; p10: %@; p90: %@; errors: %@; lapses: %@>", self.class.description, self, @(self.count), @(self.mean), @(self.standardDeviation), @(self.coefficientOfVariation), @(self.median), @(self.percentile10), @(self.percentile90), @(self.errorCount), @(self.lapseCount)];
+}
+
+@end
@@ -0,0 +1,97 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKResponseStatistics;
+
+/**
+ Accumulates response time statistics one event at a time, in constant memory.
+ 
+ The mean and variance are updated with Welford's algorithm. Percentiles are estimated from a
+ fixed array of logarithmically spaced buckets, each spanning 2% of its value, so any percentile
+ is within 1% of the exact value for times between 0.1 ms and 10,000 s. Times outside that range
+ are clamped into it for the percentiles only.
+ 
+ The accumulator is not thread-safe; feed it from the thread that handles the task's events.
+ */
+@interface ORKResponseStatisticsAccumulator : NSObject
+
+/**
+ The number of response times added.
+ */
+@property (nonatomic, readonly) NSUInteger count;
+
+/**
+ Adds a response time, in seconds.
+ */
+- (void)addValue:(double)value;
+
+/**
+ Adds the interval between this event and the previous one, in seconds. The first event only
+ starts the first interval.
+ */
+- (void)addEventWithTimestamp:(NSTimeInterval)timestamp;
+
+/**
+ Counts an erroneous response.
+ */
+- (void)addError;
+
+/**
+ Counts a stimulus without a response.
+ */
+- (void)addLapse;
+
+/**
+ Returns the estimated response time at the given percentile, between 0 and 100, or 0 if no
+ response time was added. The percentile is the response time at rank `percentile / 100 * (count - 1)`,
+ rounded down, without interpolation.
+ */
+- (double)valueAtPercentile:(double)percentile;
+
+/**
+ Returns a summary of the events added so far.
+ */
+- (ORKResponseStatistics *)statistics;
+
+/**
+ Discards all events.
+ */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,171 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKResponseStatisticsAccumulator.h"
+
+#import "ORKResponseStatistics.h"
+
+
+// Relative accuracy of the percentile estimates.
+static const double ORKResponseStatisticsRelativeAccuracy = 0.01;
+static const double ORKResponseStatisticsMinimumValue = 1e-4;
+static const NSUInteger ORKResponseStatisticsBucketCount = 1024;
+
+@implementation ORKResponseStatisticsAccumulator {
+    double _mean;
+    // Sum of squared differences from the mean.
+    double _m2;
+    double _minimum;
+    double _maximum;
+    NSInteger _errorCount;
+    NSInteger _lapseCount;
+    NSTimeInterval _previousEventTimestamp;
+    BOOL _hasPreviousEvent;
+    
+    double _gamma;
+    double _logGamma;
+    // Bucket i > 0 counts values in (min * gamma^(i - 1), min * gamma^i]; bucket 0 counts values up to min.
+    uint32_t _buckets[ORKResponseStatisticsBucketCount];
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _gamma = (1 + ORKResponseStatisticsRelativeAccuracy) / (1 - ORKResponseStatisticsRelativeAccuracy);
+        _logGamma = log(_gamma);
+    }
+    return self;
+}
+
+- (NSUInteger)bucketIndexForValue:(double)value {
+    if (!(value > ORKResponseStatisticsMinimumValue)) {
+        return 0;
+    }
+    double index = ceil(log(value / ORKResponseStatisticsMinimumValue) / _logGamma);
+    return (NSUInteger)MIN(index, (double)(ORKResponseStatisticsBucketCount - 1));
+}
+
+// The value with the smallest relative error to any value in the bucket.
+- (double)representativeValueForBucketIndex:(NSUInteger)index {
+    if (index == 0) {
+        return ORKResponseStatisticsMinimumValue;
+    }
+    return ORKResponseStatisticsMinimumValue * pow(_gamma, index) * 2 / (_gamma + 1);
+}
+
+- (void)addValue:(double)value {
+    if (!isfinite(value)) {
+        return;
+    }
+    _count += 1;
+    double delta = value - _mean;
+    _mean += delta / _count;
+    _m2 += delta * (value - _mean);
+    if (_count == 1) {
+        _minimum = value;
+        _maximum = value;
+    } else {
+        _minimum = MIN(_minimum, value);
+        _maximum = MAX(_maximum, value);
+    }
+    _buckets[[self bucketIndexForValue:value]] += 1;
+}
+
+- (void)addEventWithTimestamp:(NSTimeInterval)timestamp {
+    if (_hasPreviousEvent) {
+        [self addValue:timestamp - _previousEventTimestamp];
+    }
+    _previousEventTimestamp = timestamp;
+    _hasPreviousEvent = YES;
+}
+
+- (void)addError {
+    _errorCount += 1;
+}
+
+- (void)addLapse {
+    _lapseCount += 1;
+}
+
+- (double)valueAtPercentile:(double)percentile {
+    if (_count == 0) {
+        return 0;
+    }
+    double rank = MIN(MAX(percentile, 0), 100) / 100 * (_count - 1);
+    // The extremes are known exactly.
+    if (rank <= 0) {
+        return _minimum;
+    } else if (rank >= _count - 1) {
+        return _maximum;
+    }
+    NSUInteger cumulativeCount = 0;
+    for (NSUInteger index = 0; index < ORKResponseStatisticsBucketCount; index++) {
+        cumulativeCount += _buckets[index];
+        if (cumulativeCount > rank) {
+            double value = [self representativeValueForBucketIndex:index];
+            return MIN(MAX(value, _minimum), _maximum);
+        }
+    }
+    return _maximum;
+}
+
+- (ORKResponseStatistics *)statistics {
+    ORKResponseStatistics *statistics = [ORKResponseStatistics new];
+    statistics.count = _count;
+    statistics.errorCount = _errorCount;
+    statistics.lapseCount = _lapseCount;
+    if (_count > 0) {
+        double standardDeviation = _count > 1 ? sqrt(_m2 / (_count - 1)) : 0;
+        statistics.mean = _mean;
+        statistics.standardDeviation = standardDeviation;
+        statistics.coefficientOfVariation = _mean != 0 ? standardDeviation / _mean : 0;
+        statistics.minimum = _minimum;
+        statistics.maximum = _maximum;
+        statistics.median = [self valueAtPercentile:50];
+        statistics.percentile10 = [self valueAtPercentile:10];
+        statistics.percentile90 = [self valueAtPercentile:90];
+    }
+    return statistics;
+}
+
+- (void)reset {
+    _count = 0;
+    _mean = 0;
+    _m2 = 0;
+    _minimum = 0;
+    _maximum = 0;
+    _errorCount = 0;
+    _lapseCount = 0;
+    _hasPreviousEvent = NO;
+    memset(_buckets, 0, sizeof(_buckets));
+}
+
+@end
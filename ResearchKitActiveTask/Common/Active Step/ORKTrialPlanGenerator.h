@@ -0,0 +1,102 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKTrialPlanResult;
+
+/**
+ The state of a seeded SplitMix64 random number generator. The same seed always produces the same
+ numbers, on every device and every version of the framework.
+ */
+typedef struct {
+    uint64_t state;
+} ORKTrialRandom;
+
+ORK_EXTERN ORKTrialRandom ORKTrialRandomMake(uint32_t seed);
+
+/**
+ Returns a uniformly distributed integer less than `upperBound`, which must not be 0.
+ */
+ORK_EXTERN uint32_t ORKTrialRandomUniform(ORKTrialRandom *random, uint32_t upperBound);
+
+/**
+ Returns `seed`, or a random non-zero seed when `seed` is 0.
+ */
+ORK_EXTERN uint32_t ORKTrialPlanSeed(uint32_t seed);
+
+/**
+ Returns the seed of the spatial span memory game with the given index in a session, which is
+ never 0.
+ */
+ORK_EXTERN uint32_t ORKTrialPlanSpatialSpanGameSeed(uint32_t seed, NSUInteger gameIndex);
+
+/**
+ Generates a trial plan on a background queue as soon as it is created, so the schedule is ready
+ by the time the step starts. Reading `trialPlan` waits for the generation to finish.
+ */
+@interface ORKTrialPlanGenerator : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithBlock:(ORKTrialPlanResult *(^)(void))block NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) ORKTrialPlanResult *trialPlan;
+
+/**
+ Returns `numberOfTrials` Stroop trials. Each trial is congruent with a probability of one half;
+ the word and the ink color are otherwise drawn uniformly.
+ */
++ (ORKTrialPlanResult *)stroopTrialPlanWithIdentifier:(NSString *)identifier
+                                                 seed:(uint32_t)seed
+                                       numberOfTrials:(NSUInteger)numberOfTrials;
+
+/**
+ Returns `seriesLength + 1` PSAT digits from 1 to 9, none equal to the digit before it.
+ */
++ (ORKTrialPlanResult *)PSATTrialPlanWithIdentifier:(NSString *)identifier
+                                               seed:(uint32_t)seed
+                                       seriesLength:(NSUInteger)seriesLength;
+
+/**
+ Returns the seeds of the first `numberOfGames` spatial span memory games.
+ */
++ (ORKTrialPlanResult *)spatialSpanTrialPlanWithIdentifier:(NSString *)identifier
+                                                      seed:(uint32_t)seed
+                                             numberOfGames:(NSUInteger)numberOfGames;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,164 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKTrialPlanGenerator.h"
+
+#import "ORKTrialPlanResult.h"
+
+#import "ORKHelpers_Internal.h"
+
+
+static const uint32_t ORKStroopColorCount = 4;
+
+ORKTrialRandom ORKTrialRandomMake(uint32_t seed) {
+    return (ORKTrialRandom){ .state = seed };
+}
+
+static uint64_t ORKTrialRandomNext(ORKTrialRandom *random) {
+    uint64_t z = (random->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+uint32_t ORKTrialRandomUniform(ORKTrialRandom *random, uint32_t upperBound) {
+    NSCParameterAssert(upperBound > 0);
+    // Reject the values above the largest multiple of upperBound so every result is equally likely.
+    uint64_t limit = UINT64_MAX - (UINT64_MAX % upperBound);
+    uint64_t value;
+    do {
+        value = ORKTrialRandomNext(random);
+    } while (value >= limit);
+    return (uint32_t)(value % upperBound);
+}
+
+uint32_t ORKTrialPlanSeed(uint32_t seed) {
+    while (seed == 0) {
+        seed = arc4random();
+    }
+    return seed;
+}
+
+uint32_t ORKTrialPlanSpatialSpanGameSeed(uint32_t seed, NSUInteger gameIndex) {
+    ORKTrialRandom random = ORKTrialRandomMake(seed);
+    random.state ^= (uint64_t)gameIndex * 0xD1B54A32D192ED03ULL;
+    uint32_t gameSeed = (uint32_t)(ORKTrialRandomNext(&random) >> 32);
+    return gameSeed != 0 ? gameSeed : 1;
+}
+
+
+@implementation ORKTrialPlanGenerator {
+    dispatch_group_t _group;
+    ORKTrialPlanResult *_trialPlan;
+}
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithBlock:(ORKTrialPlanResult *(^)(void))block {
+    ORKThrowInvalidArgumentExceptionIfNil(block);
+    self = [super init];
+    if (self) {
+        _group = dispatch_group_create();
+        dispatch_group_async(_group, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+            self->_trialPlan = block();
+        });
+    }
+    return self;
+}
+
+- (ORKTrialPlanResult *)trialPlan {
+    dispatch_group_wait(_group, DISPATCH_TIME_FOREVER);
+    return _trialPlan;
+}
+
++ (ORKTrialPlanResult *)trialPlanWithIdentifier:(NSString *)identifier seed:(uint32_t)seed stimuli:(NSArray<NSArray<NSNumber *> *> *)stimuli {
+    ORKTrialPlanResult *trialPlan = [[ORKTrialPlanResult alloc] initWithIdentifier:identifier];
+    trialPlan.seed = seed;
+    trialPlan.stimuli = stimuli;
+    return trialPlan;
+}
+
++ (ORKTrialPlanResult *)stroopTrialPlanWithIdentifier:(NSString *)identifier
+                                                 seed:(uint32_t)seed
+                                       numberOfTrials:(NSUInteger)numberOfTrials {
+    seed = ORKTrialPlanSeed(seed);
+    ORKTrialRandom random = ORKTrialRandomMake(seed);
+    NSMutableArray<NSArray<NSNumber *> *> *stimuli = [[NSMutableArray alloc] initWithCapacity:numberOfTrials];
+    for (NSUInteger trial = 0; trial < numberOfTrials; trial++) {
+        BOOL congruent = (ORKTrialRandomUniform(&random, 2) == 0);
+        uint32_t word = ORKTrialRandomUniform(&random, ORKStroopColorCount);
+        uint32_t color = word;
+        if (!congruent) {
+            // Pick one of the other colors.
+            color = (word + 1 + ORKTrialRandomUniform(&random, ORKStroopColorCount - 1)) % ORKStroopColorCount;
+        }
+        [stimuli addObject:@[@(word), @(color)]];
+    }
+    return [self trialPlanWithIdentifier:identifier seed:seed stimuli:[stimuli copy]];
+}
+
++ (ORKTrialPlanResult *)PSATTrialPlanWithIdentifier:(NSString *)identifier
+                                               seed:(uint32_t)seed
+                                       seriesLength:(NSUInteger)seriesLength {
+    seed = ORKTrialPlanSeed(seed);
+    ORKTrialRandom random = ORKTrialRandomMake(seed);
+    NSMutableArray<NSArray<NSNumber *> *> *stimuli = [[NSMutableArray alloc] initWithCapacity:seriesLength + 1];
+    uint32_t previousDigit = 0;
+    for (NSUInteger i = 0; i < seriesLength + 1; i++) {
+        // Draw from the eight digits other than the previous one, or from all nine for the first.
+        uint32_t digit = ORKTrialRandomUniform(&random, previousDigit == 0 ? 9 : 8) + 1;
+        if (previousDigit != 0 && digit >= previousDigit) {
+            digit++;
+        }
+        [stimuli addObject:@[@(digit)]];
+        previousDigit = digit;
+    }
+    return [self trialPlanWithIdentifier:identifier seed:seed stimuli:[stimuli copy]];
+}
+
++ (ORKTrialPlanResult *)spatialSpanTrialPlanWithIdentifier:(NSString *)identifier
+                                                      seed:(uint32_t)seed
+                                             numberOfGames:(NSUInteger)numberOfGames {
+    seed = ORKTrialPlanSeed(seed);
+    NSMutableArray<NSArray<NSNumber *> *> *stimuli = [[NSMutableArray alloc] initWithCapacity:numberOfGames];
+    for (NSUInteger gameIndex = 0; gameIndex < numberOfGames; gameIndex++) {
+        [stimuli addObject:@[@(ORKTrialPlanSpatialSpanGameSeed(seed, gameIndex))]];
+    }
+    return [self trialPlanWithIdentifier:identifier seed:seed stimuli:[stimuli copy]];
+}
+
+@end
@@ -0,0 +1,70 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <ResearchKit/ORKResult.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The `ORKTrialPlanResult` class records the stimulus schedule of a cognitive task step.
+ 
+ The Stroop, PSAT and spatial span memory steps generate their whole schedule from a seed before
+ the first trial, and add a trial plan result to their step result. Running the step again with
+ the same `seed` presents the same stimuli in the same order, and the schedule can be checked for
+ balance without replaying the step.
+ 
+ Each element of `stimuli` describes one trial with one or more integers:
+ 
+ - Stroop: the index of the word and the index of the ink color, in the order red, green, blue,
+ yellow. The trial is congruent when the two are equal.
+ - PSAT: the digit presented, from 1 to 9. The first digit is the initial digit, which is not
+ answered.
+ - Spatial span memory: the seed of each game's tile sequence, as reported in
+ `ORKSpatialSpanMemoryGameRecord`, for the first `maximumTests` games. Each game takes the next
+ seed, including games that are interrupted and started again.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKTrialPlanResult : ORKResult
+
+/**
+ The seed the schedule was generated from. It is never 0.
+ */
+@property (nonatomic, assign) uint32_t seed;
+
+/**
+ The stimuli of each trial, in presentation order.
+ */
+@property (nonatomic, copy, nullable) NSArray<NSArray<NSNumber *> *> *stimuli;
+
+@end
+
+NS_ASSUME_NONNULL_END
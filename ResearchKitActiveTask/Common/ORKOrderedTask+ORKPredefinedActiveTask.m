@@ -123,6 +123,34 @@ void ORKStepArrayAddStep(NSMutableArray *array, ORKStep *step) {
     [array addObject:step];
 }
 
+// Device motion recorder used by the walking steps, with on-device gait analysis.
+static ORKDeviceMotionRecorderConfiguration *ORKMakeGaitDeviceMotionRecorderConfiguration(NSURL *outputDirectory) {
+    ORKDeviceMotionRecorderConfiguration *configuration = [[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:ORKDeviceMotionRecorderIdentifier
+                                                                                                                  frequency:100
+                                                                                                            outputDirectory:outputDirectory];
+    configuration.analyzesGait = YES;
+    return configuration;
+}
+
+// Turns on gait analysis for the device motion recorders among the configurations of a walking step.
+static NSArray<ORKRecorderConfiguration *> *ORKEnableGaitAnalysis(NSArray<ORKRecorderConfiguration *> *recorderConfigurations) {
+    for (ORKRecorderConfiguration *configuration in recorderConfigurations) {
+        if ([configuration isKindOfClass:[ORKDeviceMotionRecorderConfiguration class]]) {
+            ((ORKDeviceMotionRecorderConfiguration *)configuration).analyzesGait = YES;
+        }
+    }
+    return recorderConfigurations;
+}
+
+// Device motion recorder used by the tremor test, with on-device tremor spectrum analysis.
+static ORKDeviceMotionRecorderConfiguration *ORKMakeTremorDeviceMotionRecorderConfiguration(NSString *identifier, NSURL *outputDirectory) {
+    ORKDeviceMotionRecorderConfiguration *configuration = [[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:identifier
+                                                                                                                  frequency:100.0
+                                                                                                            outputDirectory:outputDirectory];
+    configuration.analyzesTremor = YES;
+    return configuration;
+}
+
 @implementation ORKOrderedTask (ORKMakeTaskUtilities)
 
 + (NSArray<ORKRecorderConfiguration*>*)makeRecorderConfigurationsWithOptions:(ORKPredefinedTaskOption)options
@@ -822,8 +850,8 @@ NSString *const ORKFitnessRestStepIdentifier = @"fitness.rest";
             fitnessStep.title = ORKLocalizedString(@"FITNESS_TASK_TITLE", nil);
             fitnessStep.text = [NSString localizedStringWithFormat:ORKLocalizedString(@"FITNESS_WALK_INSTRUCTION_FORMAT", nil), [formatter stringFromTimeInterval:walkDuration]];
             fitnessStep.spokenInstruction = fitnessStep.text;
-            fitnessStep.recorderConfigurations = [self makeRecorderConfigurationsWithOptions:options
-                                                                             outputDirectory:outputDirectory];
+            fitnessStep.recorderConfigurations = ORKEnableGaitAnalysis([self makeRecorderConfigurationsWithOptions:options
+                                                                                                   outputDirectory:outputDirectory]);
             fitnessStep.shouldContinueOnFinish = YES;
             fitnessStep.optional = NO;
             fitnessStep.shouldStartTimerAutomatically = YES;
@@ -974,8 +1002,8 @@ NSString *const ORKSixMinuteWalkFatigueIdentifier = @"6mwt.fatigue";
     fitnessStep.title = ORKLocalizedString(@"6MWT_TEST_IN_PROGRESS", nil);
     fitnessStep.text = ORKLocalizedString(@"6MWT_TEST_IN_PROGRESS_DETAIL", nil);
     fitnessStep.spokenInstruction = fitnessStep.text;
-    fitnessStep.recorderConfigurations = [self makeRecorderConfigurationsWithOptions:options
-                                                                     outputDirectory:outputDirectory];
+    fitnessStep.recorderConfigurations = ORKEnableGaitAnalysis([self makeRecorderConfigurationsWithOptions:options
+                                                                                           outputDirectory:outputDirectory]);
     fitnessStep.shouldContinueOnFinish = YES;
     fitnessStep.optional = NO;
     fitnessStep.shouldStartTimerAutomatically = YES;
@@ -1264,9 +1292,7 @@ NSString *const ORKShortWalkRestStepIdentifier = @"walking.rest";
                                                                                                     outputDirectory:outputDirectory]];
             }
             if (!(ORKPredefinedTaskOptionExcludeDeviceMotion & options)) {
-                [recorderConfigurations addObject:[[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:ORKDeviceMotionRecorderIdentifier
-                                                                                                         frequency:100
-                                                                                                   outputDirectory:outputDirectory]];
+                [recorderConfigurations addObject:ORKMakeGaitDeviceMotionRecorderConfiguration(outputDirectory)];
             }
 
             ORKWalkingTaskStep *walkingStep = [[ORKWalkingTaskStep alloc] initWithIdentifier:ORKShortWalkOutboundStepIdentifier];
@@ -1297,9 +1323,7 @@ NSString *const ORKShortWalkRestStepIdentifier = @"walking.rest";
                                                                                                     outputDirectory:outputDirectory]];
             }
             if (!(ORKPredefinedTaskOptionExcludeDeviceMotion & options)) {
-                [recorderConfigurations addObject:[[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:ORKDeviceMotionRecorderIdentifier
-                                                                                                         frequency:100
-                                                                                                   outputDirectory:outputDirectory]];
+                [recorderConfigurations addObject:ORKMakeGaitDeviceMotionRecorderConfiguration(outputDirectory)];
             }
 
             ORKWalkingTaskStep *walkingStep = [[ORKWalkingTaskStep alloc] initWithIdentifier:ORKShortWalkReturnStepIdentifier];
@@ -1433,9 +1457,7 @@ NSString *const ORKShortWalkRestStepIdentifier = @"walking.rest";
                                                                                                     outputDirectory:outputDirectory]];
             }
             if (!(ORKPredefinedTaskOptionExcludeDeviceMotion & options)) {
-                [recorderConfigurations addObject:[[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:ORKDeviceMotionRecorderIdentifier
-                                                                                                         frequency:100
-                                                                                                   outputDirectory:outputDirectory]];
+                [recorderConfigurations addObject:ORKMakeGaitDeviceMotionRecorderConfiguration(outputDirectory)];
             }
             
             ORKWalkingTaskStep *walkingStep = [[ORKWalkingTaskStep alloc] initWithIdentifier:ORKShortWalkOutboundStepIdentifier];
@@ -2716,9 +2738,7 @@ NSString *const ORKTimedWalkTrial2StepIdentifier = @"timed.walk.trial2";
                                                                                                 outputDirectory:outputDirectory]];
         }
         if (!(options & ORKPredefinedTaskOptionExcludeDeviceMotion)) {
-            [recorderConfigurations addObject:[[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:ORKDeviceMotionRecorderIdentifier
-                                                                                                     frequency:100
-                                                                                               outputDirectory:outputDirectory]];
+            [recorderConfigurations addObject:ORKMakeGaitDeviceMotionRecorderConfiguration(outputDirectory)];
         }
         
 #if ORK_FEATURE_CLLOCATIONMANAGER_AUTHORIZATION
@@ -2984,9 +3004,7 @@ NSString *const ORKTremorTestTurnWristStepIdentifier = @"tremor.handQueenWave";
             step.recorderConfigurations = @[[[ORKAccelerometerRecorderConfiguration alloc] initWithIdentifier:@"ac1_acc"
                                                                                                     frequency:100.0
                                                                                               outputDirectory:outputDirectory],
-                                            [[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:@"ac1_motion"
-                                                                                                   frequency:100.0
-                                                                                             outputDirectory:outputDirectory]];
+                                            ORKMakeTremorDeviceMotionRecorderConfiguration(@"ac1_motion", outputDirectory)];
             step.title = ORKLocalizedString(@"TREMOR_TEST_TITLE", nil);
             step.text = [NSString localizedStringWithFormat:titleFormat, (long)activeStepDuration];
             step.spokenInstruction = step.text;
@@ -3041,9 +3059,7 @@ NSString *const ORKTremorTestTurnWristStepIdentifier = @"tremor.handQueenWave";
             step.recorderConfigurations = @[[[ORKAccelerometerRecorderConfiguration alloc] initWithIdentifier:@"ac2_acc"
                                                                                                     frequency:100.0
                                                                                               outputDirectory:outputDirectory],
-                                            [[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:@"ac2_motion"
-                                                                                                   frequency:100.0
-                                                                                             outputDirectory:outputDirectory]];
+                                            ORKMakeTremorDeviceMotionRecorderConfiguration(@"ac2_motion", outputDirectory)];
             step.title = ORKLocalizedString(@"TREMOR_TEST_TITLE", nil);
             step.text = [NSString localizedStringWithFormat:titleFormat, (long)activeStepDuration];
             step.spokenInstruction = step.text;
@@ -3103,9 +3119,7 @@ NSString *const ORKTremorTestTurnWristStepIdentifier = @"tremor.handQueenWave";
             step.recorderConfigurations = @[[[ORKAccelerometerRecorderConfiguration alloc] initWithIdentifier:@"ac3_acc"
                                                                                                     frequency:100.0
                                                                                               outputDirectory:outputDirectory],
-                                            [[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:@"ac3_motion"
-                                                                                                   frequency:100.0
-                                                                                             outputDirectory:outputDirectory]];
+                                            ORKMakeTremorDeviceMotionRecorderConfiguration(@"ac3_motion", outputDirectory)];
             step.title = ORKLocalizedString(@"TREMOR_TEST_TITLE", nil);
             step.text = [NSString localizedStringWithFormat:titleFormat, (long)activeStepDuration];
             step.spokenInstruction = step.text;
@@ -3159,9 +3173,7 @@ NSString *const ORKTremorTestTurnWristStepIdentifier = @"tremor.handQueenWave";
             step.recorderConfigurations = @[[[ORKAccelerometerRecorderConfiguration alloc] initWithIdentifier:@"ac4_acc"
                                                                                                     frequency:100.0
                                                                                               outputDirectory:outputDirectory],
-                                            [[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:@"ac4_motion"
-                                                                                                   frequency:100.0
-                                                                                             outputDirectory:outputDirectory]];
+                                            ORKMakeTremorDeviceMotionRecorderConfiguration(@"ac4_motion", outputDirectory)];
             step.title = ORKLocalizedString(@"TREMOR_TEST_TITLE", nil);
             step.text = [NSString localizedStringWithFormat:titleFormat, (long)activeStepDuration];
             step.spokenInstruction = step.text;
@@ -3213,9 +3225,7 @@ NSString *const ORKTremorTestTurnWristStepIdentifier = @"tremor.handQueenWave";
             step.recorderConfigurations = @[[[ORKAccelerometerRecorderConfiguration alloc] initWithIdentifier:@"ac5_acc"
                                                                                                     frequency:100.0
                                                                                               outputDirectory:outputDirectory],
-                                            [[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:@"ac5_motion"
-                                                                                                   frequency:100.0
-                                                                                             outputDirectory:outputDirectory]];
+                                            ORKMakeTremorDeviceMotionRecorderConfiguration(@"ac5_motion", outputDirectory)];
             step.title = ORKLocalizedString(@"TREMOR_TEST_TITLE", nil);
             step.text = [NSString localizedStringWithFormat:titleFormat, (long)activeStepDuration];
             step.spokenInstruction = step.text;
@@ -49,6 +49,13 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, readonly) double frequency;
 
+/**
+ A Boolean value indicating whether the tremor spectrum of the acceleration is computed while
+ recording. When `YES`, an `ORKTremorSpectrumResult` object is reported with the file results. The
+ default value is `NO`.
+ */
+@property (nonatomic, assign) BOOL analyzesTremor;
+
 /**
  Returns an initialized accelerometer recorder using the specified frequency.
  
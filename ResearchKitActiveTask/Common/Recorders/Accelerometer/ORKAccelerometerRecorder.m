@@ -32,6 +32,8 @@
 #import "ORKAccelerometerRecorder.h"
 
 #import "ORKDataLogger.h"
+#import "ORKTremorSpectrumAnalyzer.h"
+#import "ORKTremorSpectrumResult.h"
 
 #import "ORKRecorder_Internal.h"
 
@@ -44,6 +46,7 @@
 @interface ORKAccelerometerRecorder () {
     ORKDataLogger *_logger;
     NSError *_recordingError;
+    ORKTremorSpectrumAnalyzer *_tremorAnalyzer;
 }
 
 @property (nonatomic, strong) CMMotionManager *motionManager;
@@ -114,6 +117,10 @@
         return;
     }
     
+    if (_analyzesTremor) {
+        _tremorAnalyzer = [[ORKTremorSpectrumAnalyzer alloc] initWithSampleRate:_frequency];
+    }
+    
     self.motionManager.accelerometerUpdateInterval = 1.0 / _frequency;
     
     self.uptime = [NSProcessInfo processInfo].systemUptime;
@@ -124,6 +131,11 @@
          BOOL success = NO;
          if (data) {
              success = [self->_logger append:[data ork_JSONDictionary] error:&error];
+             ORKTremorSpectrumAnalyzer *tremorAnalyzer = self->_tremorAnalyzer;
+             if (tremorAnalyzer) {
+                 CMAcceleration acceleration = data.acceleration;
+                 [tremorAnalyzer addSampleWithTimestamp:data.timestamp x:acceleration.x y:acceleration.y z:acceleration.z];
+             }
          }
          if (!success) {
              dispatch_async(dispatch_get_main_queue(), ^{
@@ -150,6 +162,13 @@
     }
                      error:&error];
     
+    if (_tremorAnalyzer) {
+        ORKTremorSpectrumResult *tremorResult = [_tremorAnalyzer resultWithIdentifier:self.identifier];
+        tremorResult.startDate = self.startDate;
+        tremorResult.userInfo = self.userInfo;
+        [self reportSummaryResults:@[tremorResult]];
+    }
+    
     [self reportFileResultsWithFiles:fileUrls error:error];
     
     [super stop];
@@ -171,6 +190,7 @@
     [super reset];
     
     _logger = nil;
+    _tremorAnalyzer = nil;
 }
 
 - (BOOL)isRecording {
@@ -217,17 +237,20 @@
 #pragma clang diagnostic pop
 
 - (ORKRecorder *)recorderForStep:(ORKStep *)step {
-    return [[ORKAccelerometerRecorder alloc] initWithIdentifier:self.identifier
-                                                      frequency:self.frequency
-                                                           step:step
-                                                outputDirectory:self.outputDirectory
-                                       rollingFileSizeThreshold:self.rollingFileSizeThreshold];
+    ORKAccelerometerRecorder *recorder = [[ORKAccelerometerRecorder alloc] initWithIdentifier:self.identifier
+                                                                                     frequency:self.frequency
+                                                                                          step:step
+                                                                               outputDirectory:self.outputDirectory
+                                                                      rollingFileSizeThreshold:self.rollingFileSizeThreshold];
+    recorder.analyzesTremor = self.analyzesTremor;
+    return recorder;
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
     self = [super initWithCoder:aDecoder];
     if (self) {
         ORK_DECODE_DOUBLE(aDecoder, frequency);
+        ORK_DECODE_BOOL(aDecoder, analyzesTremor);
     }
     return self;
 }
@@ -235,6 +258,7 @@
 - (void)encodeWithCoder:(NSCoder *)aCoder {
     [super encodeWithCoder:aCoder];
     ORK_ENCODE_DOUBLE(aCoder, frequency);
+    ORK_ENCODE_BOOL(aCoder, analyzesTremor);
 }
 
 + (BOOL)supportsSecureCoding {
@@ -246,7 +270,8 @@
     
     __typeof(self) castObject = object;
     return (isParentSame &&
-            (self.frequency == castObject.frequency));
+            (self.frequency == castObject.frequency) &&
+            (self.analyzesTremor == castObject.analyzesTremor));
 }
 
 - (ORKPermissionMask)requestedPermissionMask {
@@ -0,0 +1,86 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKTremorSpectrumResult;
+
+/**
+ Returns the number of samples in each analysis window for the given sample rate: the smallest
+ power of two that spans at least two seconds, between 64 and 4096 samples.
+ */
+ORK_EXTERN NSUInteger ORKTremorSpectrumWindowLengthForSampleRate(double sampleRate);
+
+/**
+ Computes the acceleration power spectrum of a recording incrementally, with Welch's method.
+ 
+ Samples are kept in a circular buffer one window long. Every half window, the latest window is
+ detrended, multiplied by a Hann window and transformed with a real FFT, and its one-sided power
+ spectral density is summarized per axis and added to the running average. All buffers and the
+ FFT setup are allocated once, when the analyzer is created, so memory use does not depend on the
+ recording length beyond the per-window summaries.
+ 
+ Samples may be added from any thread.
+ */
+@interface ORKTremorSpectrumAnalyzer : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns an analyzer for samples delivered at the given rate.
+ 
+ @param sampleRate  The sample rate in hertz (Hz).
+ */
+- (instancetype)initWithSampleRate:(double)sampleRate NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) double sampleRate;
+
+@property (nonatomic, readonly) NSUInteger windowLength;
+
+/**
+ Adds one acceleration sample, in g, and analyzes a window when one is complete.
+ */
+- (void)addSampleWithTimestamp:(NSTimeInterval)timestamp x:(double)x y:(double)y z:(double)z;
+
+/**
+ Returns the spectrum of the windows analyzed so far.
+ 
+ @param identifier  The identifier of the returned result.
+ */
+- (ORKTremorSpectrumResult *)resultWithIdentifier:(NSString *)identifier;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,267 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKTremorSpectrumAnalyzer.h"
+
+#import "ORKTremorSpectrumResult.h"
+
+@import Accelerate;
+#include <os/lock.h>
+
+
+static const NSUInteger ORKTremorMinimumWindowLength = 64;
+static const NSUInteger ORKTremorMaximumWindowLength = 4096;
+static const NSTimeInterval ORKTremorMinimumWindowDuration = 2.0;
+
+// The dominant frequency is searched between these frequencies, to ignore drift and impacts.
+static const double ORKTremorMinimumDominantFrequency = 1.0;
+static const double ORKTremorMaximumDominantFrequency = 20.0;
+
+static const NSUInteger ORKTremorAxisCount = 3;
+
+NSUInteger ORKTremorSpectrumWindowLengthForSampleRate(double sampleRate) {
+    NSUInteger length = ORKTremorMinimumWindowLength;
+    while (length < ORKTremorMaximumWindowLength && length < sampleRate * ORKTremorMinimumWindowDuration) {
+        length *= 2;
+    }
+    return length;
+}
+
+// Sum of the power spectral density over [lowerFrequency, upperFrequency), times the bin width.
+static double ORKTremorBandPower(const double *spectrum, NSUInteger binCount, double binWidth, double lowerFrequency, double upperFrequency) {
+    NSUInteger first = MIN((NSUInteger)ceil(lowerFrequency / binWidth), binCount);
+    NSUInteger end = MIN((NSUInteger)ceil(upperFrequency / binWidth), binCount);
+    if (end <= first) {
+        return 0;
+    }
+    double sum = 0;
+    vDSP_sveD(spectrum + first, 1, &sum, end - first);
+    return sum * binWidth;
+}
+
+static ORKTremorAxisSpectrum *ORKTremorAxisSpectrumMake(const double *spectrum, NSUInteger binCount, double binWidth) {
+    ORKTremorAxisSpectrum *axisSpectrum = [ORKTremorAxisSpectrum new];
+    
+    NSUInteger first = MAX((NSUInteger)ceil(ORKTremorMinimumDominantFrequency / binWidth), 1);
+    NSUInteger last = MIN((NSUInteger)floor(ORKTremorMaximumDominantFrequency / binWidth), binCount - 1);
+    if (first <= last) {
+        double peak = 0;
+        vDSP_Length peakOffset = 0;
+        vDSP_maxviD(spectrum + first, 1, &peak, &peakOffset, last - first + 1);
+        if (peak > 0) {
+            NSUInteger bin = first + peakOffset;
+            double offset = 0;
+            if (bin > 0 && bin + 1 < binCount) {
+                // Parabolic interpolation between the neighbouring bins.
+                double previous = spectrum[bin - 1];
+                double next = spectrum[bin + 1];
+                double curvature = previous - 2 * peak + next;
+                if (curvature != 0) {
+                    offset = 0.5 * (previous - next) / curvature;
+                }
+            }
+            axisSpectrum.dominantFrequency = (bin + offset) * binWidth;
+        }
+    }
+    
+    axisSpectrum.bandPower4To6Hz = ORKTremorBandPower(spectrum, binCount, binWidth, 4.0, 6.0);
+    axisSpectrum.bandPower6To12Hz = ORKTremorBandPower(spectrum, binCount, binWidth, 6.0, 12.0);
+    double totalPower = 0;
+    vDSP_sveD(spectrum + 1, 1, &totalPower, binCount - 1);
+    axisSpectrum.totalPower = totalPower * binWidth;
+    return axisSpectrum;
+}
+
+
+@implementation ORKTremorSpectrumAnalyzer {
+    os_unfair_lock _lock;
+    
+    vDSP_Length _log2Length;
+    FFTSetupD _fftSetup;
+    NSUInteger _binCount;
+    double _binWidth;
+    double _densityScale;
+    
+    // All buffers live in one allocation.
+    double *_storage;
+    double *_window;
+    double *_samples[ORKTremorAxisCount];
+    double *_timestamps;
+    double *_frame;
+    DSPDoubleSplitComplex _transform;
+    double *_spectrum;
+    double *_spectrumSums[ORKTremorAxisCount];
+    
+    NSUInteger _writeIndex;
+    NSUInteger _sampleCount;
+    NSUInteger _samplesSinceWindow;
+    NSTimeInterval _firstTimestamp;
+    NSUInteger _windowCount;
+    NSMutableArray<ORKTremorSpectrumWindow *> *_windows;
+}
+
+- (instancetype)initWithSampleRate:(double)sampleRate {
+    self = [super init];
+    if (self) {
+        _sampleRate = sampleRate > 0 ? sampleRate : 1;
+        _windowLength = ORKTremorSpectrumWindowLengthForSampleRate(_sampleRate);
+        _log2Length = (vDSP_Length)log2((double)_windowLength);
+        _fftSetup = vDSP_create_fftsetupD(_log2Length, kFFTRadix2);
+        _binCount = _windowLength / 2 + 1;
+        _binWidth = _sampleRate / _windowLength;
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _windows = [NSMutableArray new];
+        
+        NSUInteger length = _windowLength;
+        NSUInteger storageLength = length * (4 + ORKTremorAxisCount) + _binCount * (1 + ORKTremorAxisCount);
+        _storage = calloc(storageLength, sizeof(double));
+        double *next = _storage;
+        _window = next; next += length;
+        _timestamps = next; next += length;
+        for (NSUInteger axis = 0; axis < ORKTremorAxisCount; axis++) {
+            _samples[axis] = next; next += length;
+        }
+        _frame = next; next += length;
+        // The FFT works in place on the two halves of one buffer.
+        _transform.realp = next; _transform.imagp = next + length / 2; next += length;
+        _spectrum = next; next += _binCount;
+        for (NSUInteger axis = 0; axis < ORKTremorAxisCount; axis++) {
+            _spectrumSums[axis] = next; next += _binCount;
+        }
+        
+        // Periodic Hann window.
+        vDSP_hann_windowD(_window, length, vDSP_HANN_DENORM);
+        double windowPower = 0;
+        vDSP_svesqD(_window, 1, &windowPower, length);
+        // vDSP's real FFT returns twice the DFT; the one-sided density doubles all but the end bins.
+        _densityScale = 2.0 / (4.0 * _sampleRate * windowPower);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_fftSetup) {
+        vDSP_destroy_fftsetupD(_fftSetup);
+    }
+    free(_storage);
+}
+
+- (void)addSampleWithTimestamp:(NSTimeInterval)timestamp x:(double)x y:(double)y z:(double)z {
+    os_unfair_lock_lock(&_lock);
+    if (_sampleCount == 0) {
+        _firstTimestamp = timestamp;
+    }
+    _timestamps[_writeIndex] = timestamp;
+    _samples[0][_writeIndex] = x;
+    _samples[1][_writeIndex] = y;
+    _samples[2][_writeIndex] = z;
+    _writeIndex = (_writeIndex + 1) % _windowLength;
+    _sampleCount += 1;
+    _samplesSinceWindow += 1;
+    if (_sampleCount >= _windowLength && _samplesSinceWindow >= _windowLength / 2) {
+        _samplesSinceWindow = 0;
+        [self analyzeLatestWindow];
+    }
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (void)analyzeLatestWindow {
+    // After a full buffer has been written, the write index points at the oldest sample.
+    NSUInteger oldest = _writeIndex;
+    NSUInteger length = _windowLength;
+    NSUInteger tailLength = length - oldest;
+    
+    ORKTremorSpectrumWindow *window = [ORKTremorSpectrumWindow new];
+    window.startTime = _timestamps[oldest] - _firstTimestamp;
+    
+    ORKTremorAxisSpectrum *axisSpectra[ORKTremorAxisCount];
+    for (NSUInteger axis = 0; axis < ORKTremorAxisCount; axis++) {
+        memcpy(_frame, _samples[axis] + oldest, tailLength * sizeof(double));
+        memcpy(_frame + tailLength, _samples[axis], oldest * sizeof(double));
+        [self computeSpectrumOfFrame];
+        vDSP_vaddD(_spectrumSums[axis], 1, _spectrum, 1, _spectrumSums[axis], 1, _binCount);
+        axisSpectra[axis] = ORKTremorAxisSpectrumMake(_spectrum, _binCount, _binWidth);
+    }
+    window.x = axisSpectra[0];
+    window.y = axisSpectra[1];
+    window.z = axisSpectra[2];
+    [_windows addObject:window];
+    _windowCount += 1;
+}
+
+// Replaces _spectrum with the one-sided power spectral density of _frame, in g² per hertz.
+- (void)computeSpectrumOfFrame {
+    NSUInteger length = _windowLength;
+    NSUInteger halfLength = length / 2;
+    
+    double mean = 0;
+    vDSP_meanvD(_frame, 1, &mean, length);
+    mean = -mean;
+    vDSP_vsaddD(_frame, 1, &mean, _frame, 1, length);
+    vDSP_vmulD(_frame, 1, _window, 1, _frame, 1, length);
+    
+    vDSP_ctozD((const DSPDoubleComplex *)_frame, 2, &_transform, 1, halfLength);
+    vDSP_fft_zripD(_fftSetup, &_transform, 1, _log2Length, kFFTDirection_Forward);
+    
+    // The Nyquist term is packed into the imaginary part of the DC term.
+    double nyquist = _transform.imagp[0];
+    _transform.imagp[0] = 0;
+    vDSP_zvmagsD(&_transform, 1, _spectrum, 1, halfLength);
+    _spectrum[halfLength] = nyquist * nyquist;
+    vDSP_vsmulD(_spectrum, 1, &_densityScale, _spectrum, 1, _binCount);
+    _spectrum[0] *= 0.5;
+    _spectrum[halfLength] *= 0.5;
+}
+
+- (ORKTremorSpectrumResult *)resultWithIdentifier:(NSString *)identifier {
+    ORKTremorSpectrumResult *result = [[ORKTremorSpectrumResult alloc] initWithIdentifier:identifier];
+    result.sampleRate = _sampleRate;
+    result.windowLength = _windowLength;
+    
+    os_unfair_lock_lock(&_lock);
+    result.windows = [_windows copy];
+    if (_windowCount > 0) {
+        double scale = 1.0 / _windowCount;
+        ORKTremorAxisSpectrum *axisSpectra[ORKTremorAxisCount];
+        for (NSUInteger axis = 0; axis < ORKTremorAxisCount; axis++) {
+            vDSP_vsmulD(_spectrumSums[axis], 1, &scale, _spectrum, 1, _binCount);
+            axisSpectra[axis] = ORKTremorAxisSpectrumMake(_spectrum, _binCount, _binWidth);
+        }
+        result.x = axisSpectra[0];
+        result.y = axisSpectra[1];
+        result.z = axisSpectra[2];
+    }
+    os_unfair_lock_unlock(&_lock);
+    
+    return result;
+}
+
+@end
@@ -0,0 +1,147 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKResult.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKTremorSpectrumWindow;
+@class ORKTremorAxisSpectrum;
+
+/**
+ The `ORKTremorSpectrumResult` class records the acceleration power spectrum of a recording,
+ summarized in the frequency bands of physiological and pathological tremor.
+ 
+ An accelerometer or device motion recorder whose `analyzesTremor` property is `YES` adds this
+ result next to its file results, using the same identifier. The recording is cut into
+ half-overlapping Hann windows; each window is summarized in `windows`, and the spectra of all
+ windows are averaged (Welch's method) into the `x`, `y`, and `z` summaries.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKTremorSpectrumResult : ORKResult
+
+/**
+ The sample rate of the analyzed recording, in hertz (Hz).
+ */
+@property (nonatomic, assign) double sampleRate;
+
+/**
+ The number of samples in each analysis window.
+ */
+@property (nonatomic, assign) NSInteger windowLength;
+
+/**
+ The spectrum of the x axis, averaged over all windows.
+ */
+@property (nonatomic, strong, nullable) ORKTremorAxisSpectrum *x;
+
+/**
+ The spectrum of the y axis, averaged over all windows.
+ */
+@property (nonatomic, strong, nullable) ORKTremorAxisSpectrum *y;
+
+/**
+ The spectrum of the z axis, averaged over all windows.
+ */
+@property (nonatomic, strong, nullable) ORKTremorAxisSpectrum *z;
+
+/**
+ The spectrum of each analysis window, in chronological order.
+ */
+@property (nonatomic, copy, nullable) NSArray<ORKTremorSpectrumWindow *> *windows;
+
+@end
+
+
+/**
+ The `ORKTremorSpectrumWindow` class summarizes the spectrum of one analysis window of an
+ `ORKTremorSpectrumResult` object.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKTremorSpectrumWindow : NSObject <NSCopying, NSSecureCoding>
+
+/**
+ The time of the first sample of the window, relative to the first sample of the recording.
+ */
+@property (nonatomic, assign) NSTimeInterval startTime;
+
+/**
+ The spectrum of the x axis in this window.
+ */
+@property (nonatomic, strong, nullable) ORKTremorAxisSpectrum *x;
+
+/**
+ The spectrum of the y axis in this window.
+ */
+@property (nonatomic, strong, nullable) ORKTremorAxisSpectrum *y;
+
+/**
+ The spectrum of the z axis in this window.
+ */
+@property (nonatomic, strong, nullable) ORKTremorAxisSpectrum *z;
+
+@end
+
+
+/**
+ The `ORKTremorAxisSpectrum` class summarizes the power spectrum of the acceleration along one axis.
+ 
+ Powers are in g², and are the integral of the one-sided power spectral density over the band, so
+ that the total power is the variance of the acceleration.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKTremorAxisSpectrum : NSObject <NSCopying, NSSecureCoding>
+
+/**
+ The frequency of the highest spectral peak between 1 Hz and 20 Hz, in hertz (Hz).
+ */
+@property (nonatomic, assign) double dominantFrequency;
+
+/**
+ The power between 4 Hz and 6 Hz, the band of parkinsonian rest tremor.
+ */
+@property (nonatomic, assign) double bandPower4To6Hz;
+
+/**
+ The power between 6 Hz and 12 Hz, the band of essential and physiological tremor.
+ */
+@property (nonatomic, assign) double bandPower6To12Hz;
+
+/**
+ The power at all frequencies above 0 Hz.
+ */
+@property (nonatomic, assign) double totalPower;
+
+@end
+
+NS_ASSUME_NONNULL_END
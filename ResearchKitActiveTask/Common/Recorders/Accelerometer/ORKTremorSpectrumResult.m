@@ -0,0 +1,211 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKTremorSpectrumResult.h"
+
+#import "ORKResult_Private.h"
+#import "ORKHelpers_Internal.h"
+
+
+@implementation ORKTremorAxisSpectrum
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    ORK_ENCODE_DOUBLE(aCoder, dominantFrequency);
+    ORK_ENCODE_DOUBLE(aCoder, bandPower4To6Hz);
+    ORK_ENCODE_DOUBLE(aCoder, bandPower6To12Hz);
+    ORK_ENCODE_DOUBLE(aCoder, totalPower);
+}
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+    self = [super init];
+    if (self) {
+        ORK_DECODE_DOUBLE(aDecoder, dominantFrequency);
+        ORK_DECODE_DOUBLE(aDecoder, bandPower4To6Hz);
+        ORK_DECODE_DOUBLE(aDecoder, bandPower6To12Hz);
+        ORK_DECODE_DOUBLE(aDecoder, totalPower);
+    }
+    return self;
+}
+
+- (BOOL)isEqual:(id)object {
+    if ([self class] != [object class]) {
+        return NO;
+    }
+    
+    __typeof(self) castObject = object;
+    return ((self.dominantFrequency == castObject.dominantFrequency) &&
+            (self.bandPower4To6Hz == castObject.bandPower4To6Hz) &&
+            (self.bandPower6To12Hz == castObject.bandPower6To12Hz) &&
+            (self.totalPower == castObject.totalPower));
+}
+
+- (NSUInteger)hash {
+    return @(self.dominantFrequency).hash ^ @(self.totalPower).hash;
+}
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+    ORKTremorAxisSpectrum *spectrum = [[[self class] allocWithZone:zone] init];
+    spectrum.dominantFrequency = self.dominantFrequency;
+    spectrum.bandPower4To6Hz = self.bandPower4To6Hz;
+    spectrum.bandPower6To12Hz = self.bandPower6To12Hz;
+    spectrum.totalPower = self.totalPower;
+    return spectrum;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; dominant frequency: %@; 4-6 Hz: %@; 6-12 Hz: %@; total: %@>", self.class.description, self, @(self.dominantFrequency), @(self.bandPower4To6Hz), @(self.bandPower6To12Hz), @(self.totalPower)];
+}
+
+@end
+
+
+@implementation ORKTremorSpectrumWindow
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    ORK_ENCODE_DOUBLE(aCoder, startTime);
+    ORK_ENCODE_OBJ(aCoder, x);
+    ORK_ENCODE_OBJ(aCoder, y);
+    ORK_ENCODE_OBJ(aCoder, z);
+}
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+    self = [super init];
+    if (self) {
+        ORK_DECODE_DOUBLE(aDecoder, startTime);
+        ORK_DECODE_OBJ_CLASS(aDecoder, x, ORKTremorAxisSpectrum);
+        ORK_DECODE_OBJ_CLASS(aDecoder, y, ORKTremorAxisSpectrum);
+        ORK_DECODE_OBJ_CLASS(aDecoder, z, ORKTremorAxisSpectrum);
+    }
+    return self;
+}
+
+- (BOOL)isEqual:(id)object {
+    if ([self class] != [object class]) {
+        return NO;
+    }
+    
+    __typeof(self) castObject = object;
+    return ((self.startTime == castObject.startTime) &&
+            ORKEqualObjects(self.x, castObject.x) &&
+            ORKEqualObjects(self.y, castObject.y) &&
+            ORKEqualObjects(self.z, castObject.z));
+}
+
+- (NSUInteger)hash {
+    return @(self.startTime).hash ^ self.x.hash ^ self.y.hash ^ self.z.hash;
+}
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+    ORKTremorSpectrumWindow *window = [[[self class] allocWithZone:zone] init];
+    window.startTime = self.startTime;
+    window.x = [self.x copy];
+    window.y = [self.y copy];
+    window.z = [self.z copy];
+    return window;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; start: %@; x: %@; y: %@; z: %@>", self.class.description, self, @(self.startTime), self.x, self.y, self.z];
+}
+
+@end
+
+
+@implementation ORKTremorSpectrumResult
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    [super encodeWithCoder:aCoder];
+    ORK_ENCODE_DOUBLE(aCoder, sampleRate);
+    ORK_ENCODE_INTEGER(aCoder, windowLength);
+    ORK_ENCODE_OBJ(aCoder, x);
+    ORK_ENCODE_OBJ(aCoder, y);
+    ORK_ENCODE_OBJ(aCoder, z);
+    ORK_ENCODE_OBJ(aCoder, windows);
+}
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+    self = [super initWithCoder:aDecoder];
+    if (self) {
+        ORK_DECODE_DOUBLE(aDecoder, sampleRate);
+        ORK_DECODE_INTEGER(aDecoder, windowLength);
+        ORK_DECODE_OBJ_CLASS(aDecoder, x, ORKTremorAxisSpectrum);
+        ORK_DECODE_OBJ_CLASS(aDecoder, y, ORKTremorAxisSpectrum);
+        ORK_DECODE_OBJ_CLASS(aDecoder, z, ORKTremorAxisSpectrum);
+        _windows = (NSArray *)[aDecoder decodeObjectOfClasses:[NSSet setWithObjects:[NSArray class], [ORKTremorSpectrumWindow class], [ORKTremorAxisSpectrum class], nil] forKey:@ORK_STRINGIFY(windows)];
+    }
+    return self;
+}
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (BOOL)isEqual:(id)object {
+    BOOL isParentSame = [super isEqual:object];
+    
+    __typeof(self) castObject = object;
+    return (isParentSame &&
+            (self.sampleRate == castObject.sampleRate) &&
+            (self.windowLength == castObject.windowLength) &&
+            ORKEqualObjects(self.x, castObject.x) &&
+            ORKEqualObjects(self.y, castObject.y) &&
+            ORKEqualObjects(self.z, castObject.z) &&
+            ORKEqualObjects(self.windows, castObject.windows));
+}
+
+- (NSUInteger)hash {
+    return super.hash ^ self.windows.hash;
+}
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+    ORKTremorSpectrumResult *result = [super copyWithZone:zone];
+    result.sampleRate = self.sampleRate;
+    result.windowLength = self.windowLength;
+    result.x = [self.x copy];
+    result.y = [self.y copy];
+    result.z = [self.z copy];
+    result.windows = [self.windows copy];
+    return result;
+}
+
+- (NSString *)descriptionWithNumberOfPaddingSpaces:(NSUInteger)numberOfPaddingSpaces {
+    return [NSString stringWithFormat:@"%@; sample rate: %@; window length: %@; windows: %@; x: %@; y: %@; z: %@%@", [self descriptionPrefixWithNumberOfPaddingSpaces:numberOfPaddingSpaces], @(self.sampleRate), @(self.windowLength), @(self.windows.count), self.x, self.y, self.z, self.descriptionSuffix];
+}
+
+@end
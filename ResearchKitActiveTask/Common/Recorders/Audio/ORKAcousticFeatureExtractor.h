@@ -0,0 +1,230 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+@import Foundation;
+@import AVFoundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A single analysis frame passed to each feature stage.
+ 
+ All pointers are owned by the extractor and are only valid for the duration of the call.
+ */
+typedef struct {
+    /// Mono samples of the frame, before windowing.
+    const float *samples;
+    /// Mono samples of the frame, after applying a Hann window.
+    const float *windowedSamples;
+    /// The number of samples in the frame.
+    NSUInteger length;
+    /// Magnitude spectrum of the windowed frame, `length / 2` bins from DC up to (excluding) Nyquist.
+    const float *magnitudes;
+    /// The number of bins in `magnitudes`.
+    NSUInteger binCount;
+    /// The sample rate of the audio, in Hz.
+    double sampleRate;
+    /// The time, in seconds, from the first sample processed to the start of the frame.
+    NSTimeInterval timestamp;
+    /// The time, in seconds, between the start of consecutive frames.
+    NSTimeInterval hopDuration;
+} ORKAcousticFrame;
+
+/**
+ A stage of the acoustic feature extraction pipeline.
+ 
+ A stage computes a fixed set of named per-frame features, and accumulates summary
+ statistics over all frames it has seen. Stages are called serially, in the order in which
+ they were passed to the extractor, so a stage may read features written by earlier stages.
+ */
+@protocol ORKAcousticFeatureStage <NSObject>
+
+/**
+ The names of the per-frame features computed by the stage, in the order they are written.
+ */
+@property (nonatomic, copy, readonly) NSArray<NSString *> *featureNames;
+
+/**
+ Computes the stage's features for a frame.
+ 
+ @param frame           The frame to analyse.
+ @param frameFeatures   The features computed so far for this frame by earlier stages, keyed by feature name.
+ @param values          Storage for `featureNames.count` values, to be filled in by the stage.
+ */
+- (void)processFrame:(const ORKAcousticFrame *)frame
+       frameFeatures:(NSDictionary<NSString *, NSNumber *> *)frameFeatures
+              values:(double *)values;
+
+/**
+ Summary statistics over all frames processed since the last reset.
+ */
+- (NSDictionary<NSString *, NSNumber *> *)summary;
+
+- (void)reset;
+
+@end
+
+/**
+ Computes frame energy, zero-crossing rate and pause statistics.
+ 
+ Per-frame features: `energy` (dBFS) and `zeroCrossingRate`.
+ Summary: `meanEnergy`, `energyStandardDeviation`, `pauseCount`, `meanPauseDuration`,
+ `totalPauseDuration` and `speechRatio`.
+ */
+@interface ORKAcousticEnergyStage : NSObject <ORKAcousticFeatureStage>
+
+/// Frames quieter than this level, in dBFS, are treated as silence. The default is -45.
+@property (nonatomic, assign) double silenceThreshold;
+
+/// The minimum duration, in seconds, of a run of silent frames counted as a pause. The default is 0.25.
+@property (nonatomic, assign) NSTimeInterval minimumPauseDuration;
+
+@end
+
+/**
+ Computes the spectral centroid and spectral flatness of each frame.
+ 
+ Per-frame features: `spectralCentroid` (Hz) and `spectralFlatness`.
+ Summary: `meanSpectralCentroid`, `spectralCentroidStandardDeviation` and `meanSpectralFlatness`.
+ */
+@interface ORKAcousticSpectralStage : NSObject <ORKAcousticFeatureStage>
+
+@end
+
+/**
+ Estimates the fundamental frequency of each frame by autocorrelation, and derives
+ frame-level jitter and shimmer from consecutive voiced frames.
+ 
+ When an `ORKAcousticEnergyStage` runs earlier in the pipeline, frames quieter than
+ `silenceThreshold` are treated as unvoiced without computing the autocorrelation.
+ 
+ Per-frame features: `pitch` (Hz, 0 when unvoiced) and `voicing` (normalized autocorrelation peak).
+ Summary: `meanPitch`, `pitchStandardDeviation`, `jitter`, `shimmer` and `voicedRatio`.
+ */
+@interface ORKAcousticPitchStage : NSObject <ORKAcousticFeatureStage>
+
+/// The lowest fundamental frequency searched, in Hz. The default is 75.
+@property (nonatomic, assign) double minimumPitch;
+
+/// The highest fundamental frequency searched, in Hz. The default is 500.
+@property (nonatomic, assign) double maximumPitch;
+
+/// The normalized autocorrelation peak above which a frame is considered voiced. The default is 0.45.
+@property (nonatomic, assign) double voicingThreshold;
+
+/// Frames quieter than this level, in dBFS, are treated as unvoiced. The default is -45.
+@property (nonatomic, assign) double silenceThreshold;
+
+@end
+
+/**
+ Frames mono audio and runs a pipeline of feature stages over each frame.
+ 
+ Buffers are downmixed into a fixed-size frame buffer, so memory use does not depend on the
+ length or buffer size of the audio. Windowing and the FFT are computed once per frame with
+ vDSP and shared by all stages.
+ 
+ The extractor is not thread safe; call `processBuffer:` from a single thread or queue.
+ */
+@interface ORKAcousticFeatureExtractor : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns the energy, spectral and pitch stages, in that order.
+ */
++ (NSArray<id<ORKAcousticFeatureStage>> *)defaultStages;
+
+/**
+ Returns an extractor using the default stages, a frame length of 1024 samples and a hop of 512 samples.
+ */
+- (instancetype)initWithSampleRate:(double)sampleRate;
+
+/**
+ Returns an initialized extractor.
+ 
+ @param sampleRate      The sample rate of the audio, in Hz.
+ @param frameLength     The number of samples per frame. Must be a power of two.
+ @param hopLength       The number of samples between the start of consecutive frames. Must not exceed `frameLength`.
+ @param stages          The stages to run over each frame, in order.
+ 
+ @return An initialized extractor.
+ */
+- (instancetype)initWithSampleRate:(double)sampleRate
+                       frameLength:(NSUInteger)frameLength
+                         hopLength:(NSUInteger)hopLength
+                            stages:(NSArray<id<ORKAcousticFeatureStage>> *)stages NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) double sampleRate;
+
+@property (nonatomic, readonly) NSUInteger frameLength;
+
+@property (nonatomic, readonly) NSUInteger hopLength;
+
+@property (nonatomic, copy, readonly) NSArray<id<ORKAcousticFeatureStage>> *stages;
+
+/**
+ The names of all per-frame features, in pipeline order.
+ */
+@property (nonatomic, copy, readonly) NSArray<NSString *> *featureNames;
+
+/**
+ Called once per frame with the frame's timestamp and features.
+ */
+@property (nonatomic, copy, nullable) void (^frameHandler)(NSTimeInterval timestamp, NSDictionary<NSString *, NSNumber *> *frameFeatures);
+
+/**
+ The number of frames processed since the last reset.
+ */
+@property (nonatomic, readonly) NSUInteger frameCount;
+
+/**
+ Downmixes the buffer to mono and processes every complete frame it contains.
+ 
+ Only buffers with a floating point or 16-bit integer PCM format are supported.
+ */
+- (void)processBuffer:(AVAudioPCMBuffer *)buffer;
+
+/**
+ Processes mono floating point samples.
+ */
+- (void)processSamples:(const float *)samples count:(NSUInteger)count;
+
+/**
+ The merged summary of all stages.
+ */
+- (NSDictionary<NSString *, NSNumber *> *)summary;
+
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
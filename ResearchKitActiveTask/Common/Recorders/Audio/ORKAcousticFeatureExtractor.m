@@ -0,0 +1,577 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKAcousticFeatureExtractor.h"
+
+#import "ORKHelpers_Internal.h"
+
+@import Accelerate;
+
+static NSString *const ORKAcousticEnergyFeature = @"energy";
+static NSString *const ORKAcousticZeroCrossingRateFeature = @"zeroCrossingRate";
+static NSString *const ORKAcousticSpectralCentroidFeature = @"spectralCentroid";
+static NSString *const ORKAcousticSpectralFlatnessFeature = @"spectralFlatness";
+static NSString *const ORKAcousticPitchFeature = @"pitch";
+static NSString *const ORKAcousticVoicingFeature = @"voicing";
+
+// Energy reported for digital silence, to keep values finite.
+static const double ORKAcousticEnergyFloor = -120.0;
+
+typedef struct {
+    NSUInteger count;
+    double mean;
+    double m2;
+} ORKAcousticRunningStatistics;
+
+static void ORKAcousticRunningStatisticsAdd(ORKAcousticRunningStatistics *statistics, double value) {
+    statistics->count += 1;
+    double delta = value - statistics->mean;
+    statistics->mean += delta / statistics->count;
+    statistics->m2 += delta * (value - statistics->mean);
+}
+
+static double ORKAcousticRunningStatisticsStandardDeviation(const ORKAcousticRunningStatistics *statistics) {
+    return statistics->count > 1 ? sqrt(statistics->m2 / (statistics->count - 1)) : 0;
+}
+
+
+@implementation ORKAcousticEnergyStage {
+    ORKAcousticRunningStatistics _energy;
+    NSUInteger _frameCount;
+    NSUInteger _silentFrameCount;
+    NSUInteger _currentSilentRun;
+    NSUInteger _pauseCount;
+    NSTimeInterval _totalPauseDuration;
+    NSTimeInterval _hopDuration;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _silenceThreshold = -45.0;
+        _minimumPauseDuration = 0.25;
+    }
+    return self;
+}
+
+- (NSArray<NSString *> *)featureNames {
+    return @[ORKAcousticEnergyFeature, ORKAcousticZeroCrossingRateFeature];
+}
+
+- (void)processFrame:(const ORKAcousticFrame *)frame
+       frameFeatures:(NSDictionary<NSString *,NSNumber *> *)frameFeatures
+              values:(double *)values {
+    float rms = 0;
+    vDSP_rmsqv(frame->samples, 1, &rms, frame->length);
+    double energy = rms > 0 ? MAX(20.0 * log10(rms), ORKAcousticEnergyFloor) : ORKAcousticEnergyFloor;
+    
+    vDSP_Length lastCrossing = 0;
+    vDSP_Length crossingCount = 0;
+    vDSP_nzcros(frame->samples, 1, frame->length, &lastCrossing, &crossingCount, frame->length);
+    
+    values[0] = energy;
+    values[1] = (double)crossingCount / frame->length;
+    
+    _hopDuration = frame->hopDuration;
+    _frameCount += 1;
+    ORKAcousticRunningStatisticsAdd(&_energy, energy);
+    if (energy < _silenceThreshold) {
+        _silentFrameCount += 1;
+        _currentSilentRun += 1;
+    } else {
+        [self closeSilentRun];
+    }
+}
+
+- (void)closeSilentRun {
+    NSTimeInterval duration = _currentSilentRun * _hopDuration;
+    if (_currentSilentRun > 0 && duration >= _minimumPauseDuration) {
+        _pauseCount += 1;
+        _totalPauseDuration += duration;
+    }
+    _currentSilentRun = 0;
+}
+
+- (NSDictionary<NSString *,NSNumber *> *)summary {
+    // Trailing silence is not a pause between utterances.
+    NSTimeInterval duration = _currentSilentRun * _hopDuration;
+    NSUInteger speechFrameCount = _frameCount - _silentFrameCount;
+    return @{
+        @"meanEnergy": @(_energy.mean),
+        @"energyStandardDeviation": @(ORKAcousticRunningStatisticsStandardDeviation(&_energy)),
+        @"pauseCount": @(_pauseCount),
+        @"meanPauseDuration": @(_pauseCount > 0 ? _totalPauseDuration / _pauseCount : 0),
+        @"totalPauseDuration": @(_totalPauseDuration),
+        @"trailingSilenceDuration": @(duration),
+        @"speechRatio": @(_frameCount > 0 ? (double)speechFrameCount / _frameCount : 0)
+    };
+}
+
+- (void)reset {
+    _energy = (ORKAcousticRunningStatistics){0};
+    _frameCount = 0;
+    _silentFrameCount = 0;
+    _currentSilentRun = 0;
+    _pauseCount = 0;
+    _totalPauseDuration = 0;
+}
+
+@end
+
+
+@implementation ORKAcousticSpectralStage {
+    float *_binFrequencies;
+    NSUInteger _binCount;
+    double _sampleRate;
+    ORKAcousticRunningStatistics _centroid;
+    ORKAcousticRunningStatistics _flatness;
+}
+
+- (void)dealloc {
+    free(_binFrequencies);
+}
+
+- (NSArray<NSString *> *)featureNames {
+    return @[ORKAcousticSpectralCentroidFeature, ORKAcousticSpectralFlatnessFeature];
+}
+
+- (void)prepareForFrame:(const ORKAcousticFrame *)frame {
+    if (_binFrequencies != NULL && _binCount == frame->binCount && _sampleRate == frame->sampleRate) {
+        return;
+    }
+    free(_binFrequencies);
+    _binCount = frame->binCount;
+    _sampleRate = frame->sampleRate;
+    _binFrequencies = malloc(sizeof(float) * _binCount);
+    float start = 0;
+    float increment = (float)(_sampleRate / (2.0 * _binCount));
+    vDSP_vramp(&start, &increment, _binFrequencies, 1, _binCount);
+}
+
+- (void)processFrame:(const ORKAcousticFrame *)frame
+       frameFeatures:(NSDictionary<NSString *,NSNumber *> *)frameFeatures
+              values:(double *)values {
+    [self prepareForFrame:frame];
+    
+    float magnitudeSum = 0;
+    vDSP_sve(frame->magnitudes, 1, &magnitudeSum, frame->binCount);
+    if (magnitudeSum <= 0) {
+        values[0] = 0;
+        values[1] = 0;
+        return;
+    }
+    
+    float weightedSum = 0;
+    vDSP_dotpr(frame->magnitudes, 1, _binFrequencies, 1, &weightedSum, frame->binCount);
+    double centroid = weightedSum / magnitudeSum;
+    
+    // Flatness is the ratio of the geometric to the arithmetic mean of the power spectrum.
+    // The DC bin is excluded, and bins are floored to avoid log(0).
+    double logSum = 0;
+    NSUInteger bins = frame->binCount - 1;
+    for (NSUInteger bin = 1; bin < frame->binCount; bin++) {
+        double power = (double)frame->magnitudes[bin] * frame->magnitudes[bin];
+        logSum += log(MAX(power, 1e-20));
+    }
+    float powerSum = 0;
+    vDSP_svesq(frame->magnitudes + 1, 1, &powerSum, bins);
+    double arithmeticMean = powerSum / bins;
+    double flatness = arithmeticMean > 0 ? exp(logSum / bins) / arithmeticMean : 0;
+    
+    values[0] = centroid;
+    values[1] = flatness;
+    ORKAcousticRunningStatisticsAdd(&_centroid, centroid);
+    ORKAcousticRunningStatisticsAdd(&_flatness, flatness);
+}
+
+- (NSDictionary<NSString *,NSNumber *> *)summary {
+    return @{
+        @"meanSpectralCentroid": @(_centroid.mean),
+        @"spectralCentroidStandardDeviation": @(ORKAcousticRunningStatisticsStandardDeviation(&_centroid)),
+        @"meanSpectralFlatness": @(_flatness.mean)
+    };
+}
+
+- (void)reset {
+    _centroid = (ORKAcousticRunningStatistics){0};
+    _flatness = (ORKAcousticRunningStatistics){0};
+}
+
+@end
+
+
+@implementation ORKAcousticPitchStage {
+    float *_autocorrelation;
+    NSUInteger _autocorrelationCapacity;
+    NSUInteger _frameCount;
+    NSUInteger _voicedFrameCount;
+    ORKAcousticRunningStatistics _pitch;
+    ORKAcousticRunningStatistics _periodDifference;
+    ORKAcousticRunningStatistics _period;
+    ORKAcousticRunningStatistics _amplitudeDifference;
+    ORKAcousticRunningStatistics _amplitude;
+    double _previousPeriod;
+    double _previousAmplitude;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _minimumPitch = 75.0;
+        _maximumPitch = 500.0;
+        _voicingThreshold = 0.45;
+        _silenceThreshold = -45.0;
+    }
+    return self;
+}
+
+- (void)dealloc {
+    free(_autocorrelation);
+}
+
+- (NSArray<NSString *> *)featureNames {
+    return @[ORKAcousticPitchFeature, ORKAcousticVoicingFeature];
+}
+
+- (void)processFrame:(const ORKAcousticFrame *)frame
+       frameFeatures:(NSDictionary<NSString *,NSNumber *> *)frameFeatures
+              values:(double *)values {
+    _frameCount += 1;
+    values[0] = 0;
+    values[1] = 0;
+    
+    NSUInteger minimumLag = (NSUInteger)floor(frame->sampleRate / _maximumPitch);
+    NSUInteger maximumLag = MIN((NSUInteger)ceil(frame->sampleRate / _minimumPitch), frame->length / 2);
+    NSNumber *energy = frameFeatures[ORKAcousticEnergyFeature];
+    if (minimumLag < 2 || maximumLag <= minimumLag + 1 || (energy && energy.doubleValue < _silenceThreshold)) {
+        [self breakVoicedRun];
+        return;
+    }
+    
+    if (_autocorrelationCapacity < maximumLag + 1) {
+        free(_autocorrelation);
+        _autocorrelationCapacity = maximumLag + 1;
+        _autocorrelation = malloc(sizeof(float) * _autocorrelationCapacity);
+    }
+    
+    // r[lag] = sum(x[n] * x[n + lag]) over a fixed window, for lag in [0, maximumLag].
+    vDSP_Length window = frame->length - maximumLag;
+    vDSP_conv(frame->samples, 1, frame->samples, 1, _autocorrelation, 1, maximumLag + 1, window);
+    float zeroLag = _autocorrelation[0];
+    if (zeroLag <= 0) {
+        [self breakVoicedRun];
+        return;
+    }
+    
+    float peak = 0;
+    vDSP_Length peakIndex = 0;
+    vDSP_maxvi(_autocorrelation + minimumLag, 1, &peak, &peakIndex, maximumLag - minimumLag + 1);
+    NSUInteger lag = minimumLag + peakIndex;
+    
+    // Periodic signals have near-equal peaks at every multiple of the period. Prefer the
+    // first local maximum close to the global one to avoid octave errors.
+    for (NSUInteger candidate = minimumLag + 1; candidate < lag; candidate++) {
+        float value = _autocorrelation[candidate];
+        if (value >= 0.9f * peak && value >= _autocorrelation[candidate - 1] && value >= _autocorrelation[candidate + 1]) {
+            lag = candidate;
+            peak = value;
+            break;
+        }
+    }
+    double voicing = peak / zeroLag;
+    values[1] = voicing;
+    
+    if (voicing < _voicingThreshold) {
+        [self breakVoicedRun];
+        return;
+    }
+    
+    // Parabolic interpolation around the peak for sub-sample period resolution.
+    double refinedLag = lag;
+    if (lag > minimumLag && lag < maximumLag) {
+        double left = _autocorrelation[lag - 1];
+        double right = _autocorrelation[lag + 1];
+        double denominator = left - 2.0 * peak + right;
+        if (denominator != 0) {
+            refinedLag += 0.5 * (left - right) / denominator;
+        }
+    }
+    
+    double period = refinedLag / frame->sampleRate;
+    double pitch = 1.0 / period;
+    float amplitude = 0;
+    vDSP_maxmgv(frame->samples, 1, &amplitude, frame->length);
+    
+    values[0] = pitch;
+    _voicedFrameCount += 1;
+    ORKAcousticRunningStatisticsAdd(&_pitch, pitch);
+    ORKAcousticRunningStatisticsAdd(&_period, period);
+    ORKAcousticRunningStatisticsAdd(&_amplitude, amplitude);
+    if (_previousPeriod > 0) {
+        ORKAcousticRunningStatisticsAdd(&_periodDifference, fabs(period - _previousPeriod));
+        ORKAcousticRunningStatisticsAdd(&_amplitudeDifference, fabs(amplitude - _previousAmplitude));
+    }
+    _previousPeriod = period;
+    _previousAmplitude = amplitude;
+}
+
+- (void)breakVoicedRun {
+    _previousPeriod = 0;
+    _previousAmplitude = 0;
+}
+
+- (NSDictionary<NSString *,NSNumber *> *)summary {
+    double jitter = _period.mean > 0 ? _periodDifference.mean / _period.mean : 0;
+    double shimmer = _amplitude.mean > 0 ? _amplitudeDifference.mean / _amplitude.mean : 0;
+    return @{
+        @"meanPitch": @(_pitch.mean),
+        @"pitchStandardDeviation": @(ORKAcousticRunningStatisticsStandardDeviation(&_pitch)),
+        @"jitter": @(jitter),
+        @"shimmer": @(shimmer),
+        @"voicedRatio": @(_frameCount > 0 ? (double)_voicedFrameCount / _frameCount : 0)
+    };
+}
+
+- (void)reset {
+    _frameCount = 0;
+    _voicedFrameCount = 0;
+    _pitch = (ORKAcousticRunningStatistics){0};
+    _period = (ORKAcousticRunningStatistics){0};
+    _periodDifference = (ORKAcousticRunningStatistics){0};
+    _amplitude = (ORKAcousticRunningStatistics){0};
+    _amplitudeDifference = (ORKAcousticRunningStatistics){0};
+    [self breakVoicedRun];
+}
+
+@end
+
+
+@implementation ORKAcousticFeatureExtractor {
+    FFTSetup _fftSetup;
+    vDSP_Length _log2FrameLength;
+    float *_window;
+    float *_frame;
+    NSUInteger _frameFill;
+    float *_windowedFrame;
+    float *_magnitudes;
+    float *_realp;
+    float *_imagp;
+    float *_mixBuffer;
+    NSUInteger _mixBufferCapacity;
+    double *_values;
+}
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
++ (NSArray<id<ORKAcousticFeatureStage>> *)defaultStages {
+    return @[[ORKAcousticEnergyStage new], [ORKAcousticSpectralStage new], [ORKAcousticPitchStage new]];
+}
+
+- (instancetype)initWithSampleRate:(double)sampleRate {
+    return [self initWithSampleRate:sampleRate frameLength:1024 hopLength:512 stages:[[self class] defaultStages]];
+}
+
+- (instancetype)initWithSampleRate:(double)sampleRate
+                       frameLength:(NSUInteger)frameLength
+                         hopLength:(NSUInteger)hopLength
+                            stages:(NSArray<id<ORKAcousticFeatureStage>> *)stages {
+    self = [super init];
+    if (self) {
+        if (frameLength < 64 || (frameLength & (frameLength - 1)) != 0) {
+            @throw [NSException exceptionWithName:NSInvalidArgumentException reason:@"frameLength must be a power of two of at least 64" userInfo:nil];
+        }
+        if (hopLength == 0 || hopLength > frameLength) {
+            @throw [NSException exceptionWithName:NSInvalidArgumentException reason:@"hopLength must be between 1 and frameLength" userInfo:nil];
+        }
+        _sampleRate = sampleRate;
+        _frameLength = frameLength;
+        _hopLength = hopLength;
+        _stages = [stages copy];
+        
+        NSMutableArray<NSString *> *featureNames = [NSMutableArray new];
+        for (id<ORKAcousticFeatureStage> stage in _stages) {
+            [featureNames addObjectsFromArray:stage.featureNames];
+        }
+        _featureNames = [featureNames copy];
+        
+        _log2FrameLength = (vDSP_Length)log2((double)frameLength);
+        _fftSetup = vDSP_create_fftsetup(_log2FrameLength, kFFTRadix2);
+        _window = malloc(sizeof(float) * frameLength);
+        vDSP_hann_window(_window, frameLength, vDSP_HANN_NORM);
+        _frame = calloc(frameLength, sizeof(float));
+        _windowedFrame = malloc(sizeof(float) * frameLength);
+        _magnitudes = malloc(sizeof(float) * frameLength / 2);
+        _realp = malloc(sizeof(float) * frameLength / 2);
+        _imagp = malloc(sizeof(float) * frameLength / 2);
+        _values = calloc(MAX(_featureNames.count, 1), sizeof(double));
+    }
+    return self;
+}
+
+- (void)dealloc {
+    vDSP_destroy_fftsetup(_fftSetup);
+    free(_window);
+    free(_frame);
+    free(_windowedFrame);
+    free(_magnitudes);
+    free(_realp);
+    free(_imagp);
+    free(_mixBuffer);
+    free(_values);
+}
+
+- (void)processBuffer:(AVAudioPCMBuffer *)buffer {
+    AVAudioFrameCount frameCount = buffer.frameLength;
+    AVAudioChannelCount channelCount = buffer.format.channelCount;
+    if (frameCount == 0 || channelCount == 0) {
+        return;
+    }
+    
+    if (_mixBufferCapacity < frameCount) {
+        free(_mixBuffer);
+        _mixBufferCapacity = frameCount;
+        _mixBuffer = malloc(sizeof(float) * _mixBufferCapacity);
+    }
+    
+    BOOL interleaved = buffer.format.isInterleaved;
+    vDSP_Stride stride = interleaved ? channelCount : 1;
+    float scale = 1.0f / channelCount;
+    vDSP_vclr(_mixBuffer, 1, frameCount);
+    
+    if (buffer.floatChannelData != NULL) {
+        for (AVAudioChannelCount channel = 0; channel < channelCount; channel++) {
+            const float *channelData = interleaved ? buffer.floatChannelData[0] + channel : buffer.floatChannelData[channel];
+            vDSP_vsma(channelData, stride, &scale, _mixBuffer, 1, _mixBuffer, 1, frameCount);
+        }
+    } else if (buffer.int16ChannelData != NULL) {
+        float int16Scale = scale / 32768.0f;
+        for (AVAudioChannelCount channel = 0; channel < channelCount; channel++) {
+            const int16_t *channelData = interleaved ? buffer.int16ChannelData[0] + channel : buffer.int16ChannelData[channel];
+            // Reuse the magnitude storage as scratch space in chunks of half a frame.
+            NSUInteger offset = 0;
+            while (offset < frameCount) {
+                NSUInteger count = MIN(_frameLength / 2, frameCount - offset);
+                vDSP_vflt16(channelData + offset * stride, stride, _magnitudes, 1, count);
+                vDSP_vsma(_magnitudes, 1, &int16Scale, _mixBuffer + offset, 1, _mixBuffer + offset, 1, count);
+                offset += count;
+            }
+        }
+    } else {
+        ORK_Log_Error("ORKAcousticFeatureExtractor does not support the buffer format %@", buffer.format);
+        return;
+    }
+    
+    [self processSamples:_mixBuffer count:frameCount];
+}
+
+- (void)processSamples:(const float *)samples count:(NSUInteger)count {
+    NSUInteger offset = 0;
+    while (offset < count) {
+        NSUInteger copyCount = MIN(_frameLength - _frameFill, count - offset);
+        memcpy(_frame + _frameFill, samples + offset, sizeof(float) * copyCount);
+        _frameFill += copyCount;
+        offset += copyCount;
+        
+        if (_frameFill == _frameLength) {
+            [self analyzeFrame];
+            memmove(_frame, _frame + _hopLength, sizeof(float) * (_frameLength - _hopLength));
+            _frameFill = _frameLength - _hopLength;
+        }
+    }
+}
+
+- (void)analyzeFrame {
+    NSUInteger binCount = _frameLength / 2;
+    vDSP_vmul(_frame, 1, _window, 1, _windowedFrame, 1, _frameLength);
+    
+    DSPSplitComplex split = { .realp = _realp, .imagp = _imagp };
+    vDSP_ctoz((const DSPComplex *)_windowedFrame, 2, &split, 1, binCount);
+    vDSP_fft_zrip(_fftSetup, &split, 1, _log2FrameLength, kFFTDirection_Forward);
+    // The packed Nyquist term in imagp[0] is not part of the returned spectrum.
+    _imagp[0] = 0;
+    vDSP_zvabs(&split, 1, _magnitudes, 1, binCount);
+    float fftScale = 0.5f / _frameLength;
+    vDSP_vsmul(_magnitudes, 1, &fftScale, _magnitudes, 1, binCount);
+    
+    NSTimeInterval hopDuration = _hopLength / _sampleRate;
+    ORKAcousticFrame frame = {
+        .samples = _frame,
+        .windowedSamples = _windowedFrame,
+        .length = _frameLength,
+        .magnitudes = _magnitudes,
+        .binCount = binCount,
+        .sampleRate = _sampleRate,
+        .timestamp = _frameCount * hopDuration,
+        .hopDuration = hopDuration
+    };
+    
+    NSMutableDictionary<NSString *, NSNumber *> *frameFeatures = [NSMutableDictionary dictionaryWithCapacity:_featureNames.count];
+    NSUInteger valueIndex = 0;
+    for (id<ORKAcousticFeatureStage> stage in _stages) {
+        NSArray<NSString *> *names = stage.featureNames;
+        [stage processFrame:&frame frameFeatures:frameFeatures values:_values + valueIndex];
+        for (NSUInteger index = 0; index < names.count; index++) {
+            frameFeatures[names[index]] = @(_values[valueIndex + index]);
+        }
+        valueIndex += names.count;
+    }
+    _frameCount += 1;
+    
+    if (_frameHandler) {
+        _frameHandler(frame.timestamp, frameFeatures);
+    }
+}
+
+- (NSDictionary<NSString *,NSNumber *> *)summary {
+    NSMutableDictionary<NSString *, NSNumber *> *summary = [NSMutableDictionary new];
+    for (id<ORKAcousticFeatureStage> stage in _stages) {
+        [summary addEntriesFromDictionary:[stage summary]];
+    }
+    summary[@"frameCount"] = @(_frameCount);
+    summary[@"duration"] = @(_frameCount * (_hopLength / _sampleRate));
+    return [summary copy];
+}
+
+- (void)reset {
+    for (id<ORKAcousticFeatureStage> stage in _stages) {
+        [stage reset];
+    }
+    _frameFill = 0;
+    _frameCount = 0;
+    vDSP_vclr(_frame, 1, _frameLength);
+}
+
+@end
@@ -0,0 +1,60 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKAudioStreamer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKAcousticFeatureExtractor;
+
+/**
+ A recorder that runs an `ORKAcousticFeatureExtractor` over the microphone stream and logs
+ per-frame feature vectors through an `ORKDataLogger`. No audio is written to disk unless
+`chunkEncoding` is set, in which case the audio chunk files are reported along with the feature log.
+ 
+ The tap thread only copies each buffer; extraction and logging run on a background queue. If that
+ queue falls too far behind, buffers are dropped and counted in `droppedFrameCount`, which is also
+ reported in the file results' `userInfo`.
+ */
+@interface ORKAcousticFeatureRecorder : ORKAudioStreamer
+
+/**
+ The summary features of the last recording, or `nil` if no audio has been processed.
+ */
+@property (nonatomic, copy, readonly, nullable) NSDictionary<NSString *, NSNumber *> *featureSummary;
+
+/**
+ The number of audio frames dropped in the current recording because feature extraction fell behind.
+ */
+@property (nonatomic, readonly) uint64_t droppedFrameCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
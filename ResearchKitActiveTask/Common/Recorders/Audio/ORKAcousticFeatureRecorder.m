@@ -0,0 +1,277 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKAcousticFeatureRecorder.h"
+
+#import "ORKAcousticFeatureExtractor.h"
+#import "ORKDataLogger.h"
+#import "ORKRecorder_Internal.h"
+
+#import "ORKHelpers_Internal.h"
+
+#include <stdatomic.h>
+
+// Frames are appended to the log in batches to keep the per-frame cost low.
+static const NSUInteger ORKAcousticFeatureRecorderBatchSize = 64;
+
+// Number of tap buffers that may wait for feature extraction. When the queue falls further
+// behind, incoming buffers are dropped and counted instead of blocking the tap thread.
+static const NSUInteger ORKAcousticFeatureRecorderMaximumPendingBuffers = 32;
+
+static AVAudioPCMBuffer *ORKAcousticFeatureRecorderCopyBuffer(AVAudioPCMBuffer *buffer) {
+    AVAudioPCMBuffer *copy = [[AVAudioPCMBuffer alloc] initWithPCMFormat:buffer.format frameCapacity:buffer.frameLength];
+    const AudioBufferList *sourceList = buffer.audioBufferList;
+    AudioBufferList *destinationList = copy.mutableAudioBufferList;
+    for (UInt32 index = 0; index < sourceList->mNumberBuffers && index < destinationList->mNumberBuffers; index++) {
+        memcpy(destinationList->mBuffers[index].mData, sourceList->mBuffers[index].mData, sourceList->mBuffers[index].mDataByteSize);
+        destinationList->mBuffers[index].mDataByteSize = sourceList->mBuffers[index].mDataByteSize;
+    }
+    copy.frameLength = buffer.frameLength;
+    return copy;
+}
+
+@implementation ORKAcousticFeatureRecorder {
+    ORKDataLogger *_logger;
+    ORKAcousticFeatureExtractor *_extractor;
+    NSMutableArray<NSDictionary *> *_pendingFrames;
+    dispatch_queue_t _queue;
+    NSError *_loggingError;
+    
+    // Updated from the tap thread.
+    atomic_uint_fast32_t _pendingBufferCount;
+    atomic_uint_fast64_t _droppedFrameCount;
+}
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wobjc-designated-initializers"
+- (instancetype)initWithIdentifier:(NSString *)identifier
+                              step:(ORKStep *)step
+                   outputDirectory:(NSURL *)outputDirectory
+          rollingFileSizeThreshold:(size_t)rollingFileSizeThreshold {
+    self = [super initWithIdentifier:identifier
+                                step:step
+                     outputDirectory:outputDirectory
+            rollingFileSizeThreshold:rollingFileSizeThreshold];
+    if (self) {
+        _queue = dispatch_queue_create("ORKAcousticFeatureRecorder", DISPATCH_QUEUE_SERIAL);
+        _pendingFrames = [NSMutableArray arrayWithCapacity:ORKAcousticFeatureRecorderBatchSize];
+        atomic_init(&_pendingBufferCount, 0);
+        atomic_init(&_droppedFrameCount, 0);
+        self.continuesInBackground = YES;
+    }
+    return self;
+}
+#pragma clang diagnostic pop
+
+- (void)dealloc {
+    [_logger finishCurrentLog];
+}
+
+- (NSString *)recorderType {
+    return @"acousticFeatures";
+}
+
+- (NSString *)mimeType {
+    return @"application/json";
+}
+
+- (uint64_t)droppedFrameCount {
+    return atomic_load(&_droppedFrameCount);
+}
+
+- (NSDictionary *)userInfo {
+    if (!_featureSummary) {
+        return nil;
+    }
+    return @{@"acousticFeatureSummary": _featureSummary, @"droppedFrameCount": @(self.droppedFrameCount)};
+}
+
+- (void)start {
+    if (!_logger) {
+        NSError *error = nil;
+        _logger = [self makeJSONDataLoggerWithError:&error];
+        if (!_logger) {
+            [self finishRecordingWithError:error];
+            return;
+        }
+    }
+    _featureSummary = nil;
+    
+    [super start];
+}
+
+- (void)processAudioBuffer:(AVAudioPCMBuffer *)buffer {
+    // Feature extraction and logging run on the queue, so the tap thread only copies the buffer.
+    // -finishWritingFilesWithError: drains the queue, after the engine has stopped.
+    if (atomic_fetch_add(&_pendingBufferCount, 1) >= ORKAcousticFeatureRecorderMaximumPendingBuffers) {
+        atomic_fetch_sub(&_pendingBufferCount, 1);
+        atomic_fetch_add(&_droppedFrameCount, buffer.frameLength);
+        return;
+    }
+    
+    AVAudioPCMBuffer *bufferCopy = ORKAcousticFeatureRecorderCopyBuffer(buffer);
+    dispatch_async(_queue, ^{
+        [self queue_processBuffer:bufferCopy];
+        atomic_fetch_sub(&self->_pendingBufferCount, 1);
+    });
+}
+
+- (void)queue_processBuffer:(AVAudioPCMBuffer *)buffer {
+    if (!_extractor) {
+        _extractor = [[ORKAcousticFeatureExtractor alloc] initWithSampleRate:buffer.format.sampleRate];
+        ORKWeakTypeOf(self) weakSelf = self;
+        _extractor.frameHandler = ^(NSTimeInterval timestamp, NSDictionary<NSString *, NSNumber *> *frameFeatures) {
+            [weakSelf queue_appendFrameWithTimestamp:timestamp features:frameFeatures];
+        };
+    }
+    [_extractor processBuffer:buffer];
+}
+
+- (void)queue_appendFrameWithTimestamp:(NSTimeInterval)timestamp features:(NSDictionary<NSString *, NSNumber *> *)features {
+    NSMutableDictionary *frame = [features mutableCopy];
+    frame[@"timestamp"] = @(timestamp);
+    [_pendingFrames addObject:frame];
+    if (_pendingFrames.count >= ORKAcousticFeatureRecorderBatchSize) {
+        [self queue_flushPendingFrames];
+    }
+}
+
+- (void)queue_flushPendingFrames {
+    if (_pendingFrames.count == 0 || _loggingError) {
+        [_pendingFrames removeAllObjects];
+        return;
+    }
+    NSError *error = nil;
+    if (![_logger appendObjects:_pendingFrames error:&error]) {
+        _loggingError = error;
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self finishRecordingWithError:error];
+        });
+    }
+    [_pendingFrames removeAllObjects];
+}
+
+- (NSArray<NSURL *> *)finishWritingFilesWithError:(NSError **)errorOut {
+    // Audio chunk files, if the streamer is also writing them.
+    NSError *streamingError = nil;
+    NSArray<NSURL *> *streamedFileURLs = [super finishWritingFilesWithError:&streamingError];
+    
+    __block NSError *loggingError = nil;
+    dispatch_sync(_queue, ^{
+        [self queue_flushPendingFrames];
+        self->_featureSummary = [[self->_extractor summary] copy];
+        loggingError = self->_loggingError;
+    });
+    
+    uint64_t droppedFrameCount = self.droppedFrameCount;
+    if (droppedFrameCount > 0) {
+        ORK_Log_Error("ORKAcousticFeatureRecorder dropped %llu frames because feature extraction fell behind", droppedFrameCount);
+    }
+    
+    if (loggingError || streamingError) {
+        if (errorOut != NULL) {
+            *errorOut = loggingError ? : streamingError;
+        }
+        return @[];
+    }
+    
+    [_logger finishCurrentLog];
+    
+    NSMutableArray<NSURL *> *fileURLs = [NSMutableArray arrayWithArray:streamedFileURLs];
+    [_logger enumerateLogs:^(NSURL *logFileUrl, BOOL *stop) {
+        [fileURLs addObject:logFileUrl];
+    } error:errorOut];
+    return [fileURLs copy];
+}
+
+- (void)reset {
+    [super reset];
+    
+    dispatch_sync(_queue, ^{
+        self->_extractor = nil;
+        [self->_pendingFrames removeAllObjects];
+        self->_loggingError = nil;
+    });
+    atomic_store(&_droppedFrameCount, 0);
+    _logger = nil;
+}
+
+@end
+
+
+@implementation ORKAcousticFeatureRecorderConfiguration
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wobjc-designated-initializers"
+- (instancetype)initWithIdentifier:(NSString *)identifier {
+    return [self initWithIdentifier:identifier outputDirectory:nil rollingFileSizeThreshold:0];
+}
+
+- (instancetype)initWithIdentifier:(NSString *)identifier
+                   outputDirectory:(nullable NSURL *)outputDirectory {
+    return [self initWithIdentifier:identifier outputDirectory:outputDirectory rollingFileSizeThreshold:0];
+}
+#pragma clang diagnostic pop
+
+- (instancetype)initWithIdentifier:(NSString *)identifier
+                   outputDirectory:(nullable NSURL *)outputDirectory
+          rollingFileSizeThreshold:(size_t)rollingFileSizeThreshold {
+    return [super initWithIdentifier:identifier outputDirectory:outputDirectory rollingFileSizeThreshold:rollingFileSizeThreshold];
+}
+
+- (ORKRecorder *)recorderForStep:(ORKStep *)step {
+    return [[ORKAcousticFeatureRecorder alloc] initWithIdentifier:self.identifier
+                                                             step:step
+                                                  outputDirectory:self.outputDirectory
+                                         rollingFileSizeThreshold:self.rollingFileSizeThreshold];
+}
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+    self = [super initWithCoder:aDecoder];
+    return self;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    [super encodeWithCoder:aCoder];
+}
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (BOOL)isEqual:(id)object {
+    return [super isEqual:object];
+}
+
+- (ORKPermissionMask)requestedPermissionMask {
+    return ORKPermissionAudioRecording;
+}
+
+@end
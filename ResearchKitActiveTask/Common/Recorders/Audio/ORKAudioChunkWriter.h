@@ -0,0 +1,143 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+@import Foundation;
+@import AVFoundation;
+#import <ResearchKit/ORKRecorder.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Block invoked on the writer's queue each time a chunk file has been finalized.
+ 
+ @param chunkURL    The URL of the completed chunk file.
+ @param chunkIndex  The zero-based index of the chunk within the recording.
+ */
+typedef void (^ORKAudioChunkWriterChunkHandler)(NSURL *chunkURL, NSUInteger chunkIndex);
+
+/**
+ Encodes audio tap buffers into fixed-duration chunk files on a background queue.
+ 
+ Buffers passed to `appendBuffer:` are copied into a fixed pool of pre-allocated
+ `AVAudioPCMBuffer` objects, so the tap thread never allocates and the amount of audio
+ waiting to be encoded is bounded. If the encoder falls behind and the pool is exhausted,
+ incoming audio is dropped and counted in `droppedFrameCount` rather than growing memory.
+ 
+ A new chunk file is started every `chunkDuration` seconds, or when the current file reaches
+ `rollingFileSizeThreshold` bytes, whichever comes first.
+ */
+@interface ORKAudioChunkWriter : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns an initialized chunk writer.
+ 
+ @param directoryURL                The directory in which chunk files are created.
+ @param logName                     The prefix used for chunk file names.
+ @param inputFormat                 The format of the buffers that are appended.
+ @param encoding                    The encoding of the chunk files. Must not be `ORKAudioChunkEncodingNone`.
+ @param chunkDuration               The duration of each chunk in seconds, or 0 to roll over on size only.
+ @param rollingFileSizeThreshold    The size in bytes at which a chunk is rolled over, or 0 to roll over on duration only.
+ 
+ @return An initialized chunk writer.
+ */
+- (instancetype)initWithDirectoryURL:(NSURL *)directoryURL
+                             logName:(NSString *)logName
+                         inputFormat:(AVAudioFormat *)inputFormat
+                            encoding:(ORKAudioChunkEncoding)encoding
+                       chunkDuration:(NSTimeInterval)chunkDuration
+            rollingFileSizeThreshold:(size_t)rollingFileSizeThreshold NS_DESIGNATED_INITIALIZER;
+
+/**
+ Returns a chunk writer for a recorder that streams audio to chunk files.
+ 
+ The writer creates its files in the recorder's recording directory, named after its log, and rolls
+ them over at the recorder's `rollingFileSizeThreshold`. Completed chunks are passed to the
+ `audioChunkAvailableAtURL:` method of the recorder's delegate, and encoding errors to the
+ recorder's `finishRecordingWithError:`, on the main queue.
+ 
+ @param recorder        The recorder that writes the chunks.
+ @param inputFormat     The format of the buffers that are appended.
+ @param encoding        The encoding of the chunk files. Must not be `ORKAudioChunkEncodingNone`.
+ @param chunkDuration   The duration of each chunk in seconds, or 0 to roll over on size only.
+ 
+ @return An initialized chunk writer.
+ */
++ (instancetype)chunkWriterForRecorder:(ORKRecorder *)recorder
+                           inputFormat:(AVAudioFormat *)inputFormat
+                              encoding:(ORKAudioChunkEncoding)encoding
+                         chunkDuration:(NSTimeInterval)chunkDuration;
+
+@property (nonatomic, readonly) ORKAudioChunkEncoding encoding;
+
+@property (nonatomic, readonly) AVAudioFormat *inputFormat;
+
+/**
+ Invoked on the writer's queue whenever a chunk is finalized.
+ */
+@property (nonatomic, copy, nullable) ORKAudioChunkWriterChunkHandler chunkHandler;
+
+/**
+ Invoked on the writer's queue if encoding fails. No further audio is written after an error.
+ */
+@property (nonatomic, copy, nullable) void (^errorHandler)(NSError *error);
+
+/**
+ The number of frames dropped because the buffer pool was exhausted.
+ */
+@property (nonatomic, readonly) uint64_t droppedFrameCount;
+
+/**
+ The MIME type of the chunk files.
+ */
+@property (nonatomic, readonly) NSString *mimeType;
+
+/**
+ Copies the buffer into the pool and schedules it for encoding.
+ 
+ This method is safe to call from an audio tap block.
+ 
+ @return `NO` if some or all of the buffer was dropped.
+ */
+- (BOOL)appendBuffer:(AVAudioPCMBuffer *)buffer;
+
+/**
+ Waits for all pending buffers to be encoded, finalizes the current chunk, and returns
+ the URLs of all chunk files written.
+ 
+ After this method returns, further calls to `appendBuffer:` are ignored.
+ */
+- (NSArray<NSURL *> *)finishWritingWithError:(NSError * _Nullable *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
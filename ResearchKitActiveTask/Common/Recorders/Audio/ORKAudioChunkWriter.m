@@ -0,0 +1,364 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKAudioChunkWriter.h"
+
+#import "ORKAudioStreamer.h"
+#import "ORKHelpers_Internal.h"
+#import "ORKRecorder_Internal.h"
+
+#include <os/lock.h>
+#include <sys/stat.h>
+
+// Number of pre-allocated buffers waiting to be encoded, and the capacity of each.
+// At 48 kHz this bounds the backlog to roughly 1.4 seconds of audio.
+static const NSUInteger ORKAudioChunkWriterPoolSize = 16;
+static const AVAudioFrameCount ORKAudioChunkWriterPoolBufferFrameCapacity = 4096;
+
+static NSDictionary *ORKAudioChunkWriterFileSettings(ORKAudioChunkEncoding encoding, AVAudioFormat *inputFormat) {
+    NSMutableDictionary *settings = [@{
+        AVSampleRateKey: @(inputFormat.sampleRate),
+        AVNumberOfChannelsKey: @(inputFormat.channelCount)
+    } mutableCopy];
+    
+    switch (encoding) {
+        case ORKAudioChunkEncodingLinearPCM:
+            settings[AVFormatIDKey] = @(kAudioFormatLinearPCM);
+            settings[AVLinearPCMBitDepthKey] = @(16);
+            settings[AVLinearPCMIsFloatKey] = @NO;
+            settings[AVLinearPCMIsBigEndianKey] = @NO;
+            settings[AVAudioFileTypeKey] = @(kAudioFileWAVEType);
+            break;
+        case ORKAudioChunkEncodingAppleLossless:
+            settings[AVFormatIDKey] = @(kAudioFormatAppleLossless);
+            settings[AVEncoderBitDepthHintKey] = @(16);
+            settings[AVAudioFileTypeKey] = @(kAudioFileM4AType);
+            break;
+        case ORKAudioChunkEncodingAAC:
+            settings[AVFormatIDKey] = @(kAudioFormatMPEG4AAC);
+            settings[AVEncoderAudioQualityKey] = @(AVAudioQualityMedium);
+            settings[AVAudioFileTypeKey] = @(kAudioFileM4AType);
+            break;
+        case ORKAudioChunkEncodingNone:
+            @throw [NSException exceptionWithName:NSInvalidArgumentException reason:@"ORKAudioChunkWriter requires an encoding" userInfo:nil];
+    }
+    return [settings copy];
+}
+
+static void ORKAudioChunkWriterCopyFrames(AVAudioPCMBuffer *source, AVAudioFrameCount offset, AVAudioPCMBuffer *destination, AVAudioFrameCount frameCount) {
+    const AudioBufferList *sourceList = source.audioBufferList;
+    AudioBufferList *destinationList = destination.mutableAudioBufferList;
+    UInt32 bytesPerFrame = source.format.streamDescription->mBytesPerFrame;
+    for (UInt32 index = 0; index < sourceList->mNumberBuffers && index < destinationList->mNumberBuffers; index++) {
+        const uint8_t *sourceData = (const uint8_t *)sourceList->mBuffers[index].mData;
+        memcpy(destinationList->mBuffers[index].mData, sourceData + (size_t)offset * bytesPerFrame, (size_t)frameCount * bytesPerFrame);
+        destinationList->mBuffers[index].mDataByteSize = frameCount * bytesPerFrame;
+    }
+    destination.frameLength = frameCount;
+}
+
+@implementation ORKAudioChunkWriter {
+    NSURL *_directoryURL;
+    NSString *_logName;
+    NSDictionary *_fileSettings;
+    AVAudioFramePosition _framesPerChunk;
+    size_t _rollingFileSizeThreshold;
+    
+    dispatch_queue_t _queue;
+    
+    // Pool state, guarded by _poolLock. Accessed from the tap thread.
+    os_unfair_lock _poolLock;
+    NSArray<AVAudioPCMBuffer *> *_pool;
+    NSUInteger _freeSlots[ORKAudioChunkWriterPoolSize];
+    NSUInteger _freeSlotCount;
+    uint64_t _droppedFrameCount;
+    BOOL _finished;
+    
+    // Encoder state, confined to _queue.
+    AVAudioFile *_currentFile;
+    NSURL *_currentFileURL;
+    AVAudioFramePosition _framesInCurrentChunk;
+    NSMutableArray<NSURL *> *_chunkURLs;
+    NSError *_error;
+    BOOL _closed;
+}
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithDirectoryURL:(NSURL *)directoryURL
+                             logName:(NSString *)logName
+                         inputFormat:(AVAudioFormat *)inputFormat
+                            encoding:(ORKAudioChunkEncoding)encoding
+                       chunkDuration:(NSTimeInterval)chunkDuration
+            rollingFileSizeThreshold:(size_t)rollingFileSizeThreshold {
+    self = [super init];
+    if (self) {
+        ORKThrowInvalidArgumentExceptionIfNil(directoryURL);
+        ORKThrowInvalidArgumentExceptionIfNil(logName);
+        ORKThrowInvalidArgumentExceptionIfNil(inputFormat);
+        _directoryURL = [directoryURL copy];
+        _logName = [logName copy];
+        _inputFormat = inputFormat;
+        _encoding = encoding;
+        _fileSettings = ORKAudioChunkWriterFileSettings(encoding, inputFormat);
+        _framesPerChunk = (AVAudioFramePosition)round(MAX(chunkDuration, 0) * inputFormat.sampleRate);
+        _rollingFileSizeThreshold = rollingFileSizeThreshold;
+        _queue = dispatch_queue_create("ORKAudioChunkWriter", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+        _poolLock = OS_UNFAIR_LOCK_INIT;
+        
+        NSMutableArray<AVAudioPCMBuffer *> *pool = [NSMutableArray arrayWithCapacity:ORKAudioChunkWriterPoolSize];
+        for (NSUInteger slot = 0; slot < ORKAudioChunkWriterPoolSize; slot++) {
+            [pool addObject:[[AVAudioPCMBuffer alloc] initWithPCMFormat:inputFormat frameCapacity:ORKAudioChunkWriterPoolBufferFrameCapacity]];
+            _freeSlots[slot] = slot;
+        }
+        _pool = [pool copy];
+        _freeSlotCount = ORKAudioChunkWriterPoolSize;
+        _chunkURLs = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (NSString *)mimeType {
+    return (_encoding == ORKAudioChunkEncodingLinearPCM) ? @"audio/wav" : @"audio/mp4";
+}
+
+- (NSString *)fileExtension {
+    return (_encoding == ORKAudioChunkEncodingLinearPCM) ? @"wav" : @"m4a";
+}
+
+- (uint64_t)droppedFrameCount {
+    os_unfair_lock_lock(&_poolLock);
+    uint64_t count = _droppedFrameCount;
+    os_unfair_lock_unlock(&_poolLock);
+    return count;
+}
+
+#pragma mark - Tap thread
+
++ (instancetype)chunkWriterForRecorder:(ORKRecorder *)recorder
+                           inputFormat:(AVAudioFormat *)inputFormat
+                              encoding:(ORKAudioChunkEncoding)encoding
+                         chunkDuration:(NSTimeInterval)chunkDuration {
+    ORKAudioChunkWriter *chunkWriter = [[ORKAudioChunkWriter alloc] initWithDirectoryURL:[recorder recordingDirectoryURL]
+                                                                                 logName:[recorder logName]
+                                                                             inputFormat:inputFormat
+                                                                                encoding:encoding
+                                                                           chunkDuration:chunkDuration
+                                                                rollingFileSizeThreshold:recorder.rollingFileSizeThreshold];
+    ORKWeakTypeOf(recorder) weakRecorder = recorder;
+    chunkWriter.chunkHandler = ^(NSURL *chunkURL, NSUInteger chunkIndex) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+            // Both streaming delegate protocols declare this method.
+            id<ORKAudioStreamingDelegate> delegate = (id<ORKAudioStreamingDelegate>)weakRecorder.delegate;
+            if ([delegate respondsToSelector:@selector(audioChunkAvailableAtURL:)]) {
+                [delegate audioChunkAvailableAtURL:chunkURL];
+            }
+        });
+    };
+    chunkWriter.errorHandler = ^(NSError *error) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [weakRecorder finishRecordingWithError:error];
+        });
+    };
+    return chunkWriter;
+}
+
+- (BOOL)appendBuffer:(AVAudioPCMBuffer *)buffer {
+    if (![buffer.format isEqual:_inputFormat]) {
+        ORK_Log_Error("ORKAudioChunkWriter received a buffer in an unexpected format: %@", buffer.format);
+        return NO;
+    }
+    
+    AVAudioFrameCount offset = 0;
+    while (offset < buffer.frameLength) {
+        NSUInteger slot = NSNotFound;
+        os_unfair_lock_lock(&_poolLock);
+        if (_finished) {
+            os_unfair_lock_unlock(&_poolLock);
+            return NO;
+        }
+        if (_freeSlotCount > 0) {
+            slot = _freeSlots[--_freeSlotCount];
+        } else {
+            _droppedFrameCount += (buffer.frameLength - offset);
+        }
+        os_unfair_lock_unlock(&_poolLock);
+        
+        if (slot == NSNotFound) {
+            return NO;
+        }
+        
+        AVAudioPCMBuffer *pooledBuffer = _pool[slot];
+        AVAudioFrameCount frameCount = MIN(pooledBuffer.frameCapacity, buffer.frameLength - offset);
+        ORKAudioChunkWriterCopyFrames(buffer, offset, pooledBuffer, frameCount);
+        offset += frameCount;
+        
+        dispatch_async(_queue, ^{
+            [self queue_writeBufferAtSlot:slot];
+        });
+    }
+    return YES;
+}
+
+- (void)releaseSlot:(NSUInteger)slot {
+    os_unfair_lock_lock(&_poolLock);
+    _freeSlots[_freeSlotCount++] = slot;
+    os_unfair_lock_unlock(&_poolLock);
+}
+
+#pragma mark - Writer queue
+
+- (void)queue_writeBufferAtSlot:(NSUInteger)slot {
+    AVAudioPCMBuffer *buffer = _pool[slot];
+    if (_error == nil && !_closed && (_currentFile != nil || [self queue_openNextChunk])) {
+        NSError *error = nil;
+        if ([_currentFile writeFromBuffer:buffer error:&error]) {
+            _framesInCurrentChunk += buffer.frameLength;
+            if ([self queue_currentChunkIsFull]) {
+                [self queue_closeCurrentChunk];
+            }
+        } else {
+            [self queue_failWithError:error];
+        }
+    }
+    [self releaseSlot:slot];
+}
+
+- (BOOL)queue_currentChunkIsFull {
+    if (_framesPerChunk > 0 && _framesInCurrentChunk >= _framesPerChunk) {
+        return YES;
+    }
+    if (_rollingFileSizeThreshold > 0) {
+        struct stat fileStat;
+        if (stat(_currentFileURL.fileSystemRepresentation, &fileStat) == 0 && (size_t)fileStat.st_size >= _rollingFileSizeThreshold) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
+- (BOOL)queue_openNextChunk {
+    NSError *error = nil;
+    if (![[NSFileManager defaultManager] createDirectoryAtURL:_directoryURL withIntermediateDirectories:YES attributes:nil error:&error]) {
+        [self queue_failWithError:error];
+        return NO;
+    }
+    
+    NSString *fileName = [NSString stringWithFormat:@"%@_%04lu.%@", _logName, (unsigned long)_chunkURLs.count, [self fileExtension]];
+    NSURL *fileURL = [_directoryURL URLByAppendingPathComponent:fileName];
+    [[NSFileManager defaultManager] createFileAtPath:fileURL.path
+                                            contents:nil
+                                          attributes:@{NSFileProtectionKey: ORKFileProtectionFromMode(ORKFileProtectionCompleteUnlessOpen)}];
+    
+    AVAudioFile *file = [[AVAudioFile alloc] initForWriting:fileURL
+                                                   settings:_fileSettings
+                                               commonFormat:_inputFormat.commonFormat
+                                                interleaved:_inputFormat.isInterleaved
+                                                      error:&error];
+    if (file == nil) {
+        [self queue_failWithError:error];
+        return NO;
+    }
+    
+    _currentFile = file;
+    _currentFileURL = fileURL;
+    _framesInCurrentChunk = 0;
+    return YES;
+}
+
+- (void)queue_closeCurrentChunk {
+    if (_currentFile == nil) {
+        return;
+    }
+    
+    // Releasing the file flushes the encoder and finalizes the container.
+    _currentFile = nil;
+    NSURL *chunkURL = _currentFileURL;
+    _currentFileURL = nil;
+    
+#if !TARGET_IPHONE_SIMULATOR
+    NSError *error = nil;
+    if (![[NSFileManager defaultManager] setAttributes:@{NSFileProtectionKey: ORKFileProtectionFromMode(ORKFileProtectionComplete)}
+                                          ofItemAtPath:chunkURL.path
+                                                 error:&error]) {
+        ORK_Log_Error("Error setting file protection on %@: %@", chunkURL, error);
+    }
+#endif
+    
+    NSUInteger chunkIndex = _chunkURLs.count;
+    [_chunkURLs addObject:chunkURL];
+    if (_chunkHandler) {
+        _chunkHandler(chunkURL, chunkIndex);
+    }
+}
+
+- (void)queue_failWithError:(NSError *)error {
+    if (_error != nil) {
+        return;
+    }
+    _error = error;
+    _currentFile = nil;
+    if (_errorHandler) {
+        _errorHandler(error);
+    }
+}
+
+- (NSArray<NSURL *> *)finishWritingWithError:(NSError **)errorOut {
+    os_unfair_lock_lock(&_poolLock);
+    _finished = YES;
+    os_unfair_lock_unlock(&_poolLock);
+    
+    __block NSArray<NSURL *> *chunkURLs = nil;
+    __block NSError *error = nil;
+    dispatch_sync(_queue, ^{
+        [self queue_closeCurrentChunk];
+        _closed = YES;
+        chunkURLs = [_chunkURLs copy];
+        error = _error;
+    });
+    
+    uint64_t droppedFrameCount = self.droppedFrameCount;
+    if (droppedFrameCount > 0) {
+        ORK_Log_Error("ORKAudioChunkWriter dropped %llu frames because the encoder fell behind", droppedFrameCount);
+    }
+    
+    if (error && errorOut != NULL) {
+        *errorOut = error;
+    }
+    return chunkURLs;
+}
+
+@end
@@ -38,6 +38,9 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)audioAvailable:(AVAudioPCMBuffer *)buffer;
 
+@optional
+- (void)audioChunkAvailableAtURL:(NSURL *)chunkURL;
+
 @end
 
 @class ORKStep;
@@ -48,6 +51,21 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, strong, readonly, nullable) AVAudioEngine *audioEngine;
 
+// When not ORKAudioChunkEncodingNone and an output directory is set, streamed buffers are also
+// encoded to chunk files, which are reported as file results when the streamer stops.
+@property (nonatomic, assign) ORKAudioChunkEncoding chunkEncoding;
+
+@property (nonatomic, assign) NSTimeInterval chunkDuration;
+
+// Called on the audio tap thread with every buffer, before it is forwarded to the delegate.
+// Subclasses override this to run additional processing stages. The default implementation does nothing.
+- (void)processAudioBuffer:(AVAudioPCMBuffer *)buffer;
+
+// Called once when the streamer stops, after the audio engine has stopped. Returns the files written
+// while streaming, which are reported as file results, or nil if the streamer wrote no files.
+// Subclasses that write files should call super and append their own.
+- (nullable NSArray<NSURL *> *)finishWritingFilesWithError:(NSError * _Nullable *)error;
+
 @end
 
 NS_ASSUME_NONNULL_END
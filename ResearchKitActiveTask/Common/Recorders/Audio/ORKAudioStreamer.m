@@ -29,6 +29,7 @@
  */
 
 #import "ORKAudioStreamer.h"
+#import "ORKAudioChunkWriter.h"
 #import "ORKHelpers_Internal.h"
 #import "ORKRecorder_Internal.h"
 #import "ORKStep.h"
@@ -54,6 +55,7 @@
     
     if (self != nil) {
         _bypassAudioEngineStart = NO;
+        _chunkEncoding = ORKAudioChunkEncodingNone;
     }
 
     return self;
@@ -68,6 +70,8 @@
                                                                     step:step
                                                          outputDirectory:self.outputDirectory
                                                 rollingFileSizeThreshold:self.rollingFileSizeThreshold];
+    obj.chunkEncoding = self.chunkEncoding;
+    obj.chunkDuration = self.chunkDuration;
 
     return obj;
 }
@@ -76,12 +80,16 @@
     self = [super initWithCoder:aDecoder];
 
     _bypassAudioEngineStart = NO;
+    ORK_DECODE_ENUM(aDecoder, chunkEncoding);
+    ORK_DECODE_DOUBLE(aDecoder, chunkDuration);
 
     return self;
 }
 
 - (void)encodeWithCoder:(NSCoder *)aCoder {
     [super encodeWithCoder:aCoder];
+    ORK_ENCODE_ENUM(aCoder, chunkEncoding);
+    ORK_ENCODE_DOUBLE(aCoder, chunkDuration);
 }
 
 + (BOOL)supportsSecureCoding {
@@ -89,7 +97,12 @@
 }
 
 - (BOOL)isEqual:(id)object {
-    return [super isEqual:object];
+    BOOL isParentSame = [super isEqual:object];
+    
+    __typeof(self) castObject = object;
+    return (isParentSame &&
+            (self.chunkEncoding == castObject.chunkEncoding) &&
+            (self.chunkDuration == castObject.chunkDuration));
 }
 
 - (ORKPermissionMask)requestedPermissionMask {
@@ -103,6 +116,7 @@
 @implementation ORKAudioStreamer
 {
     NSString *_savedSessionCategory;
+    ORKAudioChunkWriter *_chunkWriter;
 }
 
 - (instancetype)initWithIdentifier:(NSString *)identifier step:(ORKStep *)step
@@ -163,10 +177,20 @@
         AVAudioInputNode *inputnode = _audioEngine.inputNode;
         AVAudioFormat *recordingFormat = [inputnode inputFormatForBus:0];
         
+        ORKAudioChunkWriter *chunkWriter = nil;
+        if (_chunkEncoding != ORKAudioChunkEncodingNone && [self recordingDirectoryURL] != nil)
+        {
+            chunkWriter = [ORKAudioChunkWriter chunkWriterForRecorder:self inputFormat:recordingFormat encoding:_chunkEncoding chunkDuration:_chunkDuration];
+        }
+        _chunkWriter = chunkWriter;
+        
         [inputnode installTapOnBus:0 bufferSize:1024 format:recordingFormat block:^(AVAudioPCMBuffer * _Nonnull buffer, AVAudioTime * _Nonnull when)
         {
             id<ORKAudioStreamingDelegate> delegate = (id<ORKAudioStreamingDelegate>)self.delegate;
             
+            [chunkWriter appendBuffer:buffer];
+            [self processAudioBuffer:buffer];
+            
             if (delegate && [delegate respondsToSelector:@selector(audioAvailable:)]) {
                 [delegate audioAvailable:buffer];
             }
@@ -195,9 +219,37 @@
     
     [self doStopRecording];
     
+    NSError *error = nil;
+    NSArray<NSURL *> *fileURLs = [self finishWritingFilesWithError:&error];
+    if (fileURLs != nil)
+    {
+        [self reportFileResultsWithFiles:fileURLs error:error];
+    }
+    _chunkWriter = nil;
+    
     [super stop];
 }
 
+- (void)processAudioBuffer:(AVAudioPCMBuffer *)buffer
+{
+}
+
+- (NSArray<NSURL *> *)finishWritingFilesWithError:(NSError **)error
+{
+    return [_chunkWriter finishWritingWithError:error];
+}
+
+- (NSString *)mimeType
+{
+    return _chunkWriter.mimeType;
+}
+
+- (NSDictionary *)userInfo
+{
+    // Tells analysis where the chunk files have gaps because the encoder fell behind.
+    return _chunkWriter ? @{@"droppedFrameCount": @(_chunkWriter.droppedFrameCount)} : nil;
+}
+
 - (void)doStopRecording
 {
     if (self.isRecording)
@@ -228,6 +280,8 @@
         [[_audioEngine inputNode] removeTapOnBus:0];
     }
     _audioEngine = nil;
+    [_chunkWriter finishWritingWithError:nil];
+    _chunkWriter = nil;
     [super reset];
 }
 
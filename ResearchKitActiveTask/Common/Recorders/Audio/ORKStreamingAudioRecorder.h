@@ -40,6 +40,12 @@ NS_ASSUME_NONNULL_BEGIN
 @optional
 - (void)audioAvailable:(AVAudioPCMBuffer *)buffer;
 
+/**
+ Called on the main queue each time a chunk file has been finalized, when the recorder
+ writes chunked audio. The chunk can be uploaded before the recording is complete.
+ */
+- (void)audioChunkAvailableAtURL:(NSURL *)chunkURL;
+
 @end
 
 /**
@@ -86,6 +92,18 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, strong, readonly, nullable) AVAudioEngine *audioEngine;
 
+/**
+ The encoding used to write audio in fixed-duration chunks.
+ 
+ When the value is `ORKAudioChunkEncodingNone`, a single uncompressed WAVE file is written.
+ */
+@property (nonatomic, assign) ORKAudioChunkEncoding chunkEncoding;
+
+/**
+ The duration, in seconds, of each chunk when `chunkEncoding` is not `ORKAudioChunkEncodingNone`.
+ */
+@property (nonatomic, assign) NSTimeInterval chunkDuration;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -31,6 +31,7 @@
 
 #import "ORKStreamingAudioRecorder.h"
 
+#import "ORKAudioChunkWriter.h"
 #import "ORKRecorder_Internal.h"
 
 #import "ORKHelpers_Internal.h"
@@ -41,6 +42,11 @@
 
 @property (nonatomic, copy) NSString *savedSessionCategory;
 
+@property (nonatomic, strong) ORKAudioChunkWriter *chunkWriter;
+
+// The chunk writer's dropped frame count, kept for the file results after the writer is released.
+@property (nonatomic, strong, nullable) NSNumber *droppedFrameCount;
+
 @end
 
 
@@ -121,7 +127,7 @@
     {
         NSError *error = nil;
         
-        if (![self recreateFileWithError:&error]) {
+        if (_chunkEncoding == ORKAudioChunkEncodingNone && ![self recreateFileWithError:&error]) {
             [self finishRecordingWithError:error];
             return;
         }
@@ -149,30 +155,42 @@
         AVAudioInputNode *inputnode = _audioEngine.inputNode;
         AVAudioFormat *recordingFormat = [inputnode inputFormatForBus:0];
         
-        NSURL *audiourl = [self recordingFileURL];
-        
-        // Update the file type to be written to the file
-        NSMutableDictionary *modifiedSettings = [NSMutableDictionary dictionaryWithDictionary:[recordingFormat settings]];
-        if (@available(iOS 11.0, *)) {
-            modifiedSettings[AVAudioFileTypeKey] = [NSNumber numberWithInt:kAudioFileWAVEType];
+        AVAudioFile *mixerOutputFile = nil;
+        ORKAudioChunkWriter *chunkWriter = nil;
+        if (_chunkEncoding != ORKAudioChunkEncodingNone) {
+            chunkWriter = [ORKAudioChunkWriter chunkWriterForRecorder:self inputFormat:recordingFormat encoding:_chunkEncoding chunkDuration:_chunkDuration];
         } else {
-            // Fallback on earlier versions
-            ORK_Log_Info("ORKStreamingAudioRecorder can only be used with iOS 11.0 or above.");
-        }
-        
-        AVAudioFile *mixerOutputFile = [[AVAudioFile alloc] initForWriting:audiourl settings:modifiedSettings error:&error];
-        if (error) {
-            [self finishRecordingWithError:error];
-            return;
+            NSURL *audiourl = [self recordingFileURL];
+            
+            // Update the file type to be written to the file
+            NSMutableDictionary *modifiedSettings = [NSMutableDictionary dictionaryWithDictionary:[recordingFormat settings]];
+            if (@available(iOS 11.0, *)) {
+                modifiedSettings[AVAudioFileTypeKey] = [NSNumber numberWithInt:kAudioFileWAVEType];
+            } else {
+                // Fallback on earlier versions
+                ORK_Log_Info("ORKStreamingAudioRecorder can only be used with iOS 11.0 or above.");
+            }
+            
+            mixerOutputFile = [[AVAudioFile alloc] initForWriting:audiourl settings:modifiedSettings error:&error];
+            if (error) {
+                [self finishRecordingWithError:error];
+                return;
+            }
         }
+        _chunkWriter = chunkWriter;
+        _droppedFrameCount = nil;
         
         [inputnode installTapOnBus:0 bufferSize:1024 format:recordingFormat block:^(AVAudioPCMBuffer * _Nonnull buffer, AVAudioTime * _Nonnull when) {
             id<ORKStreamingAudioResultDelegate> delegate = (id<ORKStreamingAudioResultDelegate>)self.delegate;
-            NSError *recordingError;
-            [mixerOutputFile writeFromBuffer:buffer error:&recordingError];
-            if (recordingError) {
-                [self finishRecordingWithError:recordingError];
-                return;
+            if (chunkWriter) {
+                [chunkWriter appendBuffer:buffer];
+            } else {
+                NSError *recordingError;
+                [mixerOutputFile writeFromBuffer:buffer error:&recordingError];
+                if (recordingError) {
+                    [self finishRecordingWithError:recordingError];
+                    return;
+                }
             }
             
             if (delegate && [delegate respondsToSelector:@selector(audioAvailable:)]) {
@@ -199,15 +217,36 @@
     }
     [self doStopRecording];
     
-    NSURL *fileUrl = [self recordingFileURL];
-    if (![[NSFileManager defaultManager] fileExistsAtPath:[[self recordingFileURL] path]]) {
-        fileUrl = nil;
+    if (_chunkWriter) {
+        [self finishWritingChunks];
+    } else {
+        NSURL *fileUrl = [self recordingFileURL];
+        if (![[NSFileManager defaultManager] fileExistsAtPath:[[self recordingFileURL] path]]) {
+            fileUrl = nil;
+        }
+        [self reportFileResultsWithFiles:@[fileUrl] error:nil];
     }
-    [self reportFileResultsWithFiles:@[fileUrl] error:nil];
     
     [super stop];
 }
 
+- (void)finishWritingChunks {
+    NSError *error = nil;
+    NSArray<NSURL *> *chunkURLs = [_chunkWriter finishWritingWithError:&error];
+    _droppedFrameCount = @(_chunkWriter.droppedFrameCount);
+    [self reportFileResultsWithFiles:chunkURLs error:error];
+    _chunkWriter = nil;
+}
+
+- (NSString *)mimeType {
+    return _chunkWriter.mimeType;
+}
+
+- (NSDictionary *)userInfo {
+    // Tells analysis where the chunk files have gaps because the encoder fell behind.
+    return _droppedFrameCount ? @{@"droppedFrameCount": _droppedFrameCount} : nil;
+}
+
 - (BOOL)isRecording {
     return [_audioEngine isRunning];
 }
@@ -224,7 +263,9 @@
         }
         _audioEngine = nil;
 #if !TARGET_IPHONE_SIMULATOR
-        [self applyFileProtection:ORKFileProtectionComplete toFileAtURL:[self recordingFileURL]];
+        if (!_chunkWriter) {
+            [self applyFileProtection:ORKFileProtectionComplete toFileAtURL:[self recordingFileURL]];
+        }
 #endif
         [self restoreSavedAudioSessionCategory];
     }
@@ -242,6 +283,8 @@
         [[_audioEngine inputNode] removeTapOnBus:0];
     }
     _audioEngine = nil;
+    [_chunkWriter finishWritingWithError:nil];
+    _chunkWriter = nil;
     [super reset];
 }
 
@@ -273,16 +316,24 @@
                                                                                       step:step
                                                                            outputDirectory:self.outputDirectory
                                                                   rollingFileSizeThreshold:self.rollingFileSizeThreshold];
+    obj.chunkEncoding = self.chunkEncoding;
+    obj.chunkDuration = self.chunkDuration;
     return obj;
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
     self = [super initWithCoder:aDecoder];
+    if (self) {
+        ORK_DECODE_ENUM(aDecoder, chunkEncoding);
+        ORK_DECODE_DOUBLE(aDecoder, chunkDuration);
+    }
     return self;
 }
 
 - (void)encodeWithCoder:(NSCoder *)aCoder {
     [super encodeWithCoder:aCoder];
+    ORK_ENCODE_ENUM(aCoder, chunkEncoding);
+    ORK_ENCODE_DOUBLE(aCoder, chunkDuration);
 }
 
 + (BOOL)supportsSecureCoding {
@@ -290,7 +341,12 @@
 }
 
 - (BOOL)isEqual:(id)object {
-    return [super isEqual:object];
+    BOOL isParentSame = [super isEqual:object];
+    
+    __typeof(self) castObject = object;
+    return (isParentSame &&
+            (self.chunkEncoding == castObject.chunkEncoding) &&
+            (self.chunkDuration == castObject.chunkDuration));
 }
 
 - (ORKPermissionMask)requestedPermissionMask {
@@ -59,6 +59,20 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, readonly) double frequency;
 
+/**
+ A Boolean value indicating whether gait and balance measures are computed while recording.
+ When `YES`, an `ORKGaitSummaryResult` object is reported with the file results. The default
+ value is `NO`.
+ */
+@property (nonatomic, assign) BOOL analyzesGait;
+
+/**
+ A Boolean value indicating whether the tremor spectrum of the user acceleration is computed while
+ recording. When `YES`, an `ORKTremorSpectrumResult` object is reported with the file results. The
+ default value is `NO`.
+ */
+@property (nonatomic, assign) BOOL analyzesTremor;
+
 /**
  Returns an initialized device motion recorder using the specified frequency.
  
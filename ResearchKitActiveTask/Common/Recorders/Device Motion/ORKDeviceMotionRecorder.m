@@ -32,6 +32,10 @@
 #import "ORKDeviceMotionRecorder.h"
 
 #import "ORKDataLogger.h"
+#import "ORKGaitAnalyzer.h"
+#import "ORKGaitSummaryResult.h"
+#import "ORKTremorSpectrumAnalyzer.h"
+#import "ORKTremorSpectrumResult.h"
 
 #import "ORKRecorder_Internal.h"
 
@@ -43,6 +47,8 @@
 
 @interface ORKDeviceMotionRecorder () {
     ORKDataLogger *_logger;
+    ORKGaitAnalyzer *_gaitAnalyzer;
+    ORKTremorSpectrumAnalyzer *_tremorAnalyzer;
 }
 
 @property (nonatomic, strong) CMMotionManager *motionManager;
@@ -108,6 +114,13 @@
         }
     }
     
+    if (_analyzesGait) {
+        _gaitAnalyzer = [[ORKGaitAnalyzer alloc] initWithSampleRate:_frequency];
+    }
+    if (_analyzesTremor) {
+        _tremorAnalyzer = [[ORKTremorSpectrumAnalyzer alloc] initWithSampleRate:_frequency];
+    }
+    
     self.motionManager = [self createMotionManager];
     self.motionManager.deviceMotionUpdateInterval = 1.0 / _frequency;
     
@@ -119,6 +132,22 @@
          BOOL success = NO;
          if (data) {
              success = [self->_logger append:[data ork_JSONDictionary] error:&error];
+             ORKGaitAnalyzer *gaitAnalyzer = self->_gaitAnalyzer;
+             if (gaitAnalyzer) {
+                 CMAcceleration userAcceleration = data.userAcceleration;
+                 CMAcceleration gravity = data.gravity;
+                 ORKGaitSample sample = {
+                     .timestamp = data.timestamp,
+                     .userAcceleration = { userAcceleration.x, userAcceleration.y, userAcceleration.z },
+                     .gravity = { gravity.x, gravity.y, gravity.z }
+                 };
+                 [gaitAnalyzer enqueueSample:sample];
+             }
+             ORKTremorSpectrumAnalyzer *tremorAnalyzer = self->_tremorAnalyzer;
+             if (tremorAnalyzer) {
+                 CMAcceleration userAcceleration = data.userAcceleration;
+                 [tremorAnalyzer addSampleWithTimestamp:data.timestamp x:userAcceleration.x y:userAcceleration.y z:userAcceleration.z];
+             }
              id delegate = self.delegate;
              if ([delegate respondsToSelector:@selector(deviceMotionRecorderDidUpdateWithMotion:)]) {
                  [delegate deviceMotionRecorderDidUpdateWithMotion:data];
@@ -147,6 +176,21 @@
     }
                      error:&error];
     
+    NSMutableArray<ORKResult *> *summaryResults = [NSMutableArray new];
+    if (_gaitAnalyzer) {
+        ORKGaitSummaryResult *gaitResult = [_gaitAnalyzer summaryResultWithIdentifier:self.identifier];
+        gaitResult.startDate = self.startDate;
+        gaitResult.userInfo = self.userInfo;
+        [summaryResults addObject:gaitResult];
+    }
+    if (_tremorAnalyzer) {
+        ORKTremorSpectrumResult *tremorResult = [_tremorAnalyzer resultWithIdentifier:self.identifier];
+        tremorResult.startDate = self.startDate;
+        tremorResult.userInfo = self.userInfo;
+        [summaryResults addObject:tremorResult];
+    }
+    
+    [self reportSummaryResults:summaryResults];
     [self reportFileResultsWithFiles:fileUrls error:error];
     
     [super stop];
@@ -176,6 +220,8 @@
     [super reset];
     
     _logger = nil;
+    _gaitAnalyzer = nil;
+    _tremorAnalyzer = nil;
 }
 
 @end
@@ -208,17 +254,22 @@
 #pragma clang diagnostic pop
 
 - (ORKRecorder *)recorderForStep:(ORKStep *)step {
-    return [[ORKDeviceMotionRecorder alloc] initWithIdentifier:self.identifier
-                                                     frequency:self.frequency
-                                                          step:step
-                                               outputDirectory:self.outputDirectory
-                                      rollingFileSizeThreshold:self.rollingFileSizeThreshold];
+    ORKDeviceMotionRecorder *recorder = [[ORKDeviceMotionRecorder alloc] initWithIdentifier:self.identifier
+                                                                                  frequency:self.frequency
+                                                                                       step:step
+                                                                            outputDirectory:self.outputDirectory
+                                                                   rollingFileSizeThreshold:self.rollingFileSizeThreshold];
+    recorder.analyzesGait = self.analyzesGait;
+    recorder.analyzesTremor = self.analyzesTremor;
+    return recorder;
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
     self = [super initWithCoder:aDecoder];
     if (self) {
         ORK_DECODE_DOUBLE(aDecoder, frequency);
+        ORK_DECODE_BOOL(aDecoder, analyzesGait);
+        ORK_DECODE_BOOL(aDecoder, analyzesTremor);
     }
     return self;
 }
@@ -226,6 +277,8 @@
 - (void)encodeWithCoder:(NSCoder *)aCoder {
     [super encodeWithCoder:aCoder];
     ORK_ENCODE_DOUBLE(aCoder, frequency);
+    ORK_ENCODE_BOOL(aCoder, analyzesGait);
+    ORK_ENCODE_BOOL(aCoder, analyzesTremor);
 }
 
 + (BOOL)supportsSecureCoding {
@@ -237,7 +290,9 @@
     
     __typeof(self) castObject = object;
     return (isParentSame &&
-            (self.frequency == castObject.frequency));
+            (self.frequency == castObject.frequency) &&
+            (self.analyzesGait == castObject.analyzesGait) &&
+            (self.analyzesTremor == castObject.analyzesTremor));
 }
 
 - (ORKPermissionMask)requestedPermissionMask {
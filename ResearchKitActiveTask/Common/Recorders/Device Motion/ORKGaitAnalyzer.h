@@ -0,0 +1,99 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKGaitSummaryResult;
+
+/**
+ One device motion sample, with accelerations in g in the device reference frame.
+ */
+typedef struct {
+    NSTimeInterval timestamp;
+    double userAcceleration[3];
+    double gravity[3];
+} ORKGaitSample;
+
+/**
+ Capacity of the queue between the recorder and the analysis, in samples.
+ */
+ORK_EXTERN const NSUInteger ORKGaitAnalyzerQueueCapacity;
+
+/**
+ Computes gait and balance measures incrementally from a stream of device motion samples.
+ 
+ Samples are handed over through a bounded single-producer, single-consumer queue that never
+ blocks the producer, and are analyzed on a private serial queue. Each sample is low-pass filtered
+ and split into its vertical component, along gravity, and its horizontal component. Steps are
+ peaks of the vertical acceleration above an adaptive threshold. Stride times, alternate step
+ times and sway are accumulated with running statistics, so memory use is bounded by the queue
+ capacity regardless of the recording length.
+ */
+@interface ORKGaitAnalyzer : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns an analyzer for samples delivered at the given rate.
+ 
+ @param sampleRate  The sample rate in hertz (Hz).
+ */
+- (instancetype)initWithSampleRate:(double)sampleRate NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) double sampleRate;
+
+/**
+ Adds a sample to the analysis queue without blocking.
+ 
+ Must only be called from one thread at a time.
+ 
+ @return `NO` if the queue was full and the sample was dropped.
+ */
+- (BOOL)enqueueSample:(ORKGaitSample)sample;
+
+/**
+ Analyzes the samples synchronously, after any samples that are already queued.
+ */
+- (void)processSamples:(const ORKGaitSample *)samples count:(NSUInteger)count;
+
+/**
+ Waits for every queued sample to be analyzed and returns a summary of the recording so far.
+ 
+ @param identifier  The identifier of the returned result.
+ */
+- (ORKGaitSummaryResult *)summaryResultWithIdentifier:(NSString *)identifier;
+
+@end
+
+NS_ASSUME_NONNULL_END
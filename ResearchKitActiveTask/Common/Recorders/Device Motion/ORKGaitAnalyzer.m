@@ -0,0 +1,288 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKGaitAnalyzer.h"
+
+#import "ORKGaitSummaryResult.h"
+
+#import "ORKHelpers_Internal.h"
+
+#include <stdatomic.h>
+
+
+const NSUInteger ORKGaitAnalyzerQueueCapacity = 1024;
+
+// Cut-off of the low-pass filter applied to the user acceleration.
+static const double ORKGaitFilterCutoffFrequency = 3.0;
+// Steps closer together than this are treated as a single step.
+static const NSTimeInterval ORKGaitMinimumStepInterval = 0.25;
+// Longer gaps between steps end a walking bout.
+static const NSTimeInterval ORKGaitMaximumStepInterval = 2.0;
+// Floor of the step detection threshold, in g, so standing still detects no steps.
+static const double ORKGaitMinimumStepThreshold = 0.05;
+// The threshold is this fraction of the running RMS of the vertical acceleration.
+static const double ORKGaitStepThresholdRatio = 0.5;
+// Time constant of the running RMS of the vertical acceleration.
+static const NSTimeInterval ORKGaitThresholdTimeConstant = 2.0;
+
+// Second-order Butterworth low-pass section in transposed direct form II.
+typedef struct {
+    double b0, b1, b2, a1, a2;
+    double z1, z2;
+} ORKGaitBiquad;
+
+static ORKGaitBiquad ORKGaitBiquadMakeLowPass(double cutoff, double sampleRate) {
+    double k = tan(M_PI * cutoff / sampleRate);
+    double norm = 1 / (1 + M_SQRT2 * k + k * k);
+    ORKGaitBiquad biquad = {0};
+    biquad.b0 = k * k * norm;
+    biquad.b1 = 2 * biquad.b0;
+    biquad.b2 = biquad.b0;
+    biquad.a1 = 2 * (k * k - 1) * norm;
+    biquad.a2 = (1 - M_SQRT2 * k + k * k) * norm;
+    return biquad;
+}
+
+static inline double ORKGaitBiquadProcess(ORKGaitBiquad *biquad, double x) {
+    double y = biquad->b0 * x + biquad->z1;
+    biquad->z1 = biquad->b1 * x - biquad->a1 * y + biquad->z2;
+    biquad->z2 = biquad->b2 * x - biquad->a2 * y;
+    return y;
+}
+
+// Welford running mean and variance.
+typedef struct {
+    NSUInteger count;
+    double mean;
+    double m2;
+} ORKGaitRunningStatistics;
+
+static inline void ORKGaitRunningStatisticsAdd(ORKGaitRunningStatistics *statistics, double value) {
+    statistics->count += 1;
+    double delta = value - statistics->mean;
+    statistics->mean += delta / statistics->count;
+    statistics->m2 += delta * (value - statistics->mean);
+}
+
+static inline double ORKGaitRunningStatisticsStandardDeviation(const ORKGaitRunningStatistics *statistics) {
+    return statistics->count > 1 ? sqrt(statistics->m2 / (statistics->count - 1)) : 0;
+}
+
+typedef struct {
+    ORKGaitBiquad filters[3];
+    double meanSquareVertical;
+    double thresholdSmoothing;
+    
+    // The two previous vertical accelerations; a step is detected when the middle one is a peak.
+    double previousVertical;
+    double secondPreviousVertical;
+    NSTimeInterval previousTimestamp;
+    NSUInteger processedCount;
+    
+    NSTimeInterval firstTimestamp;
+    NSTimeInterval lastTimestamp;
+    
+    NSInteger stepCount;
+    NSTimeInterval lastStepTimestamp;
+    NSTimeInterval previousStepInterval;
+    BOOL hasPreviousStepInterval;
+    NSUInteger boutStepIndex;
+    double stepIntervalSum;
+    NSUInteger stepIntervalCount;
+    
+    ORKGaitRunningStatistics strideTimes;
+    ORKGaitRunningStatistics alternateStepTimes[2];
+    
+    double horizontalSquareSum;
+} ORKGaitState;
+
+static void ORKGaitStateRecordStep(ORKGaitState *state, NSTimeInterval timestamp) {
+    if (state->stepCount > 0) {
+        NSTimeInterval interval = timestamp - state->lastStepTimestamp;
+        if (interval <= ORKGaitMaximumStepInterval) {
+            state->stepIntervalSum += interval;
+            state->stepIntervalCount += 1;
+            ORKGaitRunningStatisticsAdd(&state->alternateStepTimes[state->boutStepIndex % 2], interval);
+            state->boutStepIndex += 1;
+            if (state->hasPreviousStepInterval) {
+                ORKGaitRunningStatisticsAdd(&state->strideTimes, state->previousStepInterval + interval);
+            }
+            state->previousStepInterval = interval;
+            state->hasPreviousStepInterval = YES;
+        } else {
+            // A pause starts a new walking bout.
+            state->hasPreviousStepInterval = NO;
+            state->boutStepIndex = 0;
+        }
+    }
+    state->stepCount += 1;
+    state->lastStepTimestamp = timestamp;
+}
+
+static void ORKGaitStateProcessSample(ORKGaitState *state, const ORKGaitSample *sample) {
+    double acceleration[3];
+    for (int axis = 0; axis < 3; axis++) {
+        acceleration[axis] = ORKGaitBiquadProcess(&state->filters[axis], sample->userAcceleration[axis]);
+    }
+    
+    double gravityNorm = sqrt(sample->gravity[0] * sample->gravity[0] +
+                              sample->gravity[1] * sample->gravity[1] +
+                              sample->gravity[2] * sample->gravity[2]);
+    if (gravityNorm <= 0) {
+        return;
+    }
+    // Upwards is opposite to gravity.
+    double vertical = -(acceleration[0] * sample->gravity[0] +
+                        acceleration[1] * sample->gravity[1] +
+                        acceleration[2] * sample->gravity[2]) / gravityNorm;
+    double accelerationSquare = (acceleration[0] * acceleration[0] +
+                                 acceleration[1] * acceleration[1] +
+                                 acceleration[2] * acceleration[2]);
+    state->horizontalSquareSum += MAX(0, accelerationSquare - vertical * vertical);
+    
+    state->meanSquareVertical += state->thresholdSmoothing * (vertical * vertical - state->meanSquareVertical);
+    double threshold = MAX(ORKGaitMinimumStepThreshold, ORKGaitStepThresholdRatio * sqrt(state->meanSquareVertical));
+    
+    if (state->processedCount == 0) {
+        state->firstTimestamp = sample->timestamp;
+    }
+    if (state->processedCount >= 2 &&
+        state->previousVertical > state->secondPreviousVertical &&
+        state->previousVertical >= vertical &&
+        state->previousVertical > threshold &&
+        (state->stepCount == 0 || state->previousTimestamp - state->lastStepTimestamp >= ORKGaitMinimumStepInterval)) {
+        ORKGaitStateRecordStep(state, state->previousTimestamp);
+    }
+    
+    state->secondPreviousVertical = state->previousVertical;
+    state->previousVertical = vertical;
+    state->previousTimestamp = sample->timestamp;
+    state->lastTimestamp = sample->timestamp;
+    state->processedCount += 1;
+}
+
+
+@implementation ORKGaitAnalyzer {
+    dispatch_queue_t _analysisQueue;
+    ORKGaitState _state;
+    
+    ORKGaitSample *_ring;
+    _Atomic(uint64_t) _head;
+    _Atomic(uint64_t) _tail;
+    atomic_bool _drainScheduled;
+    _Atomic(NSInteger) _droppedSampleCount;
+}
+
+- (instancetype)initWithSampleRate:(double)sampleRate {
+    self = [super init];
+    if (self) {
+        _sampleRate = sampleRate > 0 ? sampleRate : 1;
+        _analysisQueue = dispatch_queue_create("org.researchkit.gait-analysis", DISPATCH_QUEUE_SERIAL);
+        _ring = calloc(ORKGaitAnalyzerQueueCapacity, sizeof(ORKGaitSample));
+        atomic_init(&_head, 0);
+        atomic_init(&_tail, 0);
+        atomic_init(&_drainScheduled, false);
+        atomic_init(&_droppedSampleCount, 0);
+        
+        double cutoff = MIN(ORKGaitFilterCutoffFrequency, 0.4 * _sampleRate);
+        for (int axis = 0; axis < 3; axis++) {
+            _state.filters[axis] = ORKGaitBiquadMakeLowPass(cutoff, _sampleRate);
+        }
+        _state.thresholdSmoothing = MIN(1.0, 1.0 / (ORKGaitThresholdTimeConstant * _sampleRate));
+    }
+    return self;
+}
+
+- (void)dealloc {
+    free(_ring);
+}
+
+- (BOOL)enqueueSample:(ORKGaitSample)sample {
+    uint64_t tail = atomic_load_explicit(&_tail, memory_order_relaxed);
+    uint64_t head = atomic_load_explicit(&_head, memory_order_acquire);
+    if (!_ring || tail - head >= ORKGaitAnalyzerQueueCapacity) {
+        atomic_fetch_add_explicit(&_droppedSampleCount, 1, memory_order_relaxed);
+        return NO;
+    }
+    _ring[tail % ORKGaitAnalyzerQueueCapacity] = sample;
+    atomic_store_explicit(&_tail, tail + 1, memory_order_release);
+    
+    if (!atomic_exchange(&_drainScheduled, true)) {
+        dispatch_async(_analysisQueue, ^{
+            atomic_store(&self->_drainScheduled, false);
+            [self drainQueue];
+        });
+    }
+    return YES;
+}
+
+// Must run on the analysis queue.
+- (void)drainQueue {
+    uint64_t head = atomic_load_explicit(&_head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&_tail, memory_order_acquire);
+    for (; head < tail; head++) {
+        ORKGaitStateProcessSample(&_state, &_ring[head % ORKGaitAnalyzerQueueCapacity]);
+    }
+    atomic_store_explicit(&_head, head, memory_order_release);
+}
+
+- (void)processSamples:(const ORKGaitSample *)samples count:(NSUInteger)count {
+    dispatch_sync(_analysisQueue, ^{
+        [self drainQueue];
+        for (NSUInteger index = 0; index < count; index++) {
+            ORKGaitStateProcessSample(&self->_state, &samples[index]);
+        }
+    });
+}
+
+- (ORKGaitSummaryResult *)summaryResultWithIdentifier:(NSString *)identifier {
+    ORKGaitSummaryResult *result = [[ORKGaitSummaryResult alloc] initWithIdentifier:identifier];
+    dispatch_sync(_analysisQueue, ^{
+        [self drainQueue];
+        const ORKGaitState *state = &self->_state;
+        
+        result.numberOfSteps = state->stepCount;
+        result.cadence = state->stepIntervalSum > 0 ? 60.0 * state->stepIntervalCount / state->stepIntervalSum : 0;
+        result.meanStrideTime = state->strideTimes.mean;
+        result.strideTimeVariability = state->strideTimes.mean > 0 ? ORKGaitRunningStatisticsStandardDeviation(&state->strideTimes) / state->strideTimes.mean : 0;
+        
+        const ORKGaitRunningStatistics *even = &state->alternateStepTimes[0];
+        const ORKGaitRunningStatistics *odd = &state->alternateStepTimes[1];
+        double meanStepTime = (even->mean + odd->mean) / 2;
+        result.stepTimeAsymmetry = (even->count > 0 && odd->count > 0 && meanStepTime > 0) ? fabs(even->mean - odd->mean) / meanStepTime : 0;
+        
+        result.swayRootMeanSquare = state->processedCount > 0 ? sqrt(state->horizontalSquareSum / state->processedCount) : 0;
+        result.analyzedDuration = state->processedCount > 0 ? state->lastTimestamp - state->firstTimestamp : 0;
+    });
+    result.droppedSampleCount = atomic_load(&_droppedSampleCount);
+    return result;
+}
+
+@end
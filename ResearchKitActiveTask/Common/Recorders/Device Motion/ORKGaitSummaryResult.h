@@ -0,0 +1,92 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKResult.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The `ORKGaitSummaryResult` class records gait and balance measures computed on device from a
+ device motion recording.
+ 
+ A device motion recorder whose `analyzesGait` property is `YES` adds this result next to its file
+ results, using the same identifier. Step times are measured between peaks of the vertical
+ acceleration, so alternate steps are attributed to alternate feet.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKGaitSummaryResult : ORKResult
+
+/**
+ The number of steps detected.
+ */
+@property (nonatomic, assign) NSInteger numberOfSteps;
+
+/**
+ The walking cadence in steps per minute, excluding pauses between walking bouts.
+ */
+@property (nonatomic, assign) double cadence;
+
+/**
+ The mean time between two steps of the same foot.
+ */
+@property (nonatomic, assign) NSTimeInterval meanStrideTime;
+
+/**
+ The coefficient of variation of the stride time.
+ */
+@property (nonatomic, assign) double strideTimeVariability;
+
+/**
+ The difference between the mean step times of alternate steps, relative to the mean step time.
+ 
+ A value of 0 indicates a symmetric gait.
+ */
+@property (nonatomic, assign) double stepTimeAsymmetry;
+
+/**
+ The root mean square of the horizontal acceleration, in g.
+ */
+@property (nonatomic, assign) double swayRootMeanSquare;
+
+/**
+ The time spanned by the analyzed samples.
+ */
+@property (nonatomic, assign) NSTimeInterval analyzedDuration;
+
+/**
+ The number of samples that could not be analyzed because the analysis fell behind the recording.
+ */
+@property (nonatomic, assign) NSInteger droppedSampleCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,106 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKGaitSummaryResult.h"
+
+#import "ORKResult_Private.h"
+#import "ORKHelpers_Internal.h"
+
+
+@implementation ORKGaitSummaryResult
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    [super encodeWithCoder:aCoder];
+    ORK_ENCODE_INTEGER(aCoder, numberOfSteps);
+    ORK_ENCODE_DOUBLE(aCoder, cadence);
+    ORK_ENCODE_DOUBLE(aCoder, meanStrideTime);
+    ORK_ENCODE_DOUBLE(aCoder, strideTimeVariability);
+    ORK_ENCODE_DOUBLE(aCoder, stepTimeAsymmetry);
+    ORK_ENCODE_DOUBLE(aCoder, swayRootMeanSquare);
+    ORK_ENCODE_DOUBLE(aCoder, analyzedDuration);
+    ORK_ENCODE_INTEGER(aCoder, droppedSampleCount);
+}
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+    self = [super initWithCoder:aDecoder];
+    if (self) {
+        ORK_DECODE_INTEGER(aDecoder, numberOfSteps);
+        ORK_DECODE_DOUBLE(aDecoder, cadence);
+        ORK_DECODE_DOUBLE(aDecoder, meanStrideTime);
+        ORK_DECODE_DOUBLE(aDecoder, strideTimeVariability);
+        ORK_DECODE_DOUBLE(aDecoder, stepTimeAsymmetry);
+        ORK_DECODE_DOUBLE(aDecoder, swayRootMeanSquare);
+        ORK_DECODE_DOUBLE(aDecoder, analyzedDuration);
+        ORK_DECODE_INTEGER(aDecoder, droppedSampleCount);
+    }
+    return self;
+}
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (BOOL)isEqual:(id)object {
+    BOOL isParentSame = [super isEqual:object];
+    
+    __typeof(self) castObject = object;
+    return (isParentSame &&
+            (self.numberOfSteps == castObject.numberOfSteps) &&
+            (self.cadence == castObject.cadence) &&
+            (self.meanStrideTime == castObject.meanStrideTime) &&
+            (self.strideTimeVariability == castObject.strideTimeVariability) &&
+            (self.stepTimeAsymmetry == castObject.stepTimeAsymmetry) &&
+            (self.swayRootMeanSquare == castObject.swayRootMeanSquare) &&
+            (self.analyzedDuration == castObject.analyzedDuration) &&
+            (self.droppedSampleCount == castObject.droppedSampleCount));
+}
+
+- (NSUInteger)hash {
+    return super.hash ^ (NSUInteger)self.numberOfSteps;
+}
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+    ORKGaitSummaryResult *result = [super copyWithZone:zone];
+    result.numberOfSteps = self.numberOfSteps;
+    result.cadence = self.cadence;
+    result.meanStrideTime = self.meanStrideTime;
+    result.strideTimeVariability = self.strideTimeVariability;
+    result.stepTimeAsymmetry = self.stepTimeAsymmetry;
+    result.swayRootMeanSquare = self.swayRootMeanSquare;
+    result.analyzedDuration = self.analyzedDuration;
+    result.droppedSampleCount = self.droppedSampleCount;
+    return result;
+}
+
+- (NSString *)descriptionWithNumberOfPaddingSpaces:(NSUInteger)numberOfPaddingSpaces {
+    return [NSString stringWithFormat:@"%@; steps: %@; cadence: %@; stride time: %@; stride variability: %@; step asymmetry: %@; sway: %@; duration: %@; dropped: %@%@", [self descriptionPrefixWithNumberOfPaddingSpaces:numberOfPaddingSpaces], @(self.numberOfSteps), @(self.cadence), @(self.meanStrideTime), @(self.strideTimeVariability), @(self.stepTimeAsymmetry), @(self.swayRootMeanSquare), @(self.analyzedDuration), @(self.droppedSampleCount), self.descriptionSuffix];
+}
+
+@end
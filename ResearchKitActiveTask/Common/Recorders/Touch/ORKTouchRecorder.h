@@ -52,6 +52,17 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, strong, readonly, nullable) UIView *touchView;
 
+/**
+ A Boolean value indicating whether intermediate coalesced touches are recorded in addition to
+ the touches delivered to the gesture recognizer. The default value is `NO`.
+ */
+@property (nonatomic, assign) BOOL recordsCoalescedTouches;
+
+/**
+ A Boolean value indicating whether predicted touches are recorded. The default value is `NO`.
+ */
+@property (nonatomic, assign) BOOL recordsPredictedTouches;
+
 /**
  Returns an initialized pedometer recorder.
  
@@ -124,6 +135,18 @@ ORK_CLASS_AVAILABLE
  */
 - (instancetype)initWithCoder:(NSCoder *)aDecoder NS_DESIGNATED_INITIALIZER;
 
+/**
+ A Boolean value indicating whether intermediate coalesced touches are recorded. Coalesced
+ samples carry a `type` of `coalesced` in the output. The default value is `NO`.
+ */
+@property (nonatomic, assign) BOOL recordsCoalescedTouches;
+
+/**
+ A Boolean value indicating whether predicted touches are recorded. Predicted samples carry a
+ `type` of `predicted` in the output. The default value is `NO`.
+ */
+@property (nonatomic, assign) BOOL recordsPredictedTouches;
+
 @end
 
 NS_ASSUME_NONNULL_END
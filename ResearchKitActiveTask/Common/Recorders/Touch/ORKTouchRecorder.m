@@ -35,12 +35,13 @@
 
 #import "ORKRecorder_Internal.h"
 
-#import "UITouch+ORKJSONDictionary.h"
+#import "ORKHelpers_Internal.h"
+#import "ORKTouchSampleCapture.h"
 
 
 @protocol ORKTouchRecordingDelegate <NSObject>
 
-- (void)view:(UIView *)view didDetectTouch:(UITouch *)touch;
+- (void)view:(UIView *)view didDetectTouch:(UITouch *)touch withEvent:(nullable UIEvent *)event;
 
 @end
 
@@ -54,27 +55,27 @@
 
 @implementation ORKTouchGestureRecognizer
 
-- (void)reportTouches:(NSSet *)touches {
+- (void)reportTouches:(NSSet *)touches withEvent:(UIEvent *)event {
     
     for (UITouch *touch in touches) {
-        [self.eventDelegate view:self.view didDetectTouch:touch];
+        [self.eventDelegate view:self.view didDetectTouch:touch withEvent:event];
     }
 }
 
 - (void)touchesBegan:(NSSet *)touches withEvent:(UIEvent *)event {
-    [self reportTouches:touches];
+    [self reportTouches:touches withEvent:event];
 }
 
 - (void)touchesMoved:(NSSet *)touches withEvent:(UIEvent *)event {
-    [self reportTouches:touches];
+    [self reportTouches:touches withEvent:event];
 }
 
 - (void)touchesEnded:(NSSet *)touches withEvent:(UIEvent *)event {
-    [self reportTouches:touches];
+    [self reportTouches:touches withEvent:event];
 }
 
 - (void)touchesCancelled:(NSSet *)touches withEvent:(UIEvent *)event {
-    [self reportTouches:touches];
+    [self reportTouches:touches withEvent:event];
 }
 
 @end
@@ -89,12 +90,11 @@
 
 @interface ORKTouchRecorder () <ORKTouchRecordingDelegate> {
     ORKDataLogger *_logger;
+    ORKTouchSampleCapture *_capture;
 }
 
 @property (nonatomic, strong) ORKTouchGestureRecognizer *gestureRecognizer;
 
-@property (nonatomic, strong) NSMutableArray *touchArray;
-
 @property (nonatomic) NSTimeInterval uptime;
 
 @property (nonatomic, strong) NSError *recordingError;
@@ -133,14 +133,17 @@
             [self finishRecordingWithError:error];
             return;
         }
+        _capture = [[ORKTouchSampleCapture alloc] initWithSink:[[ORKTouchJSONSampleSink alloc] initWithDataLogger:_logger]];
     }
+    _capture.capturesCoalescedTouches = _recordsCoalescedTouches;
+    _capture.capturesPredictedTouches = _recordsPredictedTouches;
+    [_capture reset];
     
     if (self.touchView) {
         [self.touchView addGestureRecognizer:self.gestureRecognizer];
         
         [super start];
         
-        self.touchArray = [NSMutableArray array];
         _uptime = [NSProcessInfo processInfo].systemUptime;
     } else {
         @throw [NSException exceptionWithName:NSGenericException
@@ -159,9 +162,14 @@
 
 - (void)stop {
     [self doStopRecording];
-    [_logger finishCurrentLog];
     
     NSError *error = nil;
+    if (![_capture flushWithError:&error]) {
+        ORK_Log_Error("Failed to write touch samples: %@", error);
+        error = nil;
+    }
+    [_logger finishCurrentLog];
+    
     __block NSMutableArray<NSURL *> *fileUrls = [[NSMutableArray alloc] init];
     [_logger enumerateLogs:^(NSURL *logFileUrl, BOOL *stop) {
         [fileUrls addObject:logFileUrl];
@@ -197,18 +205,14 @@
     [super reset];
     
     _logger = nil;
+    _capture = nil;
 }
 
 #pragma mark - ORKTouchRecordingDelegate
 
-- (void)view:(UIView *)view didDetectTouch:(UITouch *)touch {
-    
-    if ([self.touchArray containsObject:touch] == NO) {
-        [self.touchArray addObject:touch];
-    }
-    
+- (void)view:(UIView *)view didDetectTouch:(UITouch *)touch withEvent:(UIEvent *)event {
     NSError *error = nil;
-    if (![_logger append:[touch ork_JSONDictionaryInView:view allTouches:self.touchArray] error:&error]) {
+    if (![_capture captureTouch:touch withEvent:event inView:view error:&error]) {
         assert(error != nil);
         [self finishRecordingWithError:error];
     }
@@ -236,16 +240,38 @@
                                                                          step:step
                                                               outputDirectory:self.outputDirectory
                                                      rollingFileSizeThreshold:self.rollingFileSizeThreshold];
+    recorder.recordsCoalescedTouches = self.recordsCoalescedTouches;
+    recorder.recordsPredictedTouches = self.recordsPredictedTouches;
     return recorder;
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
-    return [super initWithCoder:aDecoder];
+    self = [super initWithCoder:aDecoder];
+    if (self) {
+        ORK_DECODE_BOOL(aDecoder, recordsCoalescedTouches);
+        ORK_DECODE_BOOL(aDecoder, recordsPredictedTouches);
+    }
+    return self;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    [super encodeWithCoder:aCoder];
+    ORK_ENCODE_BOOL(aCoder, recordsCoalescedTouches);
+    ORK_ENCODE_BOOL(aCoder, recordsPredictedTouches);
 }
 
 + (BOOL)supportsSecureCoding {
     return YES;
 }
 
+- (BOOL)isEqual:(id)object {
+    BOOL isParentSame = [super isEqual:object];
+    
+    __typeof(self) castObject = object;
+    return (isParentSame &&
+            (self.recordsCoalescedTouches == castObject.recordsCoalescedTouches) &&
+            (self.recordsPredictedTouches == castObject.recordsPredictedTouches));
+}
+
 @end
 
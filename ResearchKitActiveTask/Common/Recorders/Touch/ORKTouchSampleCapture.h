@@ -0,0 +1,136 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+@import UIKit;
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKDataLogger;
+
+typedef NS_ENUM(uint8_t, ORKTouchSampleKind) {
+    /// A touch delivered by the gesture recognizer.
+    ORKTouchSampleKindActual = 0,
+    
+    /// An intermediate touch reported through `-[UIEvent coalescedTouchesForTouch:]`.
+    ORKTouchSampleKindCoalesced,
+    
+    /// A touch reported through `-[UIEvent predictedTouchesForTouch:]`.
+    ORKTouchSampleKindPredicted
+};
+
+/**
+ A single captured touch sample. `index` is a stable identifier, assigned in order of first
+ appearance, for the touch sequence the sample belongs to.
+ */
+typedef struct {
+    NSTimeInterval timestamp;
+    CGPoint location;
+    uint32_t index;
+    int8_t phase;
+    ORKTouchSampleKind kind;
+} ORKTouchSample;
+
+/**
+ Receives batches of captured touch samples.
+ */
+@protocol ORKTouchSampleSink <NSObject>
+
+- (BOOL)writeSamples:(const ORKTouchSample *)samples
+               count:(NSUInteger)count
+            viewSize:(CGSize)viewSize
+               error:(NSError * _Nullable *)error;
+
+@end
+
+/**
+ Writes samples to a JSON data logger, encoding each sample directly to UTF-8 rather than
+ building an intermediate dictionary. Actual touches use the same keys as earlier versions of
+ the touch recorder; coalesced and predicted touches carry an additional `type` key.
+ */
+@interface ORKTouchJSONSampleSink : NSObject <ORKTouchSampleSink>
+
+- (instancetype)initWithDataLogger:(ORKDataLogger *)dataLogger NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
++ (NSData *)JSONDataForSample:(const ORKTouchSample *)sample viewSize:(CGSize)viewSize;
+
+@end
+
+/**
+ Captures touches into fixed-size batches with constant cost per touch.
+ 
+ Each live `UITouch` is mapped to a stable index through a hash table that does not retain the
+ touch, and is evicted when the touch ends or is cancelled. Samples are buffered and handed to
+ the sink when the buffer fills, when the last live touch ends, or on `flushWithError:`.
+ */
+@interface ORKTouchSampleCapture : NSObject
+
+- (instancetype)initWithSink:(id<ORKTouchSampleSink>)sink NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+/**
+ Whether coalesced touches are recorded in addition to the delivered touch. The default is `NO`.
+ */
+@property (nonatomic, assign) BOOL capturesCoalescedTouches;
+
+/**
+ Whether predicted touches are recorded. The default is `NO`.
+ */
+@property (nonatomic, assign) BOOL capturesPredictedTouches;
+
+/**
+ The number of touches currently being tracked.
+ */
+@property (nonatomic, readonly) NSUInteger liveTouchCount;
+
+/**
+ The number of distinct touches seen since the last reset.
+ */
+@property (nonatomic, readonly) NSUInteger touchCount;
+
+- (BOOL)captureTouch:(UITouch *)touch
+           withEvent:(nullable UIEvent *)event
+              inView:(UIView *)view
+               error:(NSError * _Nullable *)error;
+
+- (BOOL)flushWithError:(NSError * _Nullable *)error;
+
+/**
+ Discards buffered samples and forgets all touches.
+ */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,206 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKTouchSampleCapture.h"
+
+#import "ORKDataLogger.h"
+
+#import "ORKHelpers_Internal.h"
+
+#define ORKTouchSampleBatchCapacity 64
+
+@implementation ORKTouchJSONSampleSink {
+    ORKDataLogger *_dataLogger;
+}
+
+- (instancetype)initWithDataLogger:(ORKDataLogger *)dataLogger {
+    ORKThrowInvalidArgumentExceptionIfNil(dataLogger);
+    self = [super init];
+    if (self) {
+        _dataLogger = dataLogger;
+    }
+    return self;
+}
+
++ (NSData *)JSONDataForSample:(const ORKTouchSample *)sample viewSize:(CGSize)viewSize {
+    char buffer[256];
+    const char *type = NULL;
+    switch (sample->kind) {
+        case ORKTouchSampleKindCoalesced:
+            type = ",\"type\":\"coalesced\"";
+            break;
+        case ORKTouchSampleKindPredicted:
+            type = ",\"type\":\"predicted\"";
+            break;
+        case ORKTouchSampleKindActual:
+            type = "";
+            break;
+    }
+    int length = snprintf(buffer, sizeof(buffer),
+                          "{\"timestamp\":%.17g,\"phase\":%d,\"index\":%u,\"x\":%.10g,\"y\":%.10g,\"width\":%.10g,\"height\":%.10g%s}",
+                          sample->timestamp,
+                          (int)sample->phase,
+                          sample->index,
+                          (double)sample->location.x,
+                          (double)sample->location.y,
+                          (double)viewSize.width,
+                          (double)viewSize.height,
+                          type);
+    return [NSData dataWithBytes:buffer length:(NSUInteger)MIN(MAX(length, 0), (int)sizeof(buffer) - 1)];
+}
+
+- (BOOL)writeSamples:(const ORKTouchSample *)samples count:(NSUInteger)count viewSize:(CGSize)viewSize error:(NSError **)error {
+    if (count == 0) {
+        return YES;
+    }
+    NSMutableArray<NSData *> *objects = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger index = 0; index < count; index++) {
+        [objects addObject:[ORKTouchJSONSampleSink JSONDataForSample:&samples[index] viewSize:viewSize]];
+    }
+    return [_dataLogger appendObjects:objects error:error];
+}
+
+@end
+
+
+@implementation ORKTouchSampleCapture {
+    id<ORKTouchSampleSink> _sink;
+    // UITouch pointer -> index + 1. Keys are not retained; entries are removed when touches end.
+    CFMutableDictionaryRef _liveTouches;
+    uint32_t _nextIndex;
+    ORKTouchSample _batch[ORKTouchSampleBatchCapacity];
+    NSUInteger _batchCount;
+    CGSize _batchViewSize;
+}
+
+- (instancetype)initWithSink:(id<ORKTouchSampleSink>)sink {
+    ORKThrowInvalidArgumentExceptionIfNil(sink);
+    self = [super init];
+    if (self) {
+        _sink = sink;
+        _liveTouches = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    CFRelease(_liveTouches);
+}
+
+- (NSUInteger)liveTouchCount {
+    return (NSUInteger)CFDictionaryGetCount(_liveTouches);
+}
+
+- (NSUInteger)touchCount {
+    return _nextIndex;
+}
+
+- (void)reset {
+    CFDictionaryRemoveAllValues(_liveTouches);
+    _nextIndex = 0;
+    _batchCount = 0;
+}
+
+- (uint32_t)indexForTouch:(UITouch *)touch {
+    const void *key = (__bridge const void *)touch;
+    uintptr_t value = (uintptr_t)CFDictionaryGetValue(_liveTouches, key);
+    if (value == 0) {
+        value = (uintptr_t)(++_nextIndex);
+        CFDictionarySetValue(_liveTouches, key, (const void *)value);
+    }
+    return (uint32_t)(value - 1);
+}
+
+- (BOOL)appendTouch:(UITouch *)touch index:(uint32_t)index kind:(ORKTouchSampleKind)kind inView:(UIView *)view error:(NSError **)error {
+    CGSize viewSize = view.bounds.size;
+    if (_batchCount > 0 && !CGSizeEqualToSize(viewSize, _batchViewSize)) {
+        if (![self flushWithError:error]) {
+            return NO;
+        }
+    }
+    if (_batchCount == ORKTouchSampleBatchCapacity && ![self flushWithError:error]) {
+        return NO;
+    }
+    
+    _batchViewSize = viewSize;
+    _batch[_batchCount++] = (ORKTouchSample){
+        .timestamp = touch.timestamp,
+        .location = [touch locationInView:view],
+        .index = index,
+        .phase = (int8_t)touch.phase,
+        .kind = kind
+    };
+    return YES;
+}
+
+- (BOOL)captureTouch:(UITouch *)touch withEvent:(UIEvent *)event inView:(UIView *)view error:(NSError **)error {
+    uint32_t index = [self indexForTouch:touch];
+    
+    if (_capturesCoalescedTouches && event) {
+        // The last coalesced touch is the delivered touch itself.
+        NSArray<UITouch *> *coalescedTouches = [event coalescedTouchesForTouch:touch];
+        for (NSUInteger coalescedIndex = 0; coalescedIndex + 1 < coalescedTouches.count; coalescedIndex++) {
+            if (![self appendTouch:coalescedTouches[coalescedIndex] index:index kind:ORKTouchSampleKindCoalesced inView:view error:error]) {
+                return NO;
+            }
+        }
+    }
+    
+    if (![self appendTouch:touch index:index kind:ORKTouchSampleKindActual inView:view error:error]) {
+        return NO;
+    }
+    
+    if (_capturesPredictedTouches && event) {
+        for (UITouch *predictedTouch in [event predictedTouchesForTouch:touch]) {
+            if (![self appendTouch:predictedTouch index:index kind:ORKTouchSampleKindPredicted inView:view error:error]) {
+                return NO;
+            }
+        }
+    }
+    
+    if (touch.phase == UITouchPhaseEnded || touch.phase == UITouchPhaseCancelled) {
+        CFDictionaryRemoveValue(_liveTouches, (__bridge const void *)touch);
+        if (CFDictionaryGetCount(_liveTouches) == 0) {
+            return [self flushWithError:error];
+        }
+    }
+    return YES;
+}
+
+- (BOOL)flushWithError:(NSError **)error {
+    if (_batchCount == 0) {
+        return YES;
+    }
+    NSUInteger count = _batchCount;
+    _batchCount = 0;
+    return [_sink writeSamples:_batch count:count viewSize:_batchViewSize error:error];
+}
+
+@end
@@ -0,0 +1,105 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+// CBOR (RFC 8949) constants shared by the writer and the decoder.
+
+typedef NS_ENUM(uint8_t, ORKCBORMajorType) {
+    ORKCBORMajorTypeUnsignedInteger = 0,
+    ORKCBORMajorTypeNegativeInteger = 1,
+    ORKCBORMajorTypeByteString = 2,
+    ORKCBORMajorTypeTextString = 3,
+    ORKCBORMajorTypeArray = 4,
+    ORKCBORMajorTypeMap = 5,
+    ORKCBORMajorTypeTag = 6,
+    ORKCBORMajorTypeSimple = 7,
+};
+
+enum {
+    ORKCBORAdditionalInfo1Byte = 24,
+    ORKCBORAdditionalInfo2Bytes = 25,
+    ORKCBORAdditionalInfo4Bytes = 26,
+    ORKCBORAdditionalInfo8Bytes = 27,
+    ORKCBORAdditionalInfoIndefinite = 31,
+};
+
+enum {
+    ORKCBORSimpleValueFalse = 0xF4,
+    ORKCBORSimpleValueTrue = 0xF5,
+    ORKCBORSimpleValueNull = 0xF6,
+    ORKCBORFloat16 = 0xF9,
+    ORKCBORFloat32 = 0xFA,
+    ORKCBORFloat64 = 0xFB,
+    ORKCBORBreak = 0xFF,
+};
+
+// Self-described CBOR, and the RFC 8746 typed array tags.
+enum {
+    ORKCBORTagSelfDescribed = 55799,
+    ORKCBORTagUInt8Array = 64,
+    ORKCBORTagUInt8ClampedArray = 68,
+    ORKCBORTagSInt8Array = 72,
+    ORKCBORTagSInt16LittleEndianArray = 77,
+    ORKCBORTagSInt32LittleEndianArray = 78,
+    ORKCBORTagSInt64LittleEndianArray = 79,
+    ORKCBORTagFloat32LittleEndianArray = 85,
+    ORKCBORTagFloat64LittleEndianArray = 86,
+};
+
+static inline uint32_t ORKCBORBitsFromFloat(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline uint64_t ORKCBORBitsFromDouble(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline float ORKCBORFloatFromBits(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline double ORKCBORDoubleFromBits(uint64_t bits) {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,400 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKCBORDecoder.h"
+
+#import "ORKCBOR.h"
+
+#import "ORKErrors.h"
+#import "ORKHelpers_Internal.h"
+
+#include <math.h>
+
+
+// Deeper nesting than any serialized task or result, low enough to keep recursion off the stack limit.
+static const NSUInteger ORKCBORDecoderMaximumDepth = 512;
+
+static double ORKCBORDoubleFromHalf(uint16_t half) {
+    int exponent = (half >> 10) & 0x1F;
+    int mantissa = half & 0x3FF;
+    double value;
+    if (exponent == 0) {
+        value = ldexp(mantissa, -24);
+    } else if (exponent != 31) {
+        value = ldexp(mantissa + 1024, exponent - 25);
+    } else {
+        value = (mantissa == 0) ? INFINITY : NAN;
+    }
+    return (half & 0x8000) ? -value : value;
+}
+
+@implementation ORKCBORDecoder {
+    const uint8_t *_bytes;
+    NSUInteger _length;
+    NSUInteger _offset;
+    NSString *_failureDescription;
+}
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithData:(NSData *)data {
+    self = [super init];
+    if (self) {
+        _bytes = data.bytes;
+        _length = data.length;
+    }
+    return self;
+}
+
++ (id)JSONObjectWithData:(NSData *)data error:(NSError * __autoreleasing *)error {
+    ORKCBORDecoder *decoder = [[ORKCBORDecoder alloc] initWithData:data];
+    id object = [decoder readValueWithDepth:0];
+    if (object != nil && decoder->_offset != decoder->_length) {
+        object = [decoder failWithDescription:@"Unexpected data after the CBOR value"];
+    }
+    if (object == nil && error != NULL) {
+        *error = [NSError errorWithDomain:ORKErrorDomain
+                                     code:ORKErrorInvalidObject
+                                 userInfo:@{NSDebugDescriptionErrorKey: [NSString stringWithFormat:@"%@ (offset %lu)", decoder->_failureDescription, (unsigned long)decoder->_offset]}];
+    }
+    return object;
+}
+
+- (id)failWithDescription:(NSString *)description {
+    if (_failureDescription == nil) {
+        _failureDescription = description;
+    }
+    return nil;
+}
+
+#pragma mark - Bytes
+
+- (BOOL)readBytes:(void *)bytes length:(NSUInteger)length {
+    if (length > _length - _offset) {
+        [self failWithDescription:@"Unexpected end of CBOR data"];
+        return NO;
+    }
+    memcpy(bytes, _bytes + _offset, length);
+    _offset += length;
+    return YES;
+}
+
+- (BOOL)peekBreak {
+    return (_offset < _length && _bytes[_offset] == ORKCBORBreak);
+}
+
+- (BOOL)readArgument:(uint64_t *)argument additionalInfo:(uint8_t)additionalInfo {
+    if (additionalInfo < ORKCBORAdditionalInfo1Byte) {
+        *argument = additionalInfo;
+        return YES;
+    }
+    uint8_t bytes[8];
+    switch (additionalInfo) {
+        case ORKCBORAdditionalInfo1Byte:
+            if (![self readBytes:bytes length:1]) {
+                return NO;
+            }
+            *argument = bytes[0];
+            return YES;
+        case ORKCBORAdditionalInfo2Bytes:
+            if (![self readBytes:bytes length:2]) {
+                return NO;
+            }
+            *argument = OSReadBigInt16(bytes, 0);
+            return YES;
+        case ORKCBORAdditionalInfo4Bytes:
+            if (![self readBytes:bytes length:4]) {
+                return NO;
+            }
+            *argument = OSReadBigInt32(bytes, 0);
+            return YES;
+        case ORKCBORAdditionalInfo8Bytes:
+            if (![self readBytes:bytes length:8]) {
+                return NO;
+            }
+            *argument = OSReadBigInt64(bytes, 0);
+            return YES;
+        default:
+            [self failWithDescription:@"Invalid CBOR additional information"];
+            return NO;
+    }
+}
+
+#pragma mark - Values
+
+- (id)readValueWithDepth:(NSUInteger)depth {
+    if (depth > ORKCBORDecoderMaximumDepth) {
+        return [self failWithDescription:@"CBOR data is nested too deeply"];
+    }
+    
+    uint8_t initialByte;
+    if (![self readBytes:&initialByte length:1]) {
+        return nil;
+    }
+    ORKCBORMajorType majorType = (ORKCBORMajorType)(initialByte >> 5);
+    uint8_t additionalInfo = initialByte & 0x1F;
+    
+    if (majorType == ORKCBORMajorTypeSimple) {
+        return [self readSimpleValueWithInitialByte:initialByte];
+    }
+    if (additionalInfo == ORKCBORAdditionalInfoIndefinite) {
+        switch (majorType) {
+            case ORKCBORMajorTypeTextString:
+                return [self readIndefiniteTextString];
+            case ORKCBORMajorTypeArray:
+                return [self readArrayWithCount:NSUIntegerMax depth:depth];
+            case ORKCBORMajorTypeMap:
+                return [self readMapWithCount:NSUIntegerMax depth:depth];
+            default:
+                return [self failWithDescription:@"Unsupported indefinite-length CBOR item"];
+        }
+    }
+    
+    uint64_t argument;
+    if (![self readArgument:&argument additionalInfo:additionalInfo]) {
+        return nil;
+    }
+    switch (majorType) {
+        case ORKCBORMajorTypeUnsignedInteger:
+            return (argument <= LLONG_MAX) ? @((long long)argument) : @(argument);
+        case ORKCBORMajorTypeNegativeInteger:
+            if (argument > LLONG_MAX) {
+                return [self failWithDescription:@"Negative CBOR integer out of range"];
+            }
+            return @(-1 - (long long)argument);
+        case ORKCBORMajorTypeByteString:
+            return [self failWithDescription:@"CBOR byte strings are only supported in typed arrays"];
+        case ORKCBORMajorTypeTextString:
+            return [self readTextStringWithLength:argument];
+        case ORKCBORMajorTypeArray:
+        case ORKCBORMajorTypeMap: {
+            // Every item takes at least one byte, which bounds the capacity reserved for it.
+            if (argument > _length - _offset) {
+                return [self failWithDescription:@"Unexpected end of CBOR data"];
+            }
+            return (majorType == ORKCBORMajorTypeArray) ? [self readArrayWithCount:(NSUInteger)argument depth:depth] : [self readMapWithCount:(NSUInteger)argument depth:depth];
+        }
+        case ORKCBORMajorTypeTag:
+            if (argument == ORKCBORTagSelfDescribed) {
+                return [self readValueWithDepth:depth + 1];
+            }
+            if (argument >= ORKCBORTagUInt8Array && argument <= ORKCBORTagUInt8Array + 23) {
+                return [self readTypedArrayWithTag:argument];
+            }
+            return [self failWithDescription:[NSString stringWithFormat:@"Unsupported CBOR tag %llu", argument]];
+        case ORKCBORMajorTypeSimple:
+            break;
+    }
+    return [self failWithDescription:@"Invalid CBOR item"];
+}
+
+- (id)readSimpleValueWithInitialByte:(uint8_t)initialByte {
+    uint8_t bytes[8];
+    double value;
+    switch (initialByte) {
+        case ORKCBORSimpleValueFalse:
+            return @NO;
+        case ORKCBORSimpleValueTrue:
+            return @YES;
+        case ORKCBORSimpleValueNull:
+            return [NSNull null];
+        case ORKCBORFloat16:
+            if (![self readBytes:bytes length:2]) {
+                return nil;
+            }
+            value = ORKCBORDoubleFromHalf(OSReadBigInt16(bytes, 0));
+            break;
+        case ORKCBORFloat32:
+            if (![self readBytes:bytes length:4]) {
+                return nil;
+            }
+            value = ORKCBORFloatFromBits(OSReadBigInt32(bytes, 0));
+            break;
+        case ORKCBORFloat64:
+            if (![self readBytes:bytes length:8]) {
+                return nil;
+            }
+            value = ORKCBORDoubleFromBits(OSReadBigInt64(bytes, 0));
+            break;
+        case ORKCBORBreak:
+            return [self failWithDescription:@"Unexpected CBOR break"];
+        default:
+            return [self failWithDescription:@"Unsupported CBOR simple value"];
+    }
+    if (!isfinite(value)) {
+        return [self failWithDescription:@"Non-finite CBOR number"];
+    }
+    return @(value);
+}
+
+- (NSString *)readTextStringWithLength:(uint64_t)length {
+    if (length > _length - _offset) {
+        return [self failWithDescription:@"Unexpected end of CBOR data"];
+    }
+    NSString *string = [[NSString alloc] initWithBytes:_bytes + _offset length:(NSUInteger)length encoding:NSUTF8StringEncoding];
+    if (string == nil) {
+        return [self failWithDescription:@"Invalid UTF-8 in CBOR text string"];
+    }
+    _offset += (NSUInteger)length;
+    return string;
+}
+
+- (NSString *)readIndefiniteTextString {
+    NSMutableString *string = [NSMutableString string];
+    while (![self peekBreak]) {
+        uint8_t initialByte;
+        uint64_t length;
+        if (![self readBytes:&initialByte length:1]) {
+            return nil;
+        }
+        if ((initialByte >> 5) != ORKCBORMajorTypeTextString || (initialByte & 0x1F) == ORKCBORAdditionalInfoIndefinite) {
+            return [self failWithDescription:@"Invalid chunk in indefinite-length CBOR text string"];
+        }
+        if (![self readArgument:&length additionalInfo:initialByte & 0x1F]) {
+            return nil;
+        }
+        NSString *chunk = [self readTextStringWithLength:length];
+        if (chunk == nil) {
+            return nil;
+        }
+        [string appendString:chunk];
+    }
+    _offset += 1;
+    return [string copy];
+}
+
+// A count of NSUIntegerMax reads an indefinite-length array up to its break.
+- (NSArray *)readArrayWithCount:(NSUInteger)count depth:(NSUInteger)depth {
+    BOOL indefinite = (count == NSUIntegerMax);
+    NSMutableArray *array = [NSMutableArray arrayWithCapacity:indefinite ? 0 : count];
+    for (NSUInteger index = 0; indefinite || index < count; index++) {
+        if (indefinite && [self peekBreak]) {
+            _offset += 1;
+            break;
+        }
+        id element = [self readValueWithDepth:depth + 1];
+        if (element == nil) {
+            return nil;
+        }
+        [array addObject:element];
+    }
+    return array;
+}
+
+- (NSDictionary *)readMapWithCount:(NSUInteger)count depth:(NSUInteger)depth {
+    BOOL indefinite = (count == NSUIntegerMax);
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:indefinite ? 0 : count];
+    for (NSUInteger index = 0; indefinite || index < count; index++) {
+        if (indefinite && [self peekBreak]) {
+            _offset += 1;
+            break;
+        }
+        id key = [self readValueWithDepth:depth + 1];
+        if (key == nil) {
+            return nil;
+        }
+        if (![key isKindOfClass:[NSString class]]) {
+            return [self failWithDescription:@"CBOR map keys must be text strings"];
+        }
+        id value = [self readValueWithDepth:depth + 1];
+        if (value == nil) {
+            return nil;
+        }
+        dictionary[key] = value;
+    }
+    return dictionary;
+}
+
+- (NSArray<NSNumber *> *)readTypedArrayWithTag:(uint64_t)tag {
+    // RFC 8746: the tag is 0b010fsell; f = floating point, s = signed, e = little endian.
+    uint8_t flags = (uint8_t)(tag - ORKCBORTagUInt8Array);
+    BOOL isFloat = (flags & 0x10) != 0;
+    BOOL isSigned = (flags & 0x08) != 0;
+    BOOL littleEndian = (flags & 0x04) != 0;
+    NSUInteger sizeExponent = flags & 0x03;
+    NSUInteger elementSize = isFloat ? ((NSUInteger)2 << sizeExponent) : ((NSUInteger)1 << sizeExponent);
+    if ((isFloat && (isSigned || elementSize > 8)) || (!isFloat && isSigned && littleEndian && elementSize == 1)) {
+        return [self failWithDescription:[NSString stringWithFormat:@"Unsupported CBOR typed array tag %llu", tag]];
+    }
+    
+    uint8_t initialByte;
+    uint64_t length;
+    if (![self readBytes:&initialByte length:1]) {
+        return nil;
+    }
+    if ((initialByte >> 5) != ORKCBORMajorTypeByteString || (initialByte & 0x1F) == ORKCBORAdditionalInfoIndefinite) {
+        return [self failWithDescription:@"CBOR typed arrays must contain a definite-length byte string"];
+    }
+    if (![self readArgument:&length additionalInfo:initialByte & 0x1F]) {
+        return nil;
+    }
+    if (length > _length - _offset || length % elementSize != 0) {
+        return [self failWithDescription:@"Invalid CBOR typed array length"];
+    }
+    
+    NSUInteger count = (NSUInteger)length / elementSize;
+    NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger index = 0; index < count; index++) {
+        const uint8_t *element = _bytes + _offset + index * elementSize;
+        uint64_t bits = 0;
+        switch (elementSize) {
+            case 1: bits = element[0]; break;
+            case 2: bits = littleEndian ? OSReadLittleInt16(element, 0) : OSReadBigInt16(element, 0); break;
+            case 4: bits = littleEndian ? OSReadLittleInt32(element, 0) : OSReadBigInt32(element, 0); break;
+            case 8: bits = littleEndian ? OSReadLittleInt64(element, 0) : OSReadBigInt64(element, 0); break;
+        }
+        
+        NSNumber *number;
+        if (isFloat) {
+            double value = (elementSize == 2) ? ORKCBORDoubleFromHalf((uint16_t)bits) : (elementSize == 4) ? ORKCBORFloatFromBits((uint32_t)bits) : ORKCBORDoubleFromBits(bits);
+            if (!isfinite(value)) {
+                return [self failWithDescription:@"Non-finite number in CBOR typed array"];
+            }
+            number = @(value);
+        } else if (isSigned) {
+            int64_t value = (elementSize == 1) ? (int8_t)bits : (elementSize == 2) ? (int16_t)bits : (elementSize == 4) ? (int32_t)bits : (int64_t)bits;
+            number = @((long long)value);
+        } else {
+            number = (bits <= LLONG_MAX) ? @((long long)bits) : @(bits);
+        }
+        [array addObject:number];
+    }
+    _offset += (NSUInteger)length;
+    return array;
+}
+
+@end
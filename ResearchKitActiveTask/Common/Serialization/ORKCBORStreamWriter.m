@@ -0,0 +1,275 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKCBORStreamWriter.h"
+
+#import "ORKCBOR.h"
+
+#include <math.h>
+
+
+@implementation ORKCBORStreamWriter
+
+- (instancetype)initWithOutputStream:(NSOutputStream *)outputStream bufferSize:(NSUInteger)bufferSize {
+    self = [super initWithOutputStream:outputStream bufferSize:bufferSize];
+    if (self) {
+        [self appendHeadWithMajorType:ORKCBORMajorTypeTag value:ORKCBORTagSelfDescribed];
+    }
+    return self;
+}
+
+- (void)appendByte:(uint8_t)byte {
+    [self appendBytes:&byte length:1];
+}
+
+- (void)appendHeadWithMajorType:(ORKCBORMajorType)majorType value:(uint64_t)value {
+    uint8_t head[9];
+    NSUInteger length;
+    uint8_t initialByte = (uint8_t)(majorType << 5);
+    if (value < 24) {
+        head[0] = initialByte | (uint8_t)value;
+        length = 1;
+    } else if (value <= UINT8_MAX) {
+        head[0] = initialByte | ORKCBORAdditionalInfo1Byte;
+        head[1] = (uint8_t)value;
+        length = 2;
+    } else if (value <= UINT16_MAX) {
+        head[0] = initialByte | ORKCBORAdditionalInfo2Bytes;
+        OSWriteBigInt16(head, 1, (uint16_t)value);
+        length = 3;
+    } else if (value <= UINT32_MAX) {
+        head[0] = initialByte | ORKCBORAdditionalInfo4Bytes;
+        OSWriteBigInt32(head, 1, (uint32_t)value);
+        length = 5;
+    } else {
+        head[0] = initialByte | ORKCBORAdditionalInfo8Bytes;
+        OSWriteBigInt64(head, 1, value);
+        length = 9;
+    }
+    [self appendBytes:head length:length];
+}
+
+#pragma mark - Structure
+
+- (void)beginObject {
+    [self appendByte:(uint8_t)(ORKCBORMajorTypeMap << 5) | ORKCBORAdditionalInfoIndefinite];
+}
+
+- (void)endObject {
+    [self appendByte:ORKCBORBreak];
+}
+
+- (void)beginArray {
+    [self appendByte:(uint8_t)(ORKCBORMajorTypeArray << 5) | ORKCBORAdditionalInfoIndefinite];
+}
+
+- (void)endArray {
+    [self appendByte:ORKCBORBreak];
+}
+
+- (void)writeKey:(NSString *)key {
+    [self writeString:key];
+}
+
+#pragma mark - Values
+
+- (void)writeString:(NSString *)string {
+    NSUInteger length = [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    [self appendHeadWithMajorType:ORKCBORMajorTypeTextString value:length];
+    
+    // Copied in chunks so long strings are not duplicated in memory.
+    uint8_t chunk[1024];
+    NSRange remainingRange = NSMakeRange(0, string.length);
+    while (remainingRange.length > 0) {
+        NSUInteger usedLength = 0;
+        [string getBytes:chunk
+               maxLength:sizeof(chunk)
+              usedLength:&usedLength
+                encoding:NSUTF8StringEncoding
+                 options:0
+                   range:remainingRange
+          remainingRange:&remainingRange];
+        if (usedLength == 0) {
+            [self failWithInvalidObjectDescription:@"Unable to convert string to UTF-8 in CBOR write"];
+            return;
+        }
+        [self appendBytes:chunk length:usedLength];
+    }
+}
+
+- (void)writeNumber:(NSNumber *)number {
+    if (ORKStreamWriterIsBoolean(number)) {
+        [self appendByte:number.boolValue ? ORKCBORSimpleValueTrue : ORKCBORSimpleValueFalse];
+    } else if (CFNumberIsFloatType((__bridge CFNumberRef)number)) {
+        double value = number.doubleValue;
+        if (!isfinite(value)) {
+            [self failWithInvalidObjectDescription:[NSString stringWithFormat:@"Invalid number value (%@) in CBOR write", number]];
+            return;
+        }
+        uint8_t bytes[9];
+        float floatValue = (float)value;
+        if ((double)floatValue == value) {
+            bytes[0] = ORKCBORFloat32;
+            OSWriteBigInt32(bytes, 1, ORKCBORBitsFromFloat(floatValue));
+            [self appendBytes:bytes length:5];
+        } else {
+            bytes[0] = ORKCBORFloat64;
+            OSWriteBigInt64(bytes, 1, ORKCBORBitsFromDouble(value));
+            [self appendBytes:bytes length:9];
+        }
+    } else if (strcmp(number.objCType, @encode(unsigned long long)) == 0) {
+        [self appendHeadWithMajorType:ORKCBORMajorTypeUnsignedInteger value:number.unsignedLongLongValue];
+    } else {
+        long long value = number.longLongValue;
+        if (value >= 0) {
+            [self appendHeadWithMajorType:ORKCBORMajorTypeUnsignedInteger value:(uint64_t)value];
+        } else {
+            [self appendHeadWithMajorType:ORKCBORMajorTypeNegativeInteger value:(uint64_t)(-1 - value)];
+        }
+    }
+}
+
+- (void)writeNull {
+    [self appendByte:ORKCBORSimpleValueNull];
+}
+
+- (void)writeTypedArrayWithTag:(uint64_t)tag elementSize:(NSUInteger)elementSize count:(NSUInteger)count {
+    [self appendHeadWithMajorType:ORKCBORMajorTypeTag value:tag];
+    [self appendHeadWithMajorType:ORKCBORMajorTypeByteString value:(uint64_t)elementSize * count];
+}
+
+- (void)writeNumericArray:(NSArray<NSNumber *> *)array {
+    BOOL allFloats = YES;
+    BOOL allIntegers = YES;
+    BOOL allFloat32 = YES;
+    long long minimum = 0;
+    long long maximum = 0;
+    for (NSNumber *number in array) {
+        if (CFNumberIsFloatType((__bridge CFNumberRef)number)) {
+            allIntegers = NO;
+            double value = number.doubleValue;
+            if (!isfinite(value)) {
+                [self failWithInvalidObjectDescription:[NSString stringWithFormat:@"Invalid number value (%@) in CBOR write", number]];
+                return;
+            }
+            allFloat32 = allFloat32 && ((double)(float)value == value);
+        } else {
+            allFloats = NO;
+            if (strcmp(number.objCType, @encode(unsigned long long)) == 0 && number.unsignedLongLongValue > LLONG_MAX) {
+                allIntegers = NO;
+            }
+            long long value = number.longLongValue;
+            minimum = MIN(minimum, value);
+            maximum = MAX(maximum, value);
+        }
+    }
+    
+    NSUInteger count = array.count;
+    if (allFloats) {
+        if (allFloat32) {
+            [self writeTypedArrayWithTag:ORKCBORTagFloat32LittleEndianArray elementSize:sizeof(uint32_t) count:count];
+            for (NSNumber *number in array) {
+                uint32_t bits = OSSwapHostToLittleInt32(ORKCBORBitsFromFloat(number.floatValue));
+                [self appendBytes:&bits length:sizeof(bits)];
+            }
+        } else {
+            [self writeTypedArrayWithTag:ORKCBORTagFloat64LittleEndianArray elementSize:sizeof(uint64_t) count:count];
+            for (NSNumber *number in array) {
+                uint64_t bits = OSSwapHostToLittleInt64(ORKCBORBitsFromDouble(number.doubleValue));
+                [self appendBytes:&bits length:sizeof(bits)];
+            }
+        }
+    } else if (allIntegers) {
+        if (minimum >= INT8_MIN && maximum <= INT8_MAX) {
+            [self writeTypedArrayWithTag:ORKCBORTagSInt8Array elementSize:sizeof(int8_t) count:count];
+            for (NSNumber *number in array) {
+                int8_t value = (int8_t)number.longLongValue;
+                [self appendBytes:&value length:sizeof(value)];
+            }
+        } else if (minimum >= INT16_MIN && maximum <= INT16_MAX) {
+            [self writeTypedArrayWithTag:ORKCBORTagSInt16LittleEndianArray elementSize:sizeof(int16_t) count:count];
+            for (NSNumber *number in array) {
+                uint16_t value = OSSwapHostToLittleInt16((uint16_t)(int16_t)number.longLongValue);
+                [self appendBytes:&value length:sizeof(value)];
+            }
+        } else if (minimum >= INT32_MIN && maximum <= INT32_MAX) {
+            [self writeTypedArrayWithTag:ORKCBORTagSInt32LittleEndianArray elementSize:sizeof(int32_t) count:count];
+            for (NSNumber *number in array) {
+                uint32_t value = OSSwapHostToLittleInt32((uint32_t)(int32_t)number.longLongValue);
+                [self appendBytes:&value length:sizeof(value)];
+            }
+        } else {
+            [self writeTypedArrayWithTag:ORKCBORTagSInt64LittleEndianArray elementSize:sizeof(int64_t) count:count];
+            for (NSNumber *number in array) {
+                uint64_t value = OSSwapHostToLittleInt64((uint64_t)number.longLongValue);
+                [self appendBytes:&value length:sizeof(value)];
+            }
+        }
+    } else {
+        // Mixed integers and floating-point values keep their individual types.
+        [self appendHeadWithMajorType:ORKCBORMajorTypeArray value:count];
+        for (NSNumber *number in array) {
+            [self writeNumber:number];
+        }
+    }
+}
+
+- (void)writeJSONObject:(id)object {
+    if (self.error != nil) {
+        return;
+    }
+    // Containers whose size is known are written with definite lengths.
+    if ([object isKindOfClass:[NSArray class]] && !ORKStreamWriterIsNumericArray(object)) {
+        NSArray *array = (NSArray *)object;
+        [self appendHeadWithMajorType:ORKCBORMajorTypeArray value:array.count];
+        for (id element in array) {
+            [self writeJSONObject:element];
+        }
+    } else if ([object isKindOfClass:[NSDictionary class]]) {
+        NSDictionary *dictionary = (NSDictionary *)object;
+        NSArray *keys = dictionary.allKeys;
+        for (id key in keys) {
+            if (![key isKindOfClass:[NSString class]]) {
+                [self failWithInvalidObjectDescription:[NSString stringWithFormat:@"Invalid (non-string) key in CBOR map: %@", key]];
+                return;
+            }
+        }
+        [self appendHeadWithMajorType:ORKCBORMajorTypeMap value:keys.count];
+        for (NSString *key in [keys sortedArrayUsingSelector:@selector(compare:)]) {
+            [self writeString:key];
+            [self writeJSONObject:dictionary[key]];
+        }
+    } else {
+        [super writeJSONObject:object];
+    }
+}
+
+@end
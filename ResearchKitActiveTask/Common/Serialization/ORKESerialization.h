@@ -0,0 +1,394 @@
+/*
+ Copyright (c) 2015, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Foundation/Foundation.h>
+#import <UIKit/UIKit.h>
+#import <ResearchKit/ORKDefines.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Keys of the dictionaries that reference images in serialized objects.
+typedef NSString *ORKESerializationKey NS_STRING_ENUM;
+
+/// The name of a referenced image, looked up first as a system symbol and then in a bundle.
+ORK_EXTERN ORKESerializationKey const ORKESerializationKeyImageName;
+
+/**
+ Translates the localizable strings of a serialized object, such as titles and choice labels, while it
+ is decoded.
+ */
+@protocol ORKESerializationLocalizer
+
+/**
+ Returns the localized string for a key, or the key itself if it has no translation.
+ */
+- (NSString *)localizedStringForKey:(ORKESerializationKey)string;
+
+@end
+
+/**
+ A localizer that looks strings up in a strings table of a bundle.
+ 
+ The table is read once, on the first lookup, and is read again after `bundle` or `tableName` changes.
+ Lookups are thread safe.
+ */
+@interface ORKESerializationBundleLocalizer : NSObject<ORKESerializationLocalizer>
+
+/**
+ Returns a localizer for a strings table.
+ 
+ @param bundle      The bundle that contains the table.
+ @param tableName   The name of the table, without its extension. An empty name means `Localizable`.
+ */
+- (instancetype)initWithBundle:(NSBundle *)bundle tableName:(NSString *)tableName;
+
+@property (nonatomic, strong) NSBundle *bundle;
+@property (nonatomic, copy) NSString *tableName;
+
+/**
+ Returns the string for a key in the table, or the key itself if the table does not contain it.
+ */
+- (NSString *)localizedStringForKey:(ORKESerializationKey)string;
+
+@end
+
+/**
+ Converts between images and the references that stand for them in serialized objects.
+ */
+@protocol ORKESerializationImageProvider
+
+/**
+ Returns the image for a reference read while decoding, or `nil` if there is none.
+ */
+- (nullable UIImage *)imageForReference:(NSDictionary *)reference;
+
+/**
+ Stores an image while encoding and returns the reference to write in its place, or `nil` to leave
+ the image out.
+ */
+- (nullable NSDictionary *)referenceBySavingImage:(UIImage *)image;
+
+@end
+
+/// How a property modifier changes the value it injects.
+typedef NS_ENUM(NSInteger, ORKESerializationPropertyModifierType) {
+    /// The value is a path relative to the injector's base path.
+    ORKESerializationPropertyModifierTypePath
+};
+
+/**
+ A value to inject into one property of a class while decoding.
+ */
+@interface ORKESerializationPropertyModifier: NSObject
+
+/**
+ Returns a property modifier.
+ 
+ @param keypath     The class and property to replace, in the form `ClassName.propertyName`.
+ @param value       The value to decode in place of the serialized one.
+ @param type        How the value is changed before it is injected.
+ */
+- (instancetype)initWithKeypath:(NSString *)keypath value:(id)value type:(ORKESerializationPropertyModifierType)type;
+
+@property (nonatomic, copy, readonly) NSString *keypath;
+@property (nonatomic, copy, readonly) id value;
+@property (nonatomic, assign, readonly) ORKESerializationPropertyModifierType type;
+
+@end
+
+/**
+ Replaces property values of serialized objects before they are decoded.
+ 
+ A value is only injected into objects of the modifier's class that already have a value for the
+ property.
+ */
+@interface ORKESerializationPropertyInjector : NSObject
+
+/**
+ Returns a property injector.
+ 
+ @param basePath    The directory that values of path modifiers are relative to.
+ @param modifiers   The values to inject.
+ */
+- (instancetype)initWithBasePath:(NSString *)basePath modifiers:(nullable NSArray<ORKESerializationPropertyModifier *> *)modifiers;
+
+@property (nonatomic, copy, readonly) NSString *basePath;
+
+/// The values to inject, keyed by `ClassName.propertyName`, with path values resolved against `basePath`.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, id> *propertyValues;
+
+@end
+
+/**
+ Substitutes values into the localizable strings of a serialized object while it is decoded, after
+ they are localized.
+ */
+@protocol ORKESerializationStringInterpolator
+
+- (NSString *)interpolatedStringForString:(NSString *)string;
+
+@end
+
+/**
+ The collaborators and options used while encoding or decoding an object.
+ */
+@interface ORKESerializationContext : NSObject
+
+/**
+ Returns a context. Every collaborator is optional.
+ 
+ @param localizer           Translates localizable strings while decoding.
+ @param imageProvider       Converts images to and from references.
+ @param stringInterpolator  Substitutes values into localizable strings while decoding.
+ @param propertyInjector    Replaces property values before they are decoded.
+ */
+- (instancetype)initWithLocalizer:(nullable id<ORKESerializationLocalizer>)localizer
+                    imageProvider:(nullable id<ORKESerializationImageProvider>)imageProvider
+               stringInterpolator:(nullable id<ORKESerializationStringInterpolator>)stringInterpolator
+                 propertyInjector:(nullable ORKESerializationPropertyInjector *)propertyInjector;
+
+@property (nonatomic, strong, nullable) id<ORKESerializationLocalizer> localizer;
+@property (nonatomic, strong, nullable) id<ORKESerializationImageProvider> imageProvider;
+@property (nonatomic, strong, nullable) id<ORKESerializationStringInterpolator> stringInterpolator;
+@property (nonatomic, strong, nullable) ORKESerializationPropertyInjector *propertyInjector;
+
+/**
+ The maximum number of localized and interpolated strings the context remembers while decoding.
+ 
+ Strings that repeat across a definition, such as choice labels, are then localized and interpolated
+ once. Setting `localizer` or `stringInterpolator` clears the cache, so create a new context, or set
+ the interpolator again, when the interpolated values change. The default is 4096; 0 disables the cache.
+ */
+@property (nonatomic, assign) NSUInteger localizedStringCacheLimit;
+
+/**
+ Whether decoding spreads large arrays of objects, such as the steps of a task, across a concurrent queue.
+ 
+ Each element of the outermost such array is decoded on a worker thread with its own context, which
+ decodes the element's subtree sequentially, and the decoded objects keep their order. The localizer,
+ string interpolator, image provider, and property injector must be safe to call from several threads;
+ `ORKESerializationBundleLocalizer` and `ORKESerializationBundleImageProvider` are. The default is `NO`.
+ */
+@property (nonatomic, assign) BOOL decodesInParallel;
+
+@end
+
+/// Decodes the named property of a serialized object.
+typedef _Nullable id (^ORKESerializationPropertyGetter)(NSDictionary *dict, NSString *property);
+
+/// Creates an object from its serialized form, decoding the properties its initializer needs with `getter`.
+typedef _Nullable id (^ORKESerializationInitBlock)(NSDictionary *dict, ORKESerializationPropertyGetter getter);
+
+/// Converts a property value to its JSON form.
+typedef _Nullable id (^ORKESerializationObjectToJSONBlock)(id object, ORKESerializationContext *context);
+
+/// Converts the JSON form of a property value back to the value, or returns `nil` if it cannot.
+typedef _Nullable id (^ORKESerializationJSONToObjectBlock)(id jsonObject, ORKESerializationContext *context);
+
+
+/**
+ An image provider that loads referenced images from a bundle. Images cannot be saved to a bundle, so
+ encoded images are replaced with a reference to an empty name.
+ */
+@interface ORKESerializationBundleImageProvider : NSObject<ORKESerializationImageProvider>
+
+- (instancetype)initWithBundle:(NSBundle *)bundle;
+
+@property (nonatomic, strong, readonly) NSBundle *bundle;
+
+@end
+
+
+/**
+ Converts tasks, steps, results and the other ResearchKit model objects to and from JSON and CBOR.
+ 
+ Every serialized object is a dictionary whose `_class` key names its class. Decoding methods report
+ input that does not describe a serializable object, such as an unknown class or property, or a value
+ of the wrong type, with an `ORKErrorDomain` error of code `ORKErrorInvalidObject`.
+ */
+@interface ORKESerializer : NSObject
+
+/**
+ Returns the JSON representation of an object, with the default context.
+ */
++ (nullable NSDictionary *)JSONObjectForObject:(id)object error:(NSError **)error;
+
+/**
+ Returns the JSON representation of an object as UTF-8 data, with keys in sorted order.
+ 
+ @param error   On failure, the error from `NSJSONSerialization`.
+ */
++ (nullable NSData *)JSONDataForObject:(id)object error:(NSError **)error;
+
+/**
+ Decodes an object from its JSON representation, with the default context.
+ 
+ @param error   On failure, an error describing the malformed input.
+ */
++ (nullable id)objectFromJSONObject:(NSDictionary *)object error:(NSError **)error;
+
+/**
+ Decodes an object from its JSON representation.
+ 
+ @param object  The JSON representation of the object.
+ @param context The context whose localizer, interpolator, image provider and injector are applied.
+ @param error   On failure, an error describing the malformed input.
+ */
++ (nullable id)objectFromJSONObject:(NSDictionary *)object context:(ORKESerializationContext *)context error:(NSError **)error;
+
+/**
+ Returns the JSON representation of an object, with images converted by the context's image provider.
+ */
++ (NSDictionary *)JSONObjectForObject:(id)object context:(ORKESerializationContext *)context error:(__unused NSError **)error;
+
+/**
+ Decodes an object from JSON data, with the default context.
+ 
+ @param error   On failure, the error from `NSJSONSerialization` or an error describing the malformed input.
+ */
++ (nullable id)objectFromJSONData:(NSData *)data error:(NSError **)error;
+
+/**
+ Writes the JSON representation of an object to a stream as it is produced.
+ 
+ The output is equivalent to `JSONDataForObject:error:`, but no intermediate dictionary tree
+ is built: serializable objects are walked property by property and their values are written
+ through a small buffer, so memory use does not grow with the size of the arrays being
+ written. Keys are written in sorted order.
+ 
+ @param object          The task, step, result or other serializable object to write.
+ @param outputStream    An open stream to write to. The stream is not closed.
+ @param context         The serialization context, or `nil` for the default context.
+ @param error           On failure, the stream error or an `ORKErrorDomain` error describing
+                        the value that could not be written.
+ 
+ @return `YES` if the whole object was written.
+ */
++ (BOOL)writeJSONForObject:(id)object
+            toOutputStream:(NSOutputStream *)outputStream
+                   context:(nullable ORKESerializationContext *)context
+                     error:(NSError **)error;
+
+/**
+ Writes the JSON representation of an object to a file, replacing any existing file.
+ 
+ See `writeJSONForObject:toOutputStream:context:error:`.
+ */
++ (BOOL)writeJSONForObject:(id)object
+               toFileAtURL:(NSURL *)fileURL
+                   context:(nullable ORKESerializationContext *)context
+                     error:(NSError **)error;
+
+/**
+ Writes an object to a stream in CBOR (RFC 8949), a compact binary form of its JSON
+ representation.
+ 
+ The object is walked the same way as by `writeJSONForObject:toOutputStream:context:error:`, and
+ decoding the output with `JSONObjectFromCBORData:error:` gives the same values as the JSON form.
+ Numbers are written in binary, and arrays of numbers are written as RFC 8746 typed arrays.
+ */
++ (BOOL)writeCBORForObject:(id)object
+            toOutputStream:(NSOutputStream *)outputStream
+                   context:(nullable ORKESerializationContext *)context
+                     error:(NSError **)error;
+
+/**
+ Returns the CBOR representation of an object, with the default context.
+ 
+ See `writeCBORForObject:toOutputStream:context:error:`.
+ */
++ (nullable NSData *)CBORDataForObject:(id)object error:(NSError **)error;
+
+/**
+ Decodes CBOR written by `writeCBORForObject:toOutputStream:context:error:` into the JSON
+ representation of the object: dictionaries, arrays, strings, numbers and `NSNull`.
+ */
++ (nullable id)JSONObjectFromCBORData:(NSData *)data error:(NSError **)error;
+
+/**
+ Decodes an object from CBOR written by `writeCBORForObject:toOutputStream:context:error:`.
+ 
+ @param data    The CBOR data.
+ @param context The decoding context, or `nil` for the default context.
+ @param error   On failure, an error describing the malformed CBOR or the malformed object.
+ */
++ (nullable id)objectFromCBORData:(NSData *)data context:(nullable ORKESerializationContext *)context error:(NSError **)error;
+
+/// The classes that can be serialized.
++ (NSArray *)serializableClasses;
+
+/// The names of the serialized properties of a class, or an empty array if it is not serializable.
++ (NSArray<NSString *> *)serializedPropertiesForClass:(Class)c;
+
+@end
+
+
+/**
+ Adds classes and properties to the serializer, or changes how existing ones are serialized.
+ 
+ Registration is not thread safe: register before encoding or decoding anything.
+ */
+@interface ORKESerializer (Registration)
+
+/**
+ Makes a class serializable, or replaces the block that creates its instances.
+ 
+ @param serializableClass   The class to register.
+ @param initBlock           Creates an instance from its serialized form, or `nil` to use `-init`
+                            and then set every serialized property.
+ */
++ (void)registerSerializableClass:(Class)serializableClass
+                        initBlock:(nullable ORKESerializationInitBlock)initBlock;
+
+/**
+ Adds a serialized property to a class, or replaces how an existing one is serialized.
+ 
+ @param propertyName        The name of the property.
+ @param serializableClass   The class that has the property.
+ @param valueClass          The class of the value, or of each element of a container.
+ @param containerClass      `NSArray` or `NSDictionary` if the property holds a container of values, otherwise `nil`.
+ @param writeAfterInit      Whether the property is set after the class's init block has run.
+ @param objectToJSON        Converts the value to JSON, or `nil` to encode it directly.
+ @param jsonToObjectBlock   Converts JSON back to the value, or `nil` to decode it directly.
+ @param skipSerialization   Whether the property is left out when encoding.
+ */
++ (void)registerSerializableClassPropertyName:(NSString *)propertyName
+                                     forClass:(Class)serializableClass
+                                   valueClass:(Class)valueClass
+                               containerClass:(nullable Class)containerClass
+                               writeAfterInit:(BOOL)writeAfterInit
+                            objectToJSONBlock:(nullable ORKESerializationObjectToJSONBlock)objectToJSON
+                            jsonToObjectBlock:(nullable ORKESerializationJSONToObjectBlock)jsonToObjectBlock
+                            skipSerialization:(BOOL)skipSerialization;
+
+@end
+
+
+NS_ASSUME_NONNULL_END
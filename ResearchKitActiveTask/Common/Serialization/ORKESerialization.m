@@ -33,6 +33,10 @@
 
 #import "ORKESerialization.h"
 
+#import "ORKCBORDecoder.h"
+#import "ORKCBORStreamWriter.h"
+#import "ORKJSONStreamWriter.h"
+
 #import <ResearchKit/ResearchKit.h>
 #import <ResearchKit/ResearchKit_Private.h>
 #import <ResearchKitActiveTask/ResearchKitActiveTask.h>
@@ -46,6 +50,8 @@
 #import <HealthKit/HealthKit.h>
 #endif
 
+#include <os/lock.h>
+
 ORKESerializationKey const ORKESerializationKeyImageName = @"imageName";
 
 static NSString *_ClassKey = @"_class";
@@ -464,6 +470,20 @@ __unused static NSInteger const SerializationVersion = 1; // Will be used moving
 
 #define DYNAMICCAST(x, c) ((c *) ([x isKindOfClass:[c class]] ? x : nil))
 
+// Decoding raises this exception for input it cannot decode. The public decoding methods catch it and
+// return the reason as an error; any other exception is a programming error and is not caught.
+static NSString *const ORKESerializationMalformedInputException = @"ORKESerializationMalformedInputException";
+
+static void ORKESerializationRaiseMalformedInput(NSString *format, ...) NS_FORMAT_FUNCTION(1, 2) __attribute__((noreturn));
+
+static void ORKESerializationRaiseMalformedInput(NSString *format, ...) {
+    va_list arguments;
+    va_start(arguments, format);
+    NSString *reason = [[NSString alloc] initWithFormat:format arguments:arguments];
+    va_end(arguments);
+    @throw [NSException exceptionWithName:ORKESerializationMalformedInputException reason:reason userInfo:nil];
+}
+
 @class ORKESerializableProperty;
 
 @interface ORKESerializableTableEntry : NSObject
@@ -547,7 +567,9 @@ __unused static NSInteger const SerializationVersion = 1; // Will be used moving
     NSMutableDictionary *mutatedDictionary = [inputDictionary mutableCopy];
     [_propertyValues enumerateKeysAndObjectsUsingBlock:^(NSString * _Nonnull keypath, id  _Nonnull obj, __unused BOOL * _Nonnull stop) {
         NSArray<NSString *> *components = [keypath componentsSeparatedByString:@"."];
-        NSCAssert(components.count == 2, @"Unexpected number of components in keypath %@", keypath);
+        if (components.count != 2) {
+            ORKESerializationRaiseMalformedInput(@"Unexpected number of components in keypath %@", keypath);
+        }
         NSString *class = components[0];
         NSString *key = components[1];
         // Only inject the property if it's the corresponding class,and the key exists in the dictionary
@@ -638,7 +660,185 @@ static ORKESerializableProperty *imagePropertyObject(NSString *propertyName,
 
 @end
 
-@implementation ORKESerializationContext
+
+typedef NS_ENUM(NSInteger, ORKESerializationContainerKind) {
+    ORKESerializationContainerKindObject,
+    ORKESerializationContainerKindArray,
+    ORKESerializationContainerKindDictionary,
+};
+
+/**
+ A snapshot of one serializable property, with everything either direction needs to convert
+ its value resolved up front.
+ */
+@interface ORKESerializationPropertyPlan : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithProperty:(ORKESerializableProperty *)property NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, copy, readonly) NSString *propertyName;
+@property (nonatomic, readonly) Class valueClass;
+@property (nonatomic, readonly) ORKESerializationContainerKind containerKind;
+@property (nonatomic, readonly) BOOL writeAfterInit;
+@property (nonatomic, readonly) BOOL localizable;
+@property (nonatomic, copy, readonly) ORKESerializationObjectToJSONBlock objectToJSONBlock;
+@property (nonatomic, copy, readonly) ORKESerializationJSONToObjectBlock jsonToObjectBlock;
+
+@end
+
+
+/**
+ The flattened encoding of one class: the table entries of the class and its superclasses,
+ resolved once instead of walking the class hierarchy for every property.
+ */
+@interface ORKESerializationClassPlan : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithClass:(Class)class encodings:(NSArray<ORKESerializableTableEntry *> *)encodings NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) Class planClass;
+@property (nonatomic, copy, readonly) NSString *className;
+
+// NO when neither the class nor any of its superclasses is in the encoding table.
+@property (nonatomic, readonly) BOOL serializable;
+
+// The init block of the most derived class with an encoding.
+@property (nonatomic, copy, readonly) ORKESerializationInitBlock initBlock;
+
+// Keyed by property name; a subclass entry takes precedence over its superclasses.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, ORKESerializationPropertyPlan *> *decodingProperties;
+
+// In encoding order, without the properties marked to skip serialization.
+@property (nonatomic, copy, readonly) NSArray<ORKESerializationPropertyPlan *> *encodingProperties;
+
+// The encoding properties sorted by name, keeping only the last of any duplicates, for writing to a stream.
+@property (nonatomic, copy, readonly) NSArray<ORKESerializationPropertyPlan *> *sortedEncodingProperties;
+
+@property (nonatomic, copy, readonly) NSArray<NSString *> *propertyNames;
+
+@end
+
+
+@implementation ORKESerializationPropertyPlan
+
+- (instancetype)initWithProperty:(ORKESerializableProperty *)property {
+    self = [super init];
+    if (self) {
+        _propertyName = [property.propertyName copy];
+        _valueClass = property.valueClass;
+        if ([property.containerClass isSubclassOfClass:[NSArray class]]) {
+            _containerKind = ORKESerializationContainerKindArray;
+        } else if ([property.containerClass isSubclassOfClass:[NSDictionary class]]) {
+            _containerKind = ORKESerializationContainerKindDictionary;
+        } else {
+            NSCAssert(property.containerClass == [NSObject class], @"Unexpected container class %@", property.containerClass);
+            _containerKind = ORKESerializationContainerKindObject;
+        }
+        _writeAfterInit = property.writeAfterInit;
+        _localizable = ![_propertyName isEqualToString:@"identifier"];
+        _objectToJSONBlock = property.objectToJSONBlock;
+        _jsonToObjectBlock = property.jsonToObjectBlock;
+    }
+    return self;
+}
+
+@end
+
+
+@implementation ORKESerializationClassPlan
+
+- (instancetype)initWithClass:(Class)class encodings:(NSArray<ORKESerializableTableEntry *> *)encodings {
+    self = [super init];
+    if (self) {
+        _planClass = class;
+        _className = [NSStringFromClass(class) copy];
+        _serializable = (encodings.count > 0);
+        _initBlock = encodings.firstObject.initBlock;
+        
+        NSMutableDictionary<NSString *, ORKESerializationPropertyPlan *> *decodingProperties = [NSMutableDictionary dictionary];
+        NSMutableArray<ORKESerializationPropertyPlan *> *encodingProperties = [NSMutableArray array];
+        NSMutableArray<NSString *> *propertyNames = [NSMutableArray array];
+        NSMutableSet<NSString *> *excludedProperties = [NSMutableSet set];
+        for (ORKESerializableTableEntry *encoding in encodings) {
+            [encoding.properties enumerateKeysAndObjectsUsingBlock:^(NSString *propertyName, ORKESerializableProperty *property, __unused BOOL *stop) {
+                ORKESerializationPropertyPlan *propertyPlan = [[ORKESerializationPropertyPlan alloc] initWithProperty:property];
+                [propertyNames addObject:propertyName];
+                if (decodingProperties[propertyName] == nil) {
+                    decodingProperties[propertyName] = propertyPlan;
+                }
+                // A property skipped by a subclass is not serialized by its superclasses either.
+                if (property.skipSerialization) {
+                    [excludedProperties addObject:property.propertyName];
+                } else if (![excludedProperties containsObject:property.propertyName]) {
+                    [encodingProperties addObject:propertyPlan];
+                }
+            }];
+        }
+        _decodingProperties = [decodingProperties copy];
+        _encodingProperties = [encodingProperties copy];
+        
+        NSMutableDictionary<NSString *, ORKESerializationPropertyPlan *> *lastEncodingProperties = [NSMutableDictionary dictionary];
+        for (ORKESerializationPropertyPlan *propertyPlan in encodingProperties) {
+            lastEncodingProperties[propertyPlan.propertyName] = propertyPlan;
+        }
+        _sortedEncodingProperties = [lastEncodingProperties.allValues sortedArrayUsingComparator:^NSComparisonResult(ORKESerializationPropertyPlan *plan1, ORKESerializationPropertyPlan *plan2) {
+            return [plan1.propertyName compare:plan2.propertyName];
+        }];
+        _propertyNames = [propertyNames copy];
+    }
+    return self;
+}
+
+@end
+
+
+static os_unfair_lock ORKESerializationClassPlanLock = OS_UNFAIR_LOCK_INIT;
+static NSMapTable<Class, ORKESerializationClassPlan *> *ORKESerializationClassPlans = nil;
+static NSUInteger ORKESerializationClassPlanGeneration = 0;
+
+static ORKESerializationClassPlan *ORKESerializationClassPlanForClass(Class class) {
+    if (class == nil) {
+        return nil;
+    }
+    
+    os_unfair_lock_lock(&ORKESerializationClassPlanLock);
+    if (ORKESerializationClassPlans == nil) {
+        ORKESerializationClassPlans = [NSMapTable mapTableWithKeyOptions:(NSPointerFunctionsOpaqueMemory | NSPointerFunctionsObjectPointerPersonality)
+                                                            valueOptions:NSPointerFunctionsStrongMemory];
+    }
+    ORKESerializationClassPlan *plan = [ORKESerializationClassPlans objectForKey:class];
+    NSUInteger generation = ORKESerializationClassPlanGeneration;
+    os_unfair_lock_unlock(&ORKESerializationClassPlanLock);
+    
+    if (plan == nil) {
+        // Built outside the lock; if two threads race, both plans are equivalent and either may be kept.
+        plan = [[ORKESerializationClassPlan alloc] initWithClass:class encodings:classEncodingsForClass(class)];
+        os_unfair_lock_lock(&ORKESerializationClassPlanLock);
+        // Don't cache a plan built from a table that was changed by a registration in the meantime.
+        if (generation == ORKESerializationClassPlanGeneration) {
+            [ORKESerializationClassPlans setObject:plan forKey:class];
+        }
+        os_unfair_lock_unlock(&ORKESerializationClassPlanLock);
+    }
+    return plan;
+}
+
+static void ORKESerializationInvalidateClassPlans(void) {
+    os_unfair_lock_lock(&ORKESerializationClassPlanLock);
+    [ORKESerializationClassPlans removeAllObjects];
+    ORKESerializationClassPlanGeneration++;
+    os_unfair_lock_unlock(&ORKESerializationClassPlanLock);
+}
+
+static const NSUInteger ORKESerializationDefaultLocalizedStringCacheLimit = 4096;
+
+@implementation ORKESerializationContext {
+    // Maps each source string to its localized and interpolated form. NSCache is thread safe and evicts
+    // entries beyond its count limit.
+    NSCache<NSString *, NSString *> *_localizedStrings;
+}
 
 - (instancetype)initWithLocalizer:(nullable id<ORKESerializationLocalizer>)localizer
                     imageProvider:(nullable id<ORKESerializationImageProvider>)imageProvider
@@ -650,87 +850,249 @@ static ORKESerializableProperty *imagePropertyObject(NSString *propertyName,
         _imageProvider = imageProvider;
         _stringInterpolator = stringInterpolator;
         _propertyInjector = propertyInjector;
+        _localizedStrings = [[NSCache alloc] init];
+        self.localizedStringCacheLimit = ORKESerializationDefaultLocalizedStringCacheLimit;
     }
     return self;
 }
 
-@end
+- (void)setLocalizer:(id<ORKESerializationLocalizer>)localizer {
+    _localizer = localizer;
+    [_localizedStrings removeAllObjects];
+}
 
-static id propFromDict(NSDictionary *dict, NSString *propName, ORKESerializationContext *context) {
-    Class class = NSClassFromString(dict[_ClassKey]);
+- (void)setStringInterpolator:(id<ORKESerializationStringInterpolator>)stringInterpolator {
+    _stringInterpolator = stringInterpolator;
+    [_localizedStrings removeAllObjects];
+}
 
-    NSArray *classEncodings = classEncodingsForClass(class);
-    ORKESerializableProperty *propertyEntry = nil;
-    for (ORKESerializableTableEntry *classEncoding in classEncodings) {
-        
-        NSDictionary *propertyEncoding = classEncoding.properties;
-        propertyEntry = propertyEncoding[propName];
-        if (propertyEntry != nil) {
-            break;
-        }
+- (void)setLocalizedStringCacheLimit:(NSUInteger)localizedStringCacheLimit {
+    _localizedStringCacheLimit = localizedStringCacheLimit;
+    _localizedStrings.countLimit = localizedStringCacheLimit;
+    if (localizedStringCacheLimit == 0) {
+        [_localizedStrings removeAllObjects];
+    }
+}
+
+// Returns a context for one worker of a parallel decode. It has the same configuration and shares the string
+// cache, which is thread safe, but decodes sequentially.
+- (ORKESerializationContext *)workerContext {
+    ORKESerializationContext *workerContext = [[ORKESerializationContext alloc] init];
+    workerContext->_localizer = _localizer;
+    workerContext->_imageProvider = _imageProvider;
+    workerContext->_stringInterpolator = _stringInterpolator;
+    workerContext->_propertyInjector = _propertyInjector;
+    workerContext->_localizedStrings = _localizedStrings;
+    workerContext->_localizedStringCacheLimit = _localizedStringCacheLimit;
+    return workerContext;
+}
+
+- (NSString *)localizedStringForString:(NSString *)string {
+    id<ORKESerializationLocalizer> localizer = _localizer;
+    id<ORKESerializationStringInterpolator> stringInterpolator = _stringInterpolator;
+    if (localizer == nil && stringInterpolator == nil) {
+        return string;
     }
-    NSCAssert(propertyEntry != nil, @"Unexpected property %@ for class %@", propName, dict[_ClassKey]);
     
-    Class containerClass = propertyEntry.containerClass;
-    Class propertyClass = propertyEntry.valueClass;
-    ORKESerializationJSONToObjectBlock converterBlock = propertyEntry.jsonToObjectBlock;
+    BOOL cached = (_localizedStringCacheLimit > 0);
+    NSString *output = cached ? [_localizedStrings objectForKey:string] : nil;
+    if (output == nil) {
+        output = string;
+        if (localizer != nil) {
+            output = [localizer localizedStringForKey:output];
+        }
+        if (stringInterpolator != nil) {
+            output = [stringInterpolator interpolatedStringForString:output];
+        }
+        if (cached && output != nil) {
+            [_localizedStrings setObject:output forKey:string];
+        }
+    }
+    return output;
+}
+
+@end
+
+static NSString *localizedStringForString(NSString *string, ORKESerializationContext *context) {
+    return context ? [context localizedStringForString:string] : string;
+}
+
+// Arrays with at least this many objects are decoded in parallel when the context allows it.
+static const NSUInteger ORKESerializationParallelDecodingMinimumCount = 4;
+
+static BOOL shouldDecodeArrayInParallel(NSArray *inputArray, ORKESerializationContext *context) {
+    return (context.decodesInParallel &&
+            inputArray.count >= ORKESerializationParallelDecodingMinimumCount &&
+            [inputArray.firstObject isKindOfClass:[NSDictionary class]]);
+}
+
+static NSArray *objectsForJsonObjectsInParallel(NSArray *inputArray, Class propertyClass, ORKESerializationJSONToObjectBlock converterBlock, ORKESerializationContext *context) {
+    NSUInteger count = inputArray.count;
+    NSMutableArray *outputArray = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger index = 0; index < count; index++) {
+        [outputArray addObject:[NSNull null]];
+    }
     
-    id input = dict[propName];
-    id output = nil;
-    if (input != nil) {
-        if ([containerClass isSubclassOfClass:[NSArray class]]) {
-            NSMutableArray *outputArray = [NSMutableArray array];
-            for (id value in DYNAMICCAST(input, NSArray)) {
-                id convertedValue = objectForJsonObject(value, propertyClass, converterBlock, context);
-                NSCAssert(convertedValue != nil, @"Could not convert to object of class %@", propertyClass);
-                [outputArray addObject:convertedValue];
+    // dispatch_apply returns only once every element is decoded, so the lock can live on this stack frame.
+    os_unfair_lock lock = OS_UNFAIR_LOCK_INIT;
+    os_unfair_lock *lockPointer = &lock;
+    __block NSException *firstException = nil;
+    __block NSUInteger firstExceptionIndex = NSNotFound;
+    dispatch_apply(count, DISPATCH_APPLY_AUTO, ^(size_t index) {
+        @autoreleasepool {
+            id convertedValue = nil;
+            NSException *exception = nil;
+            @try {
+                convertedValue = objectForJsonObject(inputArray[index], propertyClass, converterBlock, [context workerContext]);
+                if (convertedValue == nil) {
+                    ORKESerializationRaiseMalformedInput(@"Could not convert to object of class %@", propertyClass);
+                }
             }
-            output = outputArray;
-        } else if ([containerClass isSubclassOfClass:[NSDictionary class]]) {
-            NSMutableDictionary *outputDictionary = [NSMutableDictionary dictionary];
-            for (NSString *key in [DYNAMICCAST(input, NSDictionary) allKeys]) {
-                id convertedValue = objectForJsonObject(DYNAMICCAST(input, NSDictionary)[key], propertyClass, converterBlock, nil);
-                NSCAssert(convertedValue != nil, @"Could not convert to object of class %@", propertyClass);
-                outputDictionary[key] = convertedValue;
+            @catch (NSException *caughtException) {
+                exception = caughtException;
             }
-            output = outputDictionary;
-        } else {
-            NSCAssert(containerClass == [NSObject class], @"Unexpected container class %@", containerClass);
             
-            output = objectForJsonObject(input, propertyClass, converterBlock, context);
-
-            // Edge case for ORKAnswerFormat options. Certain formats (e.g. ORKTextChoiceAnswerFormat) contain
-            // text strings (e.g. 'Yes', 'No') that need to be localized but are already of the expected type.
-            //
-            // Remaining localization/interpolication is done in `objectForJsonObject`.
-            if ([output isKindOfClass:[NSString class]] && ![propName isEqualToString:@"identifier"]) {
-                id<ORKESerializationLocalizer> localizer = context.localizer;
-                id<ORKESerializationStringInterpolator> stringInterpolator = context.stringInterpolator;
-
-                if (localizer != nil) {
-                    output =  [localizer localizedStringForKey:output];
+            os_unfair_lock_lock(lockPointer);
+            if (exception != nil) {
+                // Report the failure of the earliest element, as a sequential decode would.
+                if (index < firstExceptionIndex) {
+                    firstException = exception;
+                    firstExceptionIndex = index;
                 }
+            } else {
+                outputArray[index] = convertedValue;
+            }
+            os_unfair_lock_unlock(lockPointer);
+        }
+    });
+    
+    if (firstException != nil) {
+        @throw firstException;
+    }
+    return outputArray;
+}
 
-                if (stringInterpolator != nil) {
-                    output = [stringInterpolator interpolatedStringForString:output];
+static id objectForPropertyPlan(ORKESerializationPropertyPlan *propertyPlan, id input, ORKESerializationContext *context) {
+    Class propertyClass = propertyPlan.valueClass;
+    ORKESerializationJSONToObjectBlock converterBlock = propertyPlan.jsonToObjectBlock;
+    
+    id output = nil;
+    if (input != nil) {
+        switch (propertyPlan.containerKind) {
+            case ORKESerializationContainerKindArray: {
+                NSArray *inputArray = DYNAMICCAST(input, NSArray);
+                if (inputArray == nil) {
+                    ORKESerializationRaiseMalformedInput(@"Expected an array of %@ but got %@", propertyClass, [input class]);
+                }
+                if (shouldDecodeArrayInParallel(inputArray, context)) {
+                    output = objectsForJsonObjectsInParallel(inputArray, propertyClass, converterBlock, context);
+                    break;
                 }
+                NSMutableArray *outputArray = [NSMutableArray arrayWithCapacity:inputArray.count];
+                for (id value in inputArray) {
+                    id convertedValue = objectForJsonObject(value, propertyClass, converterBlock, context);
+                    if (convertedValue == nil) {
+                        ORKESerializationRaiseMalformedInput(@"Could not convert to object of class %@", propertyClass);
+                    }
+                    [outputArray addObject:convertedValue];
+                }
+                output = outputArray;
+                break;
+            }
+            case ORKESerializationContainerKindDictionary: {
+                NSDictionary *inputDictionary = DYNAMICCAST(input, NSDictionary);
+                if (inputDictionary == nil) {
+                    ORKESerializationRaiseMalformedInput(@"Expected a dictionary of %@ but got %@", propertyClass, [input class]);
+                }
+                NSMutableDictionary *outputDictionary = [NSMutableDictionary dictionaryWithCapacity:inputDictionary.count];
+                for (NSString *key in inputDictionary) {
+                    id convertedValue = objectForJsonObject(inputDictionary[key], propertyClass, converterBlock, nil);
+                    if (convertedValue == nil) {
+                        ORKESerializationRaiseMalformedInput(@"Could not convert to object of class %@", propertyClass);
+                    }
+                    outputDictionary[key] = convertedValue;
+                }
+                output = outputDictionary;
+                break;
+            }
+            case ORKESerializationContainerKindObject: {
+                output = objectForJsonObject(input, propertyClass, converterBlock, context);
+                
+                // Localizable strings are localized and interpolated here, both for properties set after init and
+                // for those passed to init blocks. Certain formats (e.g. ORKTextChoiceAnswerFormat) contain text
+                // strings (e.g. 'Yes', 'No') that need to be localized but are already of the expected type.
+                if (propertyPlan.localizable && [output isKindOfClass:[NSString class]]) {
+                    output = localizedStringForString(output, context);
+                }
+                break;
             }
         }
     }
     return output;
 }
 
-@implementation ORKESerializationBundleLocalizer
+static id propFromDict(NSDictionary *dict, NSString *propName, ORKESerializationContext *context) {
+    ORKESerializationClassPlan *plan = ORKESerializationClassPlanForClass(NSClassFromString(dict[_ClassKey]));
+    ORKESerializationPropertyPlan *propertyPlan = plan.decodingProperties[propName];
+    if (propertyPlan == nil) {
+        ORKESerializationRaiseMalformedInput(@"Unexpected property %@ for class %@", propName, dict[_ClassKey]);
+    }
+    
+    return objectForPropertyPlan(propertyPlan, dict[propName], context);
+}
+
+@implementation ORKESerializationBundleLocalizer {
+    os_unfair_lock _stringsLock;
+    BOOL _stringsLoaded;
+    NSDictionary<NSString *, NSString *> *_strings;
+}
 
 - (instancetype)initWithBundle:(NSBundle *)bundle tableName:(NSString *)tableName {
     self = [super init];
     if (self) {
         _bundle = bundle;
         _tableName = [tableName copy];
+        _stringsLock = OS_UNFAIR_LOCK_INIT;
     }
     return self;
 }
 
+- (void)setBundle:(NSBundle *)bundle {
+    os_unfair_lock_lock(&_stringsLock);
+    _bundle = bundle;
+    _stringsLoaded = NO;
+    _strings = nil;
+    os_unfair_lock_unlock(&_stringsLock);
+}
+
+- (void)setTableName:(NSString *)tableName {
+    os_unfair_lock_lock(&_stringsLock);
+    _tableName = [tableName copy];
+    _stringsLoaded = NO;
+    _strings = nil;
+    os_unfair_lock_unlock(&_stringsLock);
+}
+
+// Loads the whole strings table once, so that each lookup is a dictionary access rather than a bundle
+// lookup. Returns nil when the table can't be read as a plain dictionary, for example when it has plural
+// rules in a .stringsdict file, and lookups then go through the bundle.
+- (NSDictionary<NSString *, NSString *> *)strings {
+    os_unfair_lock_lock(&_stringsLock);
+    if (!_stringsLoaded) {
+        NSString *tableName = _tableName.length > 0 ? _tableName : @"Localizable";
+        NSURL *stringsdictURL = [_bundle URLForResource:tableName withExtension:@"stringsdict"];
+        NSURL *stringsURL = [_bundle URLForResource:tableName withExtension:@"strings"];
+        if (stringsURL != nil && stringsdictURL == nil) {
+            NSDictionary *strings = [NSDictionary dictionaryWithContentsOfURL:stringsURL];
+            _strings = [strings isKindOfClass:[NSDictionary class]] ? strings : nil;
+        }
+        _stringsLoaded = YES;
+    }
+    NSDictionary<NSString *, NSString *> *strings = _strings;
+    os_unfair_lock_unlock(&_stringsLock);
+    return strings;
+}
+
 - (NSString *)localizedStringForKey:(NSString *)string
 {
     // Keys that exist in the localization table will be localized.
@@ -738,6 +1100,11 @@ static id propFromDict(NSDictionary *dict, NSString *propName, ORKESerialization
     // If the key is not found in the table the provided key string will be returned as is,
     // supporting the expected functionality for inputs that contain both strings to be
     // localized as well as strings to be displayed as is.
+    NSDictionary<NSString *, NSString *> *strings = [self strings];
+    if (strings != nil) {
+        NSString *localizedString = strings[string];
+        return [localizedString isKindOfClass:[NSString class]] ? localizedString : string;
+    }
     return [self.bundle localizedStringForKey:string value:string table:self.tableName];
 }
 
@@ -746,7 +1113,9 @@ static id propFromDict(NSDictionary *dict, NSString *propName, ORKESerialization
 
 #define NUMTOSTRINGBLOCK(table) ^id(id num, __unused ORKESerializationContext *context) { return table[((NSNumber *)num).unsignedIntegerValue]; }
 #define STRINGTONUMBLOCK(table) ^id(id string, __unused ORKESerializationContext *context) { NSUInteger index = [table indexOfObject:string]; \
-NSCAssert(index != NSNotFound, @"Expected valid entry from table %@", table); \
+if (index == NSNotFound) { \
+    ORKESerializationRaiseMalformedInput(@"Unexpected value %@, expected one of %@", string, table); \
+} \
 return @(index); \
 }
 
@@ -798,6 +1167,16 @@ static NSArray *numberFormattingStyleTable(void) {
     return table;
 }
 
+// Stroke data is written as the base64 string of its binary representation.
+static const ORKESerializationObjectToJSONBlock strokeDataToJSONBlock = ^id(id strokeData, __unused ORKESerializationContext *context) {
+    return [[(ORKStrokeData *)strokeData data] base64EncodedStringWithOptions:0];
+};
+
+static const ORKESerializationJSONToObjectBlock strokeDataFromJSONBlock = ^id(id string, __unused ORKESerializationContext *context) {
+    NSData *data = [[NSData alloc] initWithBase64EncodedString:string options:0];
+    return data ? [[ORKStrokeData alloc] initWithData:data] : nil;
+};
+
 static NSDictionary *dictionaryForORKSpeechRecognitionResult(void) {
     
     NSMutableDictionary *dict = [[NSMutableDictionary alloc] init];
@@ -1257,6 +1636,7 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                     PROPERTY(requireReversal, NSNumber, NSObject, YES, nil, nil),
                     PROPERTY(customTargetPluralName, NSString, NSObject, YES, nil, nil),
                     IMAGEPROPERTY(customTargetImage, NSObject, YES),
+                    PROPERTY(seed, NSNumber, NSObject, YES, nil, nil),
                     })),
            ENTRY(ORKWalkingTaskStep,
                  ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
@@ -1294,6 +1674,7 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                     PROPERTY(interStimulusInterval, NSNumber, NSObject, YES, nil, nil),
                     PROPERTY(stimulusDuration, NSNumber, NSObject, YES, nil, nil),
                     PROPERTY(seriesLength, NSNumber, NSObject, YES, nil, nil),
+                    PROPERTY(seed, NSNumber, NSObject, YES, nil, nil),
                     })),
            ENTRY(ORKRangeOfMotionStep,
                  ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
@@ -1347,13 +1728,15 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                              ^id(id date, __unused ORKESerializationContext *context) { return ORKEStringFromDateISO8601(date); },
                              ^id(id string, __unused ORKESerializationContext *context) { return ORKEDateFromStringISO8601(string); }),
                     PROPERTY(currentInterval, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(statistics, ORKResponseStatistics, NSObject, NO, nil, nil),
                     })),
            ENTRY(ORKStroopStep,
                  ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
                      return [[ORKStroopStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
                  },
                  (@{
-                    PROPERTY(numberOfAttempts, NSNumber, NSObject, YES, nil, nil)})),
+                    PROPERTY(numberOfAttempts, NSNumber, NSObject, YES, nil, nil),
+                    PROPERTY(seed, NSNumber, NSObject, YES, nil, nil)})),
            ENTRY(ORKAccuracyStroopStep,
                  ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
                      return [[ORKAccuracyStroopStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
@@ -1429,11 +1812,21 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                      return [[ORKStreamingAudioRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict, identifier)];
                  },
                  (@{
+                    PROPERTY(chunkEncoding, NSNumber, NSObject, YES, nil, nil),
+                    PROPERTY(chunkDuration, NSNumber, NSObject, YES, nil, nil),
                     })),
            ENTRY(ORKAudioStreamerConfiguration,
            ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
                return [[ORKAudioStreamerConfiguration alloc] initWithIdentifier:GETPROP(dict, identifier)];
            },
+                 (@{
+                    PROPERTY(chunkEncoding, NSNumber, NSObject, YES, nil, nil),
+                    PROPERTY(chunkDuration, NSNumber, NSObject, YES, nil, nil),
+                    })),
+           ENTRY(ORKAcousticFeatureRecorderConfiguration,
+                 ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+                     return [[ORKAcousticFeatureRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict, identifier)];
+                 },
                  (@{
                     })),
            ENTRY(ORKAccelerometerRecorderConfiguration,
@@ -1441,7 +1834,8 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                      return [[ORKAccelerometerRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict, identifier) frequency:((NSNumber *)GETPROP(dict, frequency)).doubleValue];
                  },
                  (@{
-                    PROPERTY(frequency, NSNumber, NSObject, NO, nil, nil)
+                    PROPERTY(frequency, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(analyzesTremor, NSNumber, NSObject, YES, nil, nil),
                     })),
            ENTRY(ORKAudioRecorderConfiguration,
                  ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
@@ -1463,6 +1857,7 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                     PROPERTY(eyeSide, NSNumber, NSObject, NO, nil, nil),
                     PROPERTY(imageFileResult, ORKFileResult, NSObject, NO, nil, nil),
                     PROPERTY(drawingPathFileResult, ORKFileResult, NSObject, NO, nil, nil),
+                    PROPERTY(strokeData, ORKStrokeData, NSObject, YES, strokeDataToJSONBlock, strokeDataFromJSONBlock),
                     })),
            ENTRY(ORKConsentDocument,
                  nil,
@@ -1599,6 +1994,8 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                  (@{
                     PROPERTY(frequency, NSNumber, NSObject, NO, nil, nil),
                     PROPERTY(rollingFileSizeThreshold, NSNumber, NSObject, YES, nil, nil),
+                    PROPERTY(analyzesGait, NSNumber, NSObject, YES, nil, nil),
+                    PROPERTY(analyzesTremor, NSNumber, NSObject, YES, nil, nil),
                     })),
            ENTRY(ORKdBHLToneAudiometryOnboardingStep,
                  ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
@@ -2024,6 +2421,8 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                      return [[ORKTouchRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict,identifier)];
                  },
                  (@{
+                    PROPERTY(recordsCoalescedTouches, NSNumber, NSObject, YES, nil, nil),
+                    PROPERTY(recordsPredictedTouches, NSNumber, NSObject, YES, nil, nil),
                     })),
            ENTRY(ORKResult,
                  nil,
@@ -2061,7 +2460,8 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                              ^id(id dict, __unused ORKESerializationContext *context) { return [NSValue valueWithCGRect:rectFromDictionary(dict)]; }),
                     PROPERTY(buttonRect2, NSValue, NSObject, NO,
                              ^id(id value, __unused ORKESerializationContext *context) { return value?dictionaryFromCGRect(((NSValue *)value).CGRectValue):nil; },
-                             ^id(id dict, __unused ORKESerializationContext *context) { return [NSValue valueWithCGRect:rectFromDictionary(dict)]; })
+                             ^id(id dict, __unused ORKESerializationContext *context) { return [NSValue valueWithCGRect:rectFromDictionary(dict)]; }),
+                    PROPERTY(statistics, ORKResponseStatistics, NSObject, NO, nil, nil)
                     })),
            ENTRY(ORKTrailmakingTap,
                  nil,
@@ -2163,7 +2563,8 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                  nil,
                  (@{
                     PROPERTY(timestamp, NSNumber, NSObject, NO, nil, nil),
-                    PROPERTY(fileResults, NSArray<ORKResult *>, NSObject, NO, nil, nil)
+                    PROPERTY(fileResults, NSArray<ORKResult *>, NSObject, NO, nil, nil),
+                    PROPERTY(statistics, ORKResponseStatistics, NSObject, NO, nil, nil)
                     })),
            ENTRY(ORKSpeechInNoiseResult,
            nil,
@@ -2181,7 +2582,8 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                     PROPERTY(endTime, NSNumber, NSObject, NO, nil, nil),
                     PROPERTY(color, NSString, NSObject, NO, nil, nil),
                     PROPERTY(text, NSString, NSObject, NO, nil, nil),
-                    PROPERTY(colorSelected, NSString, NSObject, NO, nil, nil)
+                    PROPERTY(colorSelected, NSString, NSObject, NO, nil, nil),
+                    PROPERTY(statistics, ORKResponseStatistics, NSObject, NO, nil, nil)
                     })),
            ENTRY(ORKAccuracyStroopResult,
                  nil,
@@ -2197,6 +2599,65 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                     PROPERTY(timeLimit, NSNumber, NSObject, NO, nil, nil),
                     PROPERTY(duration, NSNumber, NSObject, NO, nil, nil),
                     })),
+           ENTRY(ORKGaitSummaryResult,
+                 nil,
+                 (@{
+                    PROPERTY(numberOfSteps, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(cadence, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(meanStrideTime, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(strideTimeVariability, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(stepTimeAsymmetry, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(swayRootMeanSquare, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(analyzedDuration, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(droppedSampleCount, NSNumber, NSObject, NO, nil, nil),
+                    })),
+           ENTRY(ORKTremorAxisSpectrum,
+                 nil,
+                 (@{
+                    PROPERTY(dominantFrequency, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(bandPower4To6Hz, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(bandPower6To12Hz, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(totalPower, NSNumber, NSObject, NO, nil, nil),
+                    })),
+           ENTRY(ORKTremorSpectrumWindow,
+                 nil,
+                 (@{
+                    PROPERTY(startTime, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(x, ORKTremorAxisSpectrum, NSObject, NO, nil, nil),
+                    PROPERTY(y, ORKTremorAxisSpectrum, NSObject, NO, nil, nil),
+                    PROPERTY(z, ORKTremorAxisSpectrum, NSObject, NO, nil, nil),
+                    })),
+           ENTRY(ORKTremorSpectrumResult,
+                 nil,
+                 (@{
+                    PROPERTY(sampleRate, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(windowLength, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(x, ORKTremorAxisSpectrum, NSObject, NO, nil, nil),
+                    PROPERTY(y, ORKTremorAxisSpectrum, NSObject, NO, nil, nil),
+                    PROPERTY(z, ORKTremorAxisSpectrum, NSObject, NO, nil, nil),
+                    PROPERTY(windows, ORKTremorSpectrumWindow, NSArray, NO, nil, nil),
+                    })),
+           ENTRY(ORKResponseStatistics,
+                 nil,
+                 (@{
+                    PROPERTY(count, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(mean, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(standardDeviation, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(coefficientOfVariation, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(minimum, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(maximum, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(median, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(percentile10, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(percentile90, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(errorCount, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(lapseCount, NSNumber, NSObject, NO, nil, nil),
+                    })),
+           ENTRY(ORKTrialPlanResult,
+                 nil,
+                 (@{
+                    PROPERTY(seed, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(stimuli, NSArray, NSArray, NO, nil, nil),
+                    })),
            ENTRY(ORKPSATSample,
                  nil,
                  (@{
@@ -2217,6 +2678,7 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                     PROPERTY(totalTime, NSNumber, NSObject, NO, nil, nil),
                     PROPERTY(initialDigit, NSNumber, NSObject, NO, nil, nil),
                     PROPERTY(samples, ORKPSATSample, NSArray, NO, nil, nil),
+                    PROPERTY(statistics, ORKResponseStatistics, NSObject, NO, nil, nil),
                     })),
            ENTRY(ORKRangeOfMotionResult,
                  nil,
@@ -2226,6 +2688,9 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                     PROPERTY(minimum, NSNumber, NSObject, NO, nil, nil),
                     PROPERTY(maximum, NSNumber, NSObject, NO, nil, nil),
                     PROPERTY(range, NSNumber, NSObject, NO, nil, nil),
+                    PROPERTY(timestamps, NSNumber, NSArray, NO, nil, nil),
+                    PROPERTY(angles, NSNumber, NSArray, NO, nil, nil),
+                    PROPERTY(rejectedSampleCount, NSNumber, NSObject, NO, nil, nil),
                     })),
            ENTRY(ORKTowerOfHanoiResult,
                  nil,
@@ -2371,6 +2836,7 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
            ENTRY(ORKSignatureResult,
                  nil,
                  (@{
+                    PROPERTY(strokeData, ORKStrokeData, NSObject, YES, strokeDataToJSONBlock, strokeDataFromJSONBlock),
                     })),
            ENTRY(ORKCollectionResult,
                  nil,
@@ -2397,6 +2863,25 @@ static NSMutableDictionary<NSString *, ORKESerializableTableEntry *> *ORKESerial
                  nil,
                  (@{
                     })),
+           ENTRY(ORKTaskResultDiff,
+                 ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+               return [[ORKTaskResultDiff alloc] initWithTaskIdentifier:GETPROP(dict, identifier) taskRunUUID:GETPROP(dict, taskRunUUID)];
+                 },
+                 (@{
+                    PROPERTY(identifier, NSString, NSObject, NO, nil, nil),
+                    PROPERTY(taskRunUUID, NSUUID, NSObject, NO,
+                             ^id(id uuid, __unused ORKESerializationContext *context) { return [uuid UUIDString]; },
+                             ^id(id string, __unused ORKESerializationContext *context) { return [[NSUUID alloc] initWithUUIDString:string]; }),
+                    PROPERTY(startDate, NSDate, NSObject, YES,
+                             ^id(id date, __unused ORKESerializationContext *context) { return ORKEStringFromDateISO8601(date); },
+                             ^id(id string, __unused ORKESerializationContext *context) { return ORKEDateFromStringISO8601(string); }),
+                    PROPERTY(endDate, NSDate, NSObject, YES,
+                             ^id(id date, __unused ORKESerializationContext *context) { return ORKEStringFromDateISO8601(date); },
+                             ^id(id string, __unused ORKESerializationContext *context) { return ORKEDateFromStringISO8601(string); }),
+                    PROPERTY(stepResults, ORKStepResult, NSArray, YES, nil, nil),
+                    PROPERTY(removedStepResultIdentifiers, NSString, NSArray, YES, nil, nil),
+                    PROPERTY(removedChildResultIdentifiers, NSArray, NSDictionary, YES, nil, nil),
+                    })),
            ENTRY(ORKVideoInstructionStepResult,
                  nil,
                  (@{
@@ -2624,10 +3109,6 @@ static id objectForJsonObject(id input,
         }
     }
     
-    id<ORKESerializationLocalizer> localizer = context.localizer;
-    id<ORKESerializationStringInterpolator> stringInterpolator = context.stringInterpolator;
-    
-    
     if (expectedClass != nil && [input isKindOfClass:expectedClass]) {
         // Input is already of the expected class, do nothing
         output = input;
@@ -2642,14 +3123,18 @@ static id objectForJsonObject(id input,
             dict = [propertyInjector injectedDictionaryWithDictionary:dictionary];
         }
 
-        if (expectedClass != nil) {
-            NSCAssert([NSClassFromString(className) isSubclassOfClass:expectedClass], @"Expected subclass of %@ but got %@", expectedClass, className);
+        if (![className isKindOfClass:[NSString class]]) {
+            ORKESerializationRaiseMalformedInput(@"Expected a class name for %@ but got %@", expectedClass, className);
+        }
+        if (expectedClass != nil && ![NSClassFromString(className) isSubclassOfClass:expectedClass]) {
+            ORKESerializationRaiseMalformedInput(@"Expected subclass of %@ but got %@", expectedClass, className);
+        }
+        ORKESerializationClassPlan *plan = ORKESerializationClassPlanForClass(NSClassFromString(className));
+        if (!plan.serializable) {
+            ORKESerializationRaiseMalformedInput(@"Expected serializable class but got %@", className);
         }
-        NSArray *classEncodings = classEncodingsForClass(NSClassFromString(className));
-        NSCAssert([classEncodings count] > 0, @"Expected serializable class but got %@", className);
         
-        ORKESerializableTableEntry *leafClassEncoding = classEncodings.firstObject;
-        ORKESerializationInitBlock initBlock = leafClassEncoding.initBlock;
+        ORKESerializationInitBlock initBlock = plan.initBlock;
         BOOL writeAllProperties = YES;
         if (initBlock != nil) {
             output = initBlock(dict,
@@ -2657,46 +3142,51 @@ static id objectForJsonObject(id input,
                                    return propFromDict(propDict, param, context); });
             writeAllProperties = NO;
         } else {
-            Class class = NSClassFromString(className);
-            output = [[class alloc] init];
+            output = [[plan.planClass alloc] init];
         }
         
-        for (NSString *key in [dict allKeys]) {
+        NSDictionary<NSString *, ORKESerializationPropertyPlan *> *decodingProperties = plan.decodingProperties;
+        for (NSString *key in dict) {
             if ([key isEqualToString:_ClassKey]) {
                 continue;
             }
             
-            BOOL haveSetProp = NO;
-            for (ORKESerializableTableEntry *encoding in classEncodings) {
-                NSDictionary *propertyTable = encoding.properties;
-                ORKESerializableProperty *propertyEntry = propertyTable[key];
-                if (propertyEntry != nil) {
-                    // Only write the property if it has not already been set during init
-                    if (writeAllProperties || propertyEntry.writeAfterInit) {
-                        id property = propFromDict(dict, key, context);
-                        if ([property isKindOfClass: [NSString class]] && ![key isEqualToString:@"identifier"]) {
-                            if (localizer != nil) {
-                                property = [localizer localizedStringForKey:property];
-                            }
-
-                            if (stringInterpolator != nil) {
-                                property = [stringInterpolator interpolatedStringForString:property];
-                            }
-                        }
-                        [output setValue:property forKey:key];
-                    }
-                    haveSetProp = YES;
-                    break;
-                }
+            ORKESerializationPropertyPlan *propertyPlan = decodingProperties[key];
+            if (propertyPlan == nil) {
+                ORKESerializationRaiseMalformedInput(@"Unexpected property on %@: %@", className, key);
+            }
+            
+            // Only write the property if it has not already been set during init
+            if (writeAllProperties || propertyPlan.writeAfterInit) {
+                // Localizable strings were already localized and interpolated by objectForPropertyPlan.
+                id property = objectForPropertyPlan(propertyPlan, dict[key], context);
+                [output setValue:property forKey:key];
             }
-            NSCAssert(haveSetProp, @"Unexpected property on %@: %@", className, key);
         }
     } else {
-        NSCAssert(0, @"Unexpected input of class %@ for %@", [input class], expectedClass);
+        ORKESerializationRaiseMalformedInput(@"Unexpected input of class %@ for %@", [input class], expectedClass);
     }
     return output;
 }
 
+// Decodes a JSON object, returning nil and the reason in `error` if the input is malformed.
+static id objectForJsonObjectReportingError(id input, ORKESerializationContext *context, NSError **error) {
+    @try {
+        return objectForJsonObject(input, nil, nil, context);
+    }
+    @catch (NSException *exception) {
+        if (![exception.name isEqualToString:ORKESerializationMalformedInputException]) {
+            @throw;
+        }
+        if (error != NULL) {
+            *error = [NSError errorWithDomain:ORKErrorDomain
+                                         code:ORKErrorInvalidObject
+                                     userInfo:@{NSDebugDescriptionErrorKey: exception.reason}];
+        }
+        return nil;
+    }
+}
+
 static BOOL isValid(id object) {
     return [NSJSONSerialization isValidJSONObject:object] || [object isKindOfClass:[NSValue class]] || [object isKindOfClass:[NSNumber class]] || [object isKindOfClass:[NSString class]] || [object isKindOfClass:[NSNull class]] || [object isKindOfClass:[ORKNoAnswer class]];
 }
@@ -2710,57 +3200,45 @@ static id jsonObjectForObject(id object, ORKESerializationContext *context) {
     id jsonOutput = nil;
     Class c = [object class];
     
-    NSArray *classEncodings = classEncodingsForClass(c);
+    ORKESerializationClassPlan *plan = ORKESerializationClassPlanForClass(c);
     
-    if ([classEncodings count]) {
+    if (plan.serializable) {
         NSMutableDictionary *encodedDict = [NSMutableDictionary dictionary];
-        encodedDict[_ClassKey] = NSStringFromClass(c);
+        encodedDict[_ClassKey] = plan.className;
         
-        NSMutableSet<NSString *> *excludedPoperties = [NSMutableSet set];
-        for (ORKESerializableTableEntry *encoding in classEncodings) {
-            NSDictionary<NSString *, ORKESerializableProperty *> *propertyTable = encoding.properties;
-            for (NSString *propertyName in [propertyTable allKeys]) {
-                ORKESerializableProperty *propertyEntry = propertyTable[propertyName];
-                if (propertyEntry.skipSerialization) {
-                    [excludedPoperties addObject:propertyEntry.propertyName];
-                    continue;
-                }
-                if ([excludedPoperties containsObject:propertyEntry.propertyName]) {
-                    continue;
-                }
-                ORKESerializationObjectToJSONBlock converter = propertyEntry.objectToJSONBlock;
-                Class containerClass = propertyEntry.containerClass;
-                id valueForKey = [object valueForKey:propertyName];
-                if (valueForKey != nil) {
-                    if ([containerClass isSubclassOfClass:[NSArray class]]) {
-                        NSMutableArray *a = [NSMutableArray array];
-                        for (id valueItem in valueForKey) {
-                            id outputItem;
-                            if (converter != nil) {
-                                outputItem = converter(valueItem, context);
-                                NSCAssert(isValid(valueItem), @"Expected valid JSON object");
-                            } else {
-                                // Recurse for each property
-                                outputItem = jsonObjectForObject(valueItem, context);
-                            }
-                            [a addObject:outputItem];
-                        }
-                        valueForKey = a;
-                    } else {
+        for (ORKESerializationPropertyPlan *propertyPlan in plan.encodingProperties) {
+            NSString *propertyName = propertyPlan.propertyName;
+            ORKESerializationObjectToJSONBlock converter = propertyPlan.objectToJSONBlock;
+            id valueForKey = [object valueForKey:propertyName];
+            if (valueForKey != nil) {
+                if (propertyPlan.containerKind == ORKESerializationContainerKindArray) {
+                    NSMutableArray *a = [NSMutableArray array];
+                    for (id valueItem in valueForKey) {
+                        id outputItem;
                         if (converter != nil) {
-                            valueForKey = converter(valueForKey, context);
-                            NSCAssert((valueForKey == nil) || isValid(valueForKey), @"Expected valid JSON object");
+                            outputItem = converter(valueItem, context);
+                            NSCAssert(isValid(valueItem), @"Expected valid JSON object");
                         } else {
                             // Recurse for each property
-                            valueForKey = jsonObjectForObject(valueForKey, context);
+                            outputItem = jsonObjectForObject(valueItem, context);
                         }
+                        [a addObject:outputItem];
+                    }
+                    valueForKey = a;
+                } else {
+                    if (converter != nil) {
+                        valueForKey = converter(valueForKey, context);
+                        NSCAssert((valueForKey == nil) || isValid(valueForKey), @"Expected valid JSON object");
+                    } else {
+                        // Recurse for each property
+                        valueForKey = jsonObjectForObject(valueForKey, context);
                     }
-                }
-                
-                if (valueForKey != nil) {
-                    encodedDict[propertyName] = valueForKey;
                 }
             }
+            
+            if (valueForKey != nil) {
+                encodedDict[propertyName] = valueForKey;
+            }
         }
         
         jsonOutput = encodedDict;
@@ -2789,6 +3267,104 @@ static id jsonObjectForObject(id object, ORKESerializationContext *context) {
     return jsonOutput;
 }
 
+// Returns YES for the values jsonObjectForObject converts to nil, which are left out of their container.
+static BOOL isOmittedFromJSON(id object) {
+    if (object == nil) {
+        return YES;
+    }
+    Class c = [object class];
+    return !ORKESerializationClassPlanForClass(c).serializable && [c isSubclassOfClass:[NSPredicate class]];
+}
+
+static void writeClassKey(ORKStreamWriter *writer, ORKESerializationClassPlan *plan) {
+    [writer writeKey:_ClassKey];
+    [writer writeString:plan.className];
+}
+
+// Writes the same values as jsonObjectForObject produces, without building them first.
+static void writeObject(id object, ORKStreamWriter *writer, ORKESerializationContext *context) {
+    if (writer.error != nil || object == nil) {
+        return;
+    }
+    
+    Class c = [object class];
+    ORKESerializationClassPlan *plan = ORKESerializationClassPlanForClass(c);
+    
+    if (plan.serializable) {
+        [writer beginObject];
+        BOOL wroteClassKey = NO;
+        for (ORKESerializationPropertyPlan *propertyPlan in plan.sortedEncodingProperties) {
+            NSString *propertyName = propertyPlan.propertyName;
+            if (!wroteClassKey && [_ClassKey compare:propertyName] == NSOrderedAscending) {
+                writeClassKey(writer, plan);
+                wroteClassKey = YES;
+            }
+            
+            ORKESerializationObjectToJSONBlock converter = propertyPlan.objectToJSONBlock;
+            id valueForKey = [object valueForKey:propertyName];
+            if (valueForKey == nil) {
+                continue;
+            }
+            
+            if (propertyPlan.containerKind == ORKESerializationContainerKindArray && converter == nil && ORKStreamWriterIsNumericArray(valueForKey)) {
+                [writer writeKey:propertyName];
+                [writer writeNumericArray:valueForKey];
+            } else if (propertyPlan.containerKind == ORKESerializationContainerKindArray) {
+                [writer writeKey:propertyName];
+                [writer beginArray];
+                for (id valueItem in valueForKey) {
+                    // Keeps the converted values of large arrays from accumulating.
+                    @autoreleasepool {
+                        if (converter != nil) {
+                            [writer writeJSONObject:converter(valueItem, context) ? : [NSNull null]];
+                        } else {
+                            writeObject(valueItem, writer, context);
+                        }
+                    }
+                }
+                [writer endArray];
+            } else if (converter != nil) {
+                id jsonValue = converter(valueForKey, context);
+                if (jsonValue != nil) {
+                    [writer writeKey:propertyName];
+                    [writer writeJSONObject:jsonValue];
+                }
+            } else if (!isOmittedFromJSON(valueForKey)) {
+                [writer writeKey:propertyName];
+                writeObject(valueForKey, writer, context);
+            }
+        }
+        if (!wroteClassKey) {
+            writeClassKey(writer, plan);
+        }
+        [writer endObject];
+    } else if ([c isSubclassOfClass:[NSArray class]] && ORKStreamWriterIsNumericArray(object)) {
+        [writer writeNumericArray:object];
+    } else if ([c isSubclassOfClass:[NSArray class]]) {
+        [writer beginArray];
+        for (id input in (NSArray *)object) {
+            @autoreleasepool {
+                writeObject(input, writer, context);
+            }
+        }
+        [writer endArray];
+    } else if ([c isSubclassOfClass:[NSDictionary class]]) {
+        NSDictionary *inputDict = (NSDictionary *)object;
+        [writer beginObject];
+        for (NSString *key in [inputDict.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+            id value = inputDict[key];
+            if (!isOmittedFromJSON(value)) {
+                [writer writeKey:key];
+                writeObject(value, writer, context);
+            }
+        }
+        [writer endObject];
+    } else if (![c isSubclassOfClass:[NSPredicate class]]) {  // Ignore NSPredicate which cannot be easily serialized for now
+        // Leaf: native JSON object
+        [writer writeJSONObject:object];
+    }
+}
+
 + (NSDictionary *)JSONObjectForObject:(id)object error:(__unused NSError * __autoreleasing *)error {
     return [self JSONObjectForObject:object context:[[ORKESerializationContext alloc] initWithLocalizer:nil imageProvider:nil stringInterpolator:nil propertyInjector:nil] error:error];
 }
@@ -2798,12 +3374,12 @@ static id jsonObjectForObject(id object, ORKESerializationContext *context) {
     return json;
 }
 
-+ (id)objectFromJSONObject:(NSDictionary *)object error:(__unused NSError * __autoreleasing *)error {
-    return objectForJsonObject(object, nil, nil, [[ORKESerializationContext alloc] initWithLocalizer:nil imageProvider:nil stringInterpolator:nil propertyInjector:nil]);
++ (id)objectFromJSONObject:(NSDictionary *)object error:(NSError * __autoreleasing *)error {
+    return objectForJsonObjectReportingError(object, [[ORKESerializationContext alloc] initWithLocalizer:nil imageProvider:nil stringInterpolator:nil propertyInjector:nil], error);
 }
 
-+ (id)objectFromJSONObject:(NSDictionary *)object context:(ORKESerializationContext *)context error:(__unused NSError * __autoreleasing *)error {
-    return objectForJsonObject(object, nil, nil, context);
++ (id)objectFromJSONObject:(NSDictionary *)object context:(ORKESerializationContext *)context error:(NSError * __autoreleasing *)error {
+    return objectForJsonObjectReportingError(object, context, error);
 }
 
 + (NSData *)JSONDataForObject:(id)object error:(NSError * __autoreleasing *)error {
@@ -2815,7 +3391,75 @@ static id jsonObjectForObject(id object, ORKESerializationContext *context) {
     id json = [NSJSONSerialization JSONObjectWithData:data options:(NSJSONReadingOptions)0 error:error];
     id ret = nil;
     if (json != nil) {
-        ret = objectForJsonObject(json, nil, nil, [[ORKESerializationContext alloc] initWithLocalizer:nil imageProvider:nil stringInterpolator:nil propertyInjector:nil]);
+        ret = objectForJsonObjectReportingError(json, [[ORKESerializationContext alloc] initWithLocalizer:nil imageProvider:nil stringInterpolator:nil propertyInjector:nil], error);
+    }
+    return ret;
+}
+
++ (BOOL)writeJSONForObject:(id)object
+            toOutputStream:(NSOutputStream *)outputStream
+                   context:(ORKESerializationContext *)context
+                     error:(NSError * __autoreleasing *)error {
+    if (context == nil) {
+        context = [[ORKESerializationContext alloc] initWithLocalizer:nil imageProvider:nil stringInterpolator:nil propertyInjector:nil];
+    }
+    ORKJSONStreamWriter *writer = [[ORKJSONStreamWriter alloc] initWithOutputStream:outputStream];
+    writeObject(object, writer, context);
+    BOOL success = [writer flush];
+    if (!success && error != NULL) {
+        *error = writer.error;
+    }
+    return success;
+}
+
++ (BOOL)writeJSONForObject:(id)object
+               toFileAtURL:(NSURL *)fileURL
+                   context:(ORKESerializationContext *)context
+                     error:(NSError * __autoreleasing *)error {
+    NSOutputStream *outputStream = [NSOutputStream outputStreamWithURL:fileURL append:NO];
+    [outputStream open];
+    BOOL success = [self writeJSONForObject:object toOutputStream:outputStream context:context error:error];
+    [outputStream close];
+    return success;
+}
+
++ (BOOL)writeCBORForObject:(id)object
+            toOutputStream:(NSOutputStream *)outputStream
+                   context:(ORKESerializationContext *)context
+                     error:(NSError * __autoreleasing *)error {
+    if (context == nil) {
+        context = [[ORKESerializationContext alloc] initWithLocalizer:nil imageProvider:nil stringInterpolator:nil propertyInjector:nil];
+    }
+    ORKCBORStreamWriter *writer = [[ORKCBORStreamWriter alloc] initWithOutputStream:outputStream];
+    writeObject(object, writer, context);
+    BOOL success = [writer flush];
+    if (!success && error != NULL) {
+        *error = writer.error;
+    }
+    return success;
+}
+
++ (NSData *)CBORDataForObject:(id)object error:(NSError * __autoreleasing *)error {
+    NSOutputStream *outputStream = [NSOutputStream outputStreamToMemory];
+    [outputStream open];
+    BOOL success = [self writeCBORForObject:object toOutputStream:outputStream context:nil error:error];
+    NSData *data = [outputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+    [outputStream close];
+    return success ? data : nil;
+}
+
++ (id)JSONObjectFromCBORData:(NSData *)data error:(NSError * __autoreleasing *)error {
+    return [ORKCBORDecoder JSONObjectWithData:data error:error];
+}
+
++ (id)objectFromCBORData:(NSData *)data context:(ORKESerializationContext *)context error:(NSError * __autoreleasing *)error {
+    id json = [ORKCBORDecoder JSONObjectWithData:data error:error];
+    id ret = nil;
+    if (json != nil) {
+        if (context == nil) {
+            context = [[ORKESerializationContext alloc] initWithLocalizer:nil imageProvider:nil stringInterpolator:nil propertyInjector:nil];
+        }
+        ret = objectForJsonObjectReportingError(json, context, error);
     }
     return ret;
 }
@@ -2831,12 +3475,7 @@ static id jsonObjectForObject(id object, ORKESerializationContext *context) {
 
 
 + (NSArray<NSString *> *)serializedPropertiesForClass:(Class)c {
-    NSArray<ORKESerializableTableEntry *> *entries = classEncodingsForClass(c);
-    NSMutableArray *properties = [NSMutableArray array];
-    for (ORKESerializableTableEntry *entry in entries) {
-        [properties addObjectsFromArray:[entry.properties allKeys]];
-    }
-    return properties;
+    return ORKESerializationClassPlanForClass(c).propertyNames ? : @[];
 }
 
 @end
@@ -2856,6 +3495,7 @@ static id jsonObjectForObject(id object, ORKESerializationContext *context) {
         entry = [[ORKESerializableTableEntry alloc] initWithClass:serializableClass initBlock:initBlock properties:@{}];
         encodingTable[NSStringFromClass(serializableClass)] = entry;
     }
+    ORKESerializationInvalidateClassPlans();
 }
 
 + (void)registerSerializableClassPropertyName:(NSString *)propertyName
@@ -2893,6 +3533,7 @@ static id jsonObjectForObject(id object, ORKESerializationContext *context) {
         property.jsonToObjectBlock = jsonToObjectBlock;
         property.skipSerialization = skipSerialization;
     }
+    ORKESerializationInvalidateClassPlans();
 }
 
 @end
@@ -0,0 +1,197 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKJSONStreamWriter.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+
+@implementation ORKJSONStreamWriter {
+    // One entry per open object or array: whether it already has a member.
+    NSMutableData *_hasMembers;
+    BOOL _expectingValueForKey;
+}
+
+- (instancetype)initWithOutputStream:(NSOutputStream *)outputStream bufferSize:(NSUInteger)bufferSize {
+    self = [super initWithOutputStream:outputStream bufferSize:bufferSize];
+    if (self) {
+        _hasMembers = [NSMutableData data];
+    }
+    return self;
+}
+
+- (void)appendCString:(const char *)string {
+    [self appendBytes:string length:strlen(string)];
+}
+
+#pragma mark - Structure
+
+- (void)beginValue {
+    if (_expectingValueForKey) {
+        _expectingValueForKey = NO;
+        return;
+    }
+    NSUInteger depth = _hasMembers.length;
+    if (depth > 0) {
+        BOOL *hasMembers = (BOOL *)_hasMembers.mutableBytes + (depth - 1);
+        if (*hasMembers) {
+            [self appendBytes:"," length:1];
+        }
+        *hasMembers = YES;
+    }
+}
+
+- (void)pushContainer:(const char *)opening {
+    [self beginValue];
+    [self appendBytes:opening length:1];
+    BOOL hasMembers = NO;
+    [_hasMembers appendBytes:&hasMembers length:sizeof(hasMembers)];
+}
+
+- (void)popContainer:(const char *)closing {
+    NSAssert(_hasMembers.length > 0 && !_expectingValueForKey, @"Unbalanced JSON container");
+    if (_hasMembers.length > 0) {
+        _hasMembers.length -= 1;
+    }
+    [self appendBytes:closing length:1];
+}
+
+- (void)beginObject {
+    [self pushContainer:"{"];
+}
+
+- (void)endObject {
+    [self popContainer:"}"];
+}
+
+- (void)beginArray {
+    [self pushContainer:"["];
+}
+
+- (void)endArray {
+    [self popContainer:"]"];
+}
+
+- (void)writeKey:(NSString *)key {
+    NSAssert(_hasMembers.length > 0 && !_expectingValueForKey, @"A key must be followed by a value");
+    [self beginValue];
+    [self appendEscapedString:key];
+    [self appendBytes:":" length:1];
+    _expectingValueForKey = YES;
+}
+
+#pragma mark - Values
+
+- (void)appendEscapedString:(NSString *)string {
+    // Escapes the same characters as NSJSONSerialization, including the solidus.
+    static const char hexDigits[] = "0123456789abcdef";
+    // Walk the encoded bytes by length: a C string would end at an embedded U+0000.
+    NSData *utf8Data = [string dataUsingEncoding:NSUTF8StringEncoding];
+    if (utf8Data == nil) {
+        [self failWithInvalidObjectDescription:@"Invalid string (not representable in UTF-8) in JSON write"];
+        return;
+    }
+    const char *utf8 = utf8Data.bytes;
+    const char *end = utf8 + utf8Data.length;
+    [self appendBytes:"\"" length:1];
+    const char *runStart = utf8;
+    for (const char *cursor = utf8; cursor < end; cursor++) {
+        unsigned char c = (unsigned char)*cursor;
+        const char *escape = NULL;
+        char unicodeEscape[7];
+        switch (c) {
+            case '"': escape = "\\\""; break;
+            case '\\': escape = "\\\\"; break;
+            case '/': escape = "\\/"; break;
+            case '\n': escape = "\\n"; break;
+            case '\r': escape = "\\r"; break;
+            case '\t': escape = "\\t"; break;
+            case '\b': escape = "\\b"; break;
+            case '\f': escape = "\\f"; break;
+            default:
+                if (c < 0x20) {
+                    unicodeEscape[0] = '\\';
+                    unicodeEscape[1] = 'u';
+                    unicodeEscape[2] = '0';
+                    unicodeEscape[3] = '0';
+                    unicodeEscape[4] = hexDigits[c >> 4];
+                    unicodeEscape[5] = hexDigits[c & 0xF];
+                    unicodeEscape[6] = '\0';
+                    escape = unicodeEscape;
+                }
+                break;
+        }
+        if (escape != NULL) {
+            [self appendBytes:runStart length:(NSUInteger)(cursor - runStart)];
+            [self appendCString:escape];
+            runStart = cursor + 1;
+        }
+    }
+    [self appendBytes:runStart length:(NSUInteger)(end - runStart)];
+    [self appendBytes:"\"" length:1];
+}
+
+- (void)writeString:(NSString *)string {
+    [self beginValue];
+    [self appendEscapedString:string];
+}
+
+- (void)writeNumber:(NSNumber *)number {
+    char text[32];
+    if (ORKStreamWriterIsBoolean(number)) {
+        snprintf(text, sizeof(text), "%s", number.boolValue ? "true" : "false");
+    } else if (CFNumberIsFloatType((__bridge CFNumberRef)number)) {
+        double value = number.doubleValue;
+        if (!isfinite(value)) {
+            [self failWithInvalidObjectDescription:[NSString stringWithFormat:@"Invalid number value (%@) in JSON write", number]];
+            return;
+        }
+        // Shortest form that reads back as the same double.
+        snprintf(text, sizeof(text), "%.15g", value);
+        if (strtod(text, NULL) != value) {
+            snprintf(text, sizeof(text), "%.17g", value);
+        }
+    } else if (strcmp(number.objCType, @encode(unsigned long long)) == 0) {
+        snprintf(text, sizeof(text), "%llu", number.unsignedLongLongValue);
+    } else {
+        snprintf(text, sizeof(text), "%lld", number.longLongValue);
+    }
+    [self beginValue];
+    [self appendCString:text];
+}
+
+- (void)writeNull {
+    [self beginValue];
+    [self appendCString:"null"];
+}
+
+@end
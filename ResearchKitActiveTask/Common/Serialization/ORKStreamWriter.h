@@ -0,0 +1,111 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The base class of the writers that serialize a tree of values to an output stream one token
+ at a time.
+ 
+ Output goes through a fixed-size buffer that is written to the stream whenever it fills, so the
+ memory used does not depend on the size of the document. The caller balances
+ `beginObject`/`endObject` and `beginArray`/`endArray` and writes a key before each value inside
+ an object; subclasses implement these for their format.
+ 
+ After the first failure, further writes are ignored and `error` describes the failure.
+ */
+@interface ORKStreamWriter : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithOutputStream:(NSOutputStream *)outputStream;
+
+/**
+ Returns a writer for an open output stream.
+ 
+ @param outputStream    The stream to write to. The writer does not open or close it.
+ @param bufferSize      The number of bytes collected before each write to the stream.
+ */
+- (instancetype)initWithOutputStream:(NSOutputStream *)outputStream bufferSize:(NSUInteger)bufferSize NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly, nullable) NSError *error;
+
+- (void)beginObject;
+- (void)endObject;
+- (void)beginArray;
+- (void)endArray;
+
+- (void)writeKey:(NSString *)key;
+
+- (void)writeString:(NSString *)string;
+- (void)writeNumber:(NSNumber *)number;
+- (void)writeNull;
+
+/**
+ Writes an array whose elements are all numbers other than booleans.
+ 
+ The default implementation writes the numbers one by one; formats with typed arrays write them
+ more compactly.
+ */
+- (void)writeNumericArray:(NSArray<NSNumber *> *)array;
+
+/**
+ Writes a Foundation JSON value: a dictionary with string keys (written with sorted keys), an
+ array, a string, a number or `NSNull`. Fails with `ORKErrorInvalidObject` for anything else.
+ */
+- (void)writeJSONObject:(id)object;
+
+/**
+ Writes any buffered bytes to the stream.
+ 
+ @return `YES` if everything written so far reached the stream.
+ */
+- (BOOL)flush;
+
+// For subclasses.
+- (void)appendBytes:(const void *)bytes length:(NSUInteger)length;
+- (void)failWithError:(NSError *)error;
+- (void)failWithInvalidObjectDescription:(NSString *)description;
+
+@end
+
+/// Returns `YES` if the array is not empty and all of its elements are numbers other than booleans.
+ORK_EXTERN BOOL ORKStreamWriterIsNumericArray(NSArray *array);
+
+/// Returns `YES` if the number is one of the boolean constants.
+ORK_EXTERN BOOL ORKStreamWriterIsBoolean(NSNumber *number);
+
+NS_ASSUME_NONNULL_END
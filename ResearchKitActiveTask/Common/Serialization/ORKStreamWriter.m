@@ -0,0 +1,219 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKStreamWriter.h"
+
+#import "ORKErrors.h"
+#import "ORKHelpers_Internal.h"
+
+
+static const NSUInteger ORKStreamWriterDefaultBufferSize = 64 * 1024;
+
+BOOL ORKStreamWriterIsBoolean(NSNumber *number) {
+    return ((__bridge CFBooleanRef)number == kCFBooleanTrue || (__bridge CFBooleanRef)number == kCFBooleanFalse);
+}
+
+BOOL ORKStreamWriterIsNumericArray(NSArray *array) {
+    if (array.count == 0) {
+        return NO;
+    }
+    for (id element in array) {
+        if (![element isKindOfClass:[NSNumber class]] || ORKStreamWriterIsBoolean(element)) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+@implementation ORKStreamWriter {
+    NSOutputStream *_outputStream;
+    uint8_t *_buffer;
+    NSUInteger _bufferSize;
+    NSUInteger _bufferLength;
+}
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithOutputStream:(NSOutputStream *)outputStream {
+    return [self initWithOutputStream:outputStream bufferSize:ORKStreamWriterDefaultBufferSize];
+}
+
+- (instancetype)initWithOutputStream:(NSOutputStream *)outputStream bufferSize:(NSUInteger)bufferSize {
+    self = [super init];
+    if (self) {
+        _outputStream = outputStream;
+        _bufferSize = MAX(bufferSize, (NSUInteger)64);
+        _buffer = malloc(_bufferSize);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    free(_buffer);
+}
+
+#pragma mark - Output
+
+- (void)failWithError:(NSError *)error {
+    if (_error == nil) {
+        _error = error;
+    }
+}
+
+- (void)failWithInvalidObjectDescription:(NSString *)description {
+    [self failWithError:[NSError errorWithDomain:ORKErrorDomain
+                                            code:ORKErrorInvalidObject
+                                        userInfo:@{NSDebugDescriptionErrorKey: description}]];
+}
+
+- (BOOL)flush {
+    NSUInteger offset = 0;
+    while (_error == nil && offset < _bufferLength) {
+        NSInteger written = [_outputStream write:_buffer + offset maxLength:_bufferLength - offset];
+        if (written <= 0) {
+            NSError *streamError = _outputStream.streamError;
+            [self failWithError:streamError ? : [NSError errorWithDomain:ORKErrorDomain
+                                                                    code:ORKErrorException
+                                                                userInfo:@{NSDebugDescriptionErrorKey: @"The output stream did not accept any more data."}]];
+            break;
+        }
+        offset += (NSUInteger)written;
+    }
+    _bufferLength = 0;
+    return (_error == nil);
+}
+
+- (void)appendBytes:(const void *)bytes length:(NSUInteger)length {
+    if (_error != nil) {
+        return;
+    }
+    const uint8_t *source = bytes;
+    while (length > 0) {
+        if (_bufferLength == _bufferSize && ![self flush]) {
+            return;
+        }
+        NSUInteger chunk = MIN(length, _bufferSize - _bufferLength);
+        memcpy(_buffer + _bufferLength, source, chunk);
+        _bufferLength += chunk;
+        source += chunk;
+        length -= chunk;
+    }
+}
+
+#pragma mark - Tokens
+
+- (void)beginObject {
+    @throw [NSException exceptionWithName:NSGenericException reason:@"You should override this method in a subclass" userInfo:nil];
+}
+
+- (void)endObject {
+    @throw [NSException exceptionWithName:NSGenericException reason:@"You should override this method in a subclass" userInfo:nil];
+}
+
+- (void)beginArray {
+    @throw [NSException exceptionWithName:NSGenericException reason:@"You should override this method in a subclass" userInfo:nil];
+}
+
+- (void)endArray {
+    @throw [NSException exceptionWithName:NSGenericException reason:@"You should override this method in a subclass" userInfo:nil];
+}
+
+- (void)writeKey:(NSString *)key {
+    @throw [NSException exceptionWithName:NSGenericException reason:@"You should override this method in a subclass" userInfo:nil];
+}
+
+- (void)writeString:(NSString *)string {
+    @throw [NSException exceptionWithName:NSGenericException reason:@"You should override this method in a subclass" userInfo:nil];
+}
+
+- (void)writeNumber:(NSNumber *)number {
+    @throw [NSException exceptionWithName:NSGenericException reason:@"You should override this method in a subclass" userInfo:nil];
+}
+
+- (void)writeNull {
+    @throw [NSException exceptionWithName:NSGenericException reason:@"You should override this method in a subclass" userInfo:nil];
+}
+
+- (void)writeNumericArray:(NSArray<NSNumber *> *)array {
+    [self beginArray];
+    for (NSNumber *number in array) {
+        [self writeNumber:number];
+    }
+    [self endArray];
+}
+
+- (void)writeJSONObject:(id)object {
+    if (_error != nil) {
+        return;
+    }
+    if ([object isKindOfClass:[NSString class]]) {
+        [self writeString:object];
+    } else if ([object isKindOfClass:[NSNumber class]]) {
+        [self writeNumber:object];
+    } else if ([object isKindOfClass:[NSNull class]]) {
+        [self writeNull];
+    } else if ([object isKindOfClass:[NSArray class]]) {
+        if (ORKStreamWriterIsNumericArray(object)) {
+            [self writeNumericArray:object];
+            return;
+        }
+        [self beginArray];
+        for (id element in (NSArray *)object) {
+            [self writeJSONObject:element];
+        }
+        [self endArray];
+    } else if ([object isKindOfClass:[NSDictionary class]]) {
+        NSDictionary *dictionary = (NSDictionary *)object;
+        NSArray *keys = dictionary.allKeys;
+        for (id key in keys) {
+            if (![key isKindOfClass:[NSString class]]) {
+                [self failWithInvalidObjectDescription:[NSString stringWithFormat:@"Invalid (non-string) key in JSON dictionary: %@", key]];
+                return;
+            }
+        }
+        [self beginObject];
+        for (NSString *key in [keys sortedArrayUsingSelector:@selector(compare:)]) {
+            [self writeKey:key];
+            [self writeJSONObject:dictionary[key]];
+        }
+        [self endObject];
+    } else {
+        [self failWithInvalidObjectDescription:[NSString stringWithFormat:@"Invalid type in JSON write (%@)", [object class]]];
+    }
+}
+
+@end
@@ -0,0 +1,127 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKESerializationContext;
+@class ORKOrderedTask;
+@class ORKStep;
+
+/**
+ A read-only library of serialized tasks, stored in a compact binary file that is memory-mapped
+ when it is opened.
+ 
+ A catalog is generated ahead of time from the JSON representations that `ORKESerializer`
+ produces. It holds a string table with the task and step identifiers and step titles, an index of
+ the tasks and their steps, and each task and step as a separate CBOR record. Listing the tasks and
+ reading identifiers, titles and step counts only reads the index and string table; records are
+ decoded when a task or step is requested, and only that task or step.
+ 
+ Titles are stored as they appear in the JSON representation, before localization.
+ 
+ The index is validated when the catalog is opened, so the accessors below never read outside the
+ file. A catalog may be used from any thread.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKTaskCatalog : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns a catalog built from the JSON representations of tasks, in the order given.
+ 
+ @param taskJSONObjects An array of task dictionaries, as returned by
+                        `+[ORKESerializer JSONObjectForObject:error:]` for `ORKOrderedTask` objects.
+ @param error           If a task could not be stored, an `ORKErrorDomain` error describing it.
+ */
++ (nullable NSData *)catalogDataWithTaskJSONObjects:(NSArray<NSDictionary *> *)taskJSONObjects error:(NSError * _Nullable *)error;
+
+/**
+ Writes a catalog built from the JSON representations of tasks to a file, replacing any existing file.
+ 
+ See `catalogDataWithTaskJSONObjects:error:`.
+ */
++ (BOOL)writeCatalogWithTaskJSONObjects:(NSArray<NSDictionary *> *)taskJSONObjects
+                            toFileAtURL:(NSURL *)fileURL
+                                  error:(NSError * _Nullable *)error;
+
+/**
+ Opens the catalog file at the given URL, mapping it into memory.
+ */
+- (nullable instancetype)initWithContentsOfURL:(NSURL *)fileURL error:(NSError * _Nullable *)error;
+
+/**
+ Opens a catalog held in memory. The data is not copied.
+ */
+- (nullable instancetype)initWithData:(NSData *)data error:(NSError * _Nullable *)error NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) NSUInteger numberOfTasks;
+
+/**
+ Returns the index of the task with the given identifier, or `NSNotFound`.
+ */
+- (NSUInteger)indexOfTaskWithIdentifier:(NSString *)identifier;
+
+- (NSString *)identifierOfTaskAtIndex:(NSUInteger)taskIndex;
+
+- (NSUInteger)numberOfStepsInTaskAtIndex:(NSUInteger)taskIndex;
+
+- (NSString *)identifierOfStepAtIndex:(NSUInteger)stepIndex inTaskAtIndex:(NSUInteger)taskIndex;
+
+- (nullable NSString *)titleOfStepAtIndex:(NSUInteger)stepIndex inTaskAtIndex:(NSUInteger)taskIndex;
+
+/**
+ Decodes a task and all of its steps.
+ 
+ @param taskIndex   The index of the task in the catalog.
+ @param context     The serialization context, or `nil` for the default context.
+ @param error       If the task could not be decoded, an `ORKErrorDomain` error describing it.
+ */
+- (nullable ORKOrderedTask *)taskAtIndex:(NSUInteger)taskIndex
+                                 context:(nullable ORKESerializationContext *)context
+                                   error:(NSError * _Nullable *)error;
+
+/**
+ Decodes one step of a task, without decoding the task or its other steps.
+ */
+- (nullable ORKStep *)stepAtIndex:(NSUInteger)stepIndex
+                    inTaskAtIndex:(NSUInteger)taskIndex
+                          context:(nullable ORKESerializationContext *)context
+                            error:(NSError * _Nullable *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,481 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKTaskCatalog.h"
+
+#import "ORKCBORDecoder.h"
+#import "ORKCBORStreamWriter.h"
+#import "ORKESerialization.h"
+
+#import "ORKErrors.h"
+#import "ORKHelpers_Internal.h"
+#import "ORKOrderedTask.h"
+#import "ORKStep.h"
+
+#include <libkern/OSByteOrder.h>
+
+
+/*
+ Catalog file layout. All integers are unsigned 32-bit little-endian; offsets are from the start
+ of the file.
+ 
+ Header (32 bytes):
+    magic "ORKC", version, task count, step count, string count,
+    task index offset, step index offset, string index offset
+ Task index, one entry per task (20 bytes):
+    identifier string, first step, step count, record offset, record length
+ Step index, one entry per step, grouped by task (16 bytes):
+    identifier string, title string or ORKTaskCatalogNoString, record offset, record length
+ String index, one entry per string (8 bytes):
+    offset, length of the UTF-8 bytes
+ Followed by the string bytes and the CBOR records. A task record is the task's JSON
+ representation without its steps; each step record is the JSON representation of one step.
+ */
+
+static const uint8_t ORKTaskCatalogMagic[4] = { 'O', 'R', 'K', 'C' };
+static const uint32_t ORKTaskCatalogVersion = 1;
+static const uint32_t ORKTaskCatalogNoString = UINT32_MAX;
+
+enum {
+    ORKTaskCatalogHeaderLength = 32,
+    ORKTaskCatalogTaskEntryLength = 20,
+    ORKTaskCatalogStepEntryLength = 16,
+    ORKTaskCatalogStringEntryLength = 8,
+};
+
+static NSString *const ORKTaskCatalogStepsKey = @"steps";
+static NSString *const ORKTaskCatalogIdentifierKey = @"identifier";
+static NSString *const ORKTaskCatalogTitleKey = @"title";
+
+static NSError *ORKTaskCatalogError(NSString *description) {
+    return [NSError errorWithDomain:ORKErrorDomain
+                               code:ORKErrorInvalidObject
+                           userInfo:@{NSDebugDescriptionErrorKey: description}];
+}
+
+static void ORKTaskCatalogAppendUInt32(NSMutableData *data, uint32_t value) {
+    uint32_t littleEndian = OSSwapHostToLittleInt32(value);
+    [data appendBytes:&littleEndian length:sizeof(littleEndian)];
+}
+
+static NSData *ORKTaskCatalogCBORData(id JSONObject, NSError **error) {
+    NSOutputStream *outputStream = [NSOutputStream outputStreamToMemory];
+    [outputStream open];
+    ORKCBORStreamWriter *writer = [[ORKCBORStreamWriter alloc] initWithOutputStream:outputStream];
+    [writer writeJSONObject:JSONObject];
+    BOOL success = [writer flush];
+    NSData *data = [outputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+    [outputStream close];
+    if (!success) {
+        if (error) {
+            *error = writer.error;
+        }
+        return nil;
+    }
+    return data;
+}
+
+
+@implementation ORKTaskCatalog {
+    NSData *_data;
+    const uint8_t *_bytes;
+    uint32_t _taskCount;
+    uint32_t _stepCount;
+    uint32_t _stringCount;
+    const uint8_t *_taskIndex;
+    const uint8_t *_stepIndex;
+    const uint8_t *_stringIndex;
+}
+
+#pragma mark Writing
+
++ (NSData *)catalogDataWithTaskJSONObjects:(NSArray<NSDictionary *> *)taskJSONObjects error:(NSError **)error {
+    NSMutableArray<NSData *> *strings = [NSMutableArray array];
+    NSMutableDictionary<NSString *, NSNumber *> *stringIndexes = [NSMutableDictionary dictionary];
+    uint32_t (^stringIndex)(NSString *) = ^uint32_t(NSString *string) {
+        NSNumber *index = stringIndexes[string];
+        if (index == nil) {
+            index = @(strings.count);
+            stringIndexes[string] = index;
+            [strings addObject:[string dataUsingEncoding:NSUTF8StringEncoding]];
+        }
+        return index.unsignedIntValue;
+    };
+    
+    NSMutableArray<NSData *> *records = [NSMutableArray array];
+    NSMutableData *taskEntries = [NSMutableData data];
+    NSMutableData *stepEntries = [NSMutableData data];
+    // Record offsets are not known until the string table is laid out, so entries hold the record
+    // number for now and are patched below.
+    uint32_t stepCount = 0;
+    for (NSDictionary *task in taskJSONObjects) {
+        NSArray *steps = [task isKindOfClass:[NSDictionary class]] ? task[ORKTaskCatalogStepsKey] : nil;
+        NSString *identifier = [task isKindOfClass:[NSDictionary class]] ? task[ORKTaskCatalogIdentifierKey] : nil;
+        if (![steps isKindOfClass:[NSArray class]] || ![identifier isKindOfClass:[NSString class]]) {
+            if (error) {
+                *error = ORKTaskCatalogError([NSString stringWithFormat:@"Task %lu is not the JSON representation of an ordered task.", (unsigned long)taskEntries.length / ORKTaskCatalogTaskEntryLength]);
+            }
+            return nil;
+        }
+        
+        NSMutableDictionary *taskRecord = [task mutableCopy];
+        [taskRecord removeObjectForKey:ORKTaskCatalogStepsKey];
+        NSData *taskRecordData = ORKTaskCatalogCBORData(taskRecord, error);
+        if (taskRecordData == nil) {
+            return nil;
+        }
+        ORKTaskCatalogAppendUInt32(taskEntries, stringIndex(identifier));
+        ORKTaskCatalogAppendUInt32(taskEntries, stepCount);
+        ORKTaskCatalogAppendUInt32(taskEntries, (uint32_t)steps.count);
+        ORKTaskCatalogAppendUInt32(taskEntries, (uint32_t)records.count);
+        ORKTaskCatalogAppendUInt32(taskEntries, 0);
+        [records addObject:taskRecordData];
+        
+        for (NSDictionary *step in steps) {
+            NSString *stepIdentifier = [step isKindOfClass:[NSDictionary class]] ? step[ORKTaskCatalogIdentifierKey] : nil;
+            if (![stepIdentifier isKindOfClass:[NSString class]]) {
+                if (error) {
+                    *error = ORKTaskCatalogError([NSString stringWithFormat:@"A step of task '%@' has no identifier.", identifier]);
+                }
+                return nil;
+            }
+            NSString *title = step[ORKTaskCatalogTitleKey];
+            NSData *stepRecordData = ORKTaskCatalogCBORData(step, error);
+            if (stepRecordData == nil) {
+                return nil;
+            }
+            ORKTaskCatalogAppendUInt32(stepEntries, stringIndex(stepIdentifier));
+            ORKTaskCatalogAppendUInt32(stepEntries, [title isKindOfClass:[NSString class]] ? stringIndex(title) : ORKTaskCatalogNoString);
+            ORKTaskCatalogAppendUInt32(stepEntries, (uint32_t)records.count);
+            ORKTaskCatalogAppendUInt32(stepEntries, 0);
+            [records addObject:stepRecordData];
+            stepCount += 1;
+        }
+    }
+    
+    uint64_t taskIndexOffset = ORKTaskCatalogHeaderLength;
+    uint64_t stepIndexOffset = taskIndexOffset + taskEntries.length;
+    uint64_t stringIndexOffset = stepIndexOffset + stepEntries.length;
+    uint64_t offset = stringIndexOffset + (uint64_t)strings.count * ORKTaskCatalogStringEntryLength;
+    
+    NSMutableData *stringEntries = [NSMutableData data];
+    for (NSData *string in strings) {
+        ORKTaskCatalogAppendUInt32(stringEntries, (uint32_t)offset);
+        ORKTaskCatalogAppendUInt32(stringEntries, (uint32_t)string.length);
+        offset += string.length;
+    }
+    NSMutableArray<NSNumber *> *recordOffsets = [NSMutableArray arrayWithCapacity:records.count];
+    for (NSData *record in records) {
+        [recordOffsets addObject:@(offset)];
+        offset += record.length;
+    }
+    if (offset > UINT32_MAX) {
+        if (error) {
+            *error = ORKTaskCatalogError(@"The catalog is larger than 4 GB.");
+        }
+        return nil;
+    }
+    
+    void (^patchRecords)(NSMutableData *, NSUInteger, NSUInteger) = ^(NSMutableData *entries, NSUInteger entryLength, NSUInteger recordField) {
+        uint8_t *bytes = entries.mutableBytes;
+        for (NSUInteger entry = 0; entry < entries.length; entry += entryLength) {
+            uint8_t *field = bytes + entry + recordField * sizeof(uint32_t);
+            uint32_t record = OSReadLittleInt32(field, 0);
+            OSWriteLittleInt32(field, 0, recordOffsets[record].unsignedIntValue);
+            OSWriteLittleInt32(field, sizeof(uint32_t), (uint32_t)records[record].length);
+        }
+    };
+    patchRecords(taskEntries, ORKTaskCatalogTaskEntryLength, 3);
+    patchRecords(stepEntries, ORKTaskCatalogStepEntryLength, 2);
+    
+    NSMutableData *data = [NSMutableData dataWithCapacity:(NSUInteger)offset];
+    [data appendBytes:ORKTaskCatalogMagic length:sizeof(ORKTaskCatalogMagic)];
+    ORKTaskCatalogAppendUInt32(data, ORKTaskCatalogVersion);
+    ORKTaskCatalogAppendUInt32(data, (uint32_t)taskJSONObjects.count);
+    ORKTaskCatalogAppendUInt32(data, stepCount);
+    ORKTaskCatalogAppendUInt32(data, (uint32_t)strings.count);
+    ORKTaskCatalogAppendUInt32(data, (uint32_t)taskIndexOffset);
+    ORKTaskCatalogAppendUInt32(data, (uint32_t)stepIndexOffset);
+    ORKTaskCatalogAppendUInt32(data, (uint32_t)stringIndexOffset);
+    [data appendData:taskEntries];
+    [data appendData:stepEntries];
+    [data appendData:stringEntries];
+    for (NSData *string in strings) {
+        [data appendData:string];
+    }
+    for (NSData *record in records) {
+        [data appendData:record];
+    }
+    return data;
+}
+
++ (BOOL)writeCatalogWithTaskJSONObjects:(NSArray<NSDictionary *> *)taskJSONObjects toFileAtURL:(NSURL *)fileURL error:(NSError **)error {
+    NSData *data = [self catalogDataWithTaskJSONObjects:taskJSONObjects error:error];
+    return data != nil && [data writeToURL:fileURL options:NSDataWritingAtomic error:error];
+}
+
+#pragma mark Reading
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithContentsOfURL:(NSURL *)fileURL error:(NSError **)error {
+    NSData *data = [NSData dataWithContentsOfURL:fileURL options:NSDataReadingMappedAlways error:error];
+    if (data == nil) {
+        return nil;
+    }
+    return [self initWithData:data error:error];
+}
+
+- (instancetype)initWithData:(NSData *)data error:(NSError **)error {
+    self = [super init];
+    if (self) {
+        _data = data;
+        _bytes = data.bytes;
+        NSString *failure = [self validate];
+        if (failure != nil) {
+            if (error) {
+                *error = ORKTaskCatalogError(failure);
+            }
+            return nil;
+        }
+    }
+    return self;
+}
+
+- (uint32_t)readUInt32:(const uint8_t *)base entry:(NSUInteger)entry length:(NSUInteger)entryLength field:(NSUInteger)field {
+    return OSReadLittleInt32(base, entry * entryLength + field * sizeof(uint32_t));
+}
+
+- (BOOL)containsRangeWithOffset:(uint64_t)offset length:(uint64_t)length {
+    return offset <= _data.length && length <= _data.length - offset;
+}
+
+// Checks everything the accessors rely on, and returns a description of the first problem.
+- (NSString *)validate {
+    if (_data.length < ORKTaskCatalogHeaderLength || memcmp(_bytes, ORKTaskCatalogMagic, sizeof(ORKTaskCatalogMagic)) != 0) {
+        return @"The data is not a task catalog.";
+    }
+    if (OSReadLittleInt32(_bytes, 4) != ORKTaskCatalogVersion) {
+        return @"The task catalog version is not supported.";
+    }
+    _taskCount = OSReadLittleInt32(_bytes, 8);
+    _stepCount = OSReadLittleInt32(_bytes, 12);
+    _stringCount = OSReadLittleInt32(_bytes, 16);
+    uint32_t taskIndexOffset = OSReadLittleInt32(_bytes, 20);
+    uint32_t stepIndexOffset = OSReadLittleInt32(_bytes, 24);
+    uint32_t stringIndexOffset = OSReadLittleInt32(_bytes, 28);
+    if (![self containsRangeWithOffset:taskIndexOffset length:(uint64_t)_taskCount * ORKTaskCatalogTaskEntryLength]
+        || ![self containsRangeWithOffset:stepIndexOffset length:(uint64_t)_stepCount * ORKTaskCatalogStepEntryLength]
+        || ![self containsRangeWithOffset:stringIndexOffset length:(uint64_t)_stringCount * ORKTaskCatalogStringEntryLength]) {
+        return @"The task catalog index is truncated.";
+    }
+    _taskIndex = _bytes + taskIndexOffset;
+    _stepIndex = _bytes + stepIndexOffset;
+    _stringIndex = _bytes + stringIndexOffset;
+    
+    for (NSUInteger string = 0; string < _stringCount; string++) {
+        uint32_t offset = [self readUInt32:_stringIndex entry:string length:ORKTaskCatalogStringEntryLength field:0];
+        uint32_t length = [self readUInt32:_stringIndex entry:string length:ORKTaskCatalogStringEntryLength field:1];
+        if (![self containsRangeWithOffset:offset length:length]) {
+            return @"A task catalog string is out of range.";
+        }
+        NSString *decoded = [[NSString alloc] initWithBytesNoCopy:(void *)(_bytes + offset) length:length encoding:NSUTF8StringEncoding freeWhenDone:NO];
+        if (decoded == nil) {
+            return @"A task catalog string is not valid UTF-8.";
+        }
+    }
+    for (NSUInteger task = 0; task < _taskCount; task++) {
+        uint32_t identifier = [self readUInt32:_taskIndex entry:task length:ORKTaskCatalogTaskEntryLength field:0];
+        uint32_t firstStep = [self readUInt32:_taskIndex entry:task length:ORKTaskCatalogTaskEntryLength field:1];
+        uint32_t stepCount = [self readUInt32:_taskIndex entry:task length:ORKTaskCatalogTaskEntryLength field:2];
+        uint32_t recordOffset = [self readUInt32:_taskIndex entry:task length:ORKTaskCatalogTaskEntryLength field:3];
+        uint32_t recordLength = [self readUInt32:_taskIndex entry:task length:ORKTaskCatalogTaskEntryLength field:4];
+        if (identifier >= _stringCount || (uint64_t)firstStep + stepCount > _stepCount || ![self containsRangeWithOffset:recordOffset length:recordLength]) {
+            return @"A task catalog task entry is out of range.";
+        }
+    }
+    for (NSUInteger step = 0; step < _stepCount; step++) {
+        uint32_t identifier = [self readUInt32:_stepIndex entry:step length:ORKTaskCatalogStepEntryLength field:0];
+        uint32_t title = [self readUInt32:_stepIndex entry:step length:ORKTaskCatalogStepEntryLength field:1];
+        uint32_t recordOffset = [self readUInt32:_stepIndex entry:step length:ORKTaskCatalogStepEntryLength field:2];
+        uint32_t recordLength = [self readUInt32:_stepIndex entry:step length:ORKTaskCatalogStepEntryLength field:3];
+        if (identifier >= _stringCount || (title >= _stringCount && title != ORKTaskCatalogNoString) || ![self containsRangeWithOffset:recordOffset length:recordLength]) {
+            return @"A task catalog step entry is out of range.";
+        }
+    }
+    return nil;
+}
+
+- (NSString *)stringAtIndex:(uint32_t)string {
+    uint32_t offset = [self readUInt32:_stringIndex entry:string length:ORKTaskCatalogStringEntryLength field:0];
+    uint32_t length = [self readUInt32:_stringIndex entry:string length:ORKTaskCatalogStringEntryLength field:1];
+    return [[NSString alloc] initWithBytes:_bytes + offset length:length encoding:NSUTF8StringEncoding];
+}
+
+- (void)checkTaskIndex:(NSUInteger)taskIndex {
+    if (taskIndex >= _taskCount) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Task index %lu is beyond the %lu tasks in the catalog", (unsigned long)taskIndex, (unsigned long)_taskCount]
+                                     userInfo:nil];
+    }
+}
+
+// Returns the entry of a step in the step index.
+- (NSUInteger)stepEntryForStepAtIndex:(NSUInteger)stepIndex inTaskAtIndex:(NSUInteger)taskIndex {
+    NSUInteger stepCount = [self numberOfStepsInTaskAtIndex:taskIndex];
+    if (stepIndex >= stepCount) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Step index %lu is beyond the %lu steps of task %lu", (unsigned long)stepIndex, (unsigned long)stepCount, (unsigned long)taskIndex]
+                                     userInfo:nil];
+    }
+    return [self readUInt32:_taskIndex entry:taskIndex length:ORKTaskCatalogTaskEntryLength field:1] + stepIndex;
+}
+
+- (NSData *)recordAtOffset:(uint32_t)offset length:(uint32_t)length {
+    // The record is decoded before this returns, so it does not need to outlive the catalog's data.
+    return [NSData dataWithBytesNoCopy:(void *)(_bytes + offset) length:length freeWhenDone:NO];
+}
+
+- (NSUInteger)numberOfTasks {
+    return _taskCount;
+}
+
+- (NSUInteger)indexOfTaskWithIdentifier:(NSString *)identifier {
+    // Compare encoded bytes rather than a C string, which would end at an embedded NUL.
+    NSData *utf8Data = [identifier dataUsingEncoding:NSUTF8StringEncoding];
+    const uint8_t *utf8 = utf8Data.bytes;
+    NSUInteger utf8Length = utf8Data.length;
+    for (NSUInteger task = 0; task < _taskCount; task++) {
+        uint32_t string = [self readUInt32:_taskIndex entry:task length:ORKTaskCatalogTaskEntryLength field:0];
+        uint32_t offset = [self readUInt32:_stringIndex entry:string length:ORKTaskCatalogStringEntryLength field:0];
+        uint32_t length = [self readUInt32:_stringIndex entry:string length:ORKTaskCatalogStringEntryLength field:1];
+        if (length == utf8Length && memcmp(_bytes + offset, utf8, length) == 0) {
+            return task;
+        }
+    }
+    return NSNotFound;
+}
+
+- (NSString *)identifierOfTaskAtIndex:(NSUInteger)taskIndex {
+    [self checkTaskIndex:taskIndex];
+    return [self stringAtIndex:[self readUInt32:_taskIndex entry:taskIndex length:ORKTaskCatalogTaskEntryLength field:0]];
+}
+
+- (NSUInteger)numberOfStepsInTaskAtIndex:(NSUInteger)taskIndex {
+    [self checkTaskIndex:taskIndex];
+    return [self readUInt32:_taskIndex entry:taskIndex length:ORKTaskCatalogTaskEntryLength field:2];
+}
+
+- (NSString *)identifierOfStepAtIndex:(NSUInteger)stepIndex inTaskAtIndex:(NSUInteger)taskIndex {
+    NSUInteger entry = [self stepEntryForStepAtIndex:stepIndex inTaskAtIndex:taskIndex];
+    return [self stringAtIndex:[self readUInt32:_stepIndex entry:entry length:ORKTaskCatalogStepEntryLength field:0]];
+}
+
+- (NSString *)titleOfStepAtIndex:(NSUInteger)stepIndex inTaskAtIndex:(NSUInteger)taskIndex {
+    NSUInteger entry = [self stepEntryForStepAtIndex:stepIndex inTaskAtIndex:taskIndex];
+    uint32_t title = [self readUInt32:_stepIndex entry:entry length:ORKTaskCatalogStepEntryLength field:1];
+    return (title == ORKTaskCatalogNoString) ? nil : [self stringAtIndex:title];
+}
+
+- (id)JSONObjectOfStepEntry:(NSUInteger)entry error:(NSError **)error {
+    uint32_t offset = [self readUInt32:_stepIndex entry:entry length:ORKTaskCatalogStepEntryLength field:2];
+    uint32_t length = [self readUInt32:_stepIndex entry:entry length:ORKTaskCatalogStepEntryLength field:3];
+    return [ORKCBORDecoder JSONObjectWithData:[self recordAtOffset:offset length:length] error:error];
+}
+
+- (ORKOrderedTask *)taskAtIndex:(NSUInteger)taskIndex context:(ORKESerializationContext *)context error:(NSError **)error {
+    [self checkTaskIndex:taskIndex];
+    uint32_t offset = [self readUInt32:_taskIndex entry:taskIndex length:ORKTaskCatalogTaskEntryLength field:3];
+    uint32_t length = [self readUInt32:_taskIndex entry:taskIndex length:ORKTaskCatalogTaskEntryLength field:4];
+    NSDictionary *taskRecord = [ORKCBORDecoder JSONObjectWithData:[self recordAtOffset:offset length:length] error:error];
+    if (taskRecord == nil) {
+        return nil;
+    }
+    if (![taskRecord isKindOfClass:[NSDictionary class]]) {
+        if (error) {
+            *error = ORKTaskCatalogError(@"A task catalog task record is not a dictionary.");
+        }
+        return nil;
+    }
+    
+    NSUInteger firstStep = [self readUInt32:_taskIndex entry:taskIndex length:ORKTaskCatalogTaskEntryLength field:1];
+    NSUInteger stepCount = [self readUInt32:_taskIndex entry:taskIndex length:ORKTaskCatalogTaskEntryLength field:2];
+    NSMutableArray *steps = [NSMutableArray arrayWithCapacity:stepCount];
+    for (NSUInteger entry = firstStep; entry < firstStep + stepCount; entry++) {
+        id step = [self JSONObjectOfStepEntry:entry error:error];
+        if (step == nil) {
+            return nil;
+        }
+        [steps addObject:step];
+    }
+    NSMutableDictionary *taskJSONObject = [taskRecord mutableCopy];
+    taskJSONObject[ORKTaskCatalogStepsKey] = steps;
+    
+    return [self objectOfClass:[ORKOrderedTask class] fromJSONObject:taskJSONObject context:context error:error];
+}
+
+- (ORKStep *)stepAtIndex:(NSUInteger)stepIndex inTaskAtIndex:(NSUInteger)taskIndex context:(ORKESerializationContext *)context error:(NSError **)error {
+    NSUInteger entry = [self stepEntryForStepAtIndex:stepIndex inTaskAtIndex:taskIndex];
+    id stepJSONObject = [self JSONObjectOfStepEntry:entry error:error];
+    if (stepJSONObject == nil) {
+        return nil;
+    }
+    return [self objectOfClass:[ORKStep class] fromJSONObject:stepJSONObject context:context error:error];
+}
+
+- (id)objectOfClass:(Class)objectClass fromJSONObject:(id)JSONObject context:(ORKESerializationContext *)context error:(NSError **)error {
+    id object = nil;
+    if ([JSONObject isKindOfClass:[NSDictionary class]]) {
+        if (context == nil) {
+            context = [[ORKESerializationContext alloc] initWithLocalizer:nil imageProvider:nil stringInterpolator:nil propertyInjector:nil];
+        }
+        object = [ORKESerializer objectFromJSONObject:JSONObject context:context error:error];
+        if (object == nil) {
+            // Keep the serializer's error, which says what is malformed.
+            return nil;
+        }
+    }
+    if (![object isKindOfClass:objectClass]) {
+        if (error) {
+            *error = ORKTaskCatalogError([NSString stringWithFormat:@"A task catalog record is not a serialized %@.", NSStringFromClass(objectClass)]);
+        }
+        return nil;
+    }
+    return object;
+}
+
+@end
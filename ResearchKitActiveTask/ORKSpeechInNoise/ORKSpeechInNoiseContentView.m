@@ -174,14 +174,9 @@ static CGFloat const ORKSpeechInNoiseContentViewVerticalMargin = 44;
 - (void)addSample:(NSNumber *)sample
 {
     NSAssert(sample != nil, @"Sample should be non-nil");
-    if (!_samples) {
-        _samples = [NSMutableArray array];
-    }
-    [_samples addObject:sample];
-    
-    _samples = [ORKLastNSamples(_samples, 500) mutableCopy];
-    
-    [self updateGraphSamples];
+    // The metering view keeps its own ring buffer and redraws at display cadence.
+    float value = sample.floatValue;
+    [_graphView appendSamples:&value count:1];
 }
 
 - (void)removeAllSamples
@@ -39,12 +39,14 @@
 #import "ORKSpeechInNoiseContentView.h"
 #import "ORKSpeechInNoiseStep.h"
 #import "ORKSpeechInNoiseResult.h"
+#import "ORKSpeechInNoiseStimulusCache.h"
 
 #import "ORKCollectionResult_Private.h"
 #import "ORKHelpers_Internal.h"
 #import "ORKRoundTappingButton.h"
 #import "ORKPlaybackButton.h"
 #import "ORKSkin.h"
+#import "ORKOrderedTask.h"
 #import "ORKTaskViewController.h"
 #import "ORKTaskViewController_Internal.h"
 
@@ -61,8 +63,6 @@
     AVAudioPCMBuffer *_noiseAudioBuffer;
     AVAudioPCMBuffer *_speechAudioBuffer;
     AVAudioPCMBuffer *_filterAudioBuffer;
-    AVAudioFrameCount _speechToneCapacity;
-    AVAudioFrameCount _noiseToneCapacity;
     BOOL _installedTap;
 }
 
@@ -73,9 +73,6 @@
 - (void)viewDidLoad {
     [super viewDidLoad];
     
-    _noiseAudioBuffer = [[AVAudioPCMBuffer alloc] init];
-    _speechAudioBuffer = [[AVAudioPCMBuffer alloc] init];
-    _filterAudioBuffer = [[AVAudioPCMBuffer alloc] init];
     _installedTap = NO;
     
     [self setupContentView];
@@ -116,76 +113,87 @@
 }
 
 - (void)setupBuffers {
+    ORKSpeechInNoiseStimulusCache *cache = [ORKSpeechInNoiseStimulusCache sharedCache];
+    ORKSpeechInNoiseStep *step = [self speechInNoiseStep];
     
-    if ([[self speechInNoiseStep] speechFilePath] != nil)
-    {
-        NSURL *url = [NSURL fileURLWithPath:[self speechInNoiseStep].speechFilePath isDirectory:NO];
-        [self loadFileAtURL:url intoBuffer:&_speechAudioBuffer];
-    }
-    else
-    {
-        [self loadFileName:[self speechInNoiseStep].speechFileNameWithExtension intoBuffer:&_speechAudioBuffer];
-    }
+    NSURL *speechURL = [[self class] speechURLForStep:step];
+    NSURL *noiseURL = [ORKSpeechInNoiseStimulusCache URLForResourceWithFileName:step.noiseFileNameWithExtension];
+    NSURL *filterURL = [ORKSpeechInNoiseStimulusCache URLForResourceWithFileName:step.filterFileNameWithExtension];
+    
+    _speechAudioBuffer = speechURL ? [cache bufferForURL:speechURL error:nil] : nil;
+    _noiseAudioBuffer = noiseURL ? [cache bufferForURL:noiseURL error:nil] : nil;
+    _filterAudioBuffer = filterURL ? [cache bufferForURL:filterURL error:nil] : nil;
+    _toneDuration = _speechAudioBuffer ? _speechAudioBuffer.frameLength / _speechAudioBuffer.format.sampleRate : 0;
+    
+    [self prefetchNextStepStimuli];
     
-    [self loadFileName:[self speechInNoiseStep].noiseFileNameWithExtension intoBuffer:&_noiseAudioBuffer];
-    [self loadFileName:[self speechInNoiseStep].filterFileNameWithExtension intoBuffer:&_filterAudioBuffer];
+    if (!_speechAudioBuffer) {
+        ORK_Log_Error("Unable to load speech in noise stimulus for step %@", step.identifier);
+        return;
+    }
     
     _mixerNode = _audioEngine.mainMixerNode;
     [_audioEngine connect:_playerNode to:_mixerNode format:_speechAudioBuffer.format];
     [_audioEngine startAndReturnError:nil];
     
-    if ([self speechInNoiseStep].willAudioLoop) {
+    if (step.willAudioLoop) {
         [_playerNode scheduleBuffer:_speechAudioBuffer atTime:nil options:AVAudioPlayerNodeBufferLoops completionHandler:nil];
-    } else {
-        int randomOffset = arc4random_uniform(_noiseToneCapacity - _speechToneCapacity);
-        for (int i = 0; i < _speechToneCapacity; i++) {
-            _speechAudioBuffer.floatChannelData[0][i] += _noiseAudioBuffer.floatChannelData[0][i + randomOffset] * [self speechInNoiseStep].gainAppliedToNoise;
-        }
-        for (int i = 0; i < _speechToneCapacity; i++) {
-            _speechAudioBuffer.floatChannelData[0][i] *= _filterAudioBuffer.floatChannelData[0][i];
+    } else if (_noiseAudioBuffer && _filterAudioBuffer) {
+        AVAudioFrameCount mixCount = MIN(_speechAudioBuffer.frameLength, _filterAudioBuffer.frameLength);
+        AVAudioFramePosition randomOffset = (_noiseAudioBuffer.frameLength > mixCount) ? arc4random_uniform(_noiseAudioBuffer.frameLength - mixCount) : 0;
+        // The cached buffers are shared, so mix into a fresh buffer rather than in place.
+        AVAudioPCMBuffer *stimulus = [ORKSpeechInNoiseStimulusCache mixedStimulusWithSpeech:_speechAudioBuffer
+                                                                                        noise:_noiseAudioBuffer
+                                                                                       filter:_filterAudioBuffer
+                                                                                    noiseGain:step.gainAppliedToNoise
+                                                                                  noiseOffset:randomOffset];
+        if (stimulus) {
+            [_playerNode scheduleBuffer:stimulus atTime:nil options:AVAudioPlayerNodeBufferInterrupts completionHandler:nil];
         }
-        [_playerNode scheduleBuffer:_speechAudioBuffer atTime:nil options:AVAudioPlayerNodeBufferInterrupts completionHandler:nil];
     }
 }
 
-- (void)loadFileAtURL:(NSURL *)url intoBuffer:(AVAudioPCMBuffer * __strong *)buffer {
-    
-    AVAudioFile *audioFile = [[AVAudioFile alloc] initForReading:url error:nil];
-    AVAudioFormat *audioFileFormat = audioFile.processingFormat;
-    AVAudioFrameCount audioFileCapacity = (AVAudioFrameCount)audioFile.length;
-    
-    if (*buffer == _filterAudioBuffer)
-    {
-        _speechToneCapacity = audioFileCapacity;
++ (nullable NSURL *)speechURLForStep:(ORKSpeechInNoiseStep *)step {
+    if (step.speechFilePath != nil) {
+        return [NSURL fileURLWithPath:step.speechFilePath isDirectory:NO];
     }
-    else if (*buffer == _noiseAudioBuffer)
-    {
-        _noiseToneCapacity = audioFileCapacity;
-    }
-    else
-    {
-        AVAsset *asset = [AVURLAsset URLAssetWithURL:url options:nil];
-        CMTime audioDuration = asset.duration;
-        _toneDuration = CMTimeGetSeconds(audioDuration);
+    if (step.speechFileNameWithExtension != nil) {
+        return [ORKSpeechInNoiseStimulusCache URLForResourceWithFileName:step.speechFileNameWithExtension];
     }
-    
-    *buffer = [[AVAudioPCMBuffer alloc] initWithPCMFormat:audioFileFormat frameCapacity:audioFileCapacity];
-    
-    [audioFile readIntoBuffer:*buffer error:nil];
+    return nil;
 }
 
-- (void)loadFileName: (NSString *)file intoBuffer: (AVAudioPCMBuffer * __strong *)buffer {
-    NSArray *fileComponents = [file componentsSeparatedByString:@"."];
-    NSString *fileName = fileComponents[0];
-    NSString *fileExtension = fileComponents[1];
-    
-    NSURL *fileURL = [[NSBundle bundleForClass:[self class]] URLForResource:fileName withExtension:fileExtension];
+- (void)prefetchNextStepStimuli {
+    id<ORKTask> task = self.taskViewController.task;
+    if (![task isKindOfClass:[ORKOrderedTask class]]) {
+        return;
+    }
     
-    if (fileURL == nil) {
-        fileURL = [[NSBundle mainBundle] URLForResource:fileName withExtension:fileExtension];
+    NSArray<ORKStep *> *steps = [(ORKOrderedTask *)task steps];
+    NSUInteger index = [steps indexOfObject:self.step];
+    if (index == NSNotFound) {
+        return;
     }
     
-    [self loadFileAtURL:fileURL intoBuffer:buffer];
+    for (NSUInteger nextIndex = index + 1; nextIndex < steps.count; nextIndex++) {
+        if (![steps[nextIndex] isKindOfClass:[ORKSpeechInNoiseStep class]]) {
+            continue;
+        }
+        ORKSpeechInNoiseStep *nextStep = (ORKSpeechInNoiseStep *)steps[nextIndex];
+        NSMutableArray<NSURL *> *urls = [NSMutableArray new];
+        NSURL *speechURL = [[self class] speechURLForStep:nextStep];
+        if (speechURL) {
+            [urls addObject:speechURL];
+        }
+        for (NSString *fileName in @[nextStep.noiseFileNameWithExtension ?: @"", nextStep.filterFileNameWithExtension ?: @""]) {
+            NSURL *url = fileName.length > 0 ? [ORKSpeechInNoiseStimulusCache URLForResourceWithFileName:fileName] : nil;
+            if (url) {
+                [urls addObject:url];
+            }
+        }
+        [[ORKSpeechInNoiseStimulusCache sharedCache] prefetchURLs:urls];
+        break;
+    }
 }
 
 - (void)installTap {
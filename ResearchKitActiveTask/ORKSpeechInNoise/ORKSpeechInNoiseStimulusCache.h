@@ -0,0 +1,101 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+@import Foundation;
+@import AVFoundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A shared, memory-bounded cache of decoded speech-in-noise stimuli.
+ 
+ Audio files are decoded once into `AVAudioPCMBuffer` objects and kept until the total
+ size of the cache exceeds `totalCostLimit`, at which point the least recently used buffers
+ are evicted. Decoding happens on a serial background queue, so a prefetch that is already
+ in flight is reused rather than repeated when the buffer is requested.
+ 
+ Buffers returned by the cache are shared and must not be modified. Use
+ `mixedStimulusWithSpeech:noise:filter:noiseGain:noiseOffset:` to build a playable stimulus.
+ */
+@interface ORKSpeechInNoiseStimulusCache : NSObject
+
++ (instancetype)sharedCache;
+
+/**
+ The maximum total size, in bytes, of the decoded buffers kept by the cache. The default is 32 MB.
+ */
+@property (nonatomic, assign) NSUInteger totalCostLimit;
+
+/**
+ The total size, in bytes, of the buffers currently held by the cache.
+ */
+@property (nonatomic, readonly) NSUInteger totalCost;
+
+/**
+ Returns the decoded contents of the file, decoding it synchronously if it is not cached.
+ */
+- (nullable AVAudioPCMBuffer *)bufferForURL:(NSURL *)url error:(NSError * _Nullable *)error;
+
+/**
+ Decodes the files on a background queue, so that later calls to `bufferForURL:error:` return immediately.
+ */
+- (void)prefetchURLs:(NSArray<NSURL *> *)urls;
+
+- (void)removeAllBuffers;
+
+/**
+ Returns the URL of a bundled stimulus file, looking first in the ResearchKitActiveTask bundle and then in the main bundle.
+ 
+ @param fileNameWithExtension   A file name such as `Noise.wav`.
+ */
++ (nullable NSURL *)URLForResourceWithFileName:(NSString *)fileNameWithExtension;
+
+/**
+ Returns a new buffer containing the speech with noise mixed in and the filter applied.
+ 
+ The first `MIN(speech.frameLength, filter.frameLength)` frames of the speech are mixed with
+ the noise starting at `noiseOffset`, scaled by `noiseGain`, and then multiplied by the filter.
+ Any remaining speech frames are copied unchanged. The input buffers are not modified.
+ 
+ @param speech      The decoded speech.
+ @param noise       The decoded noise.
+ @param filter      The decoded filter envelope.
+ @param noiseGain   The linear gain applied to the noise, which sets the signal-to-noise ratio.
+ @param noiseOffset The frame in the noise at which mixing starts.
+ */
++ (nullable AVAudioPCMBuffer *)mixedStimulusWithSpeech:(AVAudioPCMBuffer *)speech
+                                                 noise:(AVAudioPCMBuffer *)noise
+                                                filter:(AVAudioPCMBuffer *)filter
+                                             noiseGain:(float)noiseGain
+                                           noiseOffset:(AVAudioFramePosition)noiseOffset;
+
+@end
+
+NS_ASSUME_NONNULL_END
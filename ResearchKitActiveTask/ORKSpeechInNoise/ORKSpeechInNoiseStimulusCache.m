@@ -0,0 +1,252 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKSpeechInNoiseStimulusCache.h"
+
+#import "ORKSpeechInNoiseStep.h"
+
+#import "ORKHelpers_Internal.h"
+
+@import Accelerate;
+@import UIKit;
+
+#include <os/lock.h>
+
+static const NSUInteger ORKSpeechInNoiseStimulusCacheDefaultCostLimit = 32 * 1024 * 1024;
+
+static NSUInteger ORKSpeechInNoiseBufferCost(AVAudioPCMBuffer *buffer) {
+    const AudioBufferList *bufferList = buffer.audioBufferList;
+    NSUInteger cost = 0;
+    for (UInt32 index = 0; index < bufferList->mNumberBuffers; index++) {
+        cost += bufferList->mBuffers[index].mDataByteSize;
+    }
+    return cost;
+}
+
+@implementation ORKSpeechInNoiseStimulusCache {
+    os_unfair_lock _lock;
+    NSMutableDictionary<NSURL *, AVAudioPCMBuffer *> *_buffers;
+    // Least recently used first.
+    NSMutableArray<NSURL *> *_usageOrder;
+    dispatch_queue_t _decodeQueue;
+    NSUInteger _totalCost;
+    NSUInteger _totalCostLimit;
+}
+
++ (instancetype)sharedCache {
+    static ORKSpeechInNoiseStimulusCache *sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [[ORKSpeechInNoiseStimulusCache alloc] init];
+    });
+    return sharedCache;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _buffers = [NSMutableDictionary new];
+        _usageOrder = [NSMutableArray new];
+        _totalCostLimit = ORKSpeechInNoiseStimulusCacheDefaultCostLimit;
+        _decodeQueue = dispatch_queue_create("ORKSpeechInNoiseStimulusCache", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_USER_INITIATED, 0));
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(removeAllBuffers)
+                                                     name:UIApplicationDidReceiveMemoryWarningNotification
+                                                   object:nil];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)setTotalCostLimit:(NSUInteger)totalCostLimit {
+    os_unfair_lock_lock(&_lock);
+    _totalCostLimit = totalCostLimit;
+    [self locked_evictToCostLimit];
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (NSUInteger)totalCostLimit {
+    os_unfair_lock_lock(&_lock);
+    NSUInteger limit = _totalCostLimit;
+    os_unfair_lock_unlock(&_lock);
+    return limit;
+}
+
+- (NSUInteger)totalCost {
+    os_unfair_lock_lock(&_lock);
+    NSUInteger cost = _totalCost;
+    os_unfair_lock_unlock(&_lock);
+    return cost;
+}
+
+- (AVAudioPCMBuffer *)cachedBufferForURL:(NSURL *)url {
+    os_unfair_lock_lock(&_lock);
+    AVAudioPCMBuffer *buffer = _buffers[url];
+    if (buffer) {
+        [_usageOrder removeObject:url];
+        [_usageOrder addObject:url];
+    }
+    os_unfair_lock_unlock(&_lock);
+    return buffer;
+}
+
+- (void)storeBuffer:(AVAudioPCMBuffer *)buffer forURL:(NSURL *)url {
+    os_unfair_lock_lock(&_lock);
+    if (!_buffers[url]) {
+        _buffers[url] = buffer;
+        [_usageOrder addObject:url];
+        _totalCost += ORKSpeechInNoiseBufferCost(buffer);
+        [self locked_evictToCostLimit];
+    }
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (void)locked_evictToCostLimit {
+    // Always keep the most recently used buffer, even if it alone exceeds the limit.
+    while (_totalCost > _totalCostLimit && _usageOrder.count > 1) {
+        NSURL *url = _usageOrder.firstObject;
+        [_usageOrder removeObjectAtIndex:0];
+        _totalCost -= ORKSpeechInNoiseBufferCost(_buffers[url]);
+        [_buffers removeObjectForKey:url];
+    }
+}
+
+- (void)removeAllBuffers {
+    os_unfair_lock_lock(&_lock);
+    [_buffers removeAllObjects];
+    [_usageOrder removeAllObjects];
+    _totalCost = 0;
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (AVAudioPCMBuffer *)decodeQueue_bufferForURL:(NSURL *)url error:(NSError **)errorOut {
+    AVAudioPCMBuffer *buffer = [self cachedBufferForURL:url];
+    if (buffer) {
+        return buffer;
+    }
+    
+    NSError *error = nil;
+    AVAudioFile *audioFile = [[AVAudioFile alloc] initForReading:url error:&error];
+    if (audioFile) {
+        buffer = [[AVAudioPCMBuffer alloc] initWithPCMFormat:audioFile.processingFormat frameCapacity:(AVAudioFrameCount)audioFile.length];
+        if (![audioFile readIntoBuffer:buffer error:&error]) {
+            buffer = nil;
+        }
+    }
+    
+    if (buffer) {
+        [self storeBuffer:buffer forURL:url];
+    } else {
+        ORK_Log_Error("Failed to decode speech in noise stimulus %@: %@", url, error);
+        if (errorOut != NULL) {
+            *errorOut = error;
+        }
+    }
+    return buffer;
+}
+
+- (AVAudioPCMBuffer *)bufferForURL:(NSURL *)url error:(NSError **)errorOut {
+    ORKThrowInvalidArgumentExceptionIfNil(url);
+    AVAudioPCMBuffer *buffer = [self cachedBufferForURL:url];
+    if (buffer) {
+        return buffer;
+    }
+    
+    __block NSError *error = nil;
+    dispatch_sync(_decodeQueue, ^{
+        buffer = [self decodeQueue_bufferForURL:url error:&error];
+    });
+    if (!buffer && errorOut != NULL) {
+        *errorOut = error;
+    }
+    return buffer;
+}
+
+- (void)prefetchURLs:(NSArray<NSURL *> *)urls {
+    for (NSURL *url in urls) {
+        dispatch_async(_decodeQueue, ^{
+            [self decodeQueue_bufferForURL:url error:nil];
+        });
+    }
+}
+
++ (NSURL *)URLForResourceWithFileName:(NSString *)fileNameWithExtension {
+    NSString *fileName = [fileNameWithExtension stringByDeletingPathExtension];
+    NSString *fileExtension = [fileNameWithExtension pathExtension];
+    
+    NSURL *fileURL = [[NSBundle bundleForClass:[ORKSpeechInNoiseStep class]] URLForResource:fileName withExtension:fileExtension];
+    if (fileURL == nil) {
+        fileURL = [[NSBundle mainBundle] URLForResource:fileName withExtension:fileExtension];
+    }
+    return fileURL;
+}
+
++ (AVAudioPCMBuffer *)mixedStimulusWithSpeech:(AVAudioPCMBuffer *)speech
+                                        noise:(AVAudioPCMBuffer *)noise
+                                       filter:(AVAudioPCMBuffer *)filter
+                                    noiseGain:(float)noiseGain
+                                  noiseOffset:(AVAudioFramePosition)noiseOffset {
+    if (speech.floatChannelData == NULL || noise.floatChannelData == NULL || filter.floatChannelData == NULL) {
+        ORK_Log_Error("Speech in noise stimuli must be decoded to floating point buffers");
+        return nil;
+    }
+    
+    AVAudioPCMBuffer *output = [[AVAudioPCMBuffer alloc] initWithPCMFormat:speech.format frameCapacity:speech.frameLength];
+    output.frameLength = speech.frameLength;
+    
+    AVAudioFrameCount mixCount = MIN(speech.frameLength, filter.frameLength);
+    if (noiseOffset < 0 || noiseOffset + mixCount > noise.frameLength) {
+        noiseOffset = 0;
+        mixCount = MIN(mixCount, noise.frameLength);
+    }
+    
+    AVAudioChannelCount channelCount = speech.format.channelCount;
+    for (AVAudioChannelCount channel = 0; channel < channelCount; channel++) {
+        const float *speechData = speech.floatChannelData[channel];
+        // Mono noise and filter are applied to every speech channel.
+        const float *noiseData = noise.floatChannelData[MIN(channel, noise.format.channelCount - 1)] + noiseOffset;
+        const float *filterData = filter.floatChannelData[MIN(channel, filter.format.channelCount - 1)];
+        float *outputData = output.floatChannelData[channel];
+        
+        // output = (noise * gain + speech) * filter
+        vDSP_vsma(noiseData, 1, &noiseGain, speechData, 1, outputData, 1, mixCount);
+        vDSP_vmul(outputData, 1, filterData, 1, outputData, 1, mixCount);
+        if (speech.frameLength > mixCount) {
+            memcpy(outputData + mixCount, speechData + mixCount, sizeof(float) * (speech.frameLength - mixCount));
+        }
+    }
+    return output;
+}
+
+@end
@@ -30,6 +30,7 @@
 
 
 #import <ResearchKit/ORKResult.h>
+#import <ResearchKitActiveTask/ORKResponseStatistics.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -97,6 +98,11 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, copy, nullable) NSArray<ORKPSATSample *> *samples;
 
+/**
+ A summary of the times taken to answer each addition, of the incorrect answers, and of the additions without an answer, accumulated as the task proceeds.
+ */
+@property (nonatomic, copy, nullable) ORKResponseStatistics *statistics;
+
 @end
 
 
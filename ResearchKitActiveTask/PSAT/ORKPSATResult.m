@@ -101,6 +101,7 @@
     ORK_ENCODE_DOUBLE(aCoder, totalTime);
     ORK_ENCODE_INTEGER(aCoder, initialDigit);
     ORK_ENCODE_OBJ(aCoder, samples);
+    ORK_ENCODE_OBJ(aCoder, statistics);
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
@@ -115,6 +116,7 @@
         ORK_DECODE_DOUBLE(aDecoder, totalTime);
         ORK_DECODE_INTEGER(aDecoder, initialDigit);
         ORK_DECODE_OBJ_ARRAY(aDecoder, samples, ORKPSATSample);
+        ORK_DECODE_OBJ_CLASS(aDecoder, statistics, ORKResponseStatistics);
     }
     return self;
     
@@ -137,7 +139,8 @@
             (self.totalDyad == castObject.totalDyad) &&
             (self.totalTime == castObject.totalTime) &&
             (self.initialDigit == castObject.initialDigit) &&
-            ORKEqualObjects(self.samples, castObject.samples)) ;
+            ORKEqualObjects(self.samples, castObject.samples) &&
+            ORKEqualObjects(self.statistics, castObject.statistics)) ;
 }
 
 - (NSUInteger)hash {
@@ -155,6 +158,7 @@
     result.totalTime = self.totalTime;
     result.initialDigit = self.initialDigit;
     result.samples = [self.samples copy];
+    result.statistics = self.statistics;
     return result;
 }
 
@@ -44,6 +44,13 @@ ORK_CLASS_AVAILABLE
 @property (nonatomic, assign) NSTimeInterval stimulusDuration;
 @property (nonatomic, assign) NSInteger seriesLength;
 
+/**
+ The seed of the step's stimulus schedule. The default value is 0, which uses a new random seed
+ each time the step runs. The seed used is reported in the step's `ORKTrialPlanResult`; run the
+ step with that seed to present the same stimuli again.
+ */
+@property (nonatomic, assign) uint32_t seed;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -98,6 +98,7 @@
         ORK_DECODE_DOUBLE(aDecoder, interStimulusInterval);
         ORK_DECODE_DOUBLE(aDecoder, stimulusDuration);
         ORK_DECODE_INTEGER(aDecoder, seriesLength);
+        ORK_DECODE_UINT32(aDecoder, seed);
     }
     return self;
 }
@@ -108,6 +109,7 @@
     ORK_ENCODE_DOUBLE(aCoder, interStimulusInterval);
     ORK_ENCODE_DOUBLE(aCoder, stimulusDuration);
     ORK_ENCODE_INTEGER(aCoder, seriesLength);
+    ORK_ENCODE_UINT32(aCoder, seed);
 }
 
 - (instancetype)copyWithZone:(NSZone *)zone {
@@ -116,11 +118,12 @@
     step.interStimulusInterval = self.interStimulusInterval;
     step.stimulusDuration = self.stimulusDuration;
     step.seriesLength = self.seriesLength;
+    step.seed = self.seed;
     return step;
 }
 
 - (NSUInteger)hash {
-    return [super hash] ^ self.presentationMode ^ (NSInteger)(self.interStimulusInterval*100) ^ (NSInteger)(self.stimulusDuration*100) ^ self.seriesLength;
+    return [super hash] ^ self.presentationMode ^ (NSInteger)(self.interStimulusInterval*100) ^ (NSInteger)(self.stimulusDuration*100) ^ self.seriesLength ^ self.seed;
 }
 
 - (BOOL)isEqual:(id)object {
@@ -131,7 +134,8 @@
             (self.presentationMode == castObject.presentationMode) &&
             (self.interStimulusInterval == castObject.interStimulusInterval) &&
             (self.stimulusDuration == castObject.stimulusDuration) &&
-            (self.seriesLength == castObject.seriesLength));
+            (self.seriesLength == castObject.seriesLength) &&
+            (self.seed == castObject.seed));
 }
 
 @end
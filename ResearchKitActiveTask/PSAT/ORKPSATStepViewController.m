@@ -43,8 +43,11 @@
 #import "ORKCollectionResult_Private.h"
 #import "ORKPSATResult.h"
 #import "ORKPSATStep.h"
+#import "ORKResponseStatisticsAccumulator.h"
 #import "ORKResult.h"
 #import "ORKStepViewController_Internal.h"
+#import "ORKTrialPlanGenerator.h"
+#import "ORKTrialPlanResult.h"
 
 #import "ORKHelpers_Internal.h"
 
@@ -59,6 +62,9 @@
 @property (nonatomic, strong) ORKActiveStepTimer *clearDigitsTimer;
 @property (nonatomic, assign) NSTimeInterval answerStart;
 @property (nonatomic, assign) NSTimeInterval answerEnd;
+@property (nonatomic, strong) ORKResponseStatisticsAccumulator *statisticsAccumulator;
+@property (nonatomic, strong) ORKTrialPlanGenerator *trialPlanGenerator;
+@property (nonatomic, strong) ORKTrialPlanResult *trialPlan;
 
 @end
 
@@ -80,19 +86,6 @@
     return (ORKPSATStep *)self.step;
 }
 
-- (NSArray *)arrayWithPSATDigits {
-    NSMutableArray *array = [[NSMutableArray alloc] initWithCapacity:[self psatStep].seriesLength + 1];
-    NSUInteger digit = 0;
-    for (NSUInteger i = 0; i < [self psatStep].seriesLength + 1; i++) {
-        do
-        {
-            digit = (arc4random() % (9)) + 1;
-        } while (digit == ((NSNumber *)[array lastObject]).integerValue);
-        [array addObject:@(digit)];
-    }
-    return array;
-}
-
 - (void)initializeInternalButtonItems {
     [super initializeInternalButtonItems];
     
@@ -111,6 +104,14 @@
     self.activeStepView.customContentFillsAvailableSpace = YES;
     
     self.timerUpdateInterval = [self psatStep].interStimulusInterval;
+    
+    // Draw the whole series now, off the main thread, so no digit is generated during the task.
+    NSString *identifier = self.step.identifier;
+    uint32_t seed = [self psatStep].seed;
+    NSUInteger seriesLength = [self psatStep].seriesLength;
+    self.trialPlanGenerator = [[ORKTrialPlanGenerator alloc] initWithBlock:^ORKTrialPlanResult *{
+        return [ORKTrialPlanGenerator PSATTrialPlanWithIdentifier:identifier seed:seed seriesLength:seriesLength];
+    }];
 }
 
 - (ORKStepResult *)result {
@@ -147,8 +148,12 @@
     PSATResult.totalTime = totalTime;
     PSATResult.totalDyad = totalDyad;
     PSATResult.samples = self.samples;
+    PSATResult.statistics = [self.statisticsAccumulator statistics];
 
     [results addObject:PSATResult];
+    if (self.trialPlan) {
+        [results addObject:self.trialPlan];
+    }
     
     sResult.results = [results copy];
     
@@ -156,12 +161,18 @@
 }
 
 - (void)start {
-    self.digits = [self arrayWithPSATDigits];
+    self.trialPlan = self.trialPlanGenerator.trialPlan;
+    NSMutableArray<NSNumber *> *digits = [[NSMutableArray alloc] initWithCapacity:self.trialPlan.stimuli.count];
+    for (NSArray<NSNumber *> *stimulus in self.trialPlan.stimuli) {
+        [digits addObject:stimulus.firstObject];
+    }
+    self.digits = [digits copy];
     self.currentDigitIndex = 0;
     [self.psatContentView setAddition:self.currentDigitIndex forTotal:[self psatStep].seriesLength withDigit:self.digits[self.currentDigitIndex]];
     [self.psatContentView setProgress:0.001 animated:NO];
     self.currentAnswer = -1;
     self.samples = [NSMutableArray array];
+    self.statisticsAccumulator = [ORKResponseStatisticsAccumulator new];
     
     if ([self psatStep].presentationMode & ORKPSATPresentationModeVisual &&
         ([self psatStep].interStimulusInterval - [self psatStep].stimulusDuration) > 0.05 ) {
@@ -235,6 +246,15 @@
     sample.time = self.answerEnd == 0 ? [self psatStep].interStimulusInterval : self.answerEnd - self.answerStart;
     
     [self.samples addObject:sample];
+    
+    if (self.answerEnd == 0) {
+        [self.statisticsAccumulator addLapse];
+    } else {
+        [self.statisticsAccumulator addValue:sample.time];
+        if (!sample.isCorrect) {
+            [self.statisticsAccumulator addError];
+        }
+    }
 }
 
 #pragma mark - keyboard view delegate
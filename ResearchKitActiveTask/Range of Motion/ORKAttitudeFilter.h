@@ -0,0 +1,140 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <CoreMotion/CMAttitude.h>
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The device axis a range of motion is measured about.
+ */
+typedef NS_ENUM(NSInteger, ORKAttitudeFilterAxis) {
+    /// The device's x axis, used in portrait orientations.
+    ORKAttitudeFilterAxisX = 0,
+    
+    /// The device's y axis, used in landscape orientations.
+    ORKAttitudeFilterAxisY,
+};
+
+/**
+ Returns the angle, in degrees from -180 to 180, of the component of the rotation `quaternion`
+ about `axis` (its twist). Unlike Euler angles, the twist stays accurate however far the device
+ is also turned about the other axes; it is 0 when the rotation is a half turn about an axis
+ perpendicular to `axis`.
+ */
+ORK_EXTERN double ORKAttitudeFilterTwistAngle(CMQuaternion quaternion, ORKAttitudeFilterAxis axis);
+
+/**
+ Returns the Euler angle, in degrees from -180 to 180, of the attitude `quaternion` about `axis`,
+ as the range of motion tasks have always measured the start position.
+ */
+ORK_EXTERN double ORKAttitudeFilterEulerAngle(CMQuaternion quaternion, ORKAttitudeFilterAxis axis);
+
+/**
+ Turns device attitudes into a filtered time series of angles about one axis, relative to a
+ reference attitude, on a private serial queue.
+ 
+ Each attitude is expressed relative to the reference, flipped into the same hemisphere as the
+ filtered attitude, and rejected as an outlier if reaching it would take an angular speed above
+ `maximumAngularSpeed`; after three rejections in a row the filter accepts the next attitude, so
+ it follows a genuine fast movement. Accepted attitudes are blended into the filtered attitude by
+ spherical linear interpolation, a first-order low-pass filter with the time constant
+ `timeConstant`. The angle of the filtered attitude is its twist about the axis; angles between
+ 90 and 180 degrees are reported from -270 to -180 degrees, which covers every achievable knee
+ and shoulder range of motion without a discontinuity.
+ 
+ Reading the results waits for every queued attitude to be filtered.
+ */
+@interface ORKAttitudeFilter : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns a filter measuring angles about `axis`, relative to `referenceQuaternion`.
+ */
+- (instancetype)initWithAxis:(ORKAttitudeFilterAxis)axis
+         referenceQuaternion:(CMQuaternion)referenceQuaternion NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) ORKAttitudeFilterAxis axis;
+
+/**
+ The Euler angle of the reference attitude about the axis, in degrees.
+ */
+@property (nonatomic, readonly) double referenceAngle;
+
+/**
+ The time constant of the low-pass filter, in seconds. The default value is 0.1 s. Set it before
+ adding attitudes.
+ */
+@property (nonatomic, assign) NSTimeInterval timeConstant;
+
+/**
+ The highest angular speed accepted between two attitudes, in degrees per second. The default
+ value is 1000 degrees per second. Set it before adding attitudes.
+ */
+@property (nonatomic, assign) double maximumAngularSpeed;
+
+/**
+ Adds an attitude to the filter queue and returns immediately.
+ */
+- (void)enqueueQuaternion:(CMQuaternion)quaternion timestamp:(NSTimeInterval)timestamp;
+
+/**
+ Filters the attitudes synchronously, after any attitudes that are already queued.
+ */
+- (void)processQuaternions:(const CMQuaternion *)quaternions
+                timestamps:(const NSTimeInterval *)timestamps
+                     count:(NSUInteger)count;
+
+/// The filtered angle of the latest attitude, in degrees, or 0 before the first attitude.
+@property (nonatomic, readonly) double latestAngle;
+
+/// The smallest filtered angle, in degrees.
+@property (nonatomic, readonly) double minimumAngle;
+
+/// The largest filtered angle, in degrees.
+@property (nonatomic, readonly) double maximumAngle;
+
+/// The number of attitudes rejected as outliers.
+@property (nonatomic, readonly) NSUInteger rejectedSampleCount;
+
+/// The time of each accepted attitude, in seconds since the first one.
+@property (nonatomic, readonly) NSArray<NSNumber *> *timestamps;
+
+/// The filtered angle after each accepted attitude, in degrees.
+@property (nonatomic, readonly) NSArray<NSNumber *> *angles;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,273 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKAttitudeFilter.h"
+
+#import "ORKHelpers_Internal.h"
+
+
+static const NSUInteger ORKAttitudeFilterMaximumConsecutiveRejections = 3;
+
+static double ORKDegrees(double radians) {
+    return radians * 180.0 / M_PI;
+}
+
+static double ORKQuaternionDot(CMQuaternion a, CMQuaternion b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+static CMQuaternion ORKQuaternionNormalize(CMQuaternion q) {
+    double norm = sqrt(ORKQuaternionDot(q, q));
+    if (norm == 0) {
+        return (CMQuaternion){ .x = 0, .y = 0, .z = 0, .w = 1 };
+    }
+    return (CMQuaternion){ .x = q.x / norm, .y = q.y / norm, .z = q.z / norm, .w = q.w / norm };
+}
+
+static CMQuaternion ORKQuaternionNegate(CMQuaternion q) {
+    return (CMQuaternion){ .x = -q.x, .y = -q.y, .z = -q.z, .w = -q.w };
+}
+
+// Returns the rotation from a to b in the frame of a, as -[CMAttitude multiplyByInverseOfAttitude:].
+static CMQuaternion ORKQuaternionRelative(CMQuaternion a, CMQuaternion b) {
+    CMQuaternion c = { .x = -a.x, .y = -a.y, .z = -a.z, .w = a.w };
+    return (CMQuaternion){
+        .x = c.w * b.x + c.x * b.w + c.y * b.z - c.z * b.y,
+        .y = c.w * b.y - c.x * b.z + c.y * b.w + c.z * b.x,
+        .z = c.w * b.z + c.x * b.y - c.y * b.x + c.z * b.w,
+        .w = c.w * b.w - c.x * b.x - c.y * b.y - c.z * b.z
+    };
+}
+
+static CMQuaternion ORKQuaternionSlerp(CMQuaternion a, CMQuaternion b, double t) {
+    double dot = ORKQuaternionDot(a, b);
+    if (dot < 0) {
+        // Take the shorter arc.
+        b = ORKQuaternionNegate(b);
+        dot = -dot;
+    }
+    if (dot > 0.9995) {
+        // Nearly parallel: interpolate linearly to avoid dividing by a vanishing sine.
+        return ORKQuaternionNormalize((CMQuaternion){
+            .x = a.x + t * (b.x - a.x),
+            .y = a.y + t * (b.y - a.y),
+            .z = a.z + t * (b.z - a.z),
+            .w = a.w + t * (b.w - a.w)
+        });
+    }
+    double theta = acos(dot);
+    double sinTheta = sin(theta);
+    double s0 = sin((1 - t) * theta) / sinTheta;
+    double s1 = sin(t * theta) / sinTheta;
+    return (CMQuaternion){
+        .x = s0 * a.x + s1 * b.x,
+        .y = s0 * a.y + s1 * b.y,
+        .z = s0 * a.z + s1 * b.z,
+        .w = s0 * a.w + s1 * b.w
+    };
+}
+
+// Angle of the shortest rotation between two attitudes, in degrees.
+static double ORKQuaternionAngularDistance(CMQuaternion a, CMQuaternion b) {
+    return ORKDegrees(2 * acos(MIN(1.0, fabs(ORKQuaternionDot(a, b)))));
+}
+
+double ORKAttitudeFilterTwistAngle(CMQuaternion quaternion, ORKAttitudeFilterAxis axis) {
+    CMQuaternion q = quaternion.w < 0 ? ORKQuaternionNegate(quaternion) : quaternion;
+    double component = (axis == ORKAttitudeFilterAxisY) ? q.y : q.x;
+    return ORKDegrees(2 * atan2(component, q.w));
+}
+
+double ORKAttitudeFilterEulerAngle(CMQuaternion q, ORKAttitudeFilterAxis axis) {
+    if (axis == ORKAttitudeFilterAxisY) {
+        return ORKDegrees(atan2(2.0 * (q.y * q.w - q.x * q.z), 1.0 - 2.0 * (q.y * q.y + q.z * q.z)));
+    }
+    return ORKDegrees(atan2(2.0 * (q.x * q.w + q.y * q.z), 1.0 - 2.0 * (q.x * q.x + q.z * q.z)));
+}
+
+static NSArray<NSNumber *> *ORKNumbersFromDoubleData(NSData *data) {
+    const double *values = data.bytes;
+    NSUInteger count = data.length / sizeof(double);
+    NSMutableArray<NSNumber *> *numbers = [[NSMutableArray alloc] initWithCapacity:count];
+    for (NSUInteger index = 0; index < count; index++) {
+        [numbers addObject:@(values[index])];
+    }
+    return [numbers copy];
+}
+
+
+@implementation ORKAttitudeFilter {
+    dispatch_queue_t _filterQueue;
+    CMQuaternion _referenceQuaternion;
+    
+    // Only accessed on the filter queue.
+    BOOL _hasSamples;
+    CMQuaternion _filteredQuaternion;
+    CMQuaternion _lastAcceptedQuaternion;
+    NSTimeInterval _firstTimestamp;
+    NSTimeInterval _lastTimestamp;
+    NSUInteger _consecutiveRejections;
+    NSUInteger _rejectedSampleCount;
+    double _latestAngle;
+    double _minimumAngle;
+    double _maximumAngle;
+    NSMutableData *_timestampData;
+    NSMutableData *_angleData;
+}
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithAxis:(ORKAttitudeFilterAxis)axis referenceQuaternion:(CMQuaternion)referenceQuaternion {
+    self = [super init];
+    if (self) {
+        _axis = axis;
+        _referenceQuaternion = ORKQuaternionNormalize(referenceQuaternion);
+        _referenceAngle = ORKAttitudeFilterEulerAngle(_referenceQuaternion, axis);
+        _timeConstant = 0.1;
+        _maximumAngularSpeed = 1000;
+        _filterQueue = dispatch_queue_create("org.researchkit.attitude-filter", DISPATCH_QUEUE_SERIAL);
+        _timestampData = [NSMutableData new];
+        _angleData = [NSMutableData new];
+    }
+    return self;
+}
+
+// Must run on the filter queue.
+- (void)filterQuaternion:(CMQuaternion)quaternion timestamp:(NSTimeInterval)timestamp {
+    CMQuaternion relative = ORKQuaternionNormalize(ORKQuaternionRelative(_referenceQuaternion, ORKQuaternionNormalize(quaternion)));
+    
+    if (!_hasSamples) {
+        _hasSamples = YES;
+        _filteredQuaternion = relative;
+        _firstTimestamp = timestamp;
+    } else {
+        NSTimeInterval interval = timestamp - _lastTimestamp;
+        double distance = ORKQuaternionAngularDistance(_lastAcceptedQuaternion, relative);
+        double speed = interval > 0 ? distance / interval : (distance > 0 ? INFINITY : 0);
+        if (speed > _maximumAngularSpeed && _consecutiveRejections < ORKAttitudeFilterMaximumConsecutiveRejections) {
+            _consecutiveRejections += 1;
+            _rejectedSampleCount += 1;
+            return;
+        }
+        
+        if (ORKQuaternionDot(_filteredQuaternion, relative) < 0) {
+            relative = ORKQuaternionNegate(relative);
+        }
+        double smoothing = (_timeConstant > 0 && interval > 0) ? 1 - exp(-interval / _timeConstant) : 1;
+        _filteredQuaternion = ORKQuaternionSlerp(_filteredQuaternion, relative, smoothing);
+    }
+    _consecutiveRejections = 0;
+    _lastAcceptedQuaternion = relative;
+    _lastTimestamp = timestamp;
+    
+    double angle = ORKAttitudeFilterTwistAngle(_filteredQuaternion, _axis);
+    if (angle > 90) {
+        angle -= 360;
+    }
+    BOOL isFirstAngle = (_angleData.length == 0);
+    _latestAngle = angle;
+    _minimumAngle = isFirstAngle ? angle : MIN(_minimumAngle, angle);
+    _maximumAngle = isFirstAngle ? angle : MAX(_maximumAngle, angle);
+    
+    double time = timestamp - _firstTimestamp;
+    [_timestampData appendBytes:&time length:sizeof(double)];
+    [_angleData appendBytes:&angle length:sizeof(double)];
+}
+
+- (void)enqueueQuaternion:(CMQuaternion)quaternion timestamp:(NSTimeInterval)timestamp {
+    dispatch_async(_filterQueue, ^{
+        [self filterQuaternion:quaternion timestamp:timestamp];
+    });
+}
+
+- (void)processQuaternions:(const CMQuaternion *)quaternions timestamps:(const NSTimeInterval *)timestamps count:(NSUInteger)count {
+    dispatch_sync(_filterQueue, ^{
+        for (NSUInteger index = 0; index < count; index++) {
+            [self filterQuaternion:quaternions[index] timestamp:timestamps[index]];
+        }
+    });
+}
+
+- (double)latestAngle {
+    __block double angle;
+    dispatch_sync(_filterQueue, ^{
+        angle = self->_latestAngle;
+    });
+    return angle;
+}
+
+- (double)minimumAngle {
+    __block double angle;
+    dispatch_sync(_filterQueue, ^{
+        angle = self->_minimumAngle;
+    });
+    return angle;
+}
+
+- (double)maximumAngle {
+    __block double angle;
+    dispatch_sync(_filterQueue, ^{
+        angle = self->_maximumAngle;
+    });
+    return angle;
+}
+
+- (NSUInteger)rejectedSampleCount {
+    __block NSUInteger count;
+    dispatch_sync(_filterQueue, ^{
+        count = self->_rejectedSampleCount;
+    });
+    return count;
+}
+
+- (NSArray<NSNumber *> *)timestamps {
+    __block NSData *data;
+    dispatch_sync(_filterQueue, ^{
+        data = [self->_timestampData copy];
+    });
+    return ORKNumbersFromDoubleData(data);
+}
+
+- (NSArray<NSNumber *> *)angles {
+    __block NSData *data;
+    dispatch_sync(_filterQueue, ^{
+        data = [self->_angleData copy];
+    });
+    return ORKNumbersFromDoubleData(data);
+}
+
+@end
@@ -67,6 +67,22 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, assign) double range;
 
+/**
+ The time of each motion sample used, in seconds since the first sample.
+ */
+@property (nonatomic, copy, nullable) NSArray<NSNumber *> *timestamps;
+
+/**
+ The filtered angle (degrees) from the device reference position at each time in `timestamps`,
+ measured the same way as `minimum` and `maximum`.
+ */
+@property (nonatomic, copy, nullable) NSArray<NSNumber *> *angles;
+
+/**
+ The number of motion samples discarded because they implied an implausibly fast movement.
+ */
+@property (nonatomic, assign) NSInteger rejectedSampleCount;
+
 @end
 
 NS_ASSUME_NONNULL_END
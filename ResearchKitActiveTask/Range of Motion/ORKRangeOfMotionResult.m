@@ -44,6 +44,9 @@
     ORK_ENCODE_DOUBLE(aCoder, minimum);
     ORK_ENCODE_DOUBLE(aCoder, maximum);
     ORK_ENCODE_DOUBLE(aCoder, range);
+    ORK_ENCODE_OBJ(aCoder, timestamps);
+    ORK_ENCODE_OBJ(aCoder, angles);
+    ORK_ENCODE_INTEGER(aCoder, rejectedSampleCount);
 }
 
 - (id)initWithCoder:(NSCoder *)aDecoder {
@@ -54,6 +57,9 @@
         ORK_DECODE_DOUBLE(aDecoder, minimum);
         ORK_DECODE_DOUBLE(aDecoder, maximum);
         ORK_DECODE_DOUBLE(aDecoder, range);
+        ORK_DECODE_OBJ_ARRAY(aDecoder, timestamps, NSNumber);
+        ORK_DECODE_OBJ_ARRAY(aDecoder, angles, NSNumber);
+        ORK_DECODE_INTEGER(aDecoder, rejectedSampleCount);
     }
     return self;
 }
@@ -70,7 +76,10 @@
     self.finish == castObject.finish &&
     self.minimum == castObject.minimum &&
     self.maximum == castObject.maximum &&
-    self.range == castObject.range;
+    self.range == castObject.range &&
+    ORKEqualObjects(self.timestamps, castObject.timestamps) &&
+    ORKEqualObjects(self.angles, castObject.angles) &&
+    self.rejectedSampleCount == castObject.rejectedSampleCount;
 }
 
 - (NSUInteger)hash {
@@ -84,11 +93,14 @@
     result.minimum = self.minimum;
     result.maximum = self.maximum;
     result.range = self.range;
+    result.timestamps = self.timestamps;
+    result.angles = self.angles;
+    result.rejectedSampleCount = self.rejectedSampleCount;
     return result;
 }
 
 - (NSString *)descriptionWithNumberOfPaddingSpaces:(NSUInteger)numberOfPaddingSpaces {
-    return [NSString stringWithFormat:@"<%@: start: %f; finish: %f; minimum: %f; maximum: %f; range: %f>", self.class.description, self.start, self.finish, self.minimum, self.maximum, self.range];
+    return [NSString stringWithFormat:@"<%@: start: %f; finish: %f; minimum: %f; maximum: %f; range: %f; samples: %@; rejectedSampleCount: %@>", self.class.description, self.start, self.finish, self.minimum, self.maximum, self.range, @(self.angles.count), @(self.rejectedSampleCount)];
 }
 
 @end
@@ -32,6 +32,7 @@
 #import "ORKRangeOfMotionStepViewController.h"
 
 #import "ORKActiveStepCustomView.h"
+#import "ORKAttitudeFilter.h"
 #import "ORKHelpers_Internal.h"
 #import "ORKActiveStepViewController_Internal.h"
 #import "ORKStepViewController_Internal.h"
@@ -45,12 +46,6 @@
 #import <ResearchKit/ORKStep.h>
 
 
-#define radiansToDegrees(radians) ((radians) * 180.0 / M_PI)
-#define allOrientationsForPitch(x, w, y, z) (atan2(2.0 * (x*w + y*z), 1.0 - 2.0 * (x*x + z*z)))
-#define allOrientationsForRoll(x, w, y, z) (atan2(2.0 * (y*w - x*z), 1.0 - 2.0 * (y*y + z*z)))
-#define allOrientationsForYaw(x, w, y, z) (asin(2.0 * (x*y - w*z)))
-
-
 @interface ORKRangeOfMotionContentView : ORKActiveStepCustomView {
     NSLayoutConstraint *_topConstraint;
 }
@@ -125,7 +120,7 @@
 @interface ORKRangeOfMotionStepViewController () <ORKDeviceMotionRecorderDelegate> {
     ORKRangeOfMotionContentView *_contentView;
     UITapGestureRecognizer *_gestureRecognizer;
-    CMAttitude *_referenceAttitude;
+    ORKAttitudeFilter *_attitudeFilter;
     UIInterfaceOrientation _orientation;
 }
 
@@ -149,65 +144,35 @@
 }
 
 - (void)calculateAndSetAngles {
-    _startAngle = ([self getDeviceAngleInDegreesFromAttitude:_referenceAttitude]);
-    
-    //This function calculates maximum and minimum angles recorded by the device
-    if (_newAngle > _maxAngle) {
-        _maxAngle = _newAngle;
-    }
-    if (_minAngle == 0.0 || _newAngle < _minAngle) {
-        _minAngle = _newAngle;
+    if (!_attitudeFilter) {
+        return;
     }
+    _startAngle = _attitudeFilter.referenceAngle;
+    _newAngle = _attitudeFilter.latestAngle;
+    _minAngle = _attitudeFilter.minimumAngle;
+    _maxAngle = _attitudeFilter.maximumAngle;
 }
 
 #pragma mark - ORKDeviceMotionRecorderDelegate
 
 - (void)deviceMotionRecorderDidUpdateWithMotion:(CMDeviceMotion *)motion {
-    if (!_referenceAttitude) {
-        _referenceAttitude = motion.attitude;
-    }
-    CMAttitude *currentAttitude = [motion.attitude copy];
-
-    [currentAttitude multiplyByInverseOfAttitude:_referenceAttitude];
-    
-    double angle = [self getDeviceAngleInDegreesFromAttitude:currentAttitude];
-
-    //This function shifts the range of angles reported by the device from +/-180 degrees to -90 to +270 degrees, which should be sufficient to cover all ahievable knee and shoulder ranges of motion
-    BOOL shiftAngleRange = angle > 90 && angle <= 180;
-    if (shiftAngleRange) {
-        _newAngle = fabs(angle) - 360;
-    } else {
-        _newAngle = angle;
+    // The first attitude is the reference; filtering and angle extraction run on the filter's queue.
+    if (!_attitudeFilter) {
+        _attitudeFilter = [[ORKAttitudeFilter alloc] initWithAxis:[self attitudeFilterAxis]
+                                              referenceQuaternion:motion.attitude.quaternion];
     }
-    
-    [self calculateAndSetAngles];
+    [_attitudeFilter enqueueQuaternion:motion.attitude.quaternion timestamp:motion.timestamp];
 }
 
 /*
- When the device is in Portrait mode, we need to get the attitude's pitch
- to determine the device's angle. attitude.pitch doesn't return all
- orientations, so we use the attitude's quaternion to calculate the
- angle.
+ When the device is in Portrait mode, the device's angle is its rotation about
+ its x axis (pitch); in Landscape mode, about its y axis (roll).
  */
-- (double)getDeviceAngleInDegreesFromAttitude:(CMAttitude *)attitude {
+- (ORKAttitudeFilterAxis)attitudeFilterAxis {
     if (!_orientation) {
         _orientation = self.view.window.windowScene.interfaceOrientation;
     }
-    double angle;
-    if (UIInterfaceOrientationIsLandscape(_orientation)) {
-        double x = attitude.quaternion.x;
-        double w = attitude.quaternion.w;
-        double y = attitude.quaternion.y;
-        double z = attitude.quaternion.z;
-        angle = radiansToDegrees(allOrientationsForRoll(x, w, y, z));
-    } else {
-        double x = attitude.quaternion.x;
-        double w = attitude.quaternion.w;
-        double y = attitude.quaternion.y;
-        double z = attitude.quaternion.z;
-        angle = radiansToDegrees(allOrientationsForPitch(x, w, y, z));
-    }
-    return angle;
+    return UIInterfaceOrientationIsLandscape(_orientation) ? ORKAttitudeFilterAxisY : ORKAttitudeFilterAxisX;
 }
 
 
@@ -216,6 +181,7 @@
 - (ORKResult *)result {
     ORKStepResult *stepResult = [super result];
     
+    [self calculateAndSetAngles];
     ORKRangeOfMotionResult *result = [[ORKRangeOfMotionResult alloc] initWithIdentifier:self.step.identifier];
     
     result.start = 90.0 - _startAngle;
@@ -225,6 +191,14 @@
     result.maximum = result.start - _minAngle;
     result.range = fabs(result.maximum - result.minimum);
     
+    NSMutableArray<NSNumber *> *angles = [NSMutableArray new];
+    for (NSNumber *angle in _attitudeFilter.angles) {
+        [angles addObject:@(result.start - angle.doubleValue)];
+    }
+    result.timestamps = _attitudeFilter.timestamps;
+    result.angles = [angles copy];
+    result.rejectedSampleCount = _attitudeFilter.rejectedSampleCount;
+    
     stepResult.results = [self.addedResults arrayByAddingObject:result] ? : @[result];
     
     return stepResult;
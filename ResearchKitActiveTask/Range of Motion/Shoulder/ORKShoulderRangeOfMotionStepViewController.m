@@ -31,30 +31,8 @@
 
 #import "ORKShoulderRangeOfMotionStepViewController.h"
 
-#import <ResearchKit/ORKCollectionResult.h>
-#import <ResearchKit/ORKStep.h>
-#import "ORKRangeOfMotionResult.h"
-#import "ORKStepViewController_Internal.h"
-
 
+// The shoulder task measures and reports angles exactly as the knee task does.
 @implementation ORKShoulderRangeOfMotionStepViewController
 
-#pragma mark - ORKActiveTaskViewController
-
-- (ORKResult *)result {
-    ORKStepResult *stepResult = [super result];
-    
-    ORKRangeOfMotionResult *result = [[ORKRangeOfMotionResult alloc] initWithIdentifier:self.step.identifier];
-    result.start = 90.0 - _startAngle;
-    result.finish = result.start - _newAngle;
-    //Because the task uses pitch in the direction opposite to the original CoreMotion device axes (i.e. right hand rule), maximum and minimum angles are reported the 'wrong' way around for the knee and shoulder tasks
-    result.minimum = result.start - _maxAngle;
-    result.maximum = result.start - _minAngle;
-    result.range = fabs(result.maximum - result.minimum);
-
-    stepResult.results = [self.addedResults arrayByAddingObject:result] ? : @[result];
-    
-    return stepResult;
-}
-
 @end
@@ -30,6 +30,7 @@
 
 
 #import <ResearchKit/ORKResult.h>
+#import <ResearchKitActiveTask/ORKResponseStatistics.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -58,6 +59,13 @@ ORK_CLASS_AVAILABLE
 @property (nonatomic, copy, nullable) NSDate * reactionDate;
 @property (nonatomic) double currentInterval;
 
+/**
+ A summary of the attempts of the step up to and including this one.
+ 
+ The summary of the last attempt covers the whole step.
+ */
+@property (nonatomic, copy, nullable) ORKResponseStatistics *statistics;
+
 
 
 @end
@@ -45,6 +45,7 @@
     ORK_ENCODE_OBJ(aCoder, stimulusStartDate);
     ORK_ENCODE_OBJ(aCoder, reactionDate);
     ORK_ENCODE_INTEGER(aCoder, currentInterval);
+    ORK_ENCODE_OBJ(aCoder, statistics);
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
@@ -55,6 +56,7 @@
         ORK_DECODE_OBJ_CLASS(aDecoder, stimulusStartDate, NSDate);
         ORK_DECODE_OBJ_CLASS(aDecoder, reactionDate, NSDate);
         ORK_DECODE_INTEGER(aDecoder, currentInterval);
+        ORK_DECODE_OBJ_CLASS(aDecoder, statistics, ORKResponseStatistics);
     }
     return self;
 }
@@ -72,7 +74,8 @@
                 ORKEqualObjects(self.timerEndDate, castObject.timerEndDate) &&
                 ORKEqualObjects(self.stimulusStartDate, castObject.stimulusStartDate) &&
                 ORKEqualObjects(self.reactionDate, castObject.reactionDate) &&
-                (self.currentInterval == castObject.currentInterval));
+                (self.currentInterval == castObject.currentInterval) &&
+                ORKEqualObjects(self.statistics, castObject.statistics));
     
 }
 
@@ -87,6 +90,7 @@
     result.stimulusStartDate = [self.stimulusStartDate copy];
     result.reactionDate = [self.reactionDate copy];
     result.currentInterval = self.currentInterval;
+    result.statistics = self.statistics;
     return result;
 }
 
@@ -44,6 +44,7 @@
 #import "ORKCollectionResult_Private.h"
 #import "ORKNormalizedReactionTimeResult.h"
 #import "ORKNormalizedReactionTimeStep.h"
+#import "ORKResponseStatisticsAccumulator.h"
 #import "ORKResult.h"
 
 #import "ORKHelpers_Internal.h"
@@ -67,6 +68,7 @@
     NSDate *_timerStartDate;
     NSDate *_stimulusStartDate;
     NSDate *_reactionDate;
+    ORKResponseStatisticsAccumulator *_statisticsAccumulator;
 }
 
 static const NSTimeInterval OutcomeAnimationDuration = 0.3;
@@ -78,6 +80,7 @@ static const NSTimeInterval OutcomeAnimationDuration = 0.3;
     // Do any additional setup after loading the view.
     [self configureTitle];
     _results = [NSMutableArray new];
+    _statisticsAccumulator = [ORKResponseStatisticsAccumulator new];
     _reactionTimeContentView = [ORKNormalizedReactionTimeContentView new];
     [_reactionTimeContentView.button addTarget:self action:@selector(startStimulusTimer) forControlEvents:UIControlEventTouchDown];
     [_reactionTimeContentView.button addTarget:self action:@selector(startReactionTimer) forControlEvents:UIControlEventTouchUpInside];
@@ -160,6 +163,15 @@ static const NSTimeInterval OutcomeAnimationDuration = 0.3;
     reactionTimeResult.reactionDate = _reactionDate;
     reactionTimeResult.stimulusStartDate = _stimulusStartDate;
     reactionTimeResult.currentInterval = [self reactionTimeStep].currentInterval;
+    if (_timedOut) {
+        [_statisticsAccumulator addLapse];
+    } else if (_stimulusStartDate && _reactionDate) {
+        [_statisticsAccumulator addValue:[_reactionDate timeIntervalSinceDate:_stimulusStartDate]];
+    } else if (_reactionDate) {
+        // Tapped before the stimulus.
+        [_statisticsAccumulator addError];
+    }
+    reactionTimeResult.statistics = [_statisticsAccumulator statistics];
     [_results addObject:reactionTimeResult];
     _timerStartDate = nil;
     _reactionDate = nil;
@@ -43,6 +43,7 @@
     [super encodeWithCoder:aCoder];
     ORK_ENCODE_DOUBLE(aCoder, timestamp);
     ORK_ENCODE_OBJ(aCoder, fileResults);
+    ORK_ENCODE_OBJ(aCoder, statistics);
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
@@ -50,6 +51,7 @@
     if (self) {
         ORK_DECODE_DOUBLE(aDecoder, timestamp);
         ORK_DECODE_OBJ_CLASS(aDecoder, fileResults, NSArray<ORKFileResult *>);
+        ORK_DECODE_OBJ_CLASS(aDecoder, statistics, ORKResponseStatistics);
     }
     return self;
 }
@@ -64,7 +66,8 @@
     __typeof(self) castObject = object;
     return (isParentSame &&
             (self.timestamp == castObject.timestamp) &&
-            ORKEqualObjects(self.fileResults, castObject.fileResults)) ;
+            ORKEqualObjects(self.fileResults, castObject.fileResults) &&
+            ORKEqualObjects(self.statistics, castObject.statistics)) ;
 }
 
 - (NSUInteger)hash {
@@ -75,6 +78,7 @@
     ORKReactionTimeResult *result = [super copyWithZone:zone];
     result.fileResults = [self.fileResults copy];
     result.timestamp = self.timestamp;
+    result.statistics = self.statistics;
     return result;
 }
 
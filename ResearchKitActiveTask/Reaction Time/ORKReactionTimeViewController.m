@@ -40,6 +40,7 @@
 #import "ORKCollectionResult_Private.h"
 #import "ORKReactionTimeResult.h"
 #import "ORKReactionTimeStep.h"
+#import "ORKResponseStatisticsAccumulator.h"
 #import "ORKResult.h"
 
 #import "ORKHelpers_Internal.h"
@@ -55,6 +56,9 @@
     NSTimer *_stimulusTimer;
     NSTimer *_timeoutTimer;
     NSTimeInterval _stimulusTimestamp;
+    // Time at which the threshold acceleration was reached in the current attempt, or 0.
+    NSTimeInterval _responseTimestamp;
+    ORKResponseStatisticsAccumulator *_statisticsAccumulator;
     BOOL _validResult;
     BOOL _timedOut;
     BOOL _shouldIndicateFailure;
@@ -70,6 +74,7 @@ static const NSTimeInterval OutcomeAnimationDuration = 0.3;
     [self configureTitle];
     _results = [NSMutableArray new];
     _fileResults = [NSMutableArray new];
+    _statisticsAccumulator = [ORKResponseStatisticsAccumulator new];
     _reactionTimeContentView = [ORKReactionTimeContentView new];
     self.activeStepView.activeCustomView = _reactionTimeContentView;
     [_reactionTimeContentView setStimulusHidden:YES];
@@ -90,6 +95,7 @@ static const NSTimeInterval OutcomeAnimationDuration = 0.3;
 
 - (void)start {
     [super start];
+    _responseTimestamp = 0;
     [self startStimulusTimer];
 
 }
@@ -98,8 +104,10 @@ static const NSTimeInterval OutcomeAnimationDuration = 0.3;
 - (void)motionBegan:(UIEventSubtype)motion withEvent:(UIEvent *)event {
     if (event.type == UIEventSubtypeMotionShake) {
         if (_validResult) {
+            [_statisticsAccumulator addValue:[NSProcessInfo processInfo].systemUptime - _stimulusTimestamp];
             ORKReactionTimeResult *reactionTimeResult = [[ORKReactionTimeResult alloc] initWithIdentifier:self.step.identifier];
             reactionTimeResult.timestamp = _stimulusTimestamp;
+            reactionTimeResult.statistics = [_statisticsAccumulator statistics];
             [_results addObject:reactionTimeResult];
         }
         [self attemptDidFinish];
@@ -131,9 +139,20 @@ static const NSTimeInterval OutcomeAnimationDuration = 0.3;
 - (void)recorder:(ORKRecorder *)recorder didCompleteWithResults:(NSArray<ORKFileResult *> *)results {
     [_fileResults addObjectsFromArray:results];
     
+    if (_validResult && _responseTimestamp > 0) {
+        [_statisticsAccumulator addValue:_responseTimestamp - _stimulusTimestamp];
+    } else if (_timedOut) {
+        [_statisticsAccumulator addLapse];
+    } else if (_responseTimestamp > 0) {
+        // Moved before the stimulus.
+        [_statisticsAccumulator addError];
+    }
+    _responseTimestamp = 0;
+    
     if (_validResult) {
         ORKReactionTimeResult *reactionTimeResult = [[ORKReactionTimeResult alloc] initWithIdentifier:self.step.identifier];
         reactionTimeResult.timestamp = _stimulusTimestamp;
+        reactionTimeResult.statistics = [_statisticsAccumulator statistics];
         
         // Save the list of file results related to that result, then reset the array for the next step
         reactionTimeResult.fileResults = [_fileResults copy];
@@ -151,6 +170,9 @@ static const NSTimeInterval OutcomeAnimationDuration = 0.3;
     CMAcceleration v = motion.userAcceleration;
     double vectorMagnitude = sqrt(((v.x * v.x) + (v.y * v.y) + (v.z * v.z)));
     if (vectorMagnitude > [self reactionTimeStep].thresholdAcceleration) {
+        if (_responseTimestamp == 0) {
+            _responseTimestamp = motion.timestamp;
+        }
         [self stopRecorders];
     }
 }
@@ -58,8 +58,10 @@ FOUNDATION_EXPORT const unsigned char ResearchKitActiveTaskVersionString[];
 #import <ResearchKitActiveTask/ORKdBHLToneAudiometryStep.h>
 #import <ResearchKitActiveTask/ORKdBHLToneAudiometryStepViewController.h>
 #import <ResearchKitActiveTask/ORKEnvironmentSPLMeterResult.h>
+#import <ResearchKitActiveTask/ORKGaitSummaryResult.h>
 #import <ResearchKitActiveTask/ORKEnvironmentSPLMeterStep.h>
 #import <ResearchKitActiveTask/ORKEnvironmentSPLMeterStepViewController.h>
+#import <ResearchKitActiveTask/ORKESerialization.h>
 #import <ResearchKitActiveTask/ORKFitnessStepViewController.h>
 #import <ResearchKitActiveTask/ORKFrontFacingCameraStepViewController.h>
 #import <ResearchKitActiveTask/ORKHolePegTestPlaceStepViewController.h>
@@ -73,6 +75,7 @@ FOUNDATION_EXPORT const unsigned char ResearchKitActiveTaskVersionString[];
 #import <ResearchKitActiveTask/ORKRangeOfMotionStepViewController.h>
 #import <ResearchKitActiveTask/ORKReactionTimeResult.h>
 #import <ResearchKitActiveTask/ORKReactionTimeViewController.h>
+#import <ResearchKitActiveTask/ORKResponseStatistics.h>
 #import <ResearchKitActiveTask/ORKShoulderRangeOfMotionStepViewController.h>
 #import <ResearchKitActiveTask/ORKSpatialSpanMemoryResult.h>
 #import <ResearchKitActiveTask/ORKSpatialSpanMemoryStepViewController.h>
@@ -86,12 +89,14 @@ FOUNDATION_EXPORT const unsigned char ResearchKitActiveTaskVersionString[];
 #import <ResearchKitActiveTask/ORKStroopStepViewController.h>
 #import <ResearchKitActiveTask/ORKTappingIntervalResult.h>
 #import <ResearchKitActiveTask/ORKTappingIntervalStepViewController.h>
+#import <ResearchKitActiveTask/ORKTaskCatalog.h>
 #import <ResearchKitActiveTask/ORKTimedWalkResult.h>
 #import <ResearchKitActiveTask/ORKTimedWalkStep.h>
 #import <ResearchKitActiveTask/ORKTimedWalkStepViewController.h>
 #import <ResearchKitActiveTask/ORKToneAudiometryResult.h>
 #import <ResearchKitActiveTask/ORKToneAudiometryStepViewController.h>
 #import <ResearchKitActiveTask/ORKTouchAbilityGestureRecoginzerEvent.h>
+#import <ResearchKitActiveTask/ORKTouchAbilityKinematicFeatures.h>
 #import <ResearchKitActiveTask/ORKTouchAbilityLongPressTrial.h>
 #import <ResearchKitActiveTask/ORKTouchAbilityPinchTrial.h>
 #import <ResearchKitActiveTask/ORKTouchAbilityRotationTrial.h>
@@ -107,6 +112,8 @@ FOUNDATION_EXPORT const unsigned char ResearchKitActiveTaskVersionString[];
 #import <ResearchKitActiveTask/ORKTowerOfHanoiStepViewController.h>
 #import <ResearchKitActiveTask/ORKTrailmakingResult.h>
 #import <ResearchKitActiveTask/ORKTrailmakingStepViewController.h>
+#import <ResearchKitActiveTask/ORKTremorSpectrumResult.h>
+#import <ResearchKitActiveTask/ORKTrialPlanResult.h>
 #import <ResearchKitActiveTask/ORKUSDZModelManager.h>
 #import <ResearchKitActiveTask/ORKUSDZModelManagerResult.h>
 #import <ResearchKitActiveTask/ORKWalkingTaskStepViewController.h>
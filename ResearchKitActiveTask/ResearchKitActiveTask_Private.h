@@ -29,16 +29,21 @@
  */
 
 #import <ResearchKitActiveTask/ORKAccelerometerRecorder.h>
+#import <ResearchKitActiveTask/ORKAcousticFeatureExtractor.h>
 #import <ResearchKitActiveTask/ORKActiveStepTimer.h>
 #import <ResearchKitActiveTask/ORKActiveStepView.h>
 #import <ResearchKitActiveTask/ORKActiveStepViewController_Internal.h>
 #import <ResearchKitActiveTask/ORKAmslerGridStep.h>
+#import <ResearchKitActiveTask/ORKAttitudeFilter.h>
+#import <ResearchKitActiveTask/ORKAudioChunkWriter.h>
 #import <ResearchKitActiveTask/ORKAudioFitnessStep.h>
 #import <ResearchKitActiveTask/ORKAudioLevelNavigationRule.h>
 #import <ResearchKitActiveTask/ORKAudioMeteringView.h>
 #import <ResearchKitActiveTask/ORKAudiometry.h>
+#import <ResearchKitActiveTask/ORKAudiometrySimulator.h>
 #import <ResearchKitActiveTask/ORKAudioRecorder.h>
 #import <ResearchKitActiveTask/ORKAudioStep.h>
+#import <ResearchKitActiveTask/ORKAudioWaveformView.h>
 #import <ResearchKitActiveTask/ORKCountdownStep.h>
 #import <ResearchKitActiveTask/ORKdBHLToneAudiometryAudioGenerator.h>
 #import <ResearchKitActiveTask/ORKdBHLToneAudiometryContentView.h>
@@ -46,6 +51,7 @@
 #import <ResearchKitActiveTask/ORKDeviceMotionRecorder.h>
 #import <ResearchKitActiveTask/ORKEnvironmentSPLMeterStepViewController_Private.h>
 #import <ResearchKitActiveTask/ORKFitnessStep.h>
+#import <ResearchKitActiveTask/ORKGaitAnalyzer.h>
 #import <ResearchKitActiveTask/ORKHealthClinicalTypeRecorder.h>
 #import <ResearchKitActiveTask/ORKHealthQuantityTypeRecorder.h>
 #import <ResearchKitActiveTask/ORKHolePegTestPlaceStep.h>
@@ -56,10 +62,12 @@
 #import <ResearchKitActiveTask/ORKPSATStep.h>
 #import <ResearchKitActiveTask/ORKRangeOfMotionStep.h>
 #import <ResearchKitActiveTask/ORKReactionTimeStep.h>
+#import <ResearchKitActiveTask/ORKResponseStatisticsAccumulator.h>
 #import <ResearchKitActiveTask/ORKShoulderRangeOfMotionStep.h>
 #import <ResearchKitActiveTask/ORKSpatialSpanMemoryStep.h>
 #import <ResearchKitActiveTask/ORKSpeechInNoiseContentView.h>
 #import <ResearchKitActiveTask/ORKSpeechInNoiseStepViewController_Private.h>
+#import <ResearchKitActiveTask/ORKSpeechInNoiseStimulusCache.h>
 #import <ResearchKitActiveTask/ORKSpeechRecognitionContentView.h>
 #import <ResearchKitActiveTask/ORKSpeechRecognitionStepViewController_Private.h>
 #import <ResearchKitActiveTask/ORKStreamingAudioRecorder.h>
@@ -68,6 +76,7 @@
 #import <ResearchKitActiveTask/ORKTimedWalkStep.h>
 #import <ResearchKitActiveTask/ORKToneAudiometryStep.h>
 #import <ResearchKitActiveTask/ORKTouchAbilityContentView.h>
+#import <ResearchKitActiveTask/ORKTouchAbilityFeatureExtractor.h>
 #import <ResearchKitActiveTask/ORKTouchAbilityLongPressStep.h>
 #import <ResearchKitActiveTask/ORKTouchAbilityPinchStep.h>
 #import <ResearchKitActiveTask/ORKTouchAbilityRotationStep.h>
@@ -76,8 +85,12 @@
 #import <ResearchKitActiveTask/ORKTouchAbilitySwipeStep.h>
 #import <ResearchKitActiveTask/ORKTouchAbilityTapStep.h>
 #import <ResearchKitActiveTask/ORKTouchAbilityTouchTracker.h>
+#import <ResearchKitActiveTask/ORKTouchAbilityTrackStore.h>
 #import <ResearchKitActiveTask/ORKTouchRecorder.h>
+#import <ResearchKitActiveTask/ORKTouchSampleCapture.h>
 #import <ResearchKitActiveTask/ORKTowerOfHanoiStep.h>
 #import <ResearchKitActiveTask/ORKTrailmakingStep.h>
+#import <ResearchKitActiveTask/ORKTremorSpectrumAnalyzer.h>
+#import <ResearchKitActiveTask/ORKTrialPlanGenerator.h>
 #import <ResearchKitActiveTask/ORKVoiceEngine.h>
 #import <ResearchKitActiveTask/ORKWalkingTaskStep.h>
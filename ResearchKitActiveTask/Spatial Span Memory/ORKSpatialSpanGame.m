@@ -30,6 +30,7 @@
 
 
 #import "ORKSpatialSpanGame.h"
+#import "ORKTrialPlanGenerator.h"
 
 #import "ORKHelpers_Internal.h"
 
@@ -55,11 +56,11 @@
         _sequence[i] = i;
     }
     
-    // Knuth algorithm: swap each with a random element elsewhere in the array.
+    // Fisher-Yates shuffle, driven by the seed so the same seed always gives the same sequence.
     // Note: we will only use the first _sequenceLength elements of this array
-    srandom(_seed);
-    for (NSInteger i = 0; i < _gameSize; i++) {
-        NSInteger rand_i = arc4random() % _gameSize;
+    ORKTrialRandom random = ORKTrialRandomMake(_seed);
+    for (NSInteger i = _gameSize - 1; i > 0; i--) {
+        NSInteger rand_i = ORKTrialRandomUniform(&random, (uint32_t)(i + 1));
         NSInteger tmp = _sequence[i];
         _sequence[i] = _sequence[rand_i];
         _sequence[rand_i] = tmp;
@@ -83,10 +84,7 @@
         NSParameterAssert(_gameSize > 0);
         NSParameterAssert(_sequenceLength > 0);
         NSParameterAssert(_sequenceLength < _gameSize);
-        _seed = seed;
-        if (_seed == 0) {
-            _seed = arc4random();
-        }
+        _seed = ORKTrialPlanSeed(seed);
         [self generateSequence];
         
         if (_sequence == NULL) {
@@ -56,6 +56,13 @@ ORK_CLASS_AVAILABLE
 @property (nonatomic, strong, nullable) UIImage *customTargetImage;
 @property (nonatomic, copy, nullable) NSString *customTargetPluralName;
 
+/**
+ The seed of the step's stimulus schedule. The default value is 0, which uses a new random seed
+ each time the step runs. The seed used is reported in the step's `ORKTrialPlanResult`; run the
+ step with that seed to present the same stimuli again.
+ */
+@property (nonatomic, assign) uint32_t seed;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -58,6 +58,7 @@
     step.requireReversal = self.requireReversal;
     step.customTargetImage = self.customTargetImage;
     step.customTargetPluralName = self.customTargetPluralName;
+    step.seed = self.seed;
     return step;
 }
 
@@ -132,6 +133,7 @@
         ORK_DECODE_BOOL(aDecoder, requireReversal);
         ORK_DECODE_IMAGE(aDecoder, customTargetImage);
         ORK_DECODE_OBJ_CLASS(aDecoder, customTargetPluralName, NSString);
+        ORK_DECODE_UINT32(aDecoder, seed);
     }
     return self;
 }
@@ -147,6 +149,7 @@
     ORK_ENCODE_BOOL(aCoder, requireReversal);
     ORK_ENCODE_IMAGE(aCoder, customTargetImage);
     ORK_ENCODE_OBJ(aCoder, customTargetPluralName);
+    ORK_ENCODE_UINT32(aCoder, seed);
 }
 
 + (BOOL)supportsSecureCoding {
@@ -165,6 +168,7 @@
             (self.maximumTests == castObject.maximumTests) &&
             (self.maximumConsecutiveFailures == castObject.maximumConsecutiveFailures) &&
             (ORKEqualObjects(self.customTargetPluralName, castObject.customTargetPluralName)) &&
+            (self.seed == castObject.seed) &&
             (self.requireReversal == castObject.requireReversal));
 }
 
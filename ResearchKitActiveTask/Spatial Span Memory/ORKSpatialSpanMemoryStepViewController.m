@@ -47,6 +47,8 @@
 #import "ORKSpatialSpanGame.h"
 #import "ORKSpatialSpanGameState.h"
 #import "ORKSpatialSpanMemoryStep.h"
+#import "ORKTrialPlanGenerator.h"
+#import "ORKTrialPlanResult.h"
 #import "ORKNavigationContainerView_Internal.h"
 
 #import "ORKHelpers_Internal.h"
@@ -139,6 +141,9 @@ typedef void (^_ORKStateHandler)(ORKState *fromState, ORKState *_toState, id con
     
     NSTimer *_playbackTimer;
     NSTimer *_activityTimer;
+    
+    uint32_t _trialPlanSeed;
+    ORKTrialPlanGenerator *_trialPlanGenerator;
 }
 
 - (ORKSpatialSpanMemoryStep *)spatialSpanStep {
@@ -181,6 +186,19 @@ typedef void (^_ORKStateHandler)(ORKState *fromState, ORKState *_toState, id con
 - (void)stepDidChange {
     [super stepDidChange];
     
+    // Each game's sequence length depends on the previous games, so only the games' seeds can be
+    // planned ahead; they all derive from the session seed.
+    _trialPlanSeed = ORKTrialPlanSeed([self spatialSpanStep].seed);
+    _trialPlanGenerator = nil;
+    if (self.step) {
+        NSString *identifier = self.step.identifier;
+        uint32_t seed = _trialPlanSeed;
+        NSUInteger numberOfGames = [self spatialSpanStep].maximumTests;
+        _trialPlanGenerator = [[ORKTrialPlanGenerator alloc] initWithBlock:^ORKTrialPlanResult *{
+            return [ORKTrialPlanGenerator spatialSpanTrialPlanWithIdentifier:identifier seed:seed numberOfGames:numberOfGames];
+        }];
+    }
+    
     [self initializeStates];
     
 }
@@ -253,6 +271,9 @@ typedef void (^_ORKStateHandler)(ORKState *fromState, ORKState *_toState, id con
     memoryResult.gameRecords = [records copy];
     
     [results addObject:memoryResult];
+    if (_trialPlanGenerator) {
+        [results addObject:_trialPlanGenerator.trialPlan];
+    }
     stepResult.results = [results copy];
     
     return stepResult;
@@ -393,7 +414,7 @@ typedef void (^_ORKStateHandler)(ORKState *fromState, ORKState *_toState, id con
     NSInteger sequenceLength = _nextGameSequenceLength;
     _gridSize = [self gridSizeForSpan:sequenceLength];
     
-    ORKSpatialSpanGame *game = [[ORKSpatialSpanGame alloc] initWithGameSize:_gridSize.width * _gridSize.height sequenceLength:sequenceLength seed:0];
+    ORKSpatialSpanGame *game = [[ORKSpatialSpanGame alloc] initWithGameSize:_gridSize.width * _gridSize.height sequenceLength:sequenceLength seed:ORKTrialPlanSpatialSpanGameSeed(_trialPlanSeed, _gameRecords.count)];
     ORKSpatialSpanGameState *gameState = [[ORKSpatialSpanGameState alloc] initWithGame:game];
     
     _currentGameState = gameState;
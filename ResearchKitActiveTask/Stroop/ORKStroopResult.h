@@ -29,6 +29,7 @@
  */
 
 #import <ResearchKit/ORKResult.h>
+#import <ResearchKitActiveTask/ORKResponseStatistics.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -66,6 +67,13 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, copy, nullable) NSString *colorSelected;
 
+/**
+ A summary of the attempts of the step up to and including this one.
+ 
+ The summary of the last attempt covers the whole step.
+ */
+@property (nonatomic, copy, nullable) ORKResponseStatistics *statistics;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -69,6 +69,7 @@
 - (instancetype)copyWithZone:(NSZone *)zone {
     ORKStroopStep *step = [super copyWithZone:zone];
     step.numberOfAttempts = self.numberOfAttempts;
+    step.seed = self.seed;
     return step;
 }
 
@@ -76,6 +77,7 @@
     self = [super initWithCoder:aDecoder];
     if (self ) {
         ORK_DECODE_INTEGER(aDecoder, numberOfAttempts);
+        ORK_DECODE_UINT32(aDecoder, seed);
     }
     return self;
 }
@@ -83,13 +85,16 @@
 - (void)encodeWithCoder:(NSCoder *)aCoder {
     [super encodeWithCoder:aCoder];
     ORK_ENCODE_INTEGER(aCoder, numberOfAttempts);
+    ORK_ENCODE_UINT32(aCoder, seed);
 }
 
 - (BOOL)isEqual:(id)object {
     BOOL isParentSame = [super isEqual:object];
     
     __typeof(self) castObject = object;
-    return (isParentSame && (self.numberOfAttempts == castObject.numberOfAttempts));
+    return (isParentSame &&
+            (self.numberOfAttempts == castObject.numberOfAttempts) &&
+            (self.seed == castObject.seed));
 }
 
 @end
@@ -38,6 +38,9 @@
 #import "ORKResult_Private.h"
 #import "ORKCollectionResult_Private.h"
 #import "ORKStroopStep.h"
+#import "ORKResponseStatisticsAccumulator.h"
+#import "ORKTrialPlanGenerator.h"
+#import "ORKTrialPlanResult.h"
 #import "ORKHelpers_Internal.h"
 #import "ORKNavigationContainerView_Internal.h"
 
@@ -46,7 +49,6 @@
 
 @property (nonatomic, strong) ORKStroopContentView *stroopContentView;
 @property (nonatomic, strong) NSDictionary *colors;
-@property (nonatomic, strong) NSDictionary *differentColorLabels;
 @property (nonatomic) NSUInteger questionNumber;
 
 @end
@@ -66,6 +68,13 @@
     NSMutableArray *_results;
     NSTimeInterval _startTime;
     NSTimeInterval _endTime;
+    ORKResponseStatisticsAccumulator *_statisticsAccumulator;
+    
+    // Color names and colors in the order of the trial plan's color indexes.
+    NSArray<NSString *> *_planColorNames;
+    NSArray<UIColor *> *_planColors;
+    ORKTrialPlanGenerator *_trialPlanGenerator;
+    ORKTrialPlanResult *_trialPlan;
 }
 
 - (instancetype)initWithStep:(ORKStep *)step {
@@ -85,6 +94,7 @@
 - (void)viewDidLoad {
     [super viewDidLoad];
     _results = [NSMutableArray new];
+    _statisticsAccumulator = [ORKResponseStatisticsAccumulator new];
     _redString = ORKLocalizedString(@"STROOP_COLOR_RED", nil);
     _greenString = ORKLocalizedString(@"STROOP_COLOR_GREEN", nil);
     _blueString = ORKLocalizedString(@"STROOP_COLOR_BLUE", nil);
@@ -101,12 +111,16 @@
                     _greenString: _green,
                     };
     
-    self.differentColorLabels = @{
-                                  _redString: @[_blue, _green, _yellow],
-                                  _blueString: @[_red, _green, _yellow,],
-                                  _yellowString: @[_red, _blue, _green],
-                                  _greenString: @[_red, _blue, _yellow],
-                                  };
+    _planColorNames = @[_redString, _greenString, _blueString, _yellowString];
+    _planColors = @[_red, _green, _blue, _yellow];
+    
+    // Draw every trial now, off the main thread, so no stimulus is generated between trials.
+    NSString *identifier = self.step.identifier;
+    uint32_t seed = [self stroopStep].seed;
+    NSUInteger numberOfTrials = [self stroopStep].numberOfAttempts;
+    _trialPlanGenerator = [[ORKTrialPlanGenerator alloc] initWithBlock:^ORKTrialPlanResult *{
+        return [ORKTrialPlanGenerator stroopTrialPlanWithIdentifier:identifier seed:seed numberOfTrials:numberOfTrials];
+    }];
 
     self.questionNumber = 0;
     _stroopContentView = [ORKStroopContentView new];
@@ -172,12 +186,13 @@
 - (ORKStepResult *)result {
     ORKStepResult *stepResult = [super result];
     if (_results) {
-         stepResult.results = [_results copy];
+         stepResult.results = _trialPlan ? [_results arrayByAddingObject:_trialPlan] : [_results copy];
     }
     return stepResult;
 }
 
 - (void)start {
+    _trialPlan = _trialPlanGenerator.trialPlan;
     [super start];
     [self startQuestion];
 }
@@ -192,6 +207,11 @@
     stroopResult.color = color;
     stroopResult.text = text;
     stroopResult.colorSelected = colorSelected;
+    [_statisticsAccumulator addValue:stroopResult.endTime - stroopResult.startTime];
+    if (![colorSelected isEqualToString:color]) {
+        [_statisticsAccumulator addError];
+    }
+    stroopResult.statistics = [_statisticsAccumulator statistics];
     [_results addObject:stroopResult];
 }
 
@@ -205,23 +225,9 @@
 }
 
 - (void)startQuestion {
-    int pattern = arc4random() % 2;
-    if (pattern == 0) {
-        int index = arc4random() % [self.colors.allKeys count];
-        NSString *text = [self.colors.allKeys objectAtIndex:index];
-        self.stroopContentView.colorLabelText = text;
-        UIColor *color = [self.colors valueForKey:text];
-        self.stroopContentView.colorLabelColor = color;
-    }
-    else {
-        int index = arc4random() % [self.differentColorLabels.allKeys count];
-        NSString *text = [self.differentColorLabels.allKeys objectAtIndex:index];
-        self.stroopContentView.colorLabelText = text;
-        NSArray *colorArray = [self.differentColorLabels valueForKey:text];
-        int randomColor = arc4random() % colorArray.count;
-        UIColor *color = [colorArray objectAtIndex:randomColor];
-        self.stroopContentView.colorLabelColor = color;
-    }
+    NSArray<NSNumber *> *stimulus = _trialPlan.stimuli[self.questionNumber];
+    self.stroopContentView.colorLabelText = _planColorNames[stimulus[0].unsignedIntegerValue];
+    self.stroopContentView.colorLabelColor = _planColors[stimulus[1].unsignedIntegerValue];
     [self setButtonsEnabled];
     _startTime = [NSProcessInfo processInfo].systemUptime;
 }
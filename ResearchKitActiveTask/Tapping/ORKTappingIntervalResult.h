@@ -30,6 +30,7 @@
 
 #import <Foundation/Foundation.h>
 #import <ResearchKit/ORKResult.h>
+#import <ResearchKitActiveTask/ORKResponseStatistics.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -135,6 +136,11 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic) CGRect buttonRect2;
 
+/**
+ A summary of the intervals between successive taps on the buttons, and of the taps outside them, accumulated as the task proceeds.
+ */
+@property (nonatomic, copy, nullable) ORKResponseStatistics *statistics;
+
 @end
 
 NS_ASSUME_NONNULL_END
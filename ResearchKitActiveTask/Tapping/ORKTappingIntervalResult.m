@@ -97,6 +97,7 @@
     ORK_ENCODE_CGRECT(aCoder, buttonRect1);
     ORK_ENCODE_CGRECT(aCoder, buttonRect2);
     ORK_ENCODE_CGSIZE(aCoder, stepViewSize);
+    ORK_ENCODE_OBJ(aCoder, statistics);
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
@@ -106,6 +107,7 @@
         ORK_DECODE_CGRECT(aDecoder, buttonRect1);
         ORK_DECODE_CGRECT(aDecoder, buttonRect2);
         ORK_DECODE_CGSIZE(aDecoder, stepViewSize);
+        ORK_DECODE_OBJ_CLASS(aDecoder, statistics, ORKResponseStatistics);
     }
     return self;
 }
@@ -122,7 +124,8 @@
             ORKEqualObjects(self.samples, castObject.samples) &&
             CGRectEqualToRect(self.buttonRect1, castObject.buttonRect1) &&
             CGRectEqualToRect(self.buttonRect2, castObject.buttonRect2) &&
-            CGSizeEqualToSize(self.stepViewSize, castObject.stepViewSize));
+            CGSizeEqualToSize(self.stepViewSize, castObject.stepViewSize) &&
+            ORKEqualObjects(self.statistics, castObject.statistics));
 }
 
 - (NSUInteger)hash {
@@ -135,6 +138,7 @@
     result.buttonRect1 = self.buttonRect1;
     result.buttonRect2 = self.buttonRect2;
     result.stepViewSize = self.stepViewSize;
+    result.statistics = self.statistics;
     return result;
 }
 
@@ -41,6 +41,7 @@
 #import "ORKActiveStepView.h"
 #import "ORKCollectionResult_Private.h"
 #import "ORKTappingIntervalResult.h"
+#import "ORKResponseStatisticsAccumulator.h"
 #import "ORKStep.h"
 #import "ORKNavigationContainerView_Internal.h"
 
@@ -64,6 +65,7 @@
     CGSize _viewSize;
     
     NSUInteger _hitButtonCount;
+    ORKResponseStatisticsAccumulator *_statisticsAccumulator;
     
     UIGestureRecognizer *_touchDownRecognizer;
 }
@@ -131,6 +133,7 @@
     tappingResult.stepViewSize = _viewSize;
     
     tappingResult.samples = _samples;
+    tappingResult.statistics = [_statisticsAccumulator statistics];
     
     [results addObject:tappingResult];
     sResult.results = [results copy];
@@ -164,6 +167,9 @@
     
     if (buttonIdentifier == ORKTappingButtonIdentifierLeft || buttonIdentifier == ORKTappingButtonIdentifierRight) {
         _hitButtonCount++;
+        [_statisticsAccumulator addEventWithTimestamp:mediaTime];
+    } else {
+        [_statisticsAccumulator addError];
     }
     // Update label
     [_tappingContentView setTapCount:_hitButtonCount];
@@ -266,6 +272,7 @@
         // Start timer on first touch event on button
         _samples = [NSMutableArray array];
         _hitButtonCount = 0;
+        _statisticsAccumulator = [ORKResponseStatisticsAccumulator new];
         [self start];
     }
     
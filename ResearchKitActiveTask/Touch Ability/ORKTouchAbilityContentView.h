@@ -50,6 +50,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 @class ORKTouchAbilityTrial;
 @class ORKTouchAbilityTrack;
+@class ORKTouchAbilityTrackStore;
 @class ORKTouchAbilityGestureRecoginzerEvent;
 
 #pragma mark - ORKTouchAbilityCustomView
@@ -60,6 +61,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, readonly) ORKTouchAbilityTrial *trial;
 @property (nonatomic, readonly) NSArray<ORKTouchAbilityTrack *> *tracks;
+@property (nonatomic, readonly) ORKTouchAbilityTrackStore *trackStore;
 @property (nonatomic, readonly) NSArray<ORKTouchAbilityGestureRecoginzerEvent *> *gestureRecognizerEvents;
 
 @property (nonatomic, weak) id<ORKTouchAbilityContentViewDelegate> _Nullable delegate;
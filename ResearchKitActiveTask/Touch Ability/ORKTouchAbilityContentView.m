@@ -113,6 +113,10 @@
     return self.touchTracker.tracks;
 }
 
+- (ORKTouchAbilityTrackStore *)trackStore {
+    return self.touchTracker.trackStore;
+}
+
 - (NSArray<ORKTouchAbilityGestureRecoginzerEvent *> *)gestureRecognizerEvents {
     if (!_gestureRecognizerEvents) {
         _gestureRecognizerEvents = [NSArray new];
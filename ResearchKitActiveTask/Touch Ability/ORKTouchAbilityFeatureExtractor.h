@@ -0,0 +1,100 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <UIKit/UIKit.h>
+#import <ResearchKit/ORKDefines.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKTouchAbilityTrial;
+@class ORKTouchAbilityTrackStore;
+@class ORKTouchAbilityKinematicFeatures;
+
+/**
+ Kinematic measures of a single sampled trajectory.
+ */
+typedef struct {
+    double duration;
+    double pathLength;
+    double displacement;
+    double peakSpeed;
+    double peakAcceleration;
+    double peakJerk;
+    NSUInteger speedPeakCount;
+    double logDimensionlessJerk;
+    BOOL hasLogDimensionlessJerk;
+} ORKTouchAbilityKinematicProfile;
+
+/**
+ Computes the kinematic profile of a trajectory with vDSP.
+ 
+ Velocity, acceleration and jerk are obtained by successive finite differences, each evaluated at
+ the midpoints of the previous sample times. The log dimensionless jerk is only available when
+ there are at least four samples and the trajectory moved.
+ 
+ @param timestamps  Strictly increasing sample times, in seconds.
+ @param x           The first coordinate of each sample.
+ @param y           The second coordinate of each sample, or `NULL` for a one-dimensional trajectory.
+ @param count       The number of samples.
+ */
+ORK_EXTERN ORKTouchAbilityKinematicProfile ORKTouchAbilityKinematicProfileMake(const double *timestamps,
+                                                                               const double *x,
+                                                                               const double * _Nullable y,
+                                                                               NSUInteger count) ORK_AVAILABLE_DECL;
+
+/**
+ Returns the coefficient of determination of the least-squares line through the samples, or `NAN`
+ when `x` has no variance.
+ */
+ORK_EXTERN double ORKTouchAbilityLinearFitCoefficientOfDetermination(const double *x,
+                                                                     const double *y,
+                                                                     NSUInteger count) ORK_AVAILABLE_DECL;
+
+/**
+ Extracts kinematic features from finished touch ability trials.
+ 
+ Trajectories are read from the timestamp and location columns of the track store the trial was
+ recorded into, so no track or touch objects are walked, and every derived quantity is computed
+ over those columns with vDSP.
+ */
+@interface ORKTouchAbilityFeatureExtractor : NSObject
+
+/**
+ Returns the kinematic features of a trial.
+ 
+ @param trial       The trial, which provides the targets and gesture results.
+ @param trackStore  The store holding the tracks recorded during the trial.
+ */
++ (ORKTouchAbilityKinematicFeatures *)kinematicFeaturesForTrial:(ORKTouchAbilityTrial *)trial
+                                                      trackStore:(ORKTouchAbilityTrackStore *)trackStore;
+
+@end
+
+NS_ASSUME_NONNULL_END
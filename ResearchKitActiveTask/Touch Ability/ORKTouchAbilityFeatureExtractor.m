@@ -0,0 +1,509 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+@import Accelerate;
+
+#import "ORKTouchAbilityFeatureExtractor.h"
+
+#import "ORKTouchAbilityKinematicFeatures.h"
+#import "ORKTouchAbilityKinematicFeatures_Internal.h"
+#import "ORKTouchAbilityTrial.h"
+#import "ORKTouchAbilityTrackStore.h"
+#import "ORKTouchAbilityGestureRecoginzerEvent.h"
+#import "ORKTouchAbilityTapTrial.h"
+#import "ORKTouchAbilityLongPressTrial.h"
+#import "ORKTouchAbilitySwipeTrial.h"
+#import "ORKTouchAbilityPinchTrial.h"
+#import "ORKTouchAbilityRotationTrial.h"
+#import "ORKTouchAbilityScrollTrial.h"
+
+#import "ORKHelpers_Internal.h"
+
+
+// Speed peaks must rise and fall by this fraction of the peak speed to count as a submovement.
+static const double ORKTouchAbilitySpeedPeakProminence = 0.1;
+
+// Differentiates `values` with respect to `times`, writing `count - 1` derivatives to `derivatives`
+// and the midpoints of the sample times they belong to to `midpoints`.
+static void ORKDifferentiate(const double *times, const double *values, vDSP_Length count, double *derivatives, double *midpoints, double *scratch) {
+    vDSP_Length length = count - 1;
+    vDSP_vsubD(times, 1, times + 1, 1, scratch, 1, length);
+    vDSP_vsubD(values, 1, values + 1, 1, derivatives, 1, length);
+    vDSP_vdivD(scratch, 1, derivatives, 1, derivatives, 1, length);
+    if (midpoints) {
+        double half = 0.5;
+        vDSP_vaddD(times, 1, times + 1, 1, midpoints, 1, length);
+        vDSP_vsmulD(midpoints, 1, &half, midpoints, 1, length);
+    }
+}
+
+static NSUInteger ORKCountSpeedPeaks(const double *speed, NSUInteger count, double peakSpeed) {
+    double prominence = peakSpeed * ORKTouchAbilitySpeedPeakProminence;
+    if (prominence <= 0) {
+        return 0;
+    }
+    NSUInteger peaks = 0;
+    BOOL rising = YES;
+    double extremum = 0;
+    for (NSUInteger index = 0; index < count; index++) {
+        double value = speed[index];
+        if (rising) {
+            extremum = MAX(extremum, value);
+            if (extremum >= prominence && value < extremum - prominence) {
+                peaks += 1;
+                rising = NO;
+                extremum = value;
+            }
+        } else {
+            extremum = MIN(extremum, value);
+            if (value > extremum + prominence) {
+                rising = YES;
+                extremum = value;
+            }
+        }
+    }
+    if (rising && extremum >= prominence) {
+        peaks += 1;
+    }
+    return peaks;
+}
+
+ORKTouchAbilityKinematicProfile ORKTouchAbilityKinematicProfileMake(const double *timestamps, const double *x, const double *y, NSUInteger count) {
+    ORKTouchAbilityKinematicProfile profile = {0};
+    if (count < 2) {
+        return profile;
+    }
+    
+    profile.duration = timestamps[count - 1] - timestamps[0];
+    profile.displacement = hypot(x[count - 1] - x[0], y ? y[count - 1] - y[0] : 0);
+    
+    // One column per derivative component, its magnitude, the sample times of the velocity and the
+    // acceleration, the time steps and a column of zeros standing in for a missing `y`.
+    double *buffer = calloc(count * 11, sizeof(double));
+    if (!buffer) {
+        return profile;
+    }
+    double *vx = buffer;
+    double *vy = buffer + count;
+    double *ax = buffer + count * 2;
+    double *ay = buffer + count * 3;
+    double *jx = buffer + count * 4;
+    double *jy = buffer + count * 5;
+    double *magnitude = buffer + count * 6;
+    double *velocityTimes = buffer + count * 7;
+    double *accelerationTimes = buffer + count * 8;
+    double *scratch = buffer + count * 9;
+    const double *yValues = y ?: buffer + count * 10;
+    
+    vDSP_Length length = count - 1;
+    
+    // Path length from the segment lengths.
+    vDSP_vsubD(x, 1, x + 1, 1, vx, 1, length);
+    vDSP_vsubD(yValues, 1, yValues + 1, 1, vy, 1, length);
+    vDSP_vdistD(vx, 1, vy, 1, magnitude, 1, length);
+    vDSP_sveD(magnitude, 1, &profile.pathLength, length);
+    
+    // Velocity.
+    ORKDifferentiate(timestamps, x, count, vx, velocityTimes, scratch);
+    ORKDifferentiate(timestamps, yValues, count, vy, NULL, scratch);
+    vDSP_vdistD(vx, 1, vy, 1, magnitude, 1, length);
+    vDSP_maxvD(magnitude, 1, &profile.peakSpeed, length);
+    profile.speedPeakCount = ORKCountSpeedPeaks(magnitude, length, profile.peakSpeed);
+    
+    // Acceleration.
+    if (length >= 2) {
+        ORKDifferentiate(velocityTimes, vx, length, ax, accelerationTimes, scratch);
+        ORKDifferentiate(velocityTimes, vy, length, ay, NULL, scratch);
+        length -= 1;
+        vDSP_vdistD(ax, 1, ay, 1, magnitude, 1, length);
+        vDSP_maxvD(magnitude, 1, &profile.peakAcceleration, length);
+        
+        // Jerk.
+        if (length >= 2) {
+            ORKDifferentiate(accelerationTimes, ax, length, jx, NULL, scratch);
+            ORKDifferentiate(accelerationTimes, ay, length, jy, NULL, scratch);
+            length -= 1;
+            vDSP_vdistD(jx, 1, jy, 1, magnitude, 1, length);
+            vDSP_maxvD(magnitude, 1, &profile.peakJerk, length);
+            
+            // Log dimensionless jerk: -ln(T^3 / v_peak^2 * integral of |j|^2 dt), with the
+            // integral approximated by the mean square jerk over the duration.
+            double meanSquareJerk = 0;
+            vDSP_measqvD(magnitude, 1, &meanSquareJerk, length);
+            double duration = profile.duration;
+            if (profile.peakSpeed > 0 && duration > 0 && meanSquareJerk > 0) {
+                double dimensionlessJerk = pow(duration, 4) / pow(profile.peakSpeed, 2) * meanSquareJerk;
+                profile.logDimensionlessJerk = -log(dimensionlessJerk);
+                profile.hasLogDimensionlessJerk = YES;
+            }
+        }
+    }
+    
+    free(buffer);
+    return profile;
+}
+
+double ORKTouchAbilityLinearFitCoefficientOfDetermination(const double *x, const double *y, NSUInteger count) {
+    if (count < 2) {
+        return NAN;
+    }
+    double *centered = malloc(count * 2 * sizeof(double));
+    if (!centered) {
+        return NAN;
+    }
+    double *cx = centered;
+    double *cy = centered + count;
+    
+    double mean = 0;
+    vDSP_meanvD(x, 1, &mean, count);
+    mean = -mean;
+    vDSP_vsaddD(x, 1, &mean, cx, 1, count);
+    vDSP_meanvD(y, 1, &mean, count);
+    mean = -mean;
+    vDSP_vsaddD(y, 1, &mean, cy, 1, count);
+    
+    double sxx = 0, syy = 0, sxy = 0;
+    vDSP_dotprD(cx, 1, cx, 1, &sxx, count);
+    vDSP_dotprD(cy, 1, cy, 1, &syy, count);
+    vDSP_dotprD(cx, 1, cy, 1, &sxy, count);
+    free(centered);
+    
+    if (sxx <= 0) {
+        return NAN;
+    }
+    if (syy <= 0) {
+        // A constant response lies exactly on a horizontal line.
+        return 1;
+    }
+    return (sxy * sxy) / (sxx * syy);
+}
+
+
+// Timestamp and split location columns for one track, with samples that do not advance in time
+// dropped.
+typedef struct {
+    double *timestamps;
+    double *x;
+    double *y;
+    NSUInteger count;
+} ORKTouchAbilityTrackColumnsBuffer;
+
+static ORKTouchAbilityTrackColumnsBuffer ORKTouchAbilityTrackColumnsBufferMake(ORKTouchAbilityTrackStore *trackStore, NSUInteger trackIndex) {
+    ORKTouchAbilityTrackColumnsBuffer columns = {0};
+    NSUInteger capacity = [trackStore sampleCountOfTrackAtIndex:trackIndex];
+    if (capacity == 0) {
+        return columns;
+    }
+    columns.timestamps = malloc(capacity * 3 * sizeof(double));
+    if (!columns.timestamps) {
+        return columns;
+    }
+    columns.x = columns.timestamps + capacity;
+    columns.y = columns.timestamps + capacity * 2;
+    const NSTimeInterval *timestamps = [trackStore timestampsOfTrackAtIndex:trackIndex];
+    const CGPoint *locations = [trackStore locationsOfTrackAtIndex:trackIndex];
+    for (NSUInteger index = 0; index < capacity; index++) {
+        if (columns.count > 0 && timestamps[index] <= columns.timestamps[columns.count - 1]) {
+            continue;
+        }
+        columns.timestamps[columns.count] = timestamps[index];
+        columns.x[columns.count] = locations[index].x;
+        columns.y[columns.count] = locations[index].y;
+        columns.count += 1;
+    }
+    return columns;
+}
+
+static void ORKTouchAbilityTrackColumnsBufferFree(ORKTouchAbilityTrackColumnsBuffer *columns) {
+    free(columns->timestamps);
+    *columns = (ORKTouchAbilityTrackColumnsBuffer){0};
+}
+
+static double ORKDistanceOutsideRange(double value, double bound1, double bound2) {
+    double lower = MIN(bound1, bound2);
+    double upper = MAX(bound1, bound2);
+    if (value < lower) {
+        return lower - value;
+    }
+    if (value > upper) {
+        return value - upper;
+    }
+    return 0;
+}
+
+
+@implementation ORKTouchAbilityFeatureExtractor
+
++ (ORKTouchAbilityKinematicFeatures *)kinematicFeaturesForTrial:(ORKTouchAbilityTrial *)trial trackStore:(ORKTouchAbilityTrackStore *)trackStore {
+    ORKThrowInvalidArgumentExceptionIfNil(trial);
+    ORKThrowInvalidArgumentExceptionIfNil(trackStore);
+    
+    ORKTouchAbilityKinematicFeatures *features = [[ORKTouchAbilityKinematicFeatures alloc] init];
+    
+    double firstTimestamp = DBL_MAX;
+    double lastTimestamp = -DBL_MAX;
+    double totalPathLength = 0;
+    double totalMovementTime = 0;
+    double peakSpeed = 0;
+    double peakAcceleration = 0;
+    double peakJerk = 0;
+    double jerkSum = 0;
+    NSUInteger jerkCount = 0;
+    ORKTouchAbilityKinematicProfile longest = {0};
+    CGPoint firstTouchLocation = CGPointZero;
+    CGVector longestDisplacement = CGVectorMake(0, 0);
+    BOOL hasFirstTouch = NO;
+    
+    NSUInteger trackCount = trackStore.trackCount;
+    for (NSUInteger trackIndex = 0; trackIndex < trackCount; trackIndex++) {
+        ORKTouchAbilityTrackColumnsBuffer columns = ORKTouchAbilityTrackColumnsBufferMake(trackStore, trackIndex);
+        if (columns.count == 0) {
+            ORKTouchAbilityTrackColumnsBufferFree(&columns);
+            continue;
+        }
+        
+        if (!hasFirstTouch || columns.timestamps[0] < firstTimestamp) {
+            firstTouchLocation = CGPointMake(columns.x[0], columns.y[0]);
+            hasFirstTouch = YES;
+        }
+        firstTimestamp = MIN(firstTimestamp, columns.timestamps[0]);
+        lastTimestamp = MAX(lastTimestamp, columns.timestamps[columns.count - 1]);
+        
+        ORKTouchAbilityKinematicProfile profile = ORKTouchAbilityKinematicProfileMake(columns.timestamps, columns.x, columns.y, columns.count);
+        totalPathLength += profile.pathLength;
+        totalMovementTime += profile.duration;
+        peakSpeed = MAX(peakSpeed, profile.peakSpeed);
+        peakAcceleration = MAX(peakAcceleration, profile.peakAcceleration);
+        peakJerk = MAX(peakJerk, profile.peakJerk);
+        if (profile.hasLogDimensionlessJerk) {
+            jerkSum += profile.logDimensionlessJerk;
+            jerkCount += 1;
+        }
+        if (profile.pathLength >= longest.pathLength) {
+            longest = profile;
+            longestDisplacement = CGVectorMake(columns.x[columns.count - 1] - columns.x[0],
+                                               columns.y[columns.count - 1] - columns.y[0]);
+        }
+        
+        ORKTouchAbilityTrackColumnsBufferFree(&columns);
+    }
+    
+    features.duration = hasFirstTouch ? lastTimestamp - firstTimestamp : 0;
+    features.pathLength = totalPathLength;
+    features.pathEfficiency = longest.pathLength > 0 ? longest.displacement / longest.pathLength : 0;
+    features.meanSpeed = totalMovementTime > 0 ? totalPathLength / totalMovementTime : 0;
+    features.peakSpeed = peakSpeed;
+    features.peakAcceleration = peakAcceleration;
+    features.peakJerk = peakJerk;
+    features.speedPeakCount = longest.speedPeakCount;
+    features.logDimensionlessJerk = jerkCount > 0 ? jerkSum / jerkCount : 0;
+    
+    if ([trial isKindOfClass:[ORKTouchAbilityTapTrial class]]) {
+        if (hasFirstTouch) {
+            CGRect target = ((ORKTouchAbilityTapTrial *)trial).targetFrameInWindow;
+            features.targetError = @(hypot(firstTouchLocation.x - CGRectGetMidX(target), firstTouchLocation.y - CGRectGetMidY(target)));
+        }
+    } else if ([trial isKindOfClass:[ORKTouchAbilityLongPressTrial class]]) {
+        if (hasFirstTouch) {
+            CGRect target = ((ORKTouchAbilityLongPressTrial *)trial).targetFrameInWindow;
+            features.targetError = @(hypot(firstTouchLocation.x - CGRectGetMidX(target), firstTouchLocation.y - CGRectGetMidY(target)));
+        }
+    } else if ([trial isKindOfClass:[ORKTouchAbilitySwipeTrial class]]) {
+        [self addSwipeFeaturesForTrial:(ORKTouchAbilitySwipeTrial *)trial displacement:longestDisplacement toFeatures:features];
+    } else if ([trial isKindOfClass:[ORKTouchAbilityScrollTrial class]]) {
+        [self addScrollFeaturesForTrial:(ORKTouchAbilityScrollTrial *)trial toFeatures:features];
+    } else if ([trial isKindOfClass:[ORKTouchAbilityPinchTrial class]]) {
+        [self addPinchFeaturesForTrial:(ORKTouchAbilityPinchTrial *)trial toFeatures:features];
+    } else if ([trial isKindOfClass:[ORKTouchAbilityRotationTrial class]]) {
+        [self addRotationFeaturesForTrial:(ORKTouchAbilityRotationTrial *)trial toFeatures:features];
+    }
+    
+    return features;
+}
+
++ (void)addSwipeFeaturesForTrial:(ORKTouchAbilitySwipeTrial *)trial displacement:(CGVector)displacement toFeatures:(ORKTouchAbilityKinematicFeatures *)features {
+    CGVector target = CGVectorMake(0, 0);
+    UISwipeGestureRecognizerDirection direction = trial.targetDirection;
+    if (direction & UISwipeGestureRecognizerDirectionRight) {
+        target.dx += 1;
+    }
+    if (direction & UISwipeGestureRecognizerDirectionLeft) {
+        target.dx -= 1;
+    }
+    if (direction & UISwipeGestureRecognizerDirectionUp) {
+        target.dy -= 1;
+    }
+    if (direction & UISwipeGestureRecognizerDirectionDown) {
+        target.dy += 1;
+    }
+    double targetLength = hypot(target.dx, target.dy);
+    double length = hypot(displacement.dx, displacement.dy);
+    if (targetLength == 0 || length == 0) {
+        return;
+    }
+    double cosine = (target.dx * displacement.dx + target.dy * displacement.dy) / (targetLength * length);
+    features.targetError = @(acos(MAX(-1.0, MIN(1.0, cosine))));
+}
+
++ (void)addScrollFeaturesForTrial:(ORKTouchAbilityScrollTrial *)trial toFeatures:(ORKTouchAbilityKinematicFeatures *)features {
+    BOOL vertical = trial.direction == ORKTouchAbilityScrollTrialDirectionVertical;
+    double initial = vertical ? trial.initialOffset.y : trial.initialOffset.x;
+    double lowerBound = vertical ? trial.targetOffsetLowerBound.y : trial.targetOffsetLowerBound.x;
+    double upperBound = vertical ? trial.targetOffsetUpperBound.y : trial.targetOffsetUpperBound.x;
+    double endDragging = vertical ? trial.endDraggingOffset.y : trial.endDraggingOffset.x;
+    double endScrolling = vertical ? trial.endScrollingOffset.y : trial.endScrollingOffset.x;
+    
+    features.targetError = @(ORKDistanceOutsideRange(endScrolling, lowerBound, upperBound));
+    
+    double lower = MIN(lowerBound, upperBound);
+    double upper = MAX(lowerBound, upperBound);
+    double overshoot = 0;
+    if (initial < lower) {
+        overshoot = MAX(0, MAX(endDragging, endScrolling) - upper);
+    } else if (initial > upper) {
+        overshoot = MAX(0, lower - MIN(endDragging, endScrolling));
+    }
+    features.overshoot = @(overshoot);
+}
+
+// Copies the timestamp and value of every gesture recognizer event of the given class, dropping
+// events that do not advance in time. Returns the number of samples written.
++ (NSUInteger)copyEventsOfClass:(Class)eventClass
+                       forTrial:(ORKTouchAbilityTrial *)trial
+                          value:(double (^)(ORKTouchAbilityGestureRecoginzerEvent *event))value
+                     timestamps:(double *)timestamps
+                         values:(double *)values {
+    NSUInteger count = 0;
+    for (ORKTouchAbilityGestureRecoginzerEvent *event in trial.gestureRecognizerEvents) {
+        if (![event isKindOfClass:eventClass]) {
+            continue;
+        }
+        if (event.state != UIGestureRecognizerStateBegan &&
+            event.state != UIGestureRecognizerStateChanged &&
+            event.state != UIGestureRecognizerStateEnded) {
+            continue;
+        }
+        if (count > 0 && event.timestamp <= timestamps[count - 1]) {
+            continue;
+        }
+        timestamps[count] = event.timestamp;
+        values[count] = value(event);
+        count += 1;
+    }
+    return count;
+}
+
++ (void)addPinchFeaturesForTrial:(ORKTouchAbilityPinchTrial *)trial toFeatures:(ORKTouchAbilityKinematicFeatures *)features {
+    double targetScale = trial.targetScale;
+    if (targetScale > 0) {
+        features.targetError = @(fabs(trial.resultScale - targetScale) / targetScale);
+    }
+    
+    NSUInteger capacity = trial.gestureRecognizerEvents.count;
+    if (capacity == 0) {
+        return;
+    }
+    double *buffer = malloc(capacity * 2 * sizeof(double));
+    if (!buffer) {
+        return;
+    }
+    double *timestamps = buffer;
+    double *scales = buffer + capacity;
+    NSUInteger count = [self copyEventsOfClass:[ORKTouchAbilityPinchGestureRecoginzerEvent class]
+                                      forTrial:trial
+                                         value:^double(ORKTouchAbilityGestureRecoginzerEvent *event) {
+        return ((ORKTouchAbilityPinchGestureRecoginzerEvent *)event).scale;
+    }
+                                    timestamps:timestamps
+                                        values:scales];
+    
+    if (count > 0 && targetScale > 0) {
+        double extremeScale = 0;
+        if (targetScale >= 1) {
+            vDSP_maxvD(scales, 1, &extremeScale, count);
+            features.overshoot = @(MAX(0, extremeScale - targetScale) / targetScale);
+        } else {
+            vDSP_minvD(scales, 1, &extremeScale, count);
+            features.overshoot = @(MAX(0, targetScale - extremeScale) / targetScale);
+        }
+    }
+    
+    if (count >= 3) {
+        double linearity = ORKTouchAbilityLinearFitCoefficientOfDetermination(timestamps, scales, count);
+        if (!isnan(linearity)) {
+            features.scaleLinearity = @(linearity);
+        }
+    }
+    
+    free(buffer);
+}
+
++ (void)addRotationFeaturesForTrial:(ORKTouchAbilityRotationTrial *)trial toFeatures:(ORKTouchAbilityKinematicFeatures *)features {
+    double targetRotation = trial.targetRotation;
+    features.targetError = @(fabs(trial.resultRotation - targetRotation));
+    
+    NSUInteger capacity = trial.gestureRecognizerEvents.count;
+    if (capacity == 0) {
+        return;
+    }
+    double *buffer = malloc(capacity * 2 * sizeof(double));
+    if (!buffer) {
+        return;
+    }
+    double *timestamps = buffer;
+    double *rotations = buffer + capacity;
+    NSUInteger count = [self copyEventsOfClass:[ORKTouchAbilityRotationGestureRecoginzerEvent class]
+                                      forTrial:trial
+                                         value:^double(ORKTouchAbilityGestureRecoginzerEvent *event) {
+        return ((ORKTouchAbilityRotationGestureRecoginzerEvent *)event).rotation;
+    }
+                                    timestamps:timestamps
+                                        values:rotations];
+    
+    if (count > 0) {
+        double extremeRotation = 0;
+        if (targetRotation >= 0) {
+            vDSP_maxvD(rotations, 1, &extremeRotation, count);
+            features.overshoot = @(MAX(0, extremeRotation - targetRotation));
+        } else {
+            vDSP_minvD(rotations, 1, &extremeRotation, count);
+            features.overshoot = @(MAX(0, targetRotation - extremeRotation));
+        }
+    }
+    
+    ORKTouchAbilityKinematicProfile profile = ORKTouchAbilityKinematicProfileMake(timestamps, rotations, NULL, count);
+    if (profile.hasLogDimensionlessJerk) {
+        features.rotationSmoothness = @(profile.logDimensionlessJerk);
+    }
+    
+    free(buffer);
+}
+
+@end
@@ -0,0 +1,127 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <UIKit/UIKit.h>
+#import <ResearchKit/ORKDefines.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Kinematic features extracted on device from the tracks and gesture recognizer events of a
+ touch ability trial.
+ 
+ Speeds, accelerations and jerks are derived by finite differences of the touch locations in
+ window coordinates, so they are expressed in points per second, points per second squared and
+ points per second cubed. Samples that share a timestamp are ignored.
+ 
+ The trial-specific features are `nil` when they do not apply to the kind of trial they were
+ computed for, or when the trial did not record enough samples.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKTouchAbilityKinematicFeatures : NSObject <NSCopying, NSSecureCoding>
+
+/**
+ The time between the first and the last recorded touch sample, in seconds.
+ */
+@property (nonatomic, readonly) NSTimeInterval duration;
+
+/**
+ The total distance travelled by all tracks, in points.
+ */
+@property (nonatomic, readonly) CGFloat pathLength;
+
+/**
+ The ratio of the straight-line displacement to the path length of the longest track.
+ 
+ A value of 1 means the finger moved along a straight line. The value is `0` when the finger did
+ not move.
+ */
+@property (nonatomic, readonly) CGFloat pathEfficiency;
+
+@property (nonatomic, readonly) CGFloat meanSpeed;
+
+@property (nonatomic, readonly) CGFloat peakSpeed;
+
+@property (nonatomic, readonly) CGFloat peakAcceleration;
+
+@property (nonatomic, readonly) CGFloat peakJerk;
+
+/**
+ The number of local maxima in the speed profile of the longest track.
+ 
+ Movements made of several corrective submovements have more speed peaks than a single smooth
+ movement.
+ */
+@property (nonatomic, readonly) NSUInteger speedPeakCount;
+
+/**
+ The log dimensionless jerk of the speed profile, averaged over the tracks with at least four
+ samples.
+ 
+ Values closer to zero indicate smoother movement. The value is `0` when no track has enough samples.
+ */
+@property (nonatomic, readonly) double logDimensionlessJerk;
+
+/**
+ How far the result of the trial is from its target.
+ 
+ For tap and long press trials this is the distance in points between the first touch and the
+ centre of the target. For swipe trials it is the angle in radians between the movement and the
+ target direction. For pinch trials it is the relative scale error, for rotation trials the
+ rotation error in radians, and for scroll trials the distance in points from the final content
+ offset to the target range.
+ */
+@property (nonatomic, readonly, nullable) NSNumber *targetError;
+
+/**
+ How far the participant went past the target before settling.
+ 
+ For pinch trials this is relative to the target scale, for rotation trials it is in radians,
+ and for scroll trials it is in points. Other trials leave this `nil`.
+ */
+@property (nonatomic, readonly, nullable) NSNumber *overshoot;
+
+/**
+ The coefficient of determination of a linear fit of the pinch scale over time.
+ 
+ Values closer to 1 indicate a steady pinch. Only pinch trials set this value.
+ */
+@property (nonatomic, readonly, nullable) NSNumber *scaleLinearity;
+
+/**
+ The log dimensionless jerk of the angular speed of the rotation gesture.
+ 
+ Values closer to zero indicate a smoother rotation. Only rotation trials set this value.
+ */
+@property (nonatomic, readonly, nullable) NSNumber *rotationSmoothness;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,136 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKTouchAbilityKinematicFeatures.h"
+#import "ORKTouchAbilityKinematicFeatures_Internal.h"
+
+#import "ORKHelpers_Internal.h"
+
+@implementation ORKTouchAbilityKinematicFeatures
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    ORK_ENCODE_DOUBLE(aCoder, duration);
+    ORK_ENCODE_DOUBLE(aCoder, pathLength);
+    ORK_ENCODE_DOUBLE(aCoder, pathEfficiency);
+    ORK_ENCODE_DOUBLE(aCoder, meanSpeed);
+    ORK_ENCODE_DOUBLE(aCoder, peakSpeed);
+    ORK_ENCODE_DOUBLE(aCoder, peakAcceleration);
+    ORK_ENCODE_DOUBLE(aCoder, peakJerk);
+    ORK_ENCODE_INTEGER(aCoder, speedPeakCount);
+    ORK_ENCODE_DOUBLE(aCoder, logDimensionlessJerk);
+    ORK_ENCODE_OBJ(aCoder, targetError);
+    ORK_ENCODE_OBJ(aCoder, overshoot);
+    ORK_ENCODE_OBJ(aCoder, scaleLinearity);
+    ORK_ENCODE_OBJ(aCoder, rotationSmoothness);
+}
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+    self = [super init];
+    if (self) {
+        ORK_DECODE_DOUBLE(aDecoder, duration);
+        ORK_DECODE_DOUBLE(aDecoder, pathLength);
+        ORK_DECODE_DOUBLE(aDecoder, pathEfficiency);
+        ORK_DECODE_DOUBLE(aDecoder, meanSpeed);
+        ORK_DECODE_DOUBLE(aDecoder, peakSpeed);
+        ORK_DECODE_DOUBLE(aDecoder, peakAcceleration);
+        ORK_DECODE_DOUBLE(aDecoder, peakJerk);
+        ORK_DECODE_INTEGER(aDecoder, speedPeakCount);
+        ORK_DECODE_DOUBLE(aDecoder, logDimensionlessJerk);
+        ORK_DECODE_OBJ_CLASS(aDecoder, targetError, NSNumber);
+        ORK_DECODE_OBJ_CLASS(aDecoder, overshoot, NSNumber);
+        ORK_DECODE_OBJ_CLASS(aDecoder, scaleLinearity, NSNumber);
+        ORK_DECODE_OBJ_CLASS(aDecoder, rotationSmoothness, NSNumber);
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    ORKTouchAbilityKinematicFeatures *features = [[[self class] allocWithZone:zone] init];
+    features.duration = self.duration;
+    features.pathLength = self.pathLength;
+    features.pathEfficiency = self.pathEfficiency;
+    features.meanSpeed = self.meanSpeed;
+    features.peakSpeed = self.peakSpeed;
+    features.peakAcceleration = self.peakAcceleration;
+    features.peakJerk = self.peakJerk;
+    features.speedPeakCount = self.speedPeakCount;
+    features.logDimensionlessJerk = self.logDimensionlessJerk;
+    features.targetError = self.targetError;
+    features.overshoot = self.overshoot;
+    features.scaleLinearity = self.scaleLinearity;
+    features.rotationSmoothness = self.rotationSmoothness;
+    return features;
+}
+
+- (BOOL)isEqual:(id)object {
+    
+    if ([self class] != [object class]) {
+        return NO;
+    }
+    
+    __typeof(self) castObject = object;
+    
+    return (self.duration == castObject.duration &&
+            self.pathLength == castObject.pathLength &&
+            self.pathEfficiency == castObject.pathEfficiency &&
+            self.meanSpeed == castObject.meanSpeed &&
+            self.peakSpeed == castObject.peakSpeed &&
+            self.peakAcceleration == castObject.peakAcceleration &&
+            self.peakJerk == castObject.peakJerk &&
+            self.speedPeakCount == castObject.speedPeakCount &&
+            self.logDimensionlessJerk == castObject.logDimensionlessJerk &&
+            ORKEqualObjects(self.targetError, castObject.targetError) &&
+            ORKEqualObjects(self.overshoot, castObject.overshoot) &&
+            ORKEqualObjects(self.scaleLinearity, castObject.scaleLinearity) &&
+            ORKEqualObjects(self.rotationSmoothness, castObject.rotationSmoothness));
+}
+
+- (NSUInteger)hash {
+    return @(self.pathLength).hash ^ @(self.duration).hash ^ self.speedPeakCount ^ self.targetError.hash;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; duration: %.3f; path length: %.1f; peak speed: %.1f; speed peaks: %@; LDLJ: %.2f; target error: %@; overshoot: %@>",
+            self.class.description,
+            self,
+            self.duration,
+            self.pathLength,
+            self.peakSpeed,
+            @(self.speedPeakCount),
+            self.logDimensionlessJerk,
+            self.targetError,
+            self.overshoot];
+}
+
+@end
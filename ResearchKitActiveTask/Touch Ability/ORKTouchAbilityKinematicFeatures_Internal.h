@@ -0,0 +1,53 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <ResearchKitActiveTask/ORKTouchAbilityKinematicFeatures.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ORKTouchAbilityKinematicFeatures ()
+
+@property (nonatomic, assign) NSTimeInterval duration;
+@property (nonatomic, assign) CGFloat pathLength;
+@property (nonatomic, assign) CGFloat pathEfficiency;
+@property (nonatomic, assign) CGFloat meanSpeed;
+@property (nonatomic, assign) CGFloat peakSpeed;
+@property (nonatomic, assign) CGFloat peakAcceleration;
+@property (nonatomic, assign) CGFloat peakJerk;
+@property (nonatomic, assign) NSUInteger speedPeakCount;
+@property (nonatomic, assign) double logDimensionlessJerk;
+@property (nonatomic, copy, nullable) NSNumber *targetError;
+@property (nonatomic, copy, nullable) NSNumber *overshoot;
+@property (nonatomic, copy, nullable) NSNumber *scaleLinearity;
+@property (nonatomic, copy, nullable) NSNumber *rotationSmoothness;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -46,6 +46,8 @@
 #import "ORKTouchAbilityLongPressStep.h"
 #import "ORKNavigableOrderedTask.h"
 #import "ORKVerticalContainerView_Internal.h"
+#import "ORKTouchAbilityTrial_Internal.h"
+#import "ORKTouchAbilityFeatureExtractor.h"
 #import "ORKHelpers_Internal.h"
 
 
@@ -207,7 +209,9 @@
         
         [strongContentView endTrial];
         
-        [self.trials addObject:(ORKTouchAbilityLongPressTrial *)strongContentView.trial];
+        ORKTouchAbilityLongPressTrial *trial = (ORKTouchAbilityLongPressTrial *)strongContentView.trial;
+        trial.kinematicFeatures = [ORKTouchAbilityFeatureExtractor kinematicFeaturesForTrial:trial trackStore:strongContentView.trackStore];
+        [self.trials addObject:trial];
         
         // Determind if should continue or finish.
         
@@ -44,6 +44,8 @@
 
 #import "ORKCollectionResult_Private.h"
 #import "ORKVerticalContainerView_Internal.h"
+#import "ORKTouchAbilityTrial_Internal.h"
+#import "ORKTouchAbilityFeatureExtractor.h"
 #import "ORKHelpers_Internal.h"
 
 @interface ORKTouchAbilityPinchStepViewController () <ORKTouchAbilityPinchContentViewDataSource, ORKTouchAbilityContentViewDelegate>
@@ -162,7 +164,9 @@
         
         [strongContentView endTrial];
         
-        [self.trials addObject:(ORKTouchAbilityPinchTrial *)strongContentView.trial];
+        ORKTouchAbilityPinchTrial *trial = (ORKTouchAbilityPinchTrial *)strongContentView.trial;
+        trial.kinematicFeatures = [ORKTouchAbilityFeatureExtractor kinematicFeaturesForTrial:trial trackStore:strongContentView.trackStore];
+        [self.trials addObject:trial];
         
         // Determind if should continue or finish.
         
@@ -45,6 +45,8 @@
 #import "ORKTouchAbilitySwipeStep.h"
 #import "ORKNavigableOrderedTask.h"
 #import "ORKVerticalContainerView_Internal.h"
+#import "ORKTouchAbilityTrial_Internal.h"
+#import "ORKTouchAbilityFeatureExtractor.h"
 #import "ORKHelpers_Internal.h"
 
 
@@ -222,7 +224,9 @@ ORKTouchAbilityContentViewDelegate
         
         [strongSelf.contentView endTrial];
         
-        [strongSelf.trials addObject:(ORKTouchAbilityScrollTrial *)strongSelf.contentView.trial];
+        ORKTouchAbilityScrollTrial *trial = (ORKTouchAbilityScrollTrial *)strongSelf.contentView.trial;
+        trial.kinematicFeatures = [ORKTouchAbilityFeatureExtractor kinematicFeaturesForTrial:trial trackStore:strongSelf.contentView.trackStore];
+        [strongSelf.trials addObject:trial];
         
         
         // Determind if should continue or finish.
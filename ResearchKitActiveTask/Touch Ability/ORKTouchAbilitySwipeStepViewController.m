@@ -46,6 +46,8 @@
 #import "ORKTouchAbilitySwipeStep.h"
 #import "ORKNavigableOrderedTask.h"
 #import "ORKVerticalContainerView_Internal.h"
+#import "ORKTouchAbilityTrial_Internal.h"
+#import "ORKTouchAbilityFeatureExtractor.h"
 #import "ORKHelpers_Internal.h"
 
 
@@ -180,7 +182,9 @@
         
         [strongContentView endTrial];
         
-        [self.trials addObject:(ORKTouchAbilitySwipeTrial *)strongContentView.trial];
+        ORKTouchAbilitySwipeTrial *trial = (ORKTouchAbilitySwipeTrial *)strongContentView.trial;
+        trial.kinematicFeatures = [ORKTouchAbilityFeatureExtractor kinematicFeaturesForTrial:trial trackStore:strongContentView.trackStore];
+        [self.trials addObject:trial];
         
         
         // Determind if should continue or finish.
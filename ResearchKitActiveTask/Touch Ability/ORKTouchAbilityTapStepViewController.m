@@ -45,6 +45,8 @@
 #import "ORKTouchAbilityTapStep.h"
 #import "ORKNavigableOrderedTask.h"
 #import "ORKVerticalContainerView_Internal.h"
+#import "ORKTouchAbilityTrial_Internal.h"
+#import "ORKTouchAbilityFeatureExtractor.h"
 #import "ORKHelpers_Internal.h"
 
 
@@ -215,7 +217,9 @@
         
         [strongContentView endTrial];
         
-        [self.trials addObject:(ORKTouchAbilityTapTrial *)strongContentView.trial];
+        ORKTouchAbilityTapTrial *trial = (ORKTouchAbilityTapTrial *)strongContentView.trial;
+        trial.kinematicFeatures = [ORKTouchAbilityFeatureExtractor kinematicFeaturesForTrial:trial trackStore:strongContentView.trackStore];
+        [self.trials addObject:trial];
         
         // Determind if should continue or finish.
         
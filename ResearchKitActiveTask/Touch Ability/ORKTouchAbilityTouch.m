@@ -31,36 +31,9 @@
 #import "Availability.h"
 
 #import "ORKTouchAbilityTouch.h"
+#import "ORKTouchAbilityTouch_Internal.h"
 #import "ORKHelpers_Internal.h"
 
-@interface ORKTouchAbilityTouch ()
-
-@property(nonatomic, assign) NSTimeInterval timestamp;
-@property(nonatomic, assign) UITouchPhase phase;
-@property(nonatomic, assign) NSUInteger tapCount;
-@property(nonatomic, assign) UITouchType type;
-
-@property(nonatomic, assign) CGFloat majorRadius;
-@property(nonatomic, assign) CGFloat majorRadiusTolerance;
-
-@property(nonatomic, assign) CGPoint locationInWindow;
-@property(nonatomic, assign) CGPoint previousLocationInWindow;
-@property(nonatomic, assign) CGPoint preciseLocationInWindow;
-@property(nonatomic, assign) CGPoint precisePreviousLocationInWindow;
-
-@property(nonatomic, assign) CGFloat force;
-@property(nonatomic, assign) CGFloat maximumPossibleForce;
-
-@property(nonatomic, assign) CGFloat azimuthAngleInWindow;
-@property(nonatomic, assign) CGVector azimuthUnitVectorInWindow;
-@property(nonatomic, assign) CGFloat altitudeAngle;
-
-@property(nonatomic, copy) NSNumber * _Nullable estimationUpdateIndex;
-@property(nonatomic, assign) UITouchProperties estimatedProperties;
-@property(nonatomic, assign) UITouchProperties estimatedPropertiesExpectingUpdates;
-
-@end
-
 @implementation ORKTouchAbilityTouch
 
 + (BOOL)supportsSecureCoding {
@@ -48,9 +48,18 @@ NS_ASSUME_NONNULL_BEGIN
 #pragma mark - ORKTouchAbilityTouchTracker
 
 @class ORKTouchAbilityTrack;
+@class ORKTouchAbilityTrackStore;
 @interface ORKTouchAbilityTouchTracker : UIGestureRecognizer
 
-@property (nonatomic, strong) NSMutableArray<ORKTouchAbilityTrack *> *tracks;
+/**
+ The recorded tracks. Track and touch objects are created when this property is read.
+ */
+@property (nonatomic, readonly) NSArray<ORKTouchAbilityTrack *> *tracks;
+
+/**
+ The columnar store the tracks are recorded into.
+ */
+@property (nonatomic, readonly) ORKTouchAbilityTrackStore *trackStore;
 @property (nonatomic, assign, getter=isTracking) BOOL tracking;
 
 @property (nonatomic, weak) id<ORKTouchAbilityTouchTrackerDelegate> _Nullable delegate;
@@ -33,6 +33,7 @@
 #import "ORKTouchAbilityTouch.h"
 #import "ORKTouchAbilityTrack.h"
 #import "ORKTouchAbilityTrack_Internal.h"
+#import "ORKTouchAbilityTrackStore.h"
 
 
 @interface ORKTouchAbilityTouchTracker ()
@@ -48,11 +49,8 @@
 
 @dynamic delegate;
 
-- (NSMutableArray<ORKTouchAbilityTrack *> *)tracks {
-    if (!_tracks) {
-        _tracks = [NSMutableArray new];
-    }
-    return _tracks;
+- (NSArray<ORKTouchAbilityTrack *> *)tracks {
+    return _trackStore.tracks;
 }
 
 
@@ -60,6 +58,7 @@
 
 - (instancetype)init {
     if (self = [super init]) {
+        _trackStore = [ORKTouchAbilityTrackStore new];
         self.tracking = NO;
         self.cancelsTouchesInView = NO;
     }
@@ -68,6 +67,7 @@
 
 - (instancetype)initWithTarget:(id)target action:(SEL)action {
     if (self = [super initWithTarget:target action:action]) {
+        _trackStore = [ORKTouchAbilityTrackStore new];
         self.tracking = NO;
         self.cancelsTouchesInView = NO;
     }
@@ -79,7 +79,7 @@
             self.class.description,
             self,
             self.isTracking ? @"true" : @"false",
-            @(self.tracks.count)];
+            @(_trackStore.trackCount)];
 }
 
 
@@ -97,7 +97,7 @@
 
 - (void)resetTracks {
     self.begun = NO;
-    [self.tracks removeAllObjects];
+    [_trackStore removeAllTracks];
 }
 
 
@@ -117,11 +117,7 @@
     }
     
     for (UITouch *touch in touches) {
-        
-        ORKTouchAbilityTrack *track = [[ORKTouchAbilityTrack alloc] init];
-        track.touches = [NSArray arrayWithObject:[[ORKTouchAbilityTouch alloc] initWithUITouch:touch]];
-        
-        [self.tracks addObject:track];
+        [_trackStore beginTrackWithTouch:touch];
     }
 }
 
@@ -171,34 +167,8 @@
 #pragma mark - Private Methods
 
 - (void)addTouchesToTracks:(NSSet<UITouch *> *)touches withEvent:(UIEvent *)event {
-    
     for (UITouch *touch in touches) {
-        
-        NSArray<UITouch *> *coalescedTouches = [event coalescedTouchesForTouch:touch] ?: [NSArray arrayWithObject:touch];
-        NSMutableArray<ORKTouchAbilityTouch *> *translatedTouches = [NSMutableArray new];
-        
-        for (UITouch *coalescedTouch in coalescedTouches) {
-            [translatedTouches addObject:[[ORKTouchAbilityTouch alloc] initWithUITouch:coalescedTouch]];
-        }
-        
-        
-        for (ORKTouchAbilityTrack *track in self.tracks) {
-            
-            if (track.touches.count == 0) {
-                continue;
-            }
-            
-            ORKTouchAbilityTouch *lastTouch = track.touches.lastObject;
-            ORKTouchAbilityTouch *firstTranslatedTouch = translatedTouches.firstObject;
-            
-            if (lastTouch.phase != UITouchPhaseEnded &&
-                CGPointEqualToPoint(lastTouch.locationInWindow, firstTranslatedTouch.previousLocationInWindow)) {
-                
-                NSMutableArray *trackTouches = [NSMutableArray arrayWithArray:track.touches];
-                [trackTouches addObjectsFromArray:translatedTouches];
-                track.touches = trackTouches;
-            }
-        }
+        [_trackStore appendTouch:touch coalescedTouches:[event coalescedTouchesForTouch:touch]];
     }
 }
 
@@ -0,0 +1,103 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKTouchAbilityTrack;
+
+/**
+ Stores touch tracks column by column.
+ 
+ Each track keeps one growable C array per touch attribute, so appending a sample is amortised
+ O(1) and allocates no objects. Live `UITouch` objects are mapped to their track through a
+ non-retaining hash table and removed when they end or are cancelled. `ORKTouchAbilityTrack` and
+ `ORKTouchAbilityTouch` objects are only created when `tracks` is read, and samples that were
+ already materialised are reused on later reads.
+ 
+ The column accessors return pointers owned by the store. They are valid until the next sample is
+ appended to the track or the store is reset. Encoding a store writes the recorded columns but not
+ the live touches, so a decoded store cannot be appended to.
+ */
+@interface ORKTouchAbilityTrackStore : NSObject <NSSecureCoding>
+
+/**
+ Starts a new track whose first sample is `touch`.
+ */
+- (void)beginTrackWithTouch:(UITouch *)touch;
+
+/**
+ Appends the coalesced samples for `touch` to its track. Does nothing if the touch has no live track.
+ 
+ @param touch               The touch delivered to the gesture recognizer.
+ @param coalescedTouches    The coalesced touches for `touch`, or `nil` to record only `touch`.
+ */
+- (void)appendTouch:(UITouch *)touch coalescedTouches:(nullable NSArray<UITouch *> *)coalescedTouches;
+
+- (void)removeAllTracks;
+
+@property (nonatomic, readonly) NSUInteger trackCount;
+
+/**
+ Returns the number of samples recorded for the track at `index`. Every track has at least one sample.
+ */
+- (NSUInteger)sampleCountOfTrackAtIndex:(NSUInteger)index;
+
+/**
+ Returns the UNIX timestamps of the samples of the track at `index`.
+ */
+- (const NSTimeInterval *)timestampsOfTrackAtIndex:(NSUInteger)index NS_RETURNS_INNER_POINTER;
+
+/**
+ Returns the locations in window coordinates of the samples of the track at `index`.
+ */
+- (const CGPoint *)locationsOfTrackAtIndex:(NSUInteger)index NS_RETURNS_INNER_POINTER;
+
+/**
+ Returns the force of the samples of the track at `index`.
+ */
+- (const CGFloat *)forcesOfTrackAtIndex:(NSUInteger)index NS_RETURNS_INNER_POINTER;
+
+/**
+ Returns the major radius of the samples of the track at `index`.
+ */
+- (const CGFloat *)majorRadiiOfTrackAtIndex:(NSUInteger)index NS_RETURNS_INNER_POINTER;
+
+/**
+ Returns the `UITouchPhase` of the samples of the track at `index`, one byte per sample.
+ */
+- (const uint8_t *)phasesOfTrackAtIndex:(NSUInteger)index NS_RETURNS_INNER_POINTER;
+
+@property (nonatomic, readonly) NSArray<ORKTouchAbilityTrack *> *tracks;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,370 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKTouchAbilityTrackStore.h"
+#import "ORKTouchAbilityTouch.h"
+#import "ORKTouchAbilityTouch_Internal.h"
+#import "ORKTouchAbilityTrack.h"
+#import "ORKTouchAbilityTrack_Internal.h"
+
+#define ORKTouchAbilityColumnInitialCapacity 32
+
+// One growable array per touch attribute.
+typedef struct {
+    NSUInteger count;
+    NSUInteger capacity;
+    NSTimeInterval *timestamp;
+    CGPoint *location;
+    CGPoint *previousLocation;
+    CGPoint *preciseLocation;
+    CGPoint *precisePreviousLocation;
+    CGFloat *force;
+    CGFloat *maximumPossibleForce;
+    CGFloat *majorRadius;
+    CGFloat *majorRadiusTolerance;
+    CGFloat *azimuthAngle;
+    CGVector *azimuthUnitVector;
+    CGFloat *altitudeAngle;
+    NSUInteger *tapCount;
+    int64_t *estimationUpdateIndex;
+    uint32_t *estimatedProperties;
+    uint32_t *estimatedPropertiesExpectingUpdates;
+    uint8_t *phase;
+    uint8_t *type;
+} ORKTouchAbilityColumns;
+
+static const int64_t ORKTouchAbilityNoEstimationUpdateIndex = -1;
+
+#define ORK_COLUMNS_FOR_EACH(X) \
+    X(timestamp) X(location) X(previousLocation) X(preciseLocation) X(precisePreviousLocation) \
+    X(force) X(maximumPossibleForce) X(majorRadius) X(majorRadiusTolerance) X(azimuthAngle) \
+    X(azimuthUnitVector) X(altitudeAngle) X(tapCount) X(estimationUpdateIndex) X(estimatedProperties) \
+    X(estimatedPropertiesExpectingUpdates) X(phase) X(type)
+
+static void ORKTouchAbilityColumnsFree(ORKTouchAbilityColumns *columns) {
+#define ORK_FREE_COLUMN(name) free(columns->name); columns->name = NULL;
+    ORK_COLUMNS_FOR_EACH(ORK_FREE_COLUMN)
+#undef ORK_FREE_COLUMN
+    columns->count = 0;
+    columns->capacity = 0;
+}
+
+// Returns NO, leaving the columns empty, if the capacity can't be allocated.
+static BOOL ORKTouchAbilityColumnsReserve(ORKTouchAbilityColumns *columns, NSUInteger minimumCapacity) {
+    if (columns->capacity >= minimumCapacity) {
+        return YES;
+    }
+    NSUInteger doubledCapacity = 0;
+    if (__builtin_mul_overflow(columns->capacity, 2, &doubledCapacity)) {
+        doubledCapacity = minimumCapacity;
+    }
+    NSUInteger capacity = MAX(doubledCapacity, MAX(minimumCapacity, ORKTouchAbilityColumnInitialCapacity));
+#define ORK_GROW_COLUMN(name) { \
+        size_t size = 0; \
+        if (__builtin_mul_overflow(capacity, sizeof(*columns->name), &size) || \
+            (columns->name = reallocf(columns->name, size)) == NULL) { \
+            ORKTouchAbilityColumnsFree(columns); \
+            return NO; \
+        } \
+    }
+    ORK_COLUMNS_FOR_EACH(ORK_GROW_COLUMN)
+#undef ORK_GROW_COLUMN
+    columns->capacity = capacity;
+    return YES;
+}
+
+static void ORKTouchAbilityColumnsAppend(ORKTouchAbilityColumns *columns, UITouch *touch, NSTimeInterval timestampOffset) {
+    if (!ORKTouchAbilityColumnsReserve(columns, columns->count + 1)) {
+        return;
+    }
+    NSUInteger index = columns->count;
+    columns->timestamp[index] = touch.timestamp + timestampOffset;
+    columns->location[index] = [touch locationInView:nil];
+    columns->previousLocation[index] = [touch previousLocationInView:nil];
+    columns->preciseLocation[index] = [touch preciseLocationInView:nil];
+    columns->precisePreviousLocation[index] = [touch precisePreviousLocationInView:nil];
+    columns->force[index] = touch.force;
+    columns->maximumPossibleForce[index] = touch.maximumPossibleForce;
+    columns->majorRadius[index] = touch.majorRadius;
+    columns->majorRadiusTolerance[index] = touch.majorRadiusTolerance;
+    columns->azimuthAngle[index] = [touch azimuthAngleInView:nil];
+    columns->azimuthUnitVector[index] = [touch azimuthUnitVectorInView:nil];
+    columns->altitudeAngle[index] = touch.altitudeAngle;
+    columns->tapCount[index] = touch.tapCount;
+    columns->estimationUpdateIndex[index] = touch.estimationUpdateIndex ? touch.estimationUpdateIndex.longLongValue : ORKTouchAbilityNoEstimationUpdateIndex;
+    columns->estimatedProperties[index] = (uint32_t)touch.estimatedProperties;
+    columns->estimatedPropertiesExpectingUpdates[index] = (uint32_t)touch.estimatedPropertiesExpectingUpdates;
+    columns->phase[index] = (uint8_t)touch.phase;
+    columns->type[index] = (uint8_t)touch.type;
+    columns->count += 1;
+}
+
+static ORKTouchAbilityTouch *ORKTouchAbilityColumnsMaterialize(const ORKTouchAbilityColumns *columns, NSUInteger index) {
+    ORKTouchAbilityTouch *touch = [[ORKTouchAbilityTouch alloc] init];
+    touch.timestamp = columns->timestamp[index];
+    touch.phase = columns->phase[index];
+    touch.tapCount = columns->tapCount[index];
+    touch.type = columns->type[index];
+    touch.majorRadius = columns->majorRadius[index];
+    touch.majorRadiusTolerance = columns->majorRadiusTolerance[index];
+    touch.locationInWindow = columns->location[index];
+    touch.previousLocationInWindow = columns->previousLocation[index];
+    touch.preciseLocationInWindow = columns->preciseLocation[index];
+    touch.precisePreviousLocationInWindow = columns->precisePreviousLocation[index];
+    touch.force = columns->force[index];
+    touch.maximumPossibleForce = columns->maximumPossibleForce[index];
+    touch.azimuthAngleInWindow = columns->azimuthAngle[index];
+    touch.azimuthUnitVectorInWindow = columns->azimuthUnitVector[index];
+    touch.altitudeAngle = columns->altitudeAngle[index];
+    touch.estimationUpdateIndex = columns->estimationUpdateIndex[index] == ORKTouchAbilityNoEstimationUpdateIndex ? nil : @(columns->estimationUpdateIndex[index]);
+    touch.estimatedProperties = columns->estimatedProperties[index];
+    touch.estimatedPropertiesExpectingUpdates = columns->estimatedPropertiesExpectingUpdates[index];
+    return touch;
+}
+
+
+@interface ORKTouchAbilityTrackColumns : NSObject {
+@public
+    ORKTouchAbilityColumns _columns;
+}
+
+// Touches materialised so far, in sample order.
+@property (nonatomic, strong) NSMutableArray<ORKTouchAbilityTouch *> *materializedTouches;
+@property (nonatomic, strong, nullable) ORKTouchAbilityTrack *materializedTrack;
+
+@end
+
+@implementation ORKTouchAbilityTrackColumns
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _materializedTouches = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    ORKTouchAbilityColumnsFree(&_columns);
+}
+
+- (ORKTouchAbilityTrack *)track {
+    if (_materializedTrack && _materializedTouches.count == _columns.count) {
+        return _materializedTrack;
+    }
+    for (NSUInteger index = _materializedTouches.count; index < _columns.count; index++) {
+        [_materializedTouches addObject:ORKTouchAbilityColumnsMaterialize(&_columns, index)];
+    }
+    ORKTouchAbilityTrack *track = [[ORKTouchAbilityTrack alloc] init];
+    track.touches = _materializedTouches;
+    _materializedTrack = track;
+    return track;
+}
+
+@end
+
+
+@implementation ORKTouchAbilityTrackStore {
+    NSMutableArray<ORKTouchAbilityTrackColumns *> *_trackColumns;
+    // UITouch pointer -> track index + 1. Keys are not retained; entries are removed when touches end.
+    CFMutableDictionaryRef _liveTracks;
+    NSTimeInterval _timestampOffset;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _trackColumns = [NSMutableArray new];
+        _liveTracks = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL);
+        [self updateTimestampOffset];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    CFRelease(_liveTracks);
+}
+
+- (void)updateTimestampOffset {
+    // `UITouch.timestamp` is relative to system uptime; results use UNIX time.
+    _timestampOffset = [NSDate dateWithTimeIntervalSinceNow:-[[NSProcessInfo processInfo] systemUptime]].timeIntervalSince1970;
+}
+
+- (NSUInteger)trackCount {
+    return _trackColumns.count;
+}
+
+- (void)removeAllTracks {
+    [_trackColumns removeAllObjects];
+    CFDictionaryRemoveAllValues(_liveTracks);
+    [self updateTimestampOffset];
+}
+
+- (void)beginTrackWithTouch:(UITouch *)touch {
+    ORKTouchAbilityTrackColumns *columns = [ORKTouchAbilityTrackColumns new];
+    ORKTouchAbilityColumnsAppend(&columns->_columns, touch, _timestampOffset);
+    [_trackColumns addObject:columns];
+    CFDictionarySetValue(_liveTracks, (__bridge const void *)touch, (const void *)(uintptr_t)_trackColumns.count);
+}
+
+- (void)appendTouch:(UITouch *)touch coalescedTouches:(NSArray<UITouch *> *)coalescedTouches {
+    const void *key = (__bridge const void *)touch;
+    uintptr_t value = (uintptr_t)CFDictionaryGetValue(_liveTracks, key);
+    if (value == 0) {
+        return;
+    }
+    
+    ORKTouchAbilityTrackColumns *columns = _trackColumns[value - 1];
+    if (coalescedTouches.count > 0) {
+        ORKTouchAbilityColumnsReserve(&columns->_columns, columns->_columns.count + coalescedTouches.count);
+        for (UITouch *coalescedTouch in coalescedTouches) {
+            ORKTouchAbilityColumnsAppend(&columns->_columns, coalescedTouch, _timestampOffset);
+        }
+    } else {
+        ORKTouchAbilityColumnsAppend(&columns->_columns, touch, _timestampOffset);
+    }
+    
+    if (touch.phase == UITouchPhaseEnded || touch.phase == UITouchPhaseCancelled) {
+        CFDictionaryRemoveValue(_liveTracks, key);
+    }
+}
+
+- (NSUInteger)sampleCountOfTrackAtIndex:(NSUInteger)index {
+    return _trackColumns[index]->_columns.count;
+}
+
+- (const NSTimeInterval *)timestampsOfTrackAtIndex:(NSUInteger)index {
+    return _trackColumns[index]->_columns.timestamp;
+}
+
+- (const CGPoint *)locationsOfTrackAtIndex:(NSUInteger)index {
+    return _trackColumns[index]->_columns.location;
+}
+
+- (const CGFloat *)forcesOfTrackAtIndex:(NSUInteger)index {
+    return _trackColumns[index]->_columns.force;
+}
+
+- (const CGFloat *)majorRadiiOfTrackAtIndex:(NSUInteger)index {
+    return _trackColumns[index]->_columns.majorRadius;
+}
+
+- (const uint8_t *)phasesOfTrackAtIndex:(NSUInteger)index {
+    return _trackColumns[index]->_columns.phase;
+}
+
+- (NSArray<ORKTouchAbilityTrack *> *)tracks {
+    NSMutableArray<ORKTouchAbilityTrack *> *tracks = [NSMutableArray arrayWithCapacity:_trackColumns.count];
+    for (ORKTouchAbilityTrackColumns *columns in _trackColumns) {
+        [tracks addObject:[columns track]];
+    }
+    return [tracks copy];
+}
+
+
+#pragma mark - NSSecureCoding
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+// Each column is encoded as the samples of all tracks laid end to end, split by `trackSampleCounts`.
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    NSMutableArray<NSNumber *> *sampleCounts = [NSMutableArray arrayWithCapacity:_trackColumns.count];
+    for (ORKTouchAbilityTrackColumns *columns in _trackColumns) {
+        [sampleCounts addObject:@(columns->_columns.count)];
+    }
+    [aCoder encodeObject:sampleCounts forKey:@"trackSampleCounts"];
+    
+#define ORK_ENCODE_COLUMN(name) { \
+        NSMutableData *data = [NSMutableData data]; \
+        for (ORKTouchAbilityTrackColumns *columns in _trackColumns) { \
+            [data appendBytes:columns->_columns.name length:columns->_columns.count * sizeof(*columns->_columns.name)]; \
+        } \
+        [aCoder encodeObject:data forKey:@#name]; \
+    }
+    ORK_COLUMNS_FOR_EACH(ORK_ENCODE_COLUMN)
+#undef ORK_ENCODE_COLUMN
+}
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+    self = [self init];
+    if (self) {
+        NSArray<NSNumber *> *sampleCounts = [aDecoder decodeObjectOfClasses:[NSSet setWithObjects:[NSArray class], [NSNumber class], nil] forKey:@"trackSampleCounts"];
+        if (![sampleCounts isKindOfClass:[NSArray class]]) {
+            return nil;
+        }
+        // Validate every count and column length before allocating anything, so that a malformed archive
+        // can't size a buffer smaller than the bytes copied into it.
+        NSUInteger totalCount = 0;
+        for (NSNumber *sampleCount in sampleCounts) {
+            if (![sampleCount isKindOfClass:[NSNumber class]] || sampleCount.unsignedIntegerValue == 0 ||
+                __builtin_add_overflow(totalCount, sampleCount.unsignedIntegerValue, &totalCount)) {
+                return nil;
+            }
+        }
+        
+#define ORK_DECODE_COLUMN(name) \
+        NSData *name##Data = [aDecoder decodeObjectOfClass:[NSData class] forKey:@#name]; \
+        { \
+            size_t length = 0; \
+            if (__builtin_mul_overflow(totalCount, sizeof(*((ORKTouchAbilityColumns *)NULL)->name), &length) || \
+                ![name##Data isKindOfClass:[NSData class]] || name##Data.length != length) { \
+                return nil; \
+            } \
+        }
+        ORK_COLUMNS_FOR_EACH(ORK_DECODE_COLUMN)
+#undef ORK_DECODE_COLUMN
+        
+        for (NSNumber *sampleCount in sampleCounts) {
+            ORKTouchAbilityTrackColumns *columns = [ORKTouchAbilityTrackColumns new];
+            if (!ORKTouchAbilityColumnsReserve(&columns->_columns, sampleCount.unsignedIntegerValue)) {
+                return nil;
+            }
+            columns->_columns.count = sampleCount.unsignedIntegerValue;
+            [_trackColumns addObject:columns];
+        }
+        
+        // Each track's length is at most the validated total length, so these products can't overflow.
+#define ORK_COPY_COLUMN(name) { \
+            const uint8_t *bytes = name##Data.bytes; \
+            for (ORKTouchAbilityTrackColumns *columns in _trackColumns) { \
+                size_t length = columns->_columns.count * sizeof(*columns->_columns.name); \
+                memcpy(columns->_columns.name, bytes, length); \
+                bytes += length; \
+            } \
+        }
+        ORK_COLUMNS_FOR_EACH(ORK_COPY_COLUMN)
+#undef ORK_COPY_COLUMN
+    }
+    return self;
+}
+
+@end
@@ -36,6 +36,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 @class ORKTouchAbilityTrack;
 @class ORKTouchAbilityGestureRecoginzerEvent;
+@class ORKTouchAbilityKinematicFeatures;
 
 ORK_CLASS_AVAILABLE
 @interface ORKTouchAbilityTrial : NSObject <NSCopying, NSSecureCoding>
@@ -46,6 +47,12 @@ ORK_CLASS_AVAILABLE
 @property (nonatomic, readonly) NSArray<ORKTouchAbilityTrack *> *tracks;
 @property (nonatomic, readonly) NSArray<ORKTouchAbilityGestureRecoginzerEvent *> *gestureRecognizerEvents;
 
+/**
+ Kinematic features computed on device from the tracks and gesture recognizer events when the
+ trial finished.
+ */
+@property (nonatomic, readonly, nullable) ORKTouchAbilityKinematicFeatures *kinematicFeatures;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -33,6 +33,7 @@
 #import "ORKTouchAbilityTrial_Internal.h"
 #import "ORKTouchAbilityTrack.h"
 #import "ORKTouchAbilityGestureRecoginzerEvent.h"
+#import "ORKTouchAbilityKinematicFeatures.h"
 #import "ORKTouchAbilityTapTrial.h"
 
 #import "ORKHelpers_Internal.h"
@@ -48,6 +49,7 @@
     ORK_ENCODE_OBJ(aCoder, endDate);
     ORK_ENCODE_OBJ(aCoder, tracks);
     ORK_ENCODE_OBJ(aCoder, gestureRecognizerEvents);
+    ORK_ENCODE_OBJ(aCoder, kinematicFeatures);
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
@@ -57,6 +59,7 @@
         ORK_DECODE_OBJ_CLASS(aDecoder, endDate, NSDate);
         ORK_DECODE_OBJ_ARRAY(aDecoder, tracks, ORKTouchAbilityTapTrial);
         ORK_DECODE_OBJ_ARRAY(aDecoder, gestureRecognizerEvents, ORKTouchAbilityGestureRecoginzerEvent);
+        ORK_DECODE_OBJ_CLASS(aDecoder, kinematicFeatures, ORKTouchAbilityKinematicFeatures);
     }
     return self;
 }
@@ -67,6 +70,7 @@
     trial.endDate = [self.endDate copy];
     trial.tracks = [self.tracks copy];
     trial.gestureRecognizerEvents = [self.gestureRecognizerEvents copy];
+    trial.kinematicFeatures = [self.kinematicFeatures copy];
     return trial;
 }
 
@@ -81,7 +85,8 @@
     return (ORKEqualObjects(self.startDate, castObject.startDate) &&
             ORKEqualObjects(self.endDate, castObject.endDate) &&
             ORKEqualObjects(self.tracks, castObject.tracks) &&
-            ORKEqualObjects(self.gestureRecognizerEvents, castObject.gestureRecognizerEvents));
+            ORKEqualObjects(self.gestureRecognizerEvents, castObject.gestureRecognizerEvents) &&
+            ORKEqualObjects(self.kinematicFeatures, castObject.kinematicFeatures));
 }
 
 - (NSDate *)startDate {
@@ -34,10 +34,13 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class ORKTouchAbilityKinematicFeatures;
+
 @interface ORKTouchAbilityTrial ()
 
 @property (nonatomic, copy) NSArray<ORKTouchAbilityTrack *> *tracks;
 @property (nonatomic, copy) NSArray<ORKTouchAbilityGestureRecoginzerEvent *> *gestureRecognizerEvents;
+@property (nonatomic, copy, nullable) ORKTouchAbilityKinematicFeatures *kinematicFeatures;
 
 @end
 
@@ -0,0 +1,201 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Foundation/Foundation.h>
+#import <ResearchKitActiveTask/ORKAudiometryProtocol.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKAudiometryStimulus;
+
+/**
+ A simulated listener that answers audiometry stimuli according to a logistic psychometric function.
+ 
+ On each trial the listener first has a chance of responding during the silent pre-stimulus
+ interval (`falsePositiveRate`). Otherwise the tone is played and heard with probability
+ `(1 - lapseRate) * Ψ(level - threshold)`, where Ψ is a logistic function that passes through
+ 0.5 at the true threshold.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKAudiometrySimulatedListener : NSObject
+
+/**
+ Returns a listener with the given true thresholds, in dBHL, keyed by frequency in hertz.
+ */
+- (instancetype)initWithThresholds:(NSDictionary<NSNumber *, NSNumber *> *)thresholds NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+/**
+ The true hearing thresholds in dBHL, keyed by frequency in hertz.
+ */
+@property (nonatomic, copy, readonly) NSDictionary<NSNumber *, NSNumber *> *thresholds;
+
+/**
+ The slope of the psychometric function in 1/dB. Larger values give a sharper transition. The default is 1.0.
+ */
+@property (nonatomic, assign) double psychometricSlope;
+
+/**
+ The probability of responding before a tone is played. The default is 0.
+ */
+@property (nonatomic, assign) double falsePositiveRate;
+
+/**
+ The probability of missing a tone regardless of its level. The default is 0.
+ */
+@property (nonatomic, assign) double lapseRate;
+
+/**
+ Returns the probability that the listener reports hearing the stimulus once it has been played.
+ */
+- (double)probabilityOfDetectingStimulus:(ORKAudiometryStimulus *)stimulus;
+
+@end
+
+
+/**
+ The accuracy of the simulated threshold estimates for one frequency.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKAudiometrySimulationFrequencyStatistics : NSObject
+
+@property (nonatomic, readonly) double frequency;
+
+@property (nonatomic, readonly) double trueThreshold;
+
+/**
+ The number of sessions that produced a valid threshold for this frequency.
+ */
+@property (nonatomic, readonly) NSUInteger estimateCount;
+
+/**
+ The mean of the estimated minus the true threshold, in dB.
+ */
+@property (nonatomic, readonly) double bias;
+
+/**
+ The sample variance of the estimated threshold, in dB².
+ */
+@property (nonatomic, readonly) double variance;
+
+@property (nonatomic, readonly) double rootMeanSquareError;
+
+/**
+ The mean number of stimuli presented at this frequency.
+ */
+@property (nonatomic, readonly) double meanTrialCount;
+
+@end
+
+
+/**
+ The aggregated outcome of a simulation run.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKAudiometrySimulationReport : NSObject
+
+@property (nonatomic, readonly) NSUInteger sessionCount;
+
+/**
+ The number of sessions that ended before reaching `maximumTrialsPerSession`.
+ */
+@property (nonatomic, readonly) NSUInteger completedSessionCount;
+
+@property (nonatomic, readonly) double meanTrialCount;
+
+@property (nonatomic, readonly) double trialCountVariance;
+
+@property (nonatomic, readonly) NSUInteger maximumTrialCount;
+
+/**
+ Per-frequency statistics, in ascending frequency order.
+ */
+@property (nonatomic, copy, readonly) NSArray<ORKAudiometrySimulationFrequencyStatistics *> *frequencyStatistics;
+
+@end
+
+
+typedef id<ORKAudiometryProtocol> _Nonnull (^ORKAudiometryProvider)(void);
+
+/**
+ Runs many headless audiometry sessions against a simulated listener in parallel.
+ 
+ Each session uses its own random number generator seeded from `seed` and the session index,
+ so a run is reproducible regardless of how sessions are scheduled across cores.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKAudiometrySimulator : NSObject
+
+/**
+ Returns a simulator.
+ 
+ @param listener    The simulated listener.
+ @param provider    A block returning a fresh audiometry algorithm. It is called concurrently
+                    from multiple threads, and the algorithm must implement `nextStimulus`.
+                    A session whose algorithm does not is counted as not completed.
+ */
+- (instancetype)initWithListener:(ORKAudiometrySimulatedListener *)listener
+              audiometryProvider:(ORKAudiometryProvider)provider NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+@property (nonatomic, strong, readonly) ORKAudiometrySimulatedListener *listener;
+
+/**
+ The number of sessions to run. The default is 1000.
+ */
+@property (nonatomic, assign) NSUInteger sessionCount;
+
+/**
+ The seed for the random number generators. The default is 0.
+ */
+@property (nonatomic, assign) uint64_t seed;
+
+/**
+ The number of trials after which a session is abandoned. The default is 1000.
+ */
+@property (nonatomic, assign) NSUInteger maximumTrialsPerSession;
+
+/**
+ Runs all sessions, blocking until they are complete.
+ 
+ @param error   If the provider returns an algorithm that does not implement `nextStimulus`,
+                an `ORKErrorDomain` error describing it.
+ 
+ @return The report, or `nil` if the algorithm cannot be simulated.
+ */
+- (nullable ORKAudiometrySimulationReport *)runWithError:(NSError * _Nullable *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,320 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKAudiometrySimulator.h"
+
+#import "ORKAudiometryStimulus.h"
+#import "ORKdBHLToneAudiometryResult.h"
+
+#import "ORKErrors.h"
+#import "ORKHelpers_Internal.h"
+
+#include <math.h>
+
+typedef struct {
+    uint64_t state;
+} ORKSimulationRandom;
+
+// SplitMix64: small, fast and good enough to drive a simulated listener.
+static uint64_t ORKSimulationRandomNext(ORKSimulationRandom *random) {
+    uint64_t z = (random->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static double ORKSimulationRandomUniform(ORKSimulationRandom *random) {
+    return (ORKSimulationRandomNext(random) >> 11) * 0x1.0p-53;
+}
+
+@implementation ORKAudiometrySimulatedListener
+
+- (instancetype)initWithThresholds:(NSDictionary<NSNumber *,NSNumber *> *)thresholds {
+    ORKThrowInvalidArgumentExceptionIfNil(thresholds);
+    self = [super init];
+    if (self) {
+        _thresholds = [thresholds copy];
+        _psychometricSlope = 1.0;
+        _falsePositiveRate = 0;
+        _lapseRate = 0;
+    }
+    return self;
+}
+
+- (double)probabilityOfDetectingStimulus:(ORKAudiometryStimulus *)stimulus {
+    NSNumber *threshold = _thresholds[@(stimulus.frequency)];
+    if (threshold == nil) {
+        return 0;
+    }
+    double psychometric = 1.0 / (1.0 + exp(-_psychometricSlope * (stimulus.level - threshold.doubleValue)));
+    return (1.0 - _lapseRate) * psychometric;
+}
+
+@end
+
+
+@implementation ORKAudiometrySimulationFrequencyStatistics
+
+- (instancetype)initWithFrequency:(double)frequency
+                    trueThreshold:(double)trueThreshold
+                    estimateCount:(NSUInteger)estimateCount
+                             bias:(double)bias
+                         variance:(double)variance
+              rootMeanSquareError:(double)rootMeanSquareError
+                   meanTrialCount:(double)meanTrialCount {
+    self = [super init];
+    if (self) {
+        _frequency = frequency;
+        _trueThreshold = trueThreshold;
+        _estimateCount = estimateCount;
+        _bias = bias;
+        _variance = variance;
+        _rootMeanSquareError = rootMeanSquareError;
+        _meanTrialCount = meanTrialCount;
+    }
+    return self;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; frequency: %.0lf; bias: %.2lf; variance: %.2lf; rmse: %.2lf; trials: %.1lf; estimates: %lu>", self.class.description, self, _frequency, _bias, _variance, _rootMeanSquareError, _meanTrialCount, (unsigned long)_estimateCount];
+}
+
+@end
+
+
+@implementation ORKAudiometrySimulationReport
+
+- (instancetype)initWithSessionCount:(NSUInteger)sessionCount
+               completedSessionCount:(NSUInteger)completedSessionCount
+                      meanTrialCount:(double)meanTrialCount
+                  trialCountVariance:(double)trialCountVariance
+                   maximumTrialCount:(NSUInteger)maximumTrialCount
+                 frequencyStatistics:(NSArray<ORKAudiometrySimulationFrequencyStatistics *> *)frequencyStatistics {
+    self = [super init];
+    if (self) {
+        _sessionCount = sessionCount;
+        _completedSessionCount = completedSessionCount;
+        _meanTrialCount = meanTrialCount;
+        _trialCountVariance = trialCountVariance;
+        _maximumTrialCount = maximumTrialCount;
+        _frequencyStatistics = [frequencyStatistics copy];
+    }
+    return self;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; sessions: %lu; completed: %lu; trials: %.1lf ± %.1lf; max trials: %lu; frequencies: %@>", self.class.description, self, (unsigned long)_sessionCount, (unsigned long)_completedSessionCount, _meanTrialCount, sqrt(_trialCountVariance), (unsigned long)_maximumTrialCount, _frequencyStatistics];
+}
+
+@end
+
+
+@implementation ORKAudiometrySimulator {
+    ORKAudiometryProvider _provider;
+}
+
+- (instancetype)initWithListener:(ORKAudiometrySimulatedListener *)listener audiometryProvider:(ORKAudiometryProvider)provider {
+    ORKThrowInvalidArgumentExceptionIfNil(listener);
+    ORKThrowInvalidArgumentExceptionIfNil(provider);
+    self = [super init];
+    if (self) {
+        _listener = listener;
+        _provider = [provider copy];
+        _sessionCount = 1000;
+        _seed = 0;
+        _maximumTrialsPerSession = 1000;
+    }
+    return self;
+}
+
+/**
+ Runs one session, writing the estimated threshold and trial count for each frequency into the
+ session's slice of the result arrays. Returns the total number of trials, and sets `completed`
+ if the algorithm ended the test.
+ */
+- (NSUInteger)runSessionWithRandom:(ORKSimulationRandom *)random
+                       frequencies:(const double *)frequencies
+                    frequencyCount:(NSUInteger)frequencyCount
+                        thresholds:(double *)thresholds
+                       trialCounts:(NSUInteger *)trialCounts
+                         completed:(BOOL *)completed {
+    id<ORKAudiometryProtocol> audiometry = _provider();
+    // -runWithError: checks the first algorithm; this only guards against a provider whose
+    // algorithms differ, since an exception must not escape a dispatch_apply worker.
+    if (![audiometry respondsToSelector:@selector(nextStimulus)]) {
+        *completed = NO;
+        return 0;
+    }
+    
+    __block NSTimeInterval simulatedTime = 0;
+    audiometry.timestampProvider = ^NSTimeInterval{
+        return simulatedTime;
+    };
+    
+    ORKAudiometrySimulatedListener *listener = _listener;
+    NSUInteger trialCount = 0;
+    while (!audiometry.testEnded && trialCount < _maximumTrialsPerSession) {
+        ORKAudiometryStimulus *stimulus = [audiometry nextStimulus];
+        if (stimulus == nil) {
+            break;
+        }
+        trialCount += 1;
+        simulatedTime += 1;
+        for (NSUInteger index = 0; index < frequencyCount; index++) {
+            if (frequencies[index] == stimulus.frequency) {
+                trialCounts[index] += 1;
+                break;
+            }
+        }
+        
+        if (ORKSimulationRandomUniform(random) < listener.falsePositiveRate) {
+            // Respond during the silent pre-stimulus interval.
+            [audiometry registerResponse:YES forUnit:nil];
+            continue;
+        }
+        
+        [audiometry registerStimulusPlayback];
+        BOOL heard = ORKSimulationRandomUniform(random) < [listener probabilityOfDetectingStimulus:stimulus];
+        [audiometry registerResponse:heard forUnit:nil];
+    }
+    *completed = audiometry.testEnded;
+    
+    for (ORKdBHLToneAudiometryFrequencySample *sample in [audiometry resultSamples]) {
+        for (NSUInteger index = 0; index < frequencyCount; index++) {
+            if (frequencies[index] == sample.frequency) {
+                thresholds[index] = sample.calculatedThreshold;
+                break;
+            }
+        }
+    }
+    return trialCount;
+}
+
+- (ORKAudiometrySimulationReport *)runWithError:(NSError **)error {
+    id<ORKAudiometryProtocol> audiometry = _provider();
+    if (![audiometry respondsToSelector:@selector(nextStimulus)]) {
+        if (error != NULL) {
+            NSString *description = [NSString stringWithFormat:@"%@ does not implement nextStimulus, so it cannot be simulated.", NSStringFromClass([audiometry class])];
+            *error = [NSError errorWithDomain:ORKErrorDomain code:ORKErrorInvalidObject userInfo:@{NSLocalizedDescriptionKey: description}];
+        }
+        return nil;
+    }
+    
+    NSArray<NSNumber *> *sortedFrequencies = [_listener.thresholds.allKeys sortedArrayUsingSelector:@selector(compare:)];
+    const NSUInteger frequencyCount = sortedFrequencies.count;
+    const NSUInteger sessionCount = _sessionCount;
+    
+    double *frequencies = calloc(frequencyCount, sizeof(double));
+    double *trueThresholds = calloc(frequencyCount, sizeof(double));
+    for (NSUInteger index = 0; index < frequencyCount; index++) {
+        frequencies[index] = sortedFrequencies[index].doubleValue;
+        trueThresholds[index] = _listener.thresholds[sortedFrequencies[index]].doubleValue;
+    }
+    
+    // Each session writes only to its own slice, so no locking is needed.
+    double *thresholds = malloc(MAX(sessionCount * frequencyCount, 1) * sizeof(double));
+    NSUInteger *trialCounts = calloc(MAX(sessionCount * frequencyCount, 1), sizeof(NSUInteger));
+    NSUInteger *sessionTrialCounts = calloc(MAX(sessionCount, 1), sizeof(NSUInteger));
+    BOOL *completed = calloc(MAX(sessionCount, 1), sizeof(BOOL));
+    for (NSUInteger index = 0; index < sessionCount * frequencyCount; index++) {
+        thresholds[index] = ORKInvalidDBHLValue;
+    }
+    
+    const uint64_t seed = _seed;
+    dispatch_apply(sessionCount, DISPATCH_APPLY_AUTO, ^(size_t session) {
+        @autoreleasepool {
+            ORKSimulationRandom random = { .state = seed ^ ((session + 1) * 0xD1B54A32D192ED03ULL) };
+            sessionTrialCounts[session] = [self runSessionWithRandom:&random
+                                                         frequencies:frequencies
+                                                      frequencyCount:frequencyCount
+                                                          thresholds:thresholds + session * frequencyCount
+                                                         trialCounts:trialCounts + session * frequencyCount
+                                                           completed:completed + session];
+        }
+    });
+    
+    // Aggregate serially in session order so the report is bit-for-bit reproducible.
+    NSMutableArray<ORKAudiometrySimulationFrequencyStatistics *> *statistics = [NSMutableArray arrayWithCapacity:frequencyCount];
+    for (NSUInteger frequencyIndex = 0; frequencyIndex < frequencyCount; frequencyIndex++) {
+        NSUInteger estimateCount = 0;
+        double meanError = 0;
+        double errorM2 = 0;
+        double squaredError = 0;
+        double trialSum = 0;
+        for (NSUInteger session = 0; session < sessionCount; session++) {
+            NSUInteger offset = session * frequencyCount + frequencyIndex;
+            trialSum += trialCounts[offset];
+            if (thresholds[offset] == ORKInvalidDBHLValue) {
+                continue;
+            }
+            double error = thresholds[offset] - trueThresholds[frequencyIndex];
+            estimateCount += 1;
+            double delta = error - meanError;
+            meanError += delta / estimateCount;
+            errorM2 += delta * (error - meanError);
+            squaredError += error * error;
+        }
+        [statistics addObject:[[ORKAudiometrySimulationFrequencyStatistics alloc] initWithFrequency:frequencies[frequencyIndex]
+                                                                                       trueThreshold:trueThresholds[frequencyIndex]
+                                                                                       estimateCount:estimateCount
+                                                                                                bias:estimateCount > 0 ? meanError : NAN
+                                                                                            variance:estimateCount > 1 ? errorM2 / (estimateCount - 1) : NAN
+                                                                                 rootMeanSquareError:estimateCount > 0 ? sqrt(squaredError / estimateCount) : NAN
+                                                                                      meanTrialCount:sessionCount > 0 ? trialSum / sessionCount : 0]];
+    }
+    
+    NSUInteger completedCount = 0;
+    NSUInteger maximumTrialCount = 0;
+    double meanTrials = 0;
+    double trialM2 = 0;
+    for (NSUInteger session = 0; session < sessionCount; session++) {
+        completedCount += completed[session] ? 1 : 0;
+        maximumTrialCount = MAX(maximumTrialCount, sessionTrialCounts[session]);
+        double delta = sessionTrialCounts[session] - meanTrials;
+        meanTrials += delta / (session + 1);
+        trialM2 += delta * (sessionTrialCounts[session] - meanTrials);
+    }
+    
+    free(frequencies);
+    free(trueThresholds);
+    free(thresholds);
+    free(trialCounts);
+    free(sessionTrialCounts);
+    free(completed);
+    
+    return [[ORKAudiometrySimulationReport alloc] initWithSessionCount:sessionCount
+                                                 completedSessionCount:completedCount
+                                                        meanTrialCount:meanTrials
+                                                    trialCountVariance:sessionCount > 1 ? trialM2 / (sessionCount - 1) : 0
+                                                     maximumTrialCount:maximumTrialCount
+                                                   frequencyStatistics:statistics];
+}
+
+@end
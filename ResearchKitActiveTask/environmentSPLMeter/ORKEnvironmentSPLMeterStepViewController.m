@@ -52,6 +52,9 @@
 #import "ORKHelpers_Internal.h"
 #import <AVFoundation/AVFoundation.h>
 #include <sys/sysctl.h>
+#include <stdatomic.h>
+
+@import Accelerate;
 
 static const NSTimeInterval SPL_METER_PLAY_DELAY_VOICEOVER = 3.0;
 
@@ -78,6 +81,8 @@ NSString * const ORKEnvironmentSPLMeterStepViewAccessibilityIdentifier = @"ORKEn
     AVAudioSessionMode _savedSessionMode;
     AVAudioSessionCategoryOptions _savedSessionCategoryOptions;
     UINotificationFeedbackGenerator *_notificationFeedbackGenerator;
+    _Atomic float _pendingProgressBar;
+    atomic_bool _progressBarUpdateScheduled;
 }
 
 @property (nonatomic, strong) ORKEnvironmentSPLMeterContentView *environmentSPLMeterContentView;
@@ -345,10 +350,7 @@ NSString * const ORKEnvironmentSPLMeterStepViewAccessibilityIdentifier = @"ORKEn
                                    }
                                    int sampleCount = self->_samplingInterval * self->_countToFetch;
                                    float rms = 0.0;
-                                   for (int i = 0; i < buffer.frameLength; i++) {
-                                       float value = [@(buffer.floatChannelData[0][i]) floatValue];
-                                       rms +=  value * value;
-                                   }
+                                   vDSP_svesq(buffer.floatChannelData[0], 1, &rms, buffer.frameLength);
                                    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
                                        [self->_rmsBuffer addObject:@(rms)];
                                        
@@ -374,13 +376,9 @@ NSString * const ORKEnvironmentSPLMeterStepViewAccessibilityIdentifier = @"ORKEn
                                        } else {
                                            if (rms > 0.0 && self->_sampleRate > 0.0) {
                                                float spl = (20 * log10f(sqrtf(rms/(float)self->_sampleRate))) - self->_sensitivityOffset + 96;
-                                               dispatch_async(dispatch_get_main_queue(), ^{
-                                                   [self.environmentSPLMeterContentView setProgressBar:(spl/self->_thresholdValue)];
-                                               });
+                                               [self scheduleProgressBarUpdate:(spl/self->_thresholdValue)];
                                            } else {
-                                               dispatch_async(dispatch_get_main_queue(), ^{
-                                                   [self.environmentSPLMeterContentView setProgressBar:(self->_spl/self->_thresholdValue)];
-                                               });
+                                               [self scheduleProgressBarUpdate:(self->_spl/self->_thresholdValue)];
                                            }
                                        }
                                        dispatch_semaphore_signal(self->_semaphoreRms);
@@ -403,6 +401,18 @@ NSString * const ORKEnvironmentSPLMeterStepViewAccessibilityIdentifier = @"ORKEn
     }
 }
 
+// Coalesces bar updates from the tap so that at most one main queue block is outstanding.
+- (void)scheduleProgressBarUpdate:(float)progress {
+    atomic_store(&_pendingProgressBar, progress);
+    if (atomic_exchange(&_progressBarUpdateScheduled, true)) {
+        return;
+    }
+    dispatch_async(dispatch_get_main_queue(), ^{
+        atomic_store(&self->_progressBarUpdateScheduled, false);
+        [self.environmentSPLMeterContentView setProgressBar:atomic_load(&self->_pendingProgressBar)];
+    });
+}
+
 - (void)evaluateThreshold:(float)spl
 {
     if (spl < _thresholdValue)
@@ -0,0 +1,124 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+@import ResearchKitActiveTask_Private;
+
+static const double ORKAcousticTestSampleRate = 16000.0;
+
+@interface ORKAcousticFeatureExtractorTests : XCTestCase
+
+@end
+
+@implementation ORKAcousticFeatureExtractorTests
+
+- (NSData *)sineWithFrequency:(double)frequency amplitude:(float)amplitude duration:(NSTimeInterval)duration {
+    NSUInteger count = (NSUInteger)(duration * ORKAcousticTestSampleRate);
+    NSMutableData *data = [NSMutableData dataWithLength:count * sizeof(float)];
+    float *samples = data.mutableBytes;
+    for (NSUInteger index = 0; index < count; index++) {
+        samples[index] = amplitude * sinf((float)(2.0 * M_PI * frequency * index / ORKAcousticTestSampleRate));
+    }
+    return data;
+}
+
+- (void)processData:(NSData *)data withExtractor:(ORKAcousticFeatureExtractor *)extractor {
+    // Feed in uneven slices to exercise framing across buffer boundaries.
+    const float *samples = data.bytes;
+    NSUInteger count = data.length / sizeof(float);
+    NSUInteger offset = 0;
+    NSUInteger slice = 333;
+    while (offset < count) {
+        NSUInteger sliceCount = MIN(slice, count - offset);
+        [extractor processSamples:samples + offset count:sliceCount];
+        offset += sliceCount;
+    }
+}
+
+- (void)testFrameCountAndFeatureNames {
+    ORKAcousticFeatureExtractor *extractor = [[ORKAcousticFeatureExtractor alloc] initWithSampleRate:ORKAcousticTestSampleRate];
+    __block NSUInteger handledFrames = 0;
+    extractor.frameHandler = ^(NSTimeInterval timestamp, NSDictionary<NSString *,NSNumber *> *frameFeatures) {
+        XCTAssertEqual(frameFeatures.count, extractor.featureNames.count);
+        handledFrames += 1;
+    };
+    
+    [self processData:[self sineWithFrequency:200 amplitude:0.5 duration:1.0] withExtractor:extractor];
+    
+    // (16000 - 1024) / 512 + 1 complete frames.
+    XCTAssertEqual(extractor.frameCount, 30);
+    XCTAssertEqual(handledFrames, 30);
+    NSArray *expectedNames = @[@"energy", @"zeroCrossingRate", @"spectralCentroid", @"spectralFlatness", @"pitch", @"voicing"];
+    XCTAssertEqualObjects(extractor.featureNames, expectedNames);
+}
+
+- (void)testPitchAndCentroidOfSine {
+    ORKAcousticFeatureExtractor *extractor = [[ORKAcousticFeatureExtractor alloc] initWithSampleRate:ORKAcousticTestSampleRate];
+    [self processData:[self sineWithFrequency:200 amplitude:0.5 duration:1.0] withExtractor:extractor];
+    
+    NSDictionary<NSString *, NSNumber *> *summary = [extractor summary];
+    XCTAssertEqualWithAccuracy(summary[@"meanPitch"].doubleValue, 200.0, 2.0);
+    XCTAssertEqualWithAccuracy(summary[@"meanSpectralCentroid"].doubleValue, 200.0, 40.0);
+    XCTAssertEqualWithAccuracy(summary[@"voicedRatio"].doubleValue, 1.0, 0.001);
+    XCTAssertLessThan(summary[@"jitter"].doubleValue, 0.01);
+    XCTAssertLessThan(summary[@"shimmer"].doubleValue, 0.01);
+    // A 0.5 amplitude sine has an RMS of about -9 dBFS.
+    XCTAssertEqualWithAccuracy(summary[@"meanEnergy"].doubleValue, -9.03, 0.5);
+}
+
+- (void)testPauseStatistics {
+    ORKAcousticFeatureExtractor *extractor = [[ORKAcousticFeatureExtractor alloc] initWithSampleRate:ORKAcousticTestSampleRate];
+    NSData *tone = [self sineWithFrequency:150 amplitude:0.5 duration:0.5];
+    NSData *silence = [NSMutableData dataWithLength:(NSUInteger)(0.5 * ORKAcousticTestSampleRate) * sizeof(float)];
+    
+    [self processData:tone withExtractor:extractor];
+    [self processData:silence withExtractor:extractor];
+    [self processData:tone withExtractor:extractor];
+    
+    NSDictionary<NSString *, NSNumber *> *summary = [extractor summary];
+    XCTAssertEqual(summary[@"pauseCount"].integerValue, 1);
+    XCTAssertEqualWithAccuracy(summary[@"totalPauseDuration"].doubleValue, 0.45, 0.1);
+    XCTAssertLessThan(summary[@"speechRatio"].doubleValue, 1.0);
+    XCTAssertGreaterThan(summary[@"speechRatio"].doubleValue, 0.5);
+    
+    [extractor reset];
+    XCTAssertEqual(extractor.frameCount, 0);
+    XCTAssertEqual([extractor summary][@"pauseCount"].integerValue, 0);
+}
+
+- (void)testInvalidFrameLengthThrows {
+    XCTAssertThrows([[ORKAcousticFeatureExtractor alloc] initWithSampleRate:ORKAcousticTestSampleRate
+                                                                frameLength:1000
+                                                                  hopLength:500
+                                                                     stages:[ORKAcousticFeatureExtractor defaultStages]]);
+}
+
+@end
@@ -0,0 +1,131 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import XCTest;
+@import ResearchKitActiveTask_Private;
+
+
+static CMQuaternion ORKTestQuaternionAboutAxis(double x, double y, double z, double degrees) {
+    double halfAngle = degrees * M_PI / 360.0;
+    double s = sin(halfAngle);
+    return (CMQuaternion){ .x = x * s, .y = y * s, .z = z * s, .w = cos(halfAngle) };
+}
+
+static CMQuaternion ORKTestQuaternionMultiply(CMQuaternion a, CMQuaternion b) {
+    return (CMQuaternion){
+        .x = a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        .y = a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        .z = a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        .w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+    };
+}
+
+
+@interface ORKAttitudeFilterTests : XCTestCase
+
+@end
+
+
+@implementation ORKAttitudeFilterTests
+
+- (void)testTwistAngleIgnoresRotationAboutOtherAxes {
+    CMQuaternion pitch = ORKTestQuaternionAboutAxis(1, 0, 0, 30);
+    CMQuaternion yaw = ORKTestQuaternionAboutAxis(0, 0, 1, 80);
+    CMQuaternion quaternion = ORKTestQuaternionMultiply(yaw, pitch);
+    
+    XCTAssertEqualWithAccuracy(ORKAttitudeFilterTwistAngle(quaternion, ORKAttitudeFilterAxisX), 30, 1e-9);
+    XCTAssertEqualWithAccuracy(ORKAttitudeFilterTwistAngle(ORKTestQuaternionAboutAxis(0, 1, 0, -120), ORKAttitudeFilterAxisY), -120, 1e-9);
+    
+    // The same rotation with the opposite sign describes the same attitude.
+    CMQuaternion negated = { .x = -pitch.x, .y = -pitch.y, .z = -pitch.z, .w = -pitch.w };
+    XCTAssertEqualWithAccuracy(ORKAttitudeFilterTwistAngle(negated, ORKAttitudeFilterAxisX), 30, 1e-9);
+}
+
+- (void)testFilterTracksRangeAndRejectsSpike {
+    CMQuaternion reference = ORKTestQuaternionMultiply(ORKTestQuaternionAboutAxis(0, 0, 1, 40), ORKTestQuaternionAboutAxis(1, 0, 0, 10));
+    ORKAttitudeFilter *filter = [[ORKAttitudeFilter alloc] initWithAxis:ORKAttitudeFilterAxisX referenceQuaternion:reference];
+    
+    // Flex to 80 degrees and back over four seconds at 60 Hz, with one spurious sample.
+    const NSUInteger count = 241;
+    CMQuaternion quaternions[count];
+    NSTimeInterval timestamps[count];
+    for (NSUInteger index = 0; index < count; index++) {
+        double angle = 80 * sin(M_PI * index / (count - 1));
+        if (index == 60) {
+            angle += 60;
+        }
+        quaternions[index] = ORKTestQuaternionMultiply(reference, ORKTestQuaternionAboutAxis(1, 0, 0, angle));
+        timestamps[index] = 100 + index / 60.0;
+    }
+    [filter processQuaternions:quaternions timestamps:timestamps count:count];
+    
+    XCTAssertEqual(filter.rejectedSampleCount, 1);
+    XCTAssertEqual(filter.angles.count, count - 1);
+    XCTAssertEqual(filter.timestamps.count, count - 1);
+    XCTAssertEqualWithAccuracy(filter.timestamps.firstObject.doubleValue, 0, 1e-9);
+    XCTAssertEqualWithAccuracy(filter.minimumAngle, 0, 1e-9);
+    XCTAssertEqualWithAccuracy(filter.maximumAngle, 80, 1);
+    XCTAssertEqualWithAccuracy(filter.latestAngle, 0, 10);
+}
+
+- (void)testFilterFollowsSustainedFastMovement {
+    ORKAttitudeFilter *filter = [[ORKAttitudeFilter alloc] initWithAxis:ORKAttitudeFilterAxisX referenceQuaternion:ORKTestQuaternionAboutAxis(1, 0, 0, 0)];
+    filter.timeConstant = 0;
+    
+    const NSUInteger count = 10;
+    CMQuaternion quaternions[count];
+    NSTimeInterval timestamps[count];
+    for (NSUInteger index = 0; index < count; index++) {
+        // Jump to 45 degrees after the first sample and stay there.
+        quaternions[index] = ORKTestQuaternionAboutAxis(1, 0, 0, index == 0 ? 0 : 45);
+        timestamps[index] = index / 60.0;
+    }
+    [filter processQuaternions:quaternions timestamps:timestamps count:count];
+    
+    XCTAssertEqual(filter.rejectedSampleCount, 3);
+    XCTAssertEqualWithAccuracy(filter.latestAngle, 45, 1e-6);
+    XCTAssertEqualWithAccuracy(filter.maximumAngle, 45, 1e-6);
+}
+
+- (void)testAnglesAboveNinetyDegreesAreShifted {
+    ORKAttitudeFilter *filter = [[ORKAttitudeFilter alloc] initWithAxis:ORKAttitudeFilterAxisY referenceQuaternion:ORKTestQuaternionAboutAxis(0, 1, 0, 0)];
+    filter.timeConstant = 0;
+    filter.maximumAngularSpeed = INFINITY;
+    
+    CMQuaternion quaternions[2] = { ORKTestQuaternionAboutAxis(0, 1, 0, 0), ORKTestQuaternionAboutAxis(0, 1, 0, 120) };
+    NSTimeInterval timestamps[2] = { 0, 1 };
+    [filter processQuaternions:quaternions timestamps:timestamps count:2];
+    
+    XCTAssertEqualWithAccuracy(filter.latestAngle, -240, 1e-6);
+    XCTAssertEqualWithAccuracy(filter.minimumAngle, -240, 1e-6);
+}
+
+@end
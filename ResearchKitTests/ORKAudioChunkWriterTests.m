@@ -0,0 +1,226 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+@import ResearchKitActiveTask_Private;
+
+static const double ORKAudioChunkWriterTestSampleRate = 44100.0;
+
+// Matches the capacity of each buffer in the writer's pool.
+static const AVAudioFrameCount ORKAudioChunkWriterTestPoolBufferFrames = 4096;
+
+@interface ORKStreamingAudioRecorder (ORKAudioChunkWriterTests)
+
+- (void)setChunkWriter:(ORKAudioChunkWriter *)chunkWriter;
+- (void)finishWritingChunks;
+
+@end
+
+
+@interface ORKAudioChunkWriterTests : XCTestCase <ORKStreamingAudioResultDelegate>
+
+@end
+
+@implementation ORKAudioChunkWriterTests {
+    NSURL *_directoryURL;
+    AVAudioFormat *_format;
+    NSArray<ORKFileResult *> *_fileResults;
+    NSMutableArray<NSURL *> *_availableChunkURLs;
+}
+
+- (void)setUp {
+    [super setUp];
+    _directoryURL = [[NSURL fileURLWithPath:NSTemporaryDirectory()] URLByAppendingPathComponent:[NSUUID UUID].UUIDString];
+    _format = [[AVAudioFormat alloc] initStandardFormatWithSampleRate:ORKAudioChunkWriterTestSampleRate channels:1];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtURL:_directoryURL error:nil];
+    [super tearDown];
+}
+
+- (ORKAudioChunkWriter *)writerWithChunkFrames:(AVAudioFrameCount)chunkFrames {
+    return [[ORKAudioChunkWriter alloc] initWithDirectoryURL:_directoryURL
+                                                     logName:@"audio"
+                                                 inputFormat:_format
+                                                    encoding:ORKAudioChunkEncodingLinearPCM
+                                               chunkDuration:chunkFrames / ORKAudioChunkWriterTestSampleRate
+                                    rollingFileSizeThreshold:0];
+}
+
+- (AVAudioPCMBuffer *)bufferWithFrameCount:(AVAudioFrameCount)frameCount {
+    AVAudioPCMBuffer *buffer = [[AVAudioPCMBuffer alloc] initWithPCMFormat:_format frameCapacity:frameCount];
+    for (AVAudioFrameCount frame = 0; frame < frameCount; frame++) {
+        buffer.floatChannelData[0][frame] = 0.25f * sinf((float)(2.0 * M_PI * 440.0 * frame / ORKAudioChunkWriterTestSampleRate));
+    }
+    buffer.frameLength = frameCount;
+    return buffer;
+}
+
+- (void)recorder:(ORKRecorder *)recorder didCompleteWithResults:(NSArray<ORKFileResult *> *)results {
+    _fileResults = results;
+}
+
+- (void)recorder:(ORKRecorder *)recorder didFailWithError:(NSError *)error {
+    XCTFail(@"%@", error);
+}
+
+- (void)audioChunkAvailableAtURL:(NSURL *)chunkURL {
+    [_availableChunkURLs addObject:chunkURL];
+}
+
+- (AVAudioFramePosition)lengthOfFileAtURL:(NSURL *)fileURL {
+    NSError *error = nil;
+    AVAudioFile *file = [[AVAudioFile alloc] initForReading:fileURL error:&error];
+    XCTAssertNotNil(file, @"%@", error);
+    return file.length;
+}
+
+- (void)testChunksRollOverAtChunkDuration {
+    ORKAudioChunkWriter *writer = [self writerWithChunkFrames:ORKAudioChunkWriterTestPoolBufferFrames];
+    NSMutableArray<NSNumber *> *chunkIndices = [NSMutableArray array];
+    writer.chunkHandler = ^(NSURL *chunkURL, NSUInteger chunkIndex) {
+        [chunkIndices addObject:@(chunkIndex)];
+    };
+    
+    // Larger than a pool buffer, so the writer splits it across slots.
+    XCTAssertTrue([writer appendBuffer:[self bufferWithFrameCount:10000]]);
+    
+    NSError *error = nil;
+    NSArray<NSURL *> *chunkURLs = [writer finishWritingWithError:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual(chunkURLs.count, 3);
+    XCTAssertEqualObjects(chunkIndices, (@[@0, @1, @2]));
+    XCTAssertEqualObjects(chunkURLs.firstObject.lastPathComponent, @"audio_0000.wav");
+    XCTAssertEqual([self lengthOfFileAtURL:chunkURLs[0]], 4096);
+    XCTAssertEqual([self lengthOfFileAtURL:chunkURLs[1]], 4096);
+    XCTAssertEqual([self lengthOfFileAtURL:chunkURLs[2]], 10000 - 2 * 4096);
+    XCTAssertEqual(writer.droppedFrameCount, 0);
+}
+
+- (void)testExhaustedPoolDropsAndCountsFrames {
+    ORKAudioChunkWriter *writer = [self writerWithChunkFrames:ORKAudioChunkWriterTestPoolBufferFrames];
+    
+    // Hold the writer queue inside the handler of the first chunk, which keeps that chunk's slot
+    // in use, so the tap side can only fill the remaining slots.
+    dispatch_semaphore_t entered = dispatch_semaphore_create(0);
+    dispatch_semaphore_t resume = dispatch_semaphore_create(0);
+    writer.chunkHandler = ^(NSURL *chunkURL, NSUInteger chunkIndex) {
+        if (chunkIndex == 0) {
+            dispatch_semaphore_signal(entered);
+            dispatch_semaphore_wait(resume, DISPATCH_TIME_FOREVER);
+        }
+    };
+    
+    XCTAssertTrue([writer appendBuffer:[self bufferWithFrameCount:ORKAudioChunkWriterTestPoolBufferFrames]]);
+    XCTAssertEqual(dispatch_semaphore_wait(entered, dispatch_time(DISPATCH_TIME_NOW, 10 * NSEC_PER_SEC)), 0);
+    
+    NSUInteger acceptedCount = 0;
+    NSUInteger droppedCount = 0;
+    for (NSUInteger index = 0; index < 20; index++) {
+        if ([writer appendBuffer:[self bufferWithFrameCount:ORKAudioChunkWriterTestPoolBufferFrames]]) {
+            acceptedCount++;
+        } else {
+            droppedCount++;
+        }
+    }
+    XCTAssertEqual(acceptedCount, 15);
+    XCTAssertEqual(droppedCount, 5);
+    XCTAssertEqual(writer.droppedFrameCount, 5 * ORKAudioChunkWriterTestPoolBufferFrames);
+    
+    dispatch_semaphore_signal(resume);
+    NSError *error = nil;
+    NSArray<NSURL *> *chunkURLs = [writer finishWritingWithError:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual(chunkURLs.count, 1 + acceptedCount);
+    XCTAssertEqual(writer.droppedFrameCount, 5 * ORKAudioChunkWriterTestPoolBufferFrames);
+    XCTAssertFalse([writer appendBuffer:[self bufferWithFrameCount:16]], @"Appending after finishing is ignored");
+}
+
+- (void)testBufferInUnexpectedFormatIsRejected {
+    ORKAudioChunkWriter *writer = [self writerWithChunkFrames:0];
+    AVAudioFormat *stereoFormat = [[AVAudioFormat alloc] initStandardFormatWithSampleRate:ORKAudioChunkWriterTestSampleRate channels:2];
+    AVAudioPCMBuffer *buffer = [[AVAudioPCMBuffer alloc] initWithPCMFormat:stereoFormat frameCapacity:128];
+    buffer.frameLength = 128;
+    
+    XCTAssertFalse([writer appendBuffer:buffer]);
+    XCTAssertEqual([writer finishWritingWithError:nil].count, 0);
+}
+
+- (void)testStreamingAudioRecorderReportsDroppedFrames {
+    ORKStreamingAudioRecorder *recorder = [[ORKStreamingAudioRecorder alloc] initWithIdentifier:@"audio" step:nil outputDirectory:_directoryURL];
+    recorder.delegate = self;
+    ORKAudioChunkWriter *writer = [ORKAudioChunkWriter chunkWriterForRecorder:recorder
+                                                                  inputFormat:_format
+                                                                     encoding:ORKAudioChunkEncodingLinearPCM
+                                                                chunkDuration:ORKAudioChunkWriterTestPoolBufferFrames / ORKAudioChunkWriterTestSampleRate];
+    _availableChunkURLs = [NSMutableArray array];
+    
+    // Hold the writer queue in the first chunk's handler, as testExhaustedPoolDropsAndCountsFrames does,
+    // so that the last buffers are dropped.
+    ORKAudioChunkWriterChunkHandler chunkHandler = writer.chunkHandler;
+    dispatch_semaphore_t entered = dispatch_semaphore_create(0);
+    dispatch_semaphore_t resume = dispatch_semaphore_create(0);
+    writer.chunkHandler = ^(NSURL *chunkURL, NSUInteger chunkIndex) {
+        chunkHandler(chunkURL, chunkIndex);
+        if (chunkIndex == 0) {
+            dispatch_semaphore_signal(entered);
+            dispatch_semaphore_wait(resume, DISPATCH_TIME_FOREVER);
+        }
+    };
+    XCTAssertTrue([writer appendBuffer:[self bufferWithFrameCount:ORKAudioChunkWriterTestPoolBufferFrames]]);
+    XCTAssertEqual(dispatch_semaphore_wait(entered, dispatch_time(DISPATCH_TIME_NOW, 10 * NSEC_PER_SEC)), 0);
+    
+    uint64_t droppedFrameCount = 0;
+    for (NSUInteger index = 0; index < 20; index++) {
+        if (![writer appendBuffer:[self bufferWithFrameCount:ORKAudioChunkWriterTestPoolBufferFrames]]) {
+            droppedFrameCount += ORKAudioChunkWriterTestPoolBufferFrames;
+        }
+    }
+    XCTAssertGreaterThan(droppedFrameCount, 0);
+    dispatch_semaphore_signal(resume);
+    
+    // The writer is released when the results are reported, so the count must outlive it.
+    [recorder setChunkWriter:writer];
+    [recorder finishWritingChunks];
+    
+    XCTAssertGreaterThan(_fileResults.count, 0);
+    for (ORKFileResult *fileResult in _fileResults) {
+        XCTAssertEqualObjects(fileResult.userInfo, @{@"droppedFrameCount": @(droppedFrameCount)});
+        XCTAssertEqualObjects(fileResult.contentType, writer.mimeType);
+    }
+    
+    // Chunks reach the recorder's delegate on the main queue.
+    [[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.1]];
+    XCTAssertEqual(_availableChunkURLs.count, _fileResults.count);
+}
+
+@end
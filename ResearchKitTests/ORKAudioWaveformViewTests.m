@@ -0,0 +1,143 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+@import ResearchKitActiveTask_Private;
+
+// Matches the column step of the waveform view: line width plus margin.
+static const CGFloat ORKAudioWaveformViewTestColumnStep = 6.0;
+
+@interface ORKAudioWaveformViewTests : XCTestCase
+
+@end
+
+@implementation ORKAudioWaveformViewTests {
+    UIWindow *_window;
+    ORKAudioWaveformView *_waveformView;
+}
+
+- (void)setUp {
+    [super setUp];
+    _window = [[UIWindow alloc] initWithFrame:CGRectMake(0, 0, 320, 480)];
+    _waveformView = [[ORKAudioWaveformView alloc] initWithFrame:CGRectMake(0, 0, 300, 150)];
+    [_waveformView setMeterColor:[UIColor blackColor]];
+    [_window addSubview:_waveformView];
+    _window.hidden = NO;
+    [self waitForDisplayLink];
+}
+
+- (void)tearDown {
+    [_waveformView removeFromSuperview];
+    _waveformView = nil;
+    _window.hidden = YES;
+    _window = nil;
+    [super tearDown];
+}
+
+- (void)waitForDisplayLink {
+    [[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.2]];
+}
+
+- (void)appendSampleCount:(NSUInteger)count value:(float)value {
+    float samples[count];
+    for (NSUInteger index = 0; index < count; index++) {
+        samples[index] = value;
+    }
+    [_waveformView appendSamples:samples count:count];
+}
+
+// Returns the number of consecutive columns, counted from the right edge, that have been drawn.
+- (NSUInteger)drawnColumnCount {
+    CGImageRef image = (__bridge CGImageRef)_waveformView.layer.contents;
+    if (image == NULL) {
+        return 0;
+    }
+    size_t width = CGImageGetWidth(image);
+    size_t height = CGImageGetHeight(image);
+    CGFloat scale = width / CGRectGetWidth(_waveformView.bounds);
+    NSMutableData *pixels = [NSMutableData dataWithLength:width * height * 4];
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context = CGBitmapContextCreate(pixels.mutableBytes, width, height, 8, width * 4, colorSpace, kCGImageAlphaPremultipliedLast);
+    CGColorSpaceRelease(colorSpace);
+    CGContextDrawImage(context, CGRectMake(0, 0, width, height), image);
+    CGContextRelease(context);
+    
+    // Sample each column halfway between the midline and the top of a full-height column.
+    const uint8_t *bytes = pixels.bytes;
+    size_t row = (size_t)(CGRectGetHeight(_waveformView.bounds) / 4 * scale);
+    const uint8_t *background = bytes + row * width * 4;
+    NSUInteger count = 0;
+    for (CGFloat x = CGRectGetWidth(_waveformView.bounds) - ORKAudioWaveformViewTestColumnStep / 2; x > 0; x -= ORKAudioWaveformViewTestColumnStep) {
+        const uint8_t *pixel = bytes + (row * width + (size_t)(x * scale)) * 4;
+        if (memcmp(pixel, background, 4) == 0) {
+            break;
+        }
+        count++;
+    }
+    return count;
+}
+
+- (void)testAppendedSamplesAreDrawnAtTheRightEdge {
+    [self appendSampleCount:3 value:0.9];
+    [self waitForDisplayLink];
+    XCTAssertEqual([self drawnColumnCount], 3);
+    
+    // Later samples shift the drawn columns left.
+    [self appendSampleCount:2 value:0.9];
+    [self waitForDisplayLink];
+    XCTAssertEqual([self drawnColumnCount], 5);
+}
+
+- (void)testAlertThresholdRedrawsAppendedSamples {
+    [self appendSampleCount:4 value:0.9];
+    [self waitForDisplayLink];
+    XCTAssertEqual([self drawnColumnCount], 4);
+    
+    [_waveformView setAlertColor:[UIColor redColor]];
+    [_waveformView setAlertThreshold:0.5];
+    [self waitForDisplayLink];
+    XCTAssertEqual([self drawnColumnCount], 4);
+}
+
+- (void)testSetSamplesReplacesAppendedSamples {
+    [self appendSampleCount:4 value:0.9];
+    [self waitForDisplayLink];
+    
+    [_waveformView setSamples:@[@0.9, @0.9]];
+    [self waitForDisplayLink];
+    XCTAssertEqual([self drawnColumnCount], 2);
+    
+    [_waveformView setSamples:nil];
+    [self waitForDisplayLink];
+    XCTAssertEqual([self drawnColumnCount], 0);
+}
+
+@end
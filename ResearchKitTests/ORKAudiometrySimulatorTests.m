@@ -0,0 +1,127 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+@import ResearchKit_Private;
+@import ResearchKitActiveTask;
+@import ResearchKitActiveTask_Private;
+
+// An algorithm that can only be driven by a user interface, since it does not provide stimuli.
+@interface ORKAudiometrySimulatorTestsInteractiveAudiometry : NSObject <ORKAudiometryProtocol>
+
+@end
+
+@implementation ORKAudiometrySimulatorTestsInteractiveAudiometry
+
+@synthesize progress = _progress;
+@synthesize testEnded = _testEnded;
+@synthesize timestampProvider = _timestampProvider;
+
+- (void)registerStimulusPlayback {
+}
+
+- (void)registerResponse:(BOOL)response forUnit:(ORKdBHLToneAudiometryUnit *)unit {
+}
+
+- (NSArray<ORKdBHLToneAudiometryFrequencySample *> *)resultSamples {
+    return @[];
+}
+
+@end
+
+
+@interface ORKAudiometrySimulatorTests : XCTestCase
+
+@end
+
+@implementation ORKAudiometrySimulatorTests
+
+- (ORKAudiometrySimulator *)simulatorWithListener:(ORKAudiometrySimulatedListener *)listener {
+    ORKdBHLToneAudiometryStep *step = [[ORKdBHLToneAudiometryStep alloc] initWithIdentifier:@"ORKAudiometrySimulatorTests"];
+    step.frequencyList = [listener.thresholds.allKeys sortedArrayUsingSelector:@selector(compare:)];
+    ORKAudiometrySimulator *simulator = [[ORKAudiometrySimulator alloc] initWithListener:listener audiometryProvider:^id<ORKAudiometryProtocol>{
+        return [[ORKAudiometry alloc] initWithStep:step];
+    }];
+    simulator.sessionCount = 200;
+    simulator.seed = 42;
+    return simulator;
+}
+
+- (void)testDeterministicListenerHasNoVariance {
+    ORKAudiometrySimulatedListener *listener = [[ORKAudiometrySimulatedListener alloc] initWithThresholds:@{@1000: @22, @4000: @37}];
+    // Thresholds between step levels keep the response probability away from 0.5.
+    listener.psychometricSlope = 1000;
+    
+    ORKAudiometrySimulationReport *report = [[self simulatorWithListener:listener] runWithError:nil];
+    
+    XCTAssertEqual(report.sessionCount, 200);
+    XCTAssertEqual(report.completedSessionCount, 200);
+    XCTAssertEqual(report.trialCountVariance, 0);
+    XCTAssertEqual(report.frequencyStatistics.count, 2);
+    for (ORKAudiometrySimulationFrequencyStatistics *statistics in report.frequencyStatistics) {
+        XCTAssertEqual(statistics.estimateCount, 200);
+        XCTAssertEqualWithAccuracy(statistics.bias, 0, 5.0, @"%@", statistics);
+        XCTAssertEqual(statistics.variance, 0);
+        XCTAssertGreaterThan(statistics.meanTrialCount, 0);
+    }
+}
+
+- (void)testNoisyListenerIsReproducible {
+    ORKAudiometrySimulatedListener *listener = [[ORKAudiometrySimulatedListener alloc] initWithThresholds:@{@500: @10, @2000: @30, @8000: @50}];
+    listener.psychometricSlope = 0.5;
+    listener.falsePositiveRate = 0.05;
+    listener.lapseRate = 0.02;
+    
+    ORKAudiometrySimulationReport *first = [[self simulatorWithListener:listener] runWithError:nil];
+    ORKAudiometrySimulationReport *second = [[self simulatorWithListener:listener] runWithError:nil];
+    
+    XCTAssertEqual(first.meanTrialCount, second.meanTrialCount);
+    XCTAssertEqual(first.maximumTrialCount, second.maximumTrialCount);
+    for (NSUInteger index = 0; index < first.frequencyStatistics.count; index++) {
+        XCTAssertEqual(first.frequencyStatistics[index].bias, second.frequencyStatistics[index].bias);
+        XCTAssertEqual(first.frequencyStatistics[index].variance, second.frequencyStatistics[index].variance);
+    }
+    XCTAssertGreaterThan(first.trialCountVariance, 0);
+}
+
+- (void)testAlgorithmWithoutStimuliFailsWithError {
+    ORKAudiometrySimulatedListener *listener = [[ORKAudiometrySimulatedListener alloc] initWithThresholds:@{@1000: @20}];
+    ORKAudiometrySimulator *simulator = [[ORKAudiometrySimulator alloc] initWithListener:listener audiometryProvider:^id<ORKAudiometryProtocol>{
+        return [ORKAudiometrySimulatorTestsInteractiveAudiometry new];
+    }];
+    
+    NSError *error = nil;
+    XCTAssertNil([simulator runWithError:&error]);
+    XCTAssertEqualObjects(error.domain, ORKErrorDomain);
+    XCTAssertEqual(error.code, ORKErrorInvalidObject);
+}
+
+@end
@@ -40,6 +40,7 @@
     ORKDataLogger *_dataLogger;
     
     NSMutableArray *_finishedLogFiles;
+    NSMutableArray *_recoveredLogFiles;
 }
 
 @end
@@ -60,6 +61,7 @@
     _logName = @"test";
     
     _finishedLogFiles = [NSMutableArray array];
+    _recoveredLogFiles = [NSMutableArray array];
     _dataLogger = [ORKDataLogger JSONDataLoggerWithDirectory:_directory logName:_logName delegate:self];
 }
 
@@ -81,6 +83,11 @@
     [_finishedLogFiles addObject:fileUrl];
 }
 
+- (void)dataLogger:(ORKDataLogger *)dataLogger recoveredInterruptedLogFile:(NSURL *)fileUrl {
+    XCTAssertEqual(_dataLogger, dataLogger, @"Should be the same");
+    [_recoveredLogFiles addObject:fileUrl];
+}
+
 - (void)testDoNothing {
     NSURL *url = [_dataLogger currentLogFileURL];
     XCTAssertTrue([[url URLByDeletingLastPathComponent] isEqual:_directory], @"current log file should be in _directory");
@@ -143,6 +150,69 @@
     XCTAssertEqual(count, 3);
 }
 
+- (void)testEncryptedLog {
+    NSData *key = [@"0123456789abcdef0123456789abcdef" dataUsingEncoding:NSUTF8StringEncoding];
+    _dataLogger.encryptionKey = key;
+    
+    NSDictionary *jsonObject = @{@"test": @[@"a", @"b"], @"blah": @(1) };
+    [self logJsonObject:jsonObject];
+    [self logJsonObjectAndRolloverAndWaitOnce:jsonObject];
+    
+    XCTAssertEqual(_finishedLogFiles.count, 1);
+    XCTAssertTrue([ORKEncryptedFileHandle isEncryptedFileAtURL:_finishedLogFiles[0]]);
+    
+    NSError *error = nil;
+    NSData *data = [ORKEncryptedFileHandle dataWithContentsOfURL:_finishedLogFiles[0] key:key error:&error];
+    XCTAssertNotNil(data, @"%@", error);
+    NSDictionary *jsonOut = [NSJSONSerialization JSONObjectWithData:data options:(NSJSONReadingOptions)0 error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(jsonOut[@"items"], (@[jsonObject, jsonObject]));
+}
+
+- (void)testMissingKeyRollsOverEncryptedLog {
+    NSData *key = [@"0123456789abcdef0123456789abcdef" dataUsingEncoding:NSUTF8StringEncoding];
+    _dataLogger.encryptionKey = key;
+    XCTAssertTrue([_dataLogger append:@{@"val":@(1)} error:nil]);
+    
+    // A new logger without the key, as after a launch in which the key couldn't be read from the keychain.
+    _dataLogger.delegate = nil;
+    _dataLogger = [ORKDataLogger JSONDataLoggerWithDirectory:_directory logName:_logName delegate:self];
+    _dataLogger.encryptionKey = nil;
+    XCTAssertTrue([_dataLogger append:@{@"val":@(2)} error:nil]);
+    [self wait];
+    
+    XCTAssertEqual(_finishedLogFiles.count, 1);
+    NSError *error = nil;
+    NSData *data = [ORKEncryptedFileHandle dataWithContentsOfURL:_finishedLogFiles[0] key:key error:&error];
+    XCTAssertNotNil(data, @"%@", error);
+    NSDictionary *jsonOut = [NSJSONSerialization JSONObjectWithData:data options:(NSJSONReadingOptions)0 error:&error];
+    XCTAssertEqualObjects(jsonOut[@"items"], (@[@{@"val":@(1)}]), @"%@", error);
+    
+    NSURL *currentLogFileURL = [_dataLogger currentLogFileURL];
+    XCTAssertFalse([ORKEncryptedFileHandle isEncryptedFileAtURL:currentLogFileURL]);
+    jsonOut = [NSJSONSerialization JSONObjectWithData:[NSData dataWithContentsOfURL:currentLogFileURL] options:(NSJSONReadingOptions)0 error:&error];
+    XCTAssertEqualObjects(jsonOut[@"items"], (@[@{@"val":@(2)}]), @"%@", error);
+}
+
+- (void)testInterruptedEncryptedLogIsReported {
+    NSData *key = [@"0123456789abcdef0123456789abcdef" dataUsingEncoding:NSUTF8StringEncoding];
+    _dataLogger.encryptionKey = key;
+    XCTAssertTrue([_dataLogger append:@{@"val":@(1)} error:nil]);
+    
+    // Cut the end off the current log, as a crash during a write would.
+    NSURL *currentLogFileURL = [_dataLogger currentLogFileURL];
+    NSData *fileData = [NSData dataWithContentsOfURL:currentLogFileURL];
+    [[fileData subdataWithRange:NSMakeRange(0, fileData.length - 4)] writeToURL:currentLogFileURL atomically:NO];
+    
+    _dataLogger.delegate = nil;
+    _dataLogger = [ORKDataLogger JSONDataLoggerWithDirectory:_directory logName:_logName delegate:self];
+    _dataLogger.encryptionKey = key;
+    [_dataLogger append:@{@"val":@(2)} error:nil];
+    [self wait];
+    
+    XCTAssertEqualObjects(_recoveredLogFiles, @[currentLogFileURL]);
+}
+
 - (void)testContinuesExistingLog {
     // Test that if you create a logger, and then kill it and create a new logger, the new one
     // continues from the right place without forcing a roll-over
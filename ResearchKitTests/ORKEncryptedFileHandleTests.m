@@ -0,0 +1,260 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import XCTest;
+@import ResearchKit_Private;
+@import Security;
+
+@interface ORKEncryptedFileHandleTests : XCTestCase
+
+@end
+
+
+@implementation ORKEncryptedFileHandleTests {
+    NSURL *_fileURL;
+    NSData *_key;
+}
+
+- (void)setUp {
+    [super setUp];
+    _fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString]];
+    XCTAssertTrue([[NSFileManager defaultManager] createFileAtPath:_fileURL.path contents:nil attributes:nil]);
+    
+    NSMutableData *key = [NSMutableData dataWithLength:32];
+    XCTAssertEqual(SecRandomCopyBytes(kSecRandomDefault, key.length, key.mutableBytes), errSecSuccess);
+    _key = key;
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtURL:_fileURL error:nil];
+    [super tearDown];
+}
+
+- (NSData *)plaintextOfLength:(NSUInteger)length {
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    uint8_t *bytes = data.mutableBytes;
+    for (NSUInteger i = 0; i < length; i++) {
+        bytes[i] = (uint8_t)('a' + (i % 26));
+    }
+    return data;
+}
+
+- (ORKEncryptedFileHandle *)fileHandleForWriting {
+    NSError *error = nil;
+    ORKEncryptedFileHandle *fileHandle = [ORKEncryptedFileHandle fileHandleForWritingToURL:_fileURL key:_key error:&error];
+    XCTAssertNotNil(fileHandle, @"%@", error);
+    return fileHandle;
+}
+
+- (void)writePlaintext:(NSData *)plaintext {
+    ORKEncryptedFileHandle *fileHandle = [self fileHandleForWriting];
+    // Write in uneven pieces, so that writes straddle chunk boundaries.
+    for (NSUInteger offset = 0; offset < plaintext.length; offset += 1000) {
+        [fileHandle writeData:[plaintext subdataWithRange:NSMakeRange(offset, MIN(1000, plaintext.length - offset))]];
+    }
+    [fileHandle closeFile];
+}
+
+- (void)testRoundTrip {
+    NSData *plaintext = [self plaintextOfLength:3 * 4096 + 17];
+    [self writePlaintext:plaintext];
+    
+    NSError *error = nil;
+    XCTAssertEqualObjects([ORKEncryptedFileHandle dataWithContentsOfURL:_fileURL key:_key error:&error], plaintext, @"%@", error);
+    XCTAssertTrue([ORKEncryptedFileHandle isEncryptedFileAtURL:_fileURL]);
+    
+    NSData *fileData = [NSData dataWithContentsOfURL:_fileURL];
+    XCTAssertEqual([fileData rangeOfData:[plaintext subdataWithRange:NSMakeRange(0, 64)] options:0 range:NSMakeRange(0, fileData.length)].location, NSNotFound);
+}
+
+- (void)testEmptyFile {
+    [[self fileHandleForWriting] closeFile];
+    
+    NSError *error = nil;
+    XCTAssertEqualObjects([ORKEncryptedFileHandle dataWithContentsOfURL:_fileURL key:_key error:&error], [NSData data], @"%@", error);
+}
+
+- (void)testRandomAccessRead {
+    NSData *plaintext = [self plaintextOfLength:5 * 4096];
+    [self writePlaintext:plaintext];
+    
+    NSError *error = nil;
+    ORKEncryptedFileHandle *fileHandle = [ORKEncryptedFileHandle fileHandleForReadingFromURL:_fileURL key:_key error:&error];
+    XCTAssertNotNil(fileHandle, @"%@", error);
+    XCTAssertEqual(fileHandle.length, plaintext.length);
+    
+    [fileHandle seekToFileOffset:2 * 4096 - 10];
+    XCTAssertEqualObjects([fileHandle readDataOfLength:20], [plaintext subdataWithRange:NSMakeRange(2 * 4096 - 10, 20)]);
+    XCTAssertEqual(fileHandle.offsetInFile, 2 * 4096 + 10);
+    
+    [fileHandle seekToFileOffset:plaintext.length - 5];
+    XCTAssertEqualObjects([fileHandle readDataToEndOfFile], [plaintext subdataWithRange:NSMakeRange(plaintext.length - 5, 5)]);
+    
+    XCTAssertThrows([fileHandle writeData:plaintext]);
+    [fileHandle closeFile];
+}
+
+- (void)testOverwriteAndTruncate {
+    NSMutableData *expected = [[self plaintextOfLength:3 * 4096] mutableCopy];
+    [self writePlaintext:expected];
+    
+    ORKEncryptedFileHandle *fileHandle = [self fileHandleForWriting];
+    NSData *patch = [@"patched across a chunk boundary" dataUsingEncoding:NSUTF8StringEncoding];
+    [fileHandle seekToFileOffset:4096 - 8];
+    [fileHandle writeData:patch];
+    [expected replaceBytesInRange:NSMakeRange(4096 - 8, patch.length) withBytes:patch.bytes];
+    
+    [fileHandle truncateFileAtOffset:4096 + 100];
+    expected.length = 4096 + 100;
+    XCTAssertEqual(fileHandle.offsetInFile, 4096 + 100);
+    
+    // Writing past the end fills the gap with zeros.
+    [fileHandle seekToFileOffset:4096 + 110];
+    [fileHandle writeData:patch];
+    expected.length = 4096 + 110;
+    [expected appendData:patch];
+    [fileHandle closeFile];
+    
+    NSError *error = nil;
+    XCTAssertEqualObjects([ORKEncryptedFileHandle dataWithContentsOfURL:_fileURL key:_key error:&error], expected, @"%@", error);
+}
+
+- (void)testResumesExistingFile {
+    NSData *plaintext = [self plaintextOfLength:4096];
+    [self writePlaintext:plaintext];
+    
+    ORKEncryptedFileHandle *fileHandle = [self fileHandleForWriting];
+    XCTAssertEqual(fileHandle.length, 4096);
+    XCTAssertEqual([fileHandle seekToEndOfFile], 4096);
+    [fileHandle writeData:plaintext];
+    [fileHandle closeFile];
+    
+    NSMutableData *expected = [plaintext mutableCopy];
+    [expected appendData:plaintext];
+    NSError *error = nil;
+    XCTAssertEqualObjects([ORKEncryptedFileHandle dataWithContentsOfURL:_fileURL key:_key error:&error], expected, @"%@", error);
+}
+
+- (void)testWrongKeyFails {
+    [self writePlaintext:[self plaintextOfLength:100]];
+    
+    NSMutableData *otherKey = [_key mutableCopy];
+    ((uint8_t *)otherKey.mutableBytes)[0] ^= 1;
+    NSError *error = nil;
+    XCTAssertNil([ORKEncryptedFileHandle fileHandleForReadingFromURL:_fileURL key:otherKey error:&error]);
+    XCTAssertEqualObjects(error.domain, ORKErrorDomain);
+}
+
+- (void)testPlainFileIsRejected {
+    [[@"{}" dataUsingEncoding:NSUTF8StringEncoding] writeToURL:_fileURL atomically:NO];
+    
+    NSError *error = nil;
+    XCTAssertFalse([ORKEncryptedFileHandle isEncryptedFileAtURL:_fileURL]);
+    XCTAssertNil([ORKEncryptedFileHandle fileHandleForWritingToURL:_fileURL key:_key error:&error]);
+    XCTAssertEqualObjects(error.domain, ORKErrorDomain);
+}
+
+- (void)testModifiedChunkIsDetected {
+    NSData *plaintext = [self plaintextOfLength:3 * 4096];
+    [self writePlaintext:plaintext];
+    
+    // Flip one byte in the middle of the file, which lands in the second chunk.
+    NSMutableData *fileData = [[NSData dataWithContentsOfURL:_fileURL] mutableCopy];
+    ((uint8_t *)fileData.mutableBytes)[fileData.length / 2] ^= 1;
+    [fileData writeToURL:_fileURL atomically:NO];
+    
+    NSError *error = nil;
+    ORKEncryptedFileHandle *fileHandle = [ORKEncryptedFileHandle fileHandleForReadingFromURL:_fileURL key:_key error:&error];
+    XCTAssertNotNil(fileHandle, @"%@", error);
+    XCTAssertEqualObjects([fileHandle readDataUpToLength:4096 error:&error], [plaintext subdataWithRange:NSMakeRange(0, 4096)], @"%@", error);
+    XCTAssertNil([fileHandle readDataUpToLength:4096 error:&error]);
+    XCTAssertEqualObjects(error.domain, ORKErrorDomain);
+    [fileHandle closeFile];
+}
+
+- (void)testTruncationAtChunkBoundaryIsDetected {
+    [self writePlaintext:[self plaintextOfLength:3 * 4096]];
+    
+    // Drop the last chunk; what remains is a well-formed sequence of chunks, none of them final.
+    NSData *fileData = [NSData dataWithContentsOfURL:_fileURL];
+    NSUInteger sealedChunkLength = 4096 + 12 + 16;
+    [[fileData subdataWithRange:NSMakeRange(0, fileData.length - sealedChunkLength)] writeToURL:_fileURL atomically:NO];
+    
+    NSError *error = nil;
+    XCTAssertNil([ORKEncryptedFileHandle dataWithContentsOfURL:_fileURL key:_key error:&error]);
+    XCTAssertEqualObjects(error.domain, ORKErrorDomain);
+}
+
+- (void)testInterruptedAppendIsRecoveredByWriter {
+    NSData *plaintext = [self plaintextOfLength:3 * 4096 + 500];
+    [self writePlaintext:plaintext];
+    
+    // An append that crosses into a new chunk reseals the old last chunk as non-final and then writes the
+    // new final chunk. Cut the file in the middle of the final chunk to simulate a crash during that write.
+    NSData *fileData = [NSData dataWithContentsOfURL:_fileURL];
+    [[fileData subdataWithRange:NSMakeRange(0, fileData.length - 200)] writeToURL:_fileURL atomically:NO];
+    
+    NSError *error = nil;
+    XCTAssertNil([ORKEncryptedFileHandle dataWithContentsOfURL:_fileURL key:_key error:&error]);
+    
+    ORKEncryptedFileHandle *fileHandle = [self fileHandleForWriting];
+    XCTAssertEqual(fileHandle.length, 3 * 4096);
+    XCTAssertTrue(fileHandle.recoveredFromInterruptedWrite);
+    NSData *appended = [@"appended after recovery" dataUsingEncoding:NSUTF8StringEncoding];
+    [fileHandle seekToEndOfFile];
+    [fileHandle writeData:appended];
+    [fileHandle closeFile];
+    
+    NSMutableData *expected = [[plaintext subdataWithRange:NSMakeRange(0, 3 * 4096)] mutableCopy];
+    [expected appendData:appended];
+    XCTAssertEqualObjects([ORKEncryptedFileHandle dataWithContentsOfURL:_fileURL key:_key error:&error], expected, @"%@", error);
+}
+
+- (void)testTornLastChunkFallsBackToPreviousChunk {
+    NSData *plaintext = [self plaintextOfLength:2 * 4096 + 100];
+    [self writePlaintext:plaintext];
+    
+    // Corrupt the last chunk, as a torn rewrite of it in place would.
+    NSMutableData *fileData = [[NSData dataWithContentsOfURL:_fileURL] mutableCopy];
+    ((uint8_t *)fileData.mutableBytes)[fileData.length - 50] ^= 1;
+    [fileData writeToURL:_fileURL atomically:NO];
+    
+    ORKEncryptedFileHandle *fileHandle = [self fileHandleForWriting];
+    XCTAssertEqual(fileHandle.length, 2 * 4096);
+    XCTAssertTrue(fileHandle.recoveredFromInterruptedWrite);
+    [fileHandle closeFile];
+    XCTAssertFalse([self fileHandleForWriting].recoveredFromInterruptedWrite);
+    
+    NSError *error = nil;
+    XCTAssertEqualObjects([ORKEncryptedFileHandle dataWithContentsOfURL:_fileURL key:_key error:&error], [plaintext subdataWithRange:NSMakeRange(0, 2 * 4096)], @"%@", error);
+}
+
+@end
@@ -0,0 +1,136 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+@import ResearchKitActiveTask_Private;
+
+static const double ORKGaitTestSampleRate = 100;
+static const NSUInteger ORKGaitTestSampleCount = 2000;
+
+@interface ORKGaitAnalyzerTests : XCTestCase
+
+@end
+
+@implementation ORKGaitAnalyzerTests {
+    ORKGaitSample *_samples;
+}
+
+- (void)setUp {
+    [super setUp];
+    _samples = calloc(ORKGaitTestSampleCount, sizeof(ORKGaitSample));
+}
+
+- (void)tearDown {
+    free(_samples);
+    _samples = NULL;
+    [super tearDown];
+}
+
+// Heel strikes as vertical acceleration bumps, alternating 0.5 s and 0.6 s apart, with the
+// device held upright and a slow side-to-side sway.
+- (NSUInteger)fillWalkingSamples {
+    double stepTimes[64];
+    NSUInteger stepCount = 0;
+    for (double time = 1.0; time < 19.0; stepCount++) {
+        stepTimes[stepCount] = time;
+        time += (stepCount % 2 == 0) ? 0.5 : 0.6;
+    }
+    for (NSUInteger index = 0; index < ORKGaitTestSampleCount; index++) {
+        double time = index / ORKGaitTestSampleRate;
+        double vertical = 0;
+        for (NSUInteger step = 0; step < stepCount; step++) {
+            double offset = (time - stepTimes[step]) / 0.06;
+            vertical += 0.3 * exp(-offset * offset);
+        }
+        _samples[index] = (ORKGaitSample){
+            .timestamp = time,
+            .userAcceleration = { 0.02 * sin(2 * M_PI * 0.7 * time), vertical, 0 },
+            .gravity = { 0, -1, 0 }
+        };
+    }
+    return stepCount;
+}
+
+- (void)testWalkingMeasures {
+    NSUInteger expectedSteps = [self fillWalkingSamples];
+    ORKGaitAnalyzer *analyzer = [[ORKGaitAnalyzer alloc] initWithSampleRate:ORKGaitTestSampleRate];
+    [analyzer processSamples:_samples count:ORKGaitTestSampleCount];
+    ORKGaitSummaryResult *result = [analyzer summaryResultWithIdentifier:@"deviceMotion"];
+    
+    XCTAssertEqualObjects(result.identifier, @"deviceMotion");
+    XCTAssertEqual(result.numberOfSteps, (NSInteger)expectedSteps);
+    XCTAssertEqualWithAccuracy(result.cadence, 60 * 2 / 1.1, 0.5);
+    XCTAssertEqualWithAccuracy(result.meanStrideTime, 1.1, 0.01);
+    XCTAssertEqualWithAccuracy(result.strideTimeVariability, 0, 0.01);
+    XCTAssertEqualWithAccuracy(result.stepTimeAsymmetry, 0.1 / 0.55, 0.02);
+    XCTAssertEqualWithAccuracy(result.analyzedDuration, (ORKGaitTestSampleCount - 1) / ORKGaitTestSampleRate, 1e-9);
+    XCTAssertEqual(result.droppedSampleCount, 0);
+}
+
+- (void)testStandingStillHasNoSteps {
+    for (NSUInteger index = 0; index < ORKGaitTestSampleCount; index++) {
+        double time = index / ORKGaitTestSampleRate;
+        _samples[index] = (ORKGaitSample){
+            .timestamp = time,
+            .userAcceleration = { 0.02 * sin(2 * M_PI * 0.7 * time), 0, 0 },
+            .gravity = { 0, -1, 0 }
+        };
+    }
+    ORKGaitAnalyzer *analyzer = [[ORKGaitAnalyzer alloc] initWithSampleRate:ORKGaitTestSampleRate];
+    [analyzer processSamples:_samples count:ORKGaitTestSampleCount];
+    ORKGaitSummaryResult *result = [analyzer summaryResultWithIdentifier:@"deviceMotion"];
+    
+    XCTAssertEqual(result.numberOfSteps, 0);
+    XCTAssertEqual(result.cadence, 0);
+    XCTAssertEqualWithAccuracy(result.swayRootMeanSquare, 0.02 / M_SQRT2, 0.002);
+}
+
+- (void)testQueuedSamplesMatchSynchronousProcessing {
+    [self fillWalkingSamples];
+    NSUInteger count = ORKGaitAnalyzerQueueCapacity - 24;
+    
+    ORKGaitAnalyzer *queued = [[ORKGaitAnalyzer alloc] initWithSampleRate:ORKGaitTestSampleRate];
+    for (NSUInteger index = 0; index < count; index++) {
+        XCTAssertTrue([queued enqueueSample:_samples[index]]);
+    }
+    ORKGaitAnalyzer *direct = [[ORKGaitAnalyzer alloc] initWithSampleRate:ORKGaitTestSampleRate];
+    [direct processSamples:_samples count:count];
+    
+    ORKGaitSummaryResult *queuedResult = [queued summaryResultWithIdentifier:@"deviceMotion"];
+    ORKGaitSummaryResult *directResult = [direct summaryResultWithIdentifier:@"deviceMotion"];
+    XCTAssertGreaterThan(queuedResult.numberOfSteps, 0);
+    XCTAssertEqual(queuedResult.numberOfSteps, directResult.numberOfSteps);
+    XCTAssertEqual(queuedResult.cadence, directResult.cadence);
+    XCTAssertEqual(queuedResult.swayRootMeanSquare, directResult.swayRootMeanSquare);
+    XCTAssertEqual(queuedResult.droppedSampleCount, 0);
+}
+
+@end
@@ -37,7 +37,6 @@
 #import <ResearchKitActiveTask/ResearchKitActiveTask_Private.h>
 #import <ResearchKitUI/ResearchKitUI.h>
 
-#import "ORKESerialization.h"
 #import <objc/runtime.h>
 
 static BOOL ORKIsResearchKitClass(Class class) {
@@ -273,6 +272,7 @@ return block(); \
  */
 ORK_MAKE_TEST_INIT(ORKResult, ^{return [self initWithIdentifier:[NSUUID UUID].UUIDString];});
 ORK_MAKE_TEST_INIT(ORKTaskResult, ^{return [self initWithTaskIdentifier:[NSUUID UUID].UUIDString taskRunUUID:[NSUUID UUID] outputDirectory:nil];});
+ORK_MAKE_TEST_INIT(ORKTaskResultDiff, ^{return [self initWithTaskIdentifier:[NSUUID UUID].UUIDString taskRunUUID:[NSUUID UUID]];});
 ORK_MAKE_TEST_INIT(ORKStepNavigationRule, ^{return [super init];});
 ORK_MAKE_TEST_INIT(ORKSkipStepNavigationRule, ^{return [super init];});
 ORK_MAKE_TEST_INIT(ORKFormItemVisibilityRule, ^{return [super init];});
@@ -374,6 +374,29 @@ ORK_MAKE_TEST_INIT(UIColor, (^{ return [self initWithRed:1 green:1 blue:1 alpha:
 ORK_MAKE_TEST_INIT(ORKNoAnswer, (^{ return [ORKDontKnowAnswer answer]; }));
 ORK_MAKE_TEST_INIT(ORKAccuracyStroopStep, (^{ return [[ORKAccuracyStroopStep alloc] initWithIdentifier:[NSUUID UUID].UUIDString]; }));
 
+@interface ORKJSONTestCountingLocalizer : NSObject<ORKESerializationLocalizer, ORKESerializationStringInterpolator>
+
+@property (nonatomic, assign) NSUInteger localizationCount;
+@property (nonatomic, assign) NSUInteger interpolationCount;
+
+@end
+
+
+@implementation ORKJSONTestCountingLocalizer
+
+- (NSString *)localizedStringForKey:(NSString *)string {
+    self.localizationCount++;
+    return [@"L:" stringByAppendingString:string];
+}
+
+- (NSString *)interpolatedStringForString:(NSString *)string {
+    self.interpolationCount++;
+    return [string stringByReplacingOccurrencesOfString:@"{name}" withString:@"Alex"];
+}
+
+@end
+
+
 @interface ORKJSONTestImageSerialization : NSObject<ORKESerializationImageProvider>
 
 @property (nonatomic, readonly) NSDictionary *imageTable;
@@ -679,11 +702,14 @@ ORK_MAKE_TEST_INIT(ORKAccuracyStroopStep, (^{ return [[ORKAccuracyStroopStep all
         @"ORKUSDZModelManagerScene",
         @"ORKBlurFooterView",
         @"ORKFrontFacingCameraStepOptionsView",
+        @"ORKEncryptedFileHandle",
         @"ORKNoAnswer",
+        @"ORKStrokeData",
         @"ORKTouchAbilityTouch",
         @"ORKTouchAbilityTouch",
         @"ORKTouchAbilityTrack",
         @"ORKTouchAbilityTrial",
+        @"ORKTouchAbilityKinematicFeatures",
         @"ORKTouchAbilityTapStep",
         @"ORKTouchAbilityTapTrial",
         @"ORKTouchAbilityPinchStep",
@@ -1751,5 +1777,243 @@ ORKESerializationPropertyInjector *ORKSerializationTestPropertyInjector(void) {
     XCTAssertEqual(scaleAnswerFormat.defaultValue, INT_MAX);
 }
 
+- (NSDictionary *)streamedJSONObjectForObject:(id)object error:(NSError **)error {
+    NSOutputStream *outputStream = [NSOutputStream outputStreamToMemory];
+    [outputStream open];
+    BOOL success = [ORKESerializer writeJSONForObject:object toOutputStream:outputStream context:nil error:error];
+    NSData *data = [outputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+    [outputStream close];
+    if (!success) {
+        return nil;
+    }
+    return [NSJSONSerialization JSONObjectWithData:data options:0 error:error];
+}
+
+- (ORKTaskResult *)taskResultWithSampleArrays {
+    NSMutableArray<ORKTappingSample *> *samples = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 5000; index++) {
+        ORKTappingSample *sample = [[ORKTappingSample alloc] init];
+        sample.timestamp = index * 0.1;
+        sample.duration = 0.05;
+        sample.buttonIdentifier = (index % 2 == 0) ? ORKTappingButtonIdentifierLeft : ORKTappingButtonIdentifierRight;
+        sample.location = CGPointMake(index % 320, 0.5);
+        [samples addObject:sample];
+    }
+    ORKTappingIntervalResult *tappingResult = [[ORKTappingIntervalResult alloc] initWithIdentifier:@"tapping"];
+    tappingResult.samples = samples;
+    tappingResult.stepViewSize = CGSizeMake(320, 480);
+    
+    ORKTextQuestionResult *textResult = [[ORKTextQuestionResult alloc] initWithIdentifier:@"text"];
+    textResult.textAnswer = @"Line one\nLine \"two\"\t/ café \U0001F600";
+    
+    ORKRangeOfMotionResult *rangeOfMotionResult = [[ORKRangeOfMotionResult alloc] initWithIdentifier:@"rangeOfMotion"];
+    NSMutableArray<NSNumber *> *timestamps = [NSMutableArray array];
+    NSMutableArray<NSNumber *> *angles = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 1000; index++) {
+        [timestamps addObject:@(index / 60.0)];
+        [angles addObject:@(90.0 * sin(index / 100.0))];
+    }
+    rangeOfMotionResult.timestamps = timestamps;
+    rangeOfMotionResult.angles = angles;
+    rangeOfMotionResult.rejectedSampleCount = 3;
+    
+    ORKStepResult *stepResult = [[ORKStepResult alloc] initWithStepIdentifier:@"step" results:@[tappingResult, textResult, rangeOfMotionResult]];
+    ORKTaskResult *taskResult = [[ORKTaskResult alloc] initWithTaskIdentifier:@"task" taskRunUUID:[NSUUID UUID] outputDirectory:nil];
+    taskResult.results = @[stepResult];
+    return taskResult;
+}
+
+- (void)testStreamingWriterMatchesJSONObject {
+    ORKTaskResult *taskResult = [self taskResultWithSampleArrays];
+    ORKTextQuestionResult *textResult = (ORKTextQuestionResult *)[[taskResult stepResultForStepIdentifier:@"step"] resultForIdentifier:@"text"];
+    
+    NSDictionary *expected = [ORKESerializer JSONObjectForObject:taskResult error:NULL];
+    expected = [NSJSONSerialization JSONObjectWithData:[NSJSONSerialization dataWithJSONObject:expected options:0 error:NULL] options:0 error:NULL];
+    
+    NSError *error = nil;
+    NSDictionary *streamed = [self streamedJSONObjectForObject:taskResult error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(streamed, expected);
+    
+    ORKTaskResult *decoded = [ORKESerializer objectFromJSONObject:streamed error:NULL];
+    ORKTextQuestionResult *decodedTextResult = (ORKTextQuestionResult *)[[decoded stepResultForStepIdentifier:@"step"] resultForIdentifier:@"text"];
+    XCTAssertEqualObjects(decodedTextResult.textAnswer, textResult.textAnswer);
+}
+
+- (void)testStreamingWriterKeepsNulCharacters {
+    ORKTextQuestionResult *result = [[ORKTextQuestionResult alloc] initWithIdentifier:@"text"];
+    result.textAnswer = @"before\0after";
+    
+    NSError *error = nil;
+    NSData *jsonData = [ORKESerializer JSONDataForObject:result error:&error];
+    XCTAssertNotNil(jsonData, @"%@", error);
+    NSDictionary *expected = [NSJSONSerialization JSONObjectWithData:jsonData options:0 error:NULL];
+    
+    NSDictionary *streamed = [self streamedJSONObjectForObject:result error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(streamed, expected);
+    XCTAssertEqualObjects(streamed[@"textAnswer"], result.textAnswer);
+}
+
+- (void)testStreamingWriterReportsInvalidNumbers {
+    ORKNumericQuestionResult *result = [[ORKNumericQuestionResult alloc] initWithIdentifier:@"numeric"];
+    result.numericAnswer = @(NAN);
+    
+    NSError *error = nil;
+    XCTAssertNil([self streamedJSONObjectForObject:result error:&error]);
+    XCTAssertEqualObjects(error.domain, ORKErrorDomain);
+    XCTAssertEqual(error.code, ORKErrorInvalidObject);
+}
+
+- (void)testCBORMatchesJSONObject {
+    ORKTaskResult *taskResult = [self taskResultWithSampleArrays];
+    
+    NSData *jsonData = [ORKESerializer JSONDataForObject:taskResult error:NULL];
+    NSDictionary *expected = [NSJSONSerialization JSONObjectWithData:jsonData options:0 error:NULL];
+    
+    NSError *error = nil;
+    NSData *cborData = [ORKESerializer CBORDataForObject:taskResult error:&error];
+    XCTAssertNotNil(cborData, @"%@", error);
+    XCTAssertLessThan(cborData.length, jsonData.length);
+    
+    NSDictionary *decoded = [ORKESerializer JSONObjectFromCBORData:cborData error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(decoded, expected);
+    
+    ORKTaskResult *decodedResult = [ORKESerializer objectFromCBORData:cborData context:nil error:&error];
+    ORKRangeOfMotionResult *rangeOfMotionResult = (ORKRangeOfMotionResult *)[[decodedResult stepResultForStepIdentifier:@"step"] resultForIdentifier:@"rangeOfMotion"];
+    ORKRangeOfMotionResult *originalRangeOfMotionResult = (ORKRangeOfMotionResult *)[[taskResult stepResultForStepIdentifier:@"step"] resultForIdentifier:@"rangeOfMotion"];
+    XCTAssertEqualObjects(rangeOfMotionResult.angles, originalRangeOfMotionResult.angles);
+    XCTAssertEqual(rangeOfMotionResult.rejectedSampleCount, 3);
+}
+
+- (void)testCBORDecoding {
+    // Self-described tag, then a map of: "f" => float32 LE typed array [1.5, -2], "i" => sint8 typed array [-1, 2],
+    // "h" => half-precision 1.0, "s" => indefinite text string "ab", "n" => null.
+    const uint8_t bytes[] = {
+        0xD9, 0xD9, 0xF7,
+        0xA5,
+        0x61, 'f', 0xD8, 85, 0x48, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xC0,
+        0x61, 'i', 0xD8, 72, 0x42, 0xFF, 0x02,
+        0x61, 'h', 0xF9, 0x3C, 0x00,
+        0x61, 's', 0x7F, 0x61, 'a', 0x61, 'b', 0xFF,
+        0x61, 'n', 0xF6,
+    };
+    NSError *error = nil;
+    NSDictionary *decoded = [ORKESerializer JSONObjectFromCBORData:[NSData dataWithBytes:bytes length:sizeof(bytes)] error:&error];
+    XCTAssertNil(error);
+    NSDictionary *expected = @{@"f": @[@1.5, @-2.0], @"i": @[@-1, @2], @"h": @1.0, @"s": @"ab", @"n": [NSNull null]};
+    XCTAssertEqualObjects(decoded, expected);
+    
+    const uint8_t truncated[] = { 0x82, 0x01 };
+    XCTAssertNil([ORKESerializer JSONObjectFromCBORData:[NSData dataWithBytes:truncated length:sizeof(truncated)] error:&error]);
+    XCTAssertEqual(error.code, ORKErrorInvalidObject);
+    
+    const uint8_t trailing[] = { 0x01, 0x02 };
+    error = nil;
+    XCTAssertNil([ORKESerializer JSONObjectFromCBORData:[NSData dataWithBytes:trailing length:sizeof(trailing)] error:&error]);
+    XCTAssertEqual(error.code, ORKErrorInvalidObject);
+}
+
+- (void)testLocalizedStringsAreMemoized {
+    NSMutableArray<ORKTextChoice *> *choices = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 20; index++) {
+        NSString *text = (index % 2 == 0) ? @"Never, {name}" : @"Sometimes";
+        [choices addObject:[[ORKTextChoice alloc] initWithText:text detailText:nil value:@(index) exclusive:NO]];
+    }
+    ORKTextChoiceAnswerFormat *answerFormat = [ORKAnswerFormat choiceAnswerFormatWithStyle:ORKChoiceAnswerStyleSingleChoice textChoices:choices];
+    NSDictionary *json = [ORKESerializer JSONObjectForObject:answerFormat error:NULL];
+    
+    ORKJSONTestCountingLocalizer *localizer = [ORKJSONTestCountingLocalizer new];
+    ORKESerializationContext *context = [[ORKESerializationContext alloc] initWithLocalizer:localizer imageProvider:nil stringInterpolator:localizer propertyInjector:nil];
+    ORKTextChoiceAnswerFormat *decoded = [ORKESerializer objectFromJSONObject:json context:context error:NULL];
+    XCTAssertEqualObjects(decoded.textChoices[0].text, @"L:Never, Alex");
+    XCTAssertEqualObjects(decoded.textChoices[1].text, @"L:Sometimes");
+    XCTAssertEqualObjects(decoded.textChoices[19].text, @"L:Sometimes");
+    NSUInteger cachedCount = localizer.localizationCount;
+    XCTAssertEqual(localizer.interpolationCount, cachedCount);
+    
+    // Without the cache, each of the 20 labels is localized separately.
+    localizer.localizationCount = 0;
+    context.localizedStringCacheLimit = 0;
+    decoded = [ORKESerializer objectFromJSONObject:json context:context error:NULL];
+    XCTAssertEqualObjects(decoded.textChoices[0].text, @"L:Never, Alex");
+    XCTAssertGreaterThanOrEqual(localizer.localizationCount, cachedCount + 18);
+}
+
+- (void)testBundleLocalizerReadsStringsTable {
+    NSURL *bundleURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID].UUIDString stringByAppendingPathExtension:@"bundle"]]];
+    XCTAssertTrue([[NSFileManager defaultManager] createDirectoryAtURL:bundleURL withIntermediateDirectories:YES attributes:nil error:NULL]);
+    XCTAssertTrue([@{@"Never": @"Jamais"} writeToURL:[bundleURL URLByAppendingPathComponent:@"Survey.strings"] error:NULL]);
+    
+    ORKESerializationBundleLocalizer *localizer = [[ORKESerializationBundleLocalizer alloc] initWithBundle:[NSBundle bundleWithURL:bundleURL] tableName:@"Survey"];
+    XCTAssertEqualObjects([localizer localizedStringForKey:@"Never"], @"Jamais");
+    XCTAssertEqualObjects([localizer localizedStringForKey:@"Always"], @"Always");
+    
+    [[NSFileManager defaultManager] removeItemAtURL:bundleURL error:NULL];
+}
+
+- (void)testParallelDecodingMatchesSequentialDecoding {
+    NSMutableArray<ORKStep *> *steps = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 40; index++) {
+        NSArray<ORKTextChoice *> *choices = @[[[ORKTextChoice alloc] initWithText:@"Never" detailText:nil value:@(0) exclusive:NO],
+                                              [[ORKTextChoice alloc] initWithText:@"Sometimes" detailText:nil value:@(1) exclusive:NO],
+                                              [[ORKTextChoice alloc] initWithText:@"Often" detailText:nil value:@(2) exclusive:NO],
+                                              [[ORKTextChoice alloc] initWithText:@"Always" detailText:nil value:@(3) exclusive:NO]];
+        ORKAnswerFormat *answerFormat = [ORKAnswerFormat choiceAnswerFormatWithStyle:ORKChoiceAnswerStyleSingleChoice textChoices:choices];
+        NSString *identifier = [NSString stringWithFormat:@"question%lu", (unsigned long)index];
+        [steps addObject:[ORKQuestionStep questionStepWithIdentifier:identifier title:identifier question:@"How often?" answer:answerFormat]];
+    }
+    ORKOrderedTask *task = [[ORKOrderedTask alloc] initWithIdentifier:@"task" steps:steps];
+    NSDictionary *json = [ORKESerializer JSONObjectForObject:task error:NULL];
+    
+    ORKESerializationContext *context = [[ORKESerializationContext alloc] initWithLocalizer:nil imageProvider:nil stringInterpolator:nil propertyInjector:nil];
+    ORKOrderedTask *sequentialTask = [ORKESerializer objectFromJSONObject:json context:context error:NULL];
+    context.decodesInParallel = YES;
+    ORKOrderedTask *parallelTask = [ORKESerializer objectFromJSONObject:json context:context error:NULL];
+    
+    XCTAssertEqualObjects(parallelTask, sequentialTask);
+    XCTAssertEqualObjects([parallelTask.steps valueForKey:@"identifier"], [task.steps valueForKey:@"identifier"]);
+    
+    // A failure in any worker is reported as an error on the calling thread.
+    NSMutableDictionary *invalidJSON = [json mutableCopy];
+    NSMutableArray *stepsJSON = [json[@"steps"] mutableCopy];
+    NSMutableDictionary *invalidStepJSON = [stepsJSON[30] mutableCopy];
+    invalidStepJSON[@"notAProperty"] = @"value";
+    stepsJSON[30] = invalidStepJSON;
+    invalidJSON[@"steps"] = stepsJSON;
+    NSError *error = nil;
+    XCTAssertNil([ORKESerializer objectFromJSONObject:invalidJSON context:context error:&error]);
+    XCTAssertEqualObjects(error.domain, ORKErrorDomain);
+}
+
+- (void)testMalformedInputReportsError {
+    ORKTextChoice *choice = [[ORKTextChoice alloc] initWithText:@"Never" detailText:nil value:@(0) exclusive:NO];
+    ORKAnswerFormat *answerFormat = [ORKAnswerFormat choiceAnswerFormatWithStyle:ORKChoiceAnswerStyleSingleChoice textChoices:@[choice]];
+    NSDictionary *json = [ORKESerializer JSONObjectForObject:answerFormat error:NULL];
+    
+    NSMutableDictionary *unknownStyle = [json mutableCopy];
+    unknownStyle[@"style"] = @"noChoice";
+    NSMutableDictionary *unknownProperty = [json mutableCopy];
+    unknownProperty[@"notAProperty"] = @"value";
+    NSMutableDictionary *unknownClass = [json mutableCopy];
+    unknownClass[@"_class"] = @"ORKNotAClass";
+    NSMutableDictionary *choicesNotAnArray = [json mutableCopy];
+    choicesNotAnArray[@"textChoices"] = @"Never";
+    
+    for (NSDictionary *invalidJSON in @[unknownStyle, unknownProperty, unknownClass, choicesNotAnArray]) {
+        NSError *error = nil;
+        XCTAssertNil([ORKESerializer objectFromJSONObject:invalidJSON error:&error], @"%@", invalidJSON);
+        XCTAssertEqualObjects(error.domain, ORKErrorDomain);
+        XCTAssertEqual(error.code, ORKErrorInvalidObject);
+        XCTAssertNotNil(error.userInfo[NSDebugDescriptionErrorKey]);
+    }
+    
+    NSError *error = nil;
+    NSData *data = [NSJSONSerialization dataWithJSONObject:unknownClass options:0 error:NULL];
+    XCTAssertNil([ORKESerializer objectFromJSONData:data error:&error]);
+    XCTAssertEqualObjects(error.domain, ORKErrorDomain);
+}
+
 @end
 
@@ -340,6 +340,7 @@ static BOOL ork_doubleEqual(double x, double y) {
     NSNumber *_rollingFileSizeThreshold;
     ORKRecorder *_recorder;
     NSArray<ORKResult *> *_result;
+    NSArray<ORKResult *> *_summaryResults;
     NSArray   *_items;
 }
 
@@ -362,6 +363,7 @@ static const NSInteger kNumberOfSamples = 5;
     _rollingFileSizeThreshold = @5000000;
     _recorder = nil;
     _result = nil;
+    _summaryResults = nil;
     _items = nil;
 }
 
@@ -375,6 +377,10 @@ static const NSInteger kNumberOfSamples = 5;
     _result = results;
 }
 
+- (void)recorder:(ORKRecorder *)recorder didCompleteWithSummaryResults:(NSArray<ORKResult *> *)results {
+    _summaryResults = results;
+}
+
 - (void)recorder:(ORKRecorder *)recorder didFailWithError:(NSError *)error {
     ORK_Log_Error("didFailWithError: %@", error);
     _recorder = nil;
@@ -538,6 +544,41 @@ static const NSInteger kNumberOfSamples = 5;
     }
 }
 
+- (void)testAccelerometerRecorderReportsTremorSpectrumSeparately {
+    ORKMockAccelerometerRecorder *recorder = [[ORKMockAccelerometerRecorder alloc] initWithIdentifier:@"accelerometer"
+                                                                                            frequency:60.0
+                                                                                                 step:[[ORKStep alloc] initWithIdentifier:@"step"]
+                                                                                      outputDirectory:[NSURL fileURLWithPath:_outputPath]
+                                                                             rollingFileSizeThreshold:_rollingFileSizeThreshold.unsignedLongValue];
+    recorder.analyzesTremor = YES;
+    recorder.delegate = self;
+    ORKMockMotionManager *manager = [ORKMockMotionManager new];
+    recorder.mockManager = manager;
+    
+    [recorder start];
+    
+    ORKMockAccelerometerData *data = [ORKMockAccelerometerData new];
+    for (NSInteger i = 0; i < kNumberOfSamples; i++) {
+        [manager injectAccelerometerData:data];
+    }
+    
+    [recorder stop];
+    
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Results reported"];
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(2.0 * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        [expectation fulfill];
+    });
+    [self waitForExpectationsWithTimeout:20.0 handler:nil];
+    [self checkResult];
+    
+    for (ORKResult *result in _result) {
+        XCTAssertTrue([result isKindOfClass:[ORKFileResult class]]);
+    }
+    XCTAssertEqual(_summaryResults.count, 1);
+    XCTAssertTrue([_summaryResults.firstObject isKindOfClass:[ORKTremorSpectrumResult class]]);
+    XCTAssertEqualObjects(_summaryResults.firstObject.identifier, @"accelerometer");
+}
+
 - (void)testDeviceMotionRecorder {
     
     ORKDeviceMotionRecorderConfiguration *recorderConfiguration = [[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:@"deviceMotion"
@@ -596,6 +637,35 @@ static const NSInteger kNumberOfSamples = 5;
     }
 }
 
+- (void)testDeviceMotionRecorderReportsGaitSummarySeparately {
+    ORKMockDeviceMotionRecorder *recorder = [[ORKMockDeviceMotionRecorder alloc] initWithIdentifier:@"deviceMotion"
+                                                                                          frequency:60.0
+                                                                                               step:[[ORKStep alloc] initWithIdentifier:@"step"]
+                                                                                    outputDirectory:[NSURL fileURLWithPath:_outputPath]
+                                                                           rollingFileSizeThreshold:_rollingFileSizeThreshold.unsignedLongValue];
+    recorder.analyzesGait = YES;
+    recorder.delegate = self;
+    ORKMockMotionManager *manager = [ORKMockMotionManager new];
+    recorder.mockManager = manager;
+    
+    [recorder start];
+    
+    ORKMockDeviceMotion *motion = [ORKMockDeviceMotion new];
+    for (NSInteger i = 0; i < kNumberOfSamples; i++) {
+        [manager injectMotion:motion];
+    }
+    
+    [recorder stop];
+    [self checkResult];
+    
+    for (ORKResult *result in _result) {
+        XCTAssertTrue([result isKindOfClass:[ORKFileResult class]]);
+    }
+    XCTAssertEqual(_summaryResults.count, 1);
+    XCTAssertTrue([_summaryResults.firstObject isKindOfClass:[ORKGaitSummaryResult class]]);
+    XCTAssertEqualObjects(_summaryResults.firstObject.identifier, @"deviceMotion");
+}
+
 - (void)testPedometerRecorder {
     
     Class recorderClass = [ORKPedometerRecorder class];
@@ -0,0 +1,95 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import XCTest;
+@import ResearchKitActiveTask_Private;
+
+
+@interface ORKResponseStatisticsAccumulatorTests : XCTestCase
+
+@end
+
+
+@implementation ORKResponseStatisticsAccumulatorTests
+
+- (void)testMeanVarianceAndCounts {
+    ORKResponseStatisticsAccumulator *accumulator = [ORKResponseStatisticsAccumulator new];
+    for (NSNumber *value in @[@0.2, @0.4, @0.6, @0.8, @1.0]) {
+        [accumulator addValue:value.doubleValue];
+    }
+    [accumulator addError];
+    [accumulator addLapse];
+    [accumulator addLapse];
+    
+    ORKResponseStatistics *statistics = [accumulator statistics];
+    XCTAssertEqual(statistics.count, 5);
+    XCTAssertEqualWithAccuracy(statistics.mean, 0.6, 1e-12);
+    XCTAssertEqualWithAccuracy(statistics.standardDeviation, sqrt(0.1), 1e-12);
+    XCTAssertEqualWithAccuracy(statistics.coefficientOfVariation, sqrt(0.1) / 0.6, 1e-12);
+    XCTAssertEqual(statistics.minimum, 0.2);
+    XCTAssertEqual(statistics.maximum, 1.0);
+    XCTAssertEqualWithAccuracy(statistics.median, 0.6, 0.006);
+    XCTAssertEqualWithAccuracy(statistics.percentile10, 0.2, 0.002);
+    XCTAssertEqualWithAccuracy(statistics.percentile90, 0.8, 0.008);
+    XCTAssertEqual(statistics.errorCount, 1);
+    XCTAssertEqual(statistics.lapseCount, 2);
+}
+
+- (void)testPercentilesWithinRelativeAccuracy {
+    ORKResponseStatisticsAccumulator *accumulator = [ORKResponseStatisticsAccumulator new];
+    // 1 ms to 1 s, in shuffled order.
+    for (NSUInteger index = 0; index < 1000; index++) {
+        [accumulator addValue:((index * 379) % 1000 + 1) / 1000.0];
+    }
+    XCTAssertEqualWithAccuracy([accumulator valueAtPercentile:50], 0.5, 0.005);
+    XCTAssertEqualWithAccuracy([accumulator valueAtPercentile:10], 0.1, 0.001);
+    XCTAssertEqualWithAccuracy([accumulator valueAtPercentile:90], 0.9, 0.009);
+    XCTAssertEqual([accumulator valueAtPercentile:0], 0.001);
+    XCTAssertEqual([accumulator valueAtPercentile:100], 1.0);
+}
+
+- (void)testEventIntervals {
+    ORKResponseStatisticsAccumulator *accumulator = [ORKResponseStatisticsAccumulator new];
+    for (NSNumber *timestamp in @[@10.0, @10.25, @10.5, @10.75]) {
+        [accumulator addEventWithTimestamp:timestamp.doubleValue];
+    }
+    ORKResponseStatistics *statistics = [accumulator statistics];
+    XCTAssertEqual(statistics.count, 3);
+    XCTAssertEqualWithAccuracy(statistics.mean, 0.25, 1e-12);
+    XCTAssertEqualWithAccuracy(statistics.coefficientOfVariation, 0, 1e-12);
+    
+    [accumulator reset];
+    statistics = [accumulator statistics];
+    XCTAssertEqual(statistics.count, 0);
+    XCTAssertEqual(statistics.median, 0);
+}
+
+@end
@@ -487,6 +487,66 @@
 
 }
 
+- (ORKTextQuestionResult *)textResultWithIdentifier:(NSString *)identifier answer:(NSString *)answer {
+    ORKTextQuestionResult *result = [[ORKTextQuestionResult alloc] initWithIdentifier:identifier];
+    result.answer = answer;
+    return result;
+}
+
+- (void)testTaskResultDiff {
+    ORKTaskResult *base = [[ORKTaskResult alloc] initWithTaskIdentifier:@"task" taskRunUUID:[NSUUID UUID] outputDirectory:nil];
+    base.results = @[[[ORKStepResult alloc] initWithStepIdentifier:@"form" results:@[[self textResultWithIdentifier:@"a" answer:@"1"],
+                                                                                       [self textResultWithIdentifier:@"b" answer:@"2"],
+                                                                                       [self textResultWithIdentifier:@"c" answer:@"3"]]],
+                     [[ORKStepResult alloc] initWithStepIdentifier:@"unchanged" results:@[[self textResultWithIdentifier:@"d" answer:@"4"]]],
+                     [[ORKStepResult alloc] initWithStepIdentifier:@"removed" results:nil]];
+    
+    ORKTaskResult *current = [base copy];
+    ORKStepResult *form = [(ORKStepResult *)current.results[0] copy];
+    form.results = @[form.results[0], [self textResultWithIdentifier:@"b" answer:@"changed"], [self textResultWithIdentifier:@"e" answer:@"5"]];
+    current.results = @[form, current.results[1], [[ORKStepResult alloc] initWithStepIdentifier:@"added" results:@[[self textResultWithIdentifier:@"f" answer:@"6"]]]];
+    current.endDate = [NSDate dateWithTimeIntervalSinceNow:60];
+    
+    ORKTaskResultDiff *diff = [ORKTaskResultDiff diffFromTaskResult:base toTaskResult:current];
+    XCTAssertEqualObjects(diff.removedStepResultIdentifiers, @[@"removed"]);
+    XCTAssertEqualObjects(diff.removedChildResultIdentifiers, @{@"form": @[@"c"]});
+    XCTAssertEqual(diff.stepResults.count, 2);
+    XCTAssertEqualObjects([diff.stepResults[0].results valueForKey:@"identifier"], (@[@"b", @"e"]));
+    XCTAssertEqualObjects(diff.stepResults[1].identifier, @"added");
+    
+    NSError *error = nil;
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:diff requiringSecureCoding:YES error:&error];
+    XCTAssertNotNil(data, @"%@", error);
+    ORKTaskResultDiff *decodedDiff = [NSKeyedUnarchiver unarchivedObjectOfClass:[ORKTaskResultDiff class] fromData:data error:&error];
+    XCTAssertEqualObjects(decodedDiff, diff, @"%@", error);
+    
+    ORKTaskResult *applied = [decodedDiff taskResultByApplyingToTaskResult:base error:&error];
+    XCTAssertEqualObjects(applied, current, @"%@", error);
+    XCTAssertEqualObjects([[ORKTaskResultDiff diffFromTaskResult:nil toTaskResult:current] taskResultByApplyingToTaskResult:nil error:nil].results, current.results);
+    
+    ORKTaskResultDiff *emptyDiff = [ORKTaskResultDiff diffFromTaskResult:current toTaskResult:[current copy]];
+    XCTAssertEqual(emptyDiff.stepResults.count, 0);
+    XCTAssertEqual(emptyDiff.removedStepResultIdentifiers.count, 0);
+    
+    ORKTaskResult *otherRun = [[ORKTaskResult alloc] initWithTaskIdentifier:@"task" taskRunUUID:[NSUUID UUID] outputDirectory:nil];
+    XCTAssertNil([diff taskResultByApplyingToTaskResult:otherRun error:&error]);
+    XCTAssertEqual(error.code, ORKErrorInvalidObject);
+}
+
+- (void)testTaskResultDiffReplacesReorderedResults {
+    ORKTaskResult *base = [[ORKTaskResult alloc] initWithTaskIdentifier:@"task" taskRunUUID:[NSUUID UUID] outputDirectory:nil];
+    base.results = @[[[ORKStepResult alloc] initWithStepIdentifier:@"form" results:@[[self textResultWithIdentifier:@"a" answer:@"1"],
+                                                                                       [self textResultWithIdentifier:@"b" answer:@"2"]]]];
+    ORKTaskResult *current = [base copy];
+    ORKStepResult *form = [(ORKStepResult *)current.results[0] copy];
+    form.results = @[[self textResultWithIdentifier:@"new" answer:@"0"], form.results[1], form.results[0]];
+    current.results = @[form];
+    
+    ORKTaskResultDiff *diff = [ORKTaskResultDiff diffFromTaskResult:base toTaskResult:current];
+    XCTAssertEqualObjects(diff.removedChildResultIdentifiers, (@{@"form": @[@"a", @"b"]}));
+    XCTAssertEqualObjects([diff taskResultByApplyingToTaskResult:base error:nil], current);
+}
+
 - (void)testConsentDocumentDecoding {
     ORKConsentDocument *document = [[ORKConsentDocument alloc] init];
     document.signatures = @[
@@ -0,0 +1,95 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Foundation/Foundation.h>
+
+@class ORKESerializationContext;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ One input of the serialization benchmark: an object, and the context to decode it with.
+ */
+@interface ORKSerializationBenchmarkCase : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithName:(NSString *)name object:(id)object decodingContext:(nullable ORKESerializationContext *)decodingContext;
+
+@property (nonatomic, copy, readonly) NSString *name;
+
+@property (nonatomic, strong, readonly) id object;
+
+@property (nonatomic, strong, readonly, nullable) ORKESerializationContext *decodingContext;
+
+@end
+
+
+/**
+ Measures encoding and decoding of a corpus of tasks and results in every serialization format.
+ 
+ Each format encodes each case, and decodes the encoded data, `iterations` times. The report gives, for
+ every case and format, the encoded size, the median encode and decode times and throughputs, and the
+ peak memory growth of each operation, sampled every millisecond. The report is a JSON object, so runs
+ can be stored and compared over time.
+ */
+@interface ORKSerializationBenchmark : NSObject
+
+/**
+ Returns the benchmark corpus. The size of every case grows linearly with `scale`.
+ 
+ - largeTask: an ordered task of question, form, and instruction steps with repeated choice labels.
+ - localizedTask: the same kind of task with localization keys, decoded with a bundle localizer.
+ - taskResult: a task result with question answers and dense tapping and range of motion samples.
+ */
++ (NSArray<ORKSerializationBenchmarkCase *> *)corpusWithScale:(NSUInteger)scale;
+
+/// The names of the measured formats.
++ (NSArray<NSString *> *)formatNames;
+
+/**
+ Encodes and decodes every case once in every format that applies to it, without measuring, and calls
+ `block` with each decoded object.
+ 
+ Throws if any format fails to encode or decode a case.
+ */
++ (void)enumerateRoundTripsOfCorpus:(NSArray<ORKSerializationBenchmarkCase *> *)corpus
+                         usingBlock:(void (^)(ORKSerializationBenchmarkCase *benchmarkCase, NSString *formatName, id decodedObject))block;
+
+/**
+ Runs the benchmark and returns the report.
+ 
+ Throws if any format fails to encode or decode a case.
+ */
++ (NSDictionary<NSString *, id> *)reportForCorpus:(NSArray<ORKSerializationBenchmarkCase *> *)corpus iterations:(NSUInteger)iterations;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,474 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import "ORKSerializationBenchmark.h"
+
+#import <ResearchKit/ResearchKit_Private.h>
+#import <ResearchKitActiveTask/ResearchKitActiveTask.h>
+
+#include <mach/mach.h>
+#include <sys/utsname.h>
+#include <time.h>
+
+
+static const NSUInteger ORKSerializationBenchmarkReportVersion = 1;
+
+@interface ORKSerializationBenchmarkCase ()
+
+// A directory the case owns, such as the bundle of a localized task, removed with the case.
+@property (nonatomic, strong, nullable) NSURL *temporaryDirectoryURL;
+
+@end
+
+
+@implementation ORKSerializationBenchmarkCase
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithName:(NSString *)name object:(id)object decodingContext:(ORKESerializationContext *)decodingContext {
+    self = [super init];
+    if (self) {
+        _name = [name copy];
+        _object = object;
+        _decodingContext = decodingContext;
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_temporaryDirectoryURL != nil) {
+        [[NSFileManager defaultManager] removeItemAtURL:_temporaryDirectoryURL error:nil];
+    }
+}
+
+@end
+
+
+typedef NSData * _Nullable (^ORKSerializationBenchmarkEncodeBlock)(id object, NSError **error);
+typedef id _Nullable (^ORKSerializationBenchmarkDecodeBlock)(NSData *data, Class objectClass, ORKESerializationContext *context, NSError **error);
+
+@interface ORKSerializationBenchmarkFormat : NSObject
+
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, copy) ORKSerializationBenchmarkEncodeBlock encodeBlock;
+@property (nonatomic, copy) ORKSerializationBenchmarkDecodeBlock decodeBlock;
+
+// The class the format is limited to, or Nil if it applies to every case.
+@property (nonatomic, strong, nullable) Class objectClass;
+
+@end
+
+
+@implementation ORKSerializationBenchmarkFormat
+
++ (instancetype)formatWithName:(NSString *)name encodeBlock:(ORKSerializationBenchmarkEncodeBlock)encodeBlock decodeBlock:(ORKSerializationBenchmarkDecodeBlock)decodeBlock {
+    ORKSerializationBenchmarkFormat *format = [ORKSerializationBenchmarkFormat new];
+    format.name = name;
+    format.encodeBlock = encodeBlock;
+    format.decodeBlock = decodeBlock;
+    return format;
+}
+
+@end
+
+
+static uint64_t ORKSerializationBenchmarkFootprint(void) {
+    task_vm_info_data_t info;
+    mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+    if (task_info(mach_task_self(), TASK_VM_INFO, (task_info_t)&info, &count) != KERN_SUCCESS) {
+        return 0;
+    }
+    return info.phys_footprint;
+}
+
+// Runs the block, and returns how long it took and how far the memory footprint rose above its starting
+// value while it ran, sampling the footprint every millisecond.
+static void ORKSerializationBenchmarkMeasure(void (^block)(void), double *seconds, uint64_t *peakMemoryBytes) {
+    uint64_t baseline = ORKSerializationBenchmarkFootprint();
+    __block uint64_t peak = baseline;
+    dispatch_queue_t samplingQueue = dispatch_queue_create("ResearchKit.serializationBenchmark.memory", DISPATCH_QUEUE_SERIAL);
+    dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, samplingQueue);
+    dispatch_source_set_timer(timer, DISPATCH_TIME_NOW, NSEC_PER_MSEC, 0);
+    dispatch_source_set_event_handler(timer, ^{
+        peak = MAX(peak, ORKSerializationBenchmarkFootprint());
+    });
+    dispatch_resume(timer);
+    
+    uint64_t start = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    block();
+    uint64_t end = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    
+    uint64_t footprint = ORKSerializationBenchmarkFootprint();
+    dispatch_source_cancel(timer);
+    dispatch_sync(samplingQueue, ^{
+        peak = MAX(peak, footprint);
+    });
+    *seconds = (end - start) / (double)NSEC_PER_SEC;
+    *peakMemoryBytes = peak - baseline;
+}
+
+static double ORKSerializationBenchmarkMedian(NSArray<NSNumber *> *values) {
+    NSArray<NSNumber *> *sortedValues = [values sortedArrayUsingSelector:@selector(compare:)];
+    NSUInteger count = sortedValues.count;
+    if (count % 2 == 1) {
+        return sortedValues[count / 2].doubleValue;
+    }
+    return (sortedValues[count / 2 - 1].doubleValue + sortedValues[count / 2].doubleValue) / 2;
+}
+
+// Returns a new context with the configuration of the given one, so that every decode starts with an
+// empty string cache.
+static ORKESerializationContext *ORKSerializationBenchmarkFreshContext(ORKESerializationContext *context) {
+    return [[ORKESerializationContext alloc] initWithLocalizer:context.localizer
+                                                 imageProvider:context.imageProvider
+                                            stringInterpolator:context.stringInterpolator
+                                              propertyInjector:context.propertyInjector];
+}
+
+static id ORKSerializationBenchmarkObjectFromJSONData(NSData *data, ORKESerializationContext *context, NSError **error) {
+    id jsonObject = [NSJSONSerialization JSONObjectWithData:data options:0 error:error];
+    return jsonObject ? [ORKESerializer objectFromJSONObject:jsonObject context:context error:error] : nil;
+}
+
+static void ORKSerializationBenchmarkRaise(ORKSerializationBenchmarkFormat *format, ORKSerializationBenchmarkCase *benchmarkCase, NSString *operation, NSError *error) {
+    @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                   reason:[NSString stringWithFormat:@"%@ failed to %@ %@: %@", format.name, operation, benchmarkCase.name, error]
+                                 userInfo:nil];
+}
+
+static NSString *ORKSerializationBenchmarkDeviceModel(void) {
+    struct utsname systemInfo;
+    uname(&systemInfo);
+    return [NSString stringWithCString:systemInfo.machine encoding:NSUTF8StringEncoding] ? : @"unknown";
+}
+
+
+@implementation ORKSerializationBenchmark
+
+#pragma mark - Corpus
+
++ (NSArray<ORKSerializationBenchmarkCase *> *)corpusWithScale:(NSUInteger)scale {
+    NSParameterAssert(scale > 0);
+    
+    ORKSerializationBenchmarkCase *largeTask = [[ORKSerializationBenchmarkCase alloc] initWithName:@"largeTask"
+                                                                                            object:[self taskWithIdentifier:@"largeTask" scale:scale strings:nil]
+                                                                                   decodingContext:nil];
+    
+    // The localized task holds localization keys, which a bundle localizer resolves from a strings table.
+    NSMutableDictionary<NSString *, NSString *> *strings = [NSMutableDictionary dictionary];
+    ORKOrderedTask *localizedTaskObject = [self taskWithIdentifier:@"localizedTask" scale:scale strings:strings];
+    NSURL *bundleURL = [[NSURL fileURLWithPath:NSTemporaryDirectory()] URLByAppendingPathComponent:[NSString stringWithFormat:@"ORKSerializationBenchmark-%@.bundle", [NSUUID UUID].UUIDString]];
+    [[NSFileManager defaultManager] createDirectoryAtURL:bundleURL withIntermediateDirectories:YES attributes:nil error:nil];
+    [strings writeToURL:[bundleURL URLByAppendingPathComponent:@"Benchmark.strings"] error:nil];
+    ORKESerializationBundleLocalizer *localizer = [[ORKESerializationBundleLocalizer alloc] initWithBundle:[NSBundle bundleWithURL:bundleURL] tableName:@"Benchmark"];
+    ORKESerializationContext *localizedContext = [[ORKESerializationContext alloc] initWithLocalizer:localizer imageProvider:nil stringInterpolator:nil propertyInjector:nil];
+    ORKSerializationBenchmarkCase *localizedTask = [[ORKSerializationBenchmarkCase alloc] initWithName:@"localizedTask"
+                                                                                                object:localizedTaskObject
+                                                                                       decodingContext:localizedContext];
+    localizedTask.temporaryDirectoryURL = bundleURL;
+    
+    ORKSerializationBenchmarkCase *taskResult = [[ORKSerializationBenchmarkCase alloc] initWithName:@"taskResult"
+                                                                                             object:[self taskResultWithScale:scale]
+                                                                                    decodingContext:nil];
+    return @[largeTask, localizedTask, taskResult];
+}
+
+// When `strings` is non-nil, the task's texts are localization keys, and the strings table is added to it.
++ (ORKOrderedTask *)taskWithIdentifier:(NSString *)identifier scale:(NSUInteger)scale strings:(NSMutableDictionary<NSString *, NSString *> *)strings {
+    NSString *(^text)(NSString *, NSString *) = ^NSString *(NSString *key, NSString *string) {
+        if (strings == nil) {
+            return string;
+        }
+        strings[key] = [@"[fr] " stringByAppendingString:string];
+        return key;
+    };
+    
+    NSArray<NSString *> *labels = @[@"Never", @"Rarely", @"Sometimes", @"Often", @"Always"];
+    NSMutableArray<ORKTextChoice *> *choices = [NSMutableArray array];
+    for (NSUInteger index = 0; index < labels.count; index++) {
+        NSString *label = text([@"CHOICE_" stringByAppendingString:labels[index].uppercaseString], labels[index]);
+        [choices addObject:[[ORKTextChoice alloc] initWithText:label detailText:nil value:@(index) exclusive:NO]];
+    }
+    
+    NSMutableArray<ORKStep *> *steps = [NSMutableArray array];
+    for (NSUInteger section = 0; section < 5 * scale; section++) {
+        ORKInstructionStep *instructionStep = [[ORKInstructionStep alloc] initWithIdentifier:[NSString stringWithFormat:@"instruction%lu", (unsigned long)section]];
+        instructionStep.title = text(@"SECTION_TITLE", @"About the past week");
+        instructionStep.text = text(@"SECTION_TEXT", @"Answer the following questions about how you felt during the past seven days.");
+        [steps addObject:instructionStep];
+        
+        for (NSUInteger question = 0; question < 4; question++) {
+            NSString *stepIdentifier = [NSString stringWithFormat:@"question%lu_%lu", (unsigned long)section, (unsigned long)question];
+            NSString *key = [NSString stringWithFormat:@"QUESTION_%lu", (unsigned long)question];
+            ORKAnswerFormat *answerFormat = [ORKAnswerFormat choiceAnswerFormatWithStyle:ORKChoiceAnswerStyleSingleChoice textChoices:choices];
+            [steps addObject:[ORKQuestionStep questionStepWithIdentifier:stepIdentifier
+                                                                   title:text(@"QUESTION_TITLE", @"How often")
+                                                                question:text(key, [NSString stringWithFormat:@"How often did symptom %lu bother you?", (unsigned long)question])
+                                                                  answer:answerFormat]];
+        }
+        
+        ORKFormStep *formStep = [[ORKFormStep alloc] initWithIdentifier:[NSString stringWithFormat:@"form%lu", (unsigned long)section]
+                                                                  title:text(@"FORM_TITLE", @"Daily check-in")
+                                                                   text:text(@"FORM_TEXT", @"Tell us about today.")];
+        formStep.formItems = @[
+            [[ORKFormItem alloc] initWithIdentifier:@"mood"
+                                               text:text(@"FORM_MOOD", @"Mood")
+                                       answerFormat:[ORKAnswerFormat scaleAnswerFormatWithMaximumValue:10 minimumValue:0 defaultValue:5 step:1 vertical:NO
+                                                                               maximumValueDescription:text(@"FORM_MOOD_MAX", @"Great")
+                                                                               minimumValueDescription:text(@"FORM_MOOD_MIN", @"Poor")]],
+            [[ORKFormItem alloc] initWithIdentifier:@"weight" text:text(@"FORM_WEIGHT", @"Weight") answerFormat:[ORKAnswerFormat decimalAnswerFormatWithUnit:@"kg"]],
+            [[ORKFormItem alloc] initWithIdentifier:@"notes" text:text(@"FORM_NOTES", @"Notes") answerFormat:[ORKAnswerFormat textAnswerFormat]],
+            [[ORKFormItem alloc] initWithIdentifier:@"medication" text:text(@"FORM_MEDICATION", @"Took medication") answerFormat:[ORKAnswerFormat booleanAnswerFormat]],
+            [[ORKFormItem alloc] initWithIdentifier:@"sleep" text:text(@"FORM_SLEEP", @"Slept well")
+                                       answerFormat:[ORKAnswerFormat choiceAnswerFormatWithStyle:ORKChoiceAnswerStyleSingleChoice textChoices:choices]]
+        ];
+        [steps addObject:formStep];
+    }
+    return [[ORKOrderedTask alloc] initWithIdentifier:identifier steps:steps];
+}
+
++ (ORKTaskResult *)taskResultWithScale:(NSUInteger)scale {
+    NSDate *startDate = [NSDate dateWithTimeIntervalSinceReferenceDate:700000000];
+    NSMutableArray<ORKStepResult *> *stepResults = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 20 * scale; index++) {
+        ORKChoiceQuestionResult *choiceResult = [[ORKChoiceQuestionResult alloc] initWithIdentifier:@"choice"];
+        choiceResult.choiceAnswers = @[@(index % 5)];
+        ORKScaleQuestionResult *scaleResult = [[ORKScaleQuestionResult alloc] initWithIdentifier:@"mood"];
+        scaleResult.scaleAnswer = @(index % 11);
+        ORKTextQuestionResult *textResult = [[ORKTextQuestionResult alloc] initWithIdentifier:@"notes"];
+        textResult.textAnswer = @"Slept about seven hours, a little tired after lunch.";
+        
+        ORKStepResult *stepResult = [[ORKStepResult alloc] initWithStepIdentifier:[NSString stringWithFormat:@"question%lu", (unsigned long)index]
+                                                                          results:@[choiceResult, scaleResult, textResult]];
+        stepResult.startDate = [startDate dateByAddingTimeInterval:index * 10];
+        stepResult.endDate = [stepResult.startDate dateByAddingTimeInterval:8];
+        [stepResults addObject:stepResult];
+    }
+    
+    NSMutableArray<ORKTappingSample *> *samples = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 2000 * scale; index++) {
+        ORKTappingSample *sample = [[ORKTappingSample alloc] init];
+        sample.timestamp = index * 0.1;
+        sample.duration = 0.05 + (index % 7) * 0.01;
+        sample.buttonIdentifier = (index % 2 == 0) ? ORKTappingButtonIdentifierLeft : ORKTappingButtonIdentifierRight;
+        sample.location = CGPointMake(index % 320, 240.5);
+        [samples addObject:sample];
+    }
+    ORKTappingIntervalResult *tappingResult = [[ORKTappingIntervalResult alloc] initWithIdentifier:@"tapping"];
+    tappingResult.samples = samples;
+    tappingResult.stepViewSize = CGSizeMake(320, 480);
+    
+    NSMutableArray<NSNumber *> *timestamps = [NSMutableArray array];
+    NSMutableArray<NSNumber *> *angles = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 1000 * scale; index++) {
+        [timestamps addObject:@(index / 60.0)];
+        [angles addObject:@(90.0 * sin(index / 100.0))];
+    }
+    ORKRangeOfMotionResult *rangeOfMotionResult = [[ORKRangeOfMotionResult alloc] initWithIdentifier:@"rangeOfMotion"];
+    rangeOfMotionResult.timestamps = timestamps;
+    rangeOfMotionResult.angles = angles;
+    
+    [stepResults addObject:[[ORKStepResult alloc] initWithStepIdentifier:@"tapping" results:@[tappingResult]]];
+    [stepResults addObject:[[ORKStepResult alloc] initWithStepIdentifier:@"rangeOfMotion" results:@[rangeOfMotionResult]]];
+    
+    ORKTaskResult *taskResult = [[ORKTaskResult alloc] initWithTaskIdentifier:@"benchmark" taskRunUUID:[NSUUID UUID] outputDirectory:nil];
+    taskResult.startDate = startDate;
+    taskResult.endDate = [startDate dateByAddingTimeInterval:3600];
+    taskResult.results = stepResults;
+    return taskResult;
+}
+
+#pragma mark - Formats
+
++ (NSArray<ORKSerializationBenchmarkFormat *> *)formats {
+    ORKSerializationBenchmarkEncodeBlock encodeJSON = ^NSData *(id object, NSError **error) {
+        return [ORKESerializer JSONDataForObject:object error:error];
+    };
+    
+    ORKSerializationBenchmarkFormat *json = [ORKSerializationBenchmarkFormat formatWithName:@"json" encodeBlock:encodeJSON decodeBlock:^id(NSData *data, __unused Class objectClass, ORKESerializationContext *context, NSError **error) {
+        return ORKSerializationBenchmarkObjectFromJSONData(data, context, error);
+    }];
+    
+    ORKSerializationBenchmarkFormat *jsonParallel = [ORKSerializationBenchmarkFormat formatWithName:@"json-parallel-decode" encodeBlock:encodeJSON decodeBlock:^id(NSData *data, __unused Class objectClass, ORKESerializationContext *context, NSError **error) {
+        context.decodesInParallel = YES;
+        return ORKSerializationBenchmarkObjectFromJSONData(data, context, error);
+    }];
+    
+    ORKSerializationBenchmarkFormat *jsonStream = [ORKSerializationBenchmarkFormat formatWithName:@"json-stream" encodeBlock:^NSData *(id object, NSError **error) {
+        NSOutputStream *outputStream = [NSOutputStream outputStreamToMemory];
+        [outputStream open];
+        BOOL success = [ORKESerializer writeJSONForObject:object toOutputStream:outputStream context:nil error:error];
+        NSData *data = [outputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+        [outputStream close];
+        return success ? data : nil;
+    } decodeBlock:json.decodeBlock];
+    
+    ORKSerializationBenchmarkFormat *cbor = [ORKSerializationBenchmarkFormat formatWithName:@"cbor" encodeBlock:^NSData *(id object, NSError **error) {
+        return [ORKESerializer CBORDataForObject:object error:error];
+    } decodeBlock:^id(NSData *data, __unused Class objectClass, ORKESerializationContext *context, NSError **error) {
+        return [ORKESerializer objectFromCBORData:data context:context error:error];
+    }];
+    
+    ORKSerializationBenchmarkFormat *secureCoding = [ORKSerializationBenchmarkFormat formatWithName:@"secure-coding" encodeBlock:^NSData *(id object, NSError **error) {
+        return [NSKeyedArchiver archivedDataWithRootObject:object requiringSecureCoding:YES error:error];
+    } decodeBlock:^id(NSData *data, Class objectClass, __unused ORKESerializationContext *context, NSError **error) {
+        return [NSKeyedUnarchiver unarchivedObjectOfClass:objectClass fromData:data error:error];
+    }];
+    
+    ORKSerializationBenchmarkFormat *taskCatalog = [ORKSerializationBenchmarkFormat formatWithName:@"task-catalog" encodeBlock:^NSData *(id object, NSError **error) {
+        NSDictionary *jsonObject = [ORKESerializer JSONObjectForObject:object error:error];
+        return jsonObject ? [ORKTaskCatalog catalogDataWithTaskJSONObjects:@[jsonObject] error:error] : nil;
+    } decodeBlock:^id(NSData *data, __unused Class objectClass, ORKESerializationContext *context, NSError **error) {
+        ORKTaskCatalog *catalog = [[ORKTaskCatalog alloc] initWithData:data error:error];
+        return [catalog taskAtIndex:0 context:context error:error];
+    }];
+    taskCatalog.objectClass = [ORKOrderedTask class];
+    
+    return @[json, jsonParallel, jsonStream, cbor, secureCoding, taskCatalog];
+}
+
++ (NSArray<NSString *> *)formatNames {
+    return [[self formats] valueForKey:@"name"];
+}
+
+#pragma mark - Round trips
+
++ (NSArray<ORKSerializationBenchmarkFormat *> *)formatsForCase:(ORKSerializationBenchmarkCase *)benchmarkCase {
+    return [[self formats] filteredArrayUsingPredicate:[NSPredicate predicateWithBlock:^BOOL(ORKSerializationBenchmarkFormat *format, __unused NSDictionary *bindings) {
+        return format.objectClass == Nil || [benchmarkCase.object isKindOfClass:format.objectClass];
+    }]];
+}
+
++ (void)enumerateRoundTripsOfCorpus:(NSArray<ORKSerializationBenchmarkCase *> *)corpus
+                         usingBlock:(void (^)(ORKSerializationBenchmarkCase *, NSString *, id))block {
+    for (ORKSerializationBenchmarkCase *benchmarkCase in corpus) {
+        for (ORKSerializationBenchmarkFormat *format in [self formatsForCase:benchmarkCase]) {
+            NSError *error = nil;
+            NSData *data = format.encodeBlock(benchmarkCase.object, &error);
+            if (data == nil) {
+                ORKSerializationBenchmarkRaise(format, benchmarkCase, @"encode", error);
+            }
+            ORKESerializationContext *context = ORKSerializationBenchmarkFreshContext(benchmarkCase.decodingContext);
+            id object = format.decodeBlock(data, [benchmarkCase.object class], context, &error);
+            if (object == nil) {
+                ORKSerializationBenchmarkRaise(format, benchmarkCase, @"decode", error);
+            }
+            block(benchmarkCase, format.name, object);
+        }
+    }
+}
+
+#pragma mark - Measurement
+
++ (NSDictionary<NSString *, id> *)measurementForCase:(ORKSerializationBenchmarkCase *)benchmarkCase format:(ORKSerializationBenchmarkFormat *)format iterations:(NSUInteger)iterations {
+    NSMutableArray<NSNumber *> *encodeTimes = [NSMutableArray array];
+    NSMutableArray<NSNumber *> *decodeTimes = [NSMutableArray array];
+    uint64_t encodePeakMemoryBytes = 0;
+    uint64_t decodePeakMemoryBytes = 0;
+    NSUInteger encodedBytes = 0;
+    
+    for (NSUInteger iteration = 0; iteration < iterations; iteration++) {
+        @autoreleasepool {
+            __block NSData *data = nil;
+            __block NSError *error = nil;
+            double seconds = 0;
+            uint64_t peakMemoryBytes = 0;
+            ORKSerializationBenchmarkMeasure(^{
+                NSError *encodeError = nil;
+                data = format.encodeBlock(benchmarkCase.object, &encodeError);
+                error = encodeError;
+            }, &seconds, &peakMemoryBytes);
+            if (data == nil) {
+                ORKSerializationBenchmarkRaise(format, benchmarkCase, @"encode", error);
+            }
+            [encodeTimes addObject:@(seconds)];
+            encodePeakMemoryBytes = MAX(encodePeakMemoryBytes, peakMemoryBytes);
+            encodedBytes = data.length;
+            
+            __block id object = nil;
+            ORKESerializationContext *context = ORKSerializationBenchmarkFreshContext(benchmarkCase.decodingContext);
+            Class objectClass = [benchmarkCase.object class];
+            ORKSerializationBenchmarkMeasure(^{
+                NSError *decodeError = nil;
+                object = format.decodeBlock(data, objectClass, context, &decodeError);
+                error = decodeError;
+            }, &seconds, &peakMemoryBytes);
+            if (object == nil) {
+                ORKSerializationBenchmarkRaise(format, benchmarkCase, @"decode", error);
+            }
+            [decodeTimes addObject:@(seconds)];
+            decodePeakMemoryBytes = MAX(decodePeakMemoryBytes, peakMemoryBytes);
+        }
+    }
+    
+    double encodeSeconds = ORKSerializationBenchmarkMedian(encodeTimes);
+    double decodeSeconds = ORKSerializationBenchmarkMedian(decodeTimes);
+    double megabytes = encodedBytes / (1024.0 * 1024.0);
+    return @{
+        @"corpus": benchmarkCase.name,
+        @"format": format.name,
+        @"bytes": @(encodedBytes),
+        @"encodeSeconds": @(encodeSeconds),
+        @"decodeSeconds": @(decodeSeconds),
+        @"encodeMegabytesPerSecond": @(megabytes / MAX(encodeSeconds, 1e-9)),
+        @"decodeMegabytesPerSecond": @(megabytes / MAX(decodeSeconds, 1e-9)),
+        @"encodePeakMemoryBytes": @(encodePeakMemoryBytes),
+        @"decodePeakMemoryBytes": @(decodePeakMemoryBytes),
+    };
+}
+
++ (NSDictionary<NSString *, id> *)reportForCorpus:(NSArray<ORKSerializationBenchmarkCase *> *)corpus iterations:(NSUInteger)iterations {
+    NSParameterAssert(iterations > 0);
+    
+    NSMutableArray<NSDictionary *> *measurements = [NSMutableArray array];
+    for (ORKSerializationBenchmarkCase *benchmarkCase in corpus) {
+        for (ORKSerializationBenchmarkFormat *format in [self formatsForCase:benchmarkCase]) {
+            [measurements addObject:[self measurementForCase:benchmarkCase format:format iterations:iterations]];
+        }
+    }
+    
+    NSISO8601DateFormatter *dateFormatter = [[NSISO8601DateFormatter alloc] init];
+    NSProcessInfo *processInfo = [NSProcessInfo processInfo];
+    return @{
+        @"version": @(ORKSerializationBenchmarkReportVersion),
+        @"date": [dateFormatter stringFromDate:[NSDate date]],
+        @"device": @{
+            @"model": ORKSerializationBenchmarkDeviceModel(),
+            @"operatingSystem": processInfo.operatingSystemVersionString,
+            @"activeProcessorCount": @(processInfo.activeProcessorCount),
+        },
+        @"iterations": @(iterations),
+        @"measurements": measurements,
+    };
+}
+
+@end
@@ -0,0 +1,101 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "ORKSerializationBenchmark.h"
+
+@import ResearchKit;
+
+// Set to a file path to run the full benchmark and write its report there.
+static NSString *const ORKSerializationBenchmarkOutputEnvironmentKey = @"ORK_SERIALIZATION_BENCHMARK_OUTPUT";
+
+@interface ORKSerializationBenchmarkTests : XCTestCase
+
+@end
+
+@implementation ORKSerializationBenchmarkTests
+
+- (void)testEveryFormatRoundTripsTheCorpus {
+    NSArray<ORKSerializationBenchmarkCase *> *corpus = [ORKSerializationBenchmark corpusWithScale:1];
+    NSDictionary *report = [ORKSerializationBenchmark reportForCorpus:corpus iterations:1];
+    XCTAssertTrue([NSJSONSerialization isValidJSONObject:report]);
+    
+    NSArray<NSDictionary *> *measurements = report[@"measurements"];
+    for (ORKSerializationBenchmarkCase *benchmarkCase in corpus) {
+        NSArray<NSDictionary *> *caseMeasurements = [measurements filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"corpus == %@", benchmarkCase.name]];
+        XCTAssertTrue([[caseMeasurements valueForKey:@"format"] containsObject:@"json"]);
+        XCTAssertTrue([[caseMeasurements valueForKey:@"format"] containsObject:@"secure-coding"]);
+        for (NSDictionary *measurement in caseMeasurements) {
+            XCTAssertTrue([[ORKSerializationBenchmark formatNames] containsObject:measurement[@"format"]]);
+            XCTAssertGreaterThan([measurement[@"bytes"] unsignedIntegerValue], 0, @"%@", measurement);
+        }
+    }
+}
+
+- (void)testEveryFormatDecodesTheCorpusFaithfully {
+    NSArray<ORKSerializationBenchmarkCase *> *corpus = [ORKSerializationBenchmark corpusWithScale:1];
+    __block NSUInteger localizedRoundTrips = 0;
+    [ORKSerializationBenchmark enumerateRoundTripsOfCorpus:corpus usingBlock:^(ORKSerializationBenchmarkCase *benchmarkCase, NSString *formatName, id decodedObject) {
+        // Secure coding ignores the decoding context, so it returns the localization keys unchanged.
+        if (benchmarkCase.decodingContext == nil || [formatName isEqualToString:@"secure-coding"]) {
+            XCTAssertEqualObjects(decodedObject, benchmarkCase.object, @"%@ %@", benchmarkCase.name, formatName);
+            return;
+        }
+        
+        localizedRoundTrips += 1;
+        ORKOrderedTask *task = decodedObject;
+        ORKInstructionStep *instructionStep = (ORKInstructionStep *)task.steps[0];
+        ORKQuestionStep *questionStep = (ORKQuestionStep *)task.steps[1];
+        ORKTextChoice *choice = ((ORKTextChoiceAnswerFormat *)questionStep.answerFormat).textChoices[0];
+        XCTAssertEqual(task.steps.count, ((ORKOrderedTask *)benchmarkCase.object).steps.count, @"%@", formatName);
+        XCTAssertEqualObjects(instructionStep.title, @"[fr] About the past week", @"%@", formatName);
+        XCTAssertEqualObjects(questionStep.question, @"[fr] How often did symptom 0 bother you?", @"%@", formatName);
+        XCTAssertEqualObjects(choice.text, @"[fr] Never", @"%@", formatName);
+    }];
+    XCTAssertGreaterThan(localizedRoundTrips, 0);
+}
+
+- (void)testBenchmark {
+    NSString *outputPath = [NSProcessInfo processInfo].environment[ORKSerializationBenchmarkOutputEnvironmentKey];
+    XCTSkipUnless(outputPath.length > 0, @"Set %@ to run the serialization benchmark.", ORKSerializationBenchmarkOutputEnvironmentKey);
+    
+    NSDictionary *report = [ORKSerializationBenchmark reportForCorpus:[ORKSerializationBenchmark corpusWithScale:20] iterations:10];
+    NSError *error = nil;
+    NSData *data = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted | NSJSONWritingSortedKeys error:&error];
+    XCTAssertNotNil(data, @"%@", error);
+    XCTAssertTrue([data writeToFile:outputPath options:NSDataWritingAtomic error:&error], @"%@", error);
+    
+    XCTAttachment *attachment = [XCTAttachment attachmentWithUniformTypeIdentifier:@"public.json" name:@"serialization-benchmark.json" payload:data userInfo:nil];
+    attachment.lifetime = XCTAttachmentLifetimeKeepAlways;
+    [self addAttachment:attachment];
+}
+
+@end
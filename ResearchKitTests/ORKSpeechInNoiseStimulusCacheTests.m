@@ -0,0 +1,91 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+@import ResearchKitActiveTask_Private;
+
+@interface ORKSpeechInNoiseStimulusCacheTests : XCTestCase
+
+@end
+
+@implementation ORKSpeechInNoiseStimulusCacheTests
+
+- (AVAudioPCMBuffer *)bufferWithFrameCount:(AVAudioFrameCount)frameCount value:(float (^)(AVAudioFrameCount frame))value {
+    AVAudioFormat *format = [[AVAudioFormat alloc] initStandardFormatWithSampleRate:44100 channels:1];
+    AVAudioPCMBuffer *buffer = [[AVAudioPCMBuffer alloc] initWithPCMFormat:format frameCapacity:frameCount];
+    buffer.frameLength = frameCount;
+    for (AVAudioFrameCount frame = 0; frame < frameCount; frame++) {
+        buffer.floatChannelData[0][frame] = value(frame);
+    }
+    return buffer;
+}
+
+- (void)testMixedStimulusMatchesScalarMix {
+    AVAudioPCMBuffer *speech = [self bufferWithFrameCount:100 value:^float(AVAudioFrameCount frame) { return 0.5f; }];
+    AVAudioPCMBuffer *noise = [self bufferWithFrameCount:300 value:^float(AVAudioFrameCount frame) { return frame * 0.001f; }];
+    AVAudioPCMBuffer *filter = [self bufferWithFrameCount:80 value:^float(AVAudioFrameCount frame) { return 0.25f; }];
+    
+    AVAudioPCMBuffer *mixed = [ORKSpeechInNoiseStimulusCache mixedStimulusWithSpeech:speech noise:noise filter:filter noiseGain:2.0f noiseOffset:50];
+    
+    XCTAssertEqual(mixed.frameLength, speech.frameLength);
+    for (AVAudioFrameCount frame = 0; frame < 80; frame++) {
+        float expected = (0.5f + (frame + 50) * 0.001f * 2.0f) * 0.25f;
+        XCTAssertEqualWithAccuracy(mixed.floatChannelData[0][frame], expected, 1e-6);
+    }
+    // Frames past the filter are passed through unchanged.
+    XCTAssertEqualWithAccuracy(mixed.floatChannelData[0][90], 0.5f, 1e-6);
+    // The inputs are shared by the cache and must not be modified.
+    XCTAssertEqualWithAccuracy(speech.floatChannelData[0][0], 0.5f, 1e-6);
+}
+
+- (void)testCacheReturnsSameBufferAndEvictsToLimit {
+    NSURL *noiseURL = [ORKSpeechInNoiseStimulusCache URLForResourceWithFileName:@"Noise.wav"];
+    NSURL *windowURL = [ORKSpeechInNoiseStimulusCache URLForResourceWithFileName:@"Window.wav"];
+    XCTAssertNotNil(noiseURL);
+    XCTAssertNotNil(windowURL);
+    
+    ORKSpeechInNoiseStimulusCache *cache = [[ORKSpeechInNoiseStimulusCache alloc] init];
+    NSError *error = nil;
+    AVAudioPCMBuffer *noise = [cache bufferForURL:noiseURL error:&error];
+    XCTAssertNotNil(noise, @"%@", error);
+    XCTAssertTrue([cache bufferForURL:noiseURL error:nil] == noise);
+    NSUInteger noiseCost = cache.totalCost;
+    XCTAssertGreaterThan(noiseCost, 0);
+    
+    cache.totalCostLimit = noiseCost;
+    AVAudioPCMBuffer *window = [cache bufferForURL:windowURL error:nil];
+    XCTAssertNotNil(window);
+    // Only the most recently used buffer survives.
+    XCTAssertTrue([cache bufferForURL:windowURL error:nil] == window);
+    XCTAssertFalse([cache bufferForURL:noiseURL error:nil] == noise);
+}
+
+@end
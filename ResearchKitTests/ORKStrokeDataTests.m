@@ -0,0 +1,123 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import XCTest;
+@import ResearchKit_Private;
+@import UIKit;
+
+
+@interface ORKStrokeDataTests : XCTestCase
+
+@end
+
+
+@implementation ORKStrokeDataTests
+
+- (ORKStrokeData *)twoStrokeData {
+    ORKStrokeDataBuilder *builder = [[ORKStrokeDataBuilder alloc] initWithLineWidth:1 lineWidthVariation:3];
+    builder.canvasSize = CGSizeMake(320, 200);
+    [builder beginStrokeWithPoint:(ORKStrokePoint){ CGPointMake(10, 20), 0, 0 }];
+    [builder addPoint:(ORKStrokePoint){ CGPointMake(15.04, 22.96), 0.5, 0.0166 }];
+    [builder addPoint:(ORKStrokePoint){ CGPointMake(30, 40), 1, 0.033 }];
+    [builder beginStrokeWithPoint:(ORKStrokePoint){ CGPointMake(100, 120), 0, 0.5 }];
+    [builder addPoint:(ORKStrokePoint){ CGPointMake(90, 110), 0, 0.52 }];
+    return [builder strokeData];
+}
+
+- (void)testPointsRoundTripQuantized {
+    ORKStrokeData *strokeData = [self twoStrokeData];
+    XCTAssertEqual(strokeData.strokeCount, 2);
+    XCTAssertEqual([strokeData numberOfPointsInStrokeAtIndex:0], 3);
+    XCTAssertEqual([strokeData numberOfPointsInStrokeAtIndex:1], 2);
+    XCTAssertEqualWithAccuracy(strokeData.canvasSize.width, 320, 0.0001);
+    XCTAssertEqualWithAccuracy(strokeData.lineWidthVariation, 3, 0.0001);
+    
+    NSMutableArray<NSValue *> *locations = [NSMutableArray new];
+    NSMutableArray<NSNumber *> *timestamps = [NSMutableArray new];
+    [strokeData enumeratePointsInStrokeAtIndex:0 usingBlock:^(ORKStrokePoint point, BOOL *stop) {
+        [locations addObject:[NSValue valueWithCGPoint:point.location]];
+        [timestamps addObject:@(point.timestamp)];
+    }];
+    XCTAssertEqual(locations.count, 3);
+    XCTAssertEqualWithAccuracy(locations[1].CGPointValue.x, 15.0, 0.0001);
+    XCTAssertEqualWithAccuracy(locations[1].CGPointValue.y, 23.0, 0.0001);
+    XCTAssertEqualWithAccuracy(timestamps[1].doubleValue, 0.017, 0.0001);
+    
+    // Deltas continue across strokes without drift.
+    __block ORKStrokePoint lastPoint;
+    [strokeData enumeratePointsInStrokeAtIndex:1 usingBlock:^(ORKStrokePoint point, BOOL *stop) {
+        lastPoint = point;
+    }];
+    XCTAssertEqualWithAccuracy(lastPoint.location.x, 90, 0.0001);
+    XCTAssertEqualWithAccuracy(lastPoint.location.y, 110, 0.0001);
+    XCTAssertEqualWithAccuracy(lastPoint.timestamp, 0.52, 0.0001);
+    
+    ORKStrokeData *decoded = [[ORKStrokeData alloc] initWithData:strokeData.data];
+    XCTAssertEqualObjects(decoded, strokeData);
+    XCTAssertLessThan(strokeData.data.length, 64);
+}
+
+- (void)testInvalidDataIsRejected {
+    NSData *data = [self twoStrokeData].data;
+    XCTAssertNil([[ORKStrokeData alloc] initWithData:[data subdataWithRange:NSMakeRange(0, data.length - 1)]]);
+    XCTAssertNil([[ORKStrokeData alloc] initWithData:[@"ORKX" dataUsingEncoding:NSUTF8StringEncoding]]);
+    XCTAssertEqual([ORKStrokeData new].strokeCount, 0);
+}
+
+- (void)testBezierPathsSplitOnLineWidthChanges {
+    NSArray<UIBezierPath *> *paths = [[self twoStrokeData] bezierPaths];
+    // The first stroke changes width twice; the second keeps one width.
+    XCTAssertEqual(paths.count, 4);
+    XCTAssertEqualWithAccuracy(paths.firstObject.lineWidth, 1, 0.0001);
+    XCTAssertEqualWithAccuracy(paths[2].lineWidth, 4, 0.0001);
+    
+    UIImage *image = [[self twoStrokeData] imageWithLineColor:[UIColor blackColor]];
+    XCTAssertEqual(image.size.width, 320);
+    XCTAssertEqual(image.size.height, 200);
+}
+
+- (void)testSignatureResultSecureCoding {
+    ORKStrokeData *strokeData = [self twoStrokeData];
+    ORKSignatureResult *result = [[ORKSignatureResult alloc] initWithIdentifier:@"signature" strokeData:strokeData];
+    XCTAssertEqual(result.signaturePath.count, 4);
+    XCTAssertNotNil(result.signatureImage);
+    
+    NSError *error = nil;
+    NSData *archive = [NSKeyedArchiver archivedDataWithRootObject:result requiringSecureCoding:YES error:&error];
+    XCTAssertNil(error);
+    ORKSignatureResult *decoded = [NSKeyedUnarchiver unarchivedObjectOfClass:[ORKSignatureResult class] fromData:archive error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(decoded, result);
+    XCTAssertEqualObjects(decoded.strokeData, strokeData);
+    XCTAssertEqual(decoded.signaturePath.count, 4);
+}
+
+@end
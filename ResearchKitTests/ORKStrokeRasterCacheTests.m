@@ -0,0 +1,106 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import XCTest;
+@import ResearchKitUI_Private;
+@import UIKit;
+
+
+@interface ORKStrokeRasterCacheTests : XCTestCase
+
+@end
+
+
+@implementation ORKStrokeRasterCacheTests
+
+- (UIBezierPath *)horizontalStrokeAtY:(CGFloat)y lineWidth:(CGFloat)lineWidth {
+    UIBezierPath *path = [UIBezierPath bezierPath];
+    path.lineWidth = lineWidth;
+    path.lineCapStyle = kCGLineCapRound;
+    [path moveToPoint:CGPointMake(10, y)];
+    [path addLineToPoint:CGPointMake(90, y)];
+    return path;
+}
+
+// Returns the alpha of each pixel of the image, top row first.
+- (NSData *)alphaOfImage:(UIImage *)image {
+    size_t width = (size_t)image.size.width;
+    size_t height = (size_t)image.size.height;
+    NSMutableData *data = [NSMutableData dataWithLength:width * height];
+    CGContextRef context = CGBitmapContextCreate(data.mutableBytes, width, height, 8, width, NULL, (CGBitmapInfo)kCGImageAlphaOnly);
+    CGContextDrawImage(context, CGRectMake(0, 0, width, height), image.CGImage);
+    CGContextRelease(context);
+    return data;
+}
+
+- (uint8_t)alphaAtX:(NSUInteger)x y:(NSUInteger)y inData:(NSData *)data width:(NSUInteger)width {
+    return ((const uint8_t *)data.bytes)[y * width + x];
+}
+
+- (void)testStrokesAreRasterizedAcrossTiles {
+    ORKStrokeRasterCache *cache = [[ORKStrokeRasterCache alloc] initWithTileSize:32];
+    [cache resetWithCanvasSize:CGSizeMake(100, 100) scale:2];
+    [cache addStroke:[self horizontalStrokeAtY:50 lineWidth:4]];
+    [cache addStroke:[self horizontalStrokeAtY:20 lineWidth:1]];
+    XCTAssertEqual(cache.strokeCount, 2);
+    XCTAssertTrue([cache isValidForCanvasSize:CGSizeMake(100, 100) scale:2 strokeCount:2]);
+    XCTAssertFalse([cache isValidForCanvasSize:CGSizeMake(100, 100) scale:3 strokeCount:2]);
+    
+    UIImage *image = [cache imageWithColor:[UIColor blackColor]];
+    XCTAssertEqual(image.size.width, 100);
+    XCTAssertEqual(image.size.height, 100);
+    
+    NSData *alpha = [self alphaOfImage:image];
+    // The stroke spans tiles in three columns.
+    XCTAssertEqual([self alphaAtX:20 y:50 inData:alpha width:100], 255);
+    XCTAssertEqual([self alphaAtX:50 y:50 inData:alpha width:100], 255);
+    XCTAssertEqual([self alphaAtX:80 y:50 inData:alpha width:100], 255);
+    // Each stroke keeps its own width.
+    XCTAssertEqual([self alphaAtX:50 y:48 inData:alpha width:100], 255);
+    XCTAssertEqual([self alphaAtX:50 y:22 inData:alpha width:100], 0);
+    // Away from the strokes, and beyond the round caps.
+    XCTAssertEqual([self alphaAtX:50 y:80 inData:alpha width:100], 0);
+    XCTAssertEqual([self alphaAtX:96 y:50 inData:alpha width:100], 0);
+}
+
+- (void)testRemoveAllStrokesKeepsGeometry {
+    ORKStrokeRasterCache *cache = [ORKStrokeRasterCache new];
+    [cache resetWithCanvasSize:CGSizeMake(100, 100) scale:2];
+    [cache addStroke:[self horizontalStrokeAtY:50 lineWidth:4]];
+    [cache removeAllStrokes];
+    
+    XCTAssertEqual(cache.strokeCount, 0);
+    XCTAssertTrue([cache isValidForCanvasSize:CGSizeMake(100, 100) scale:2 strokeCount:0]);
+    NSData *alpha = [self alphaOfImage:[cache imageWithColor:[UIColor blackColor]]];
+    XCTAssertEqual([self alphaAtX:50 y:50 inData:alpha width:100], 0);
+}
+
+@end
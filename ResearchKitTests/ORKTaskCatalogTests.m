@@ -0,0 +1,147 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import XCTest;
+@import ResearchKit;
+@import ResearchKitActiveTask;
+
+@interface ORKTaskCatalogTests : XCTestCase
+
+@end
+
+@implementation ORKTaskCatalogTests
+
+- (NSArray<ORKOrderedTask *> *)tasks {
+    ORKInstructionStep *instruction = [[ORKInstructionStep alloc] initWithIdentifier:@"intro"];
+    instruction.title = @"Welcome";
+    instruction.text = @"Answer a few questions.";
+    ORKQuestionStep *question = [ORKQuestionStep questionStepWithIdentifier:@"sleep"
+                                                                      title:@"Sleep"
+                                                                   question:@"Did you sleep well?"
+                                                                     answer:[ORKAnswerFormat booleanAnswerFormat]];
+    ORKInstructionStep *untitled = [[ORKInstructionStep alloc] initWithIdentifier:@"untitled"];
+    ORKNavigableOrderedTask *navigable = [[ORKNavigableOrderedTask alloc] initWithIdentifier:@"nävigable" steps:@[question, untitled]];
+    [navigable setNavigationRule:[[ORKDirectStepNavigationRule alloc] initWithDestinationStepIdentifier:ORKNullStepIdentifier] forTriggerStepIdentifier:@"sleep"];
+    return @[[[ORKOrderedTask alloc] initWithIdentifier:@"survey" steps:@[instruction, question]],
+             [[ORKOrderedTask alloc] initWithIdentifier:@"empty" steps:@[]],
+             navigable];
+}
+
+- (ORKTaskCatalog *)catalogWithTasks:(NSArray<ORKOrderedTask *> *)tasks {
+    NSMutableArray<NSDictionary *> *taskJSONObjects = [NSMutableArray array];
+    for (ORKOrderedTask *task in tasks) {
+        NSError *error = nil;
+        NSDictionary *JSONObject = [ORKESerializer JSONObjectForObject:task error:&error];
+        XCTAssertNotNil(JSONObject, @"%@", error);
+        [taskJSONObjects addObject:JSONObject];
+    }
+    NSError *error = nil;
+    NSData *data = [ORKTaskCatalog catalogDataWithTaskJSONObjects:taskJSONObjects error:&error];
+    XCTAssertNotNil(data, @"%@", error);
+    ORKTaskCatalog *catalog = [[ORKTaskCatalog alloc] initWithData:data error:&error];
+    XCTAssertNotNil(catalog, @"%@", error);
+    return catalog;
+}
+
+- (void)testIndexDescribesTasksWithoutDecoding {
+    ORKTaskCatalog *catalog = [self catalogWithTasks:[self tasks]];
+    
+    XCTAssertEqual(catalog.numberOfTasks, 3);
+    XCTAssertEqualObjects([catalog identifierOfTaskAtIndex:0], @"survey");
+    XCTAssertEqualObjects([catalog identifierOfTaskAtIndex:2], @"nävigable");
+    XCTAssertEqual([catalog indexOfTaskWithIdentifier:@"nävigable"], 2);
+    XCTAssertEqual([catalog indexOfTaskWithIdentifier:@"missing"], NSNotFound);
+    
+    XCTAssertEqual([catalog numberOfStepsInTaskAtIndex:0], 2);
+    XCTAssertEqual([catalog numberOfStepsInTaskAtIndex:1], 0);
+    XCTAssertEqualObjects([catalog identifierOfStepAtIndex:1 inTaskAtIndex:0], @"sleep");
+    XCTAssertEqualObjects([catalog titleOfStepAtIndex:0 inTaskAtIndex:0], @"Welcome");
+    XCTAssertEqualObjects([catalog titleOfStepAtIndex:0 inTaskAtIndex:2], @"Sleep");
+    XCTAssertNil([catalog titleOfStepAtIndex:1 inTaskAtIndex:2]);
+    XCTAssertThrows([catalog identifierOfStepAtIndex:2 inTaskAtIndex:0]);
+    XCTAssertThrows([catalog identifierOfTaskAtIndex:3]);
+}
+
+- (void)testIdentifierLookupDoesNotStopAtNul {
+    ORKInstructionStep *step = [[ORKInstructionStep alloc] initWithIdentifier:@"intro"];
+    ORKTaskCatalog *catalog = [self catalogWithTasks:@[[[ORKOrderedTask alloc] initWithIdentifier:@"a\0b" steps:@[step]],
+                                                       [[ORKOrderedTask alloc] initWithIdentifier:@"a" steps:@[step]]]];
+    
+    XCTAssertEqual([catalog indexOfTaskWithIdentifier:@"a\0b"], 0);
+    XCTAssertEqual([catalog indexOfTaskWithIdentifier:@"a"], 1);
+    XCTAssertEqual([catalog indexOfTaskWithIdentifier:@"a\0c"], NSNotFound);
+}
+
+- (void)testDecodedTasksMatchOriginals {
+    NSArray<ORKOrderedTask *> *tasks = [self tasks];
+    ORKTaskCatalog *catalog = [self catalogWithTasks:tasks];
+    
+    for (NSUInteger index = 0; index < tasks.count; index++) {
+        NSError *error = nil;
+        ORKOrderedTask *task = [catalog taskAtIndex:index context:nil error:&error];
+        XCTAssertNotNil(task, @"%@", error);
+        XCTAssertEqualObjects(task, tasks[index]);
+    }
+    
+    NSError *error = nil;
+    ORKStep *step = [catalog stepAtIndex:1 inTaskAtIndex:0 context:nil error:&error];
+    XCTAssertNotNil(step, @"%@", error);
+    XCTAssertEqualObjects(step, tasks[0].steps[1]);
+}
+
+- (void)testMappedFileRoundTrip {
+    NSArray<ORKOrderedTask *> *tasks = [self tasks];
+    NSURL *fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString]];
+    NSError *error = nil;
+    XCTAssertTrue([ORKTaskCatalog writeCatalogWithTaskJSONObjects:@[[ORKESerializer JSONObjectForObject:tasks[0] error:nil]] toFileAtURL:fileURL error:&error], @"%@", error);
+    
+    ORKTaskCatalog *catalog = [[ORKTaskCatalog alloc] initWithContentsOfURL:fileURL error:&error];
+    XCTAssertNotNil(catalog, @"%@", error);
+    XCTAssertEqualObjects([catalog taskAtIndex:0 context:nil error:nil], tasks[0]);
+    [[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+}
+
+- (void)testInvalidCatalogsAreRejected {
+    NSError *error = nil;
+    XCTAssertNil([[ORKTaskCatalog alloc] initWithData:[@"not a catalog" dataUsingEncoding:NSUTF8StringEncoding] error:&error]);
+    XCTAssertEqual(error.code, ORKErrorInvalidObject);
+    
+    NSData *data = [ORKTaskCatalog catalogDataWithTaskJSONObjects:@[[ORKESerializer JSONObjectForObject:[self tasks][0] error:nil]] error:nil];
+    error = nil;
+    XCTAssertNil([[ORKTaskCatalog alloc] initWithData:[data subdataWithRange:NSMakeRange(0, data.length - 1)] error:&error]);
+    XCTAssertNotNil(error);
+    
+    error = nil;
+    XCTAssertNil([ORKTaskCatalog catalogDataWithTaskJSONObjects:@[@{@"identifier": @"task"}] error:&error]);
+    XCTAssertNotNil(error);
+}
+
+@end
@@ -0,0 +1,112 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <XCTest/XCTest.h>
+
+@import ResearchKit;
+
+@interface ORKTaskDefinitionCacheTests : XCTestCase
+
+@end
+
+@implementation ORKTaskDefinitionCacheTests
+
+- (NSData *)archivedTask {
+    NSArray<ORKTextChoice *> *choices = @[[[ORKTextChoice alloc] initWithText:@"Yes" detailText:nil value:@(1) exclusive:NO],
+                                          [[ORKTextChoice alloc] initWithText:@"No" detailText:nil value:@(0) exclusive:YES]];
+    ORKQuestionStep *step = [ORKQuestionStep questionStepWithIdentifier:@"question"
+                                                                  title:@"Question"
+                                                               question:@"Did you sleep well?"
+                                                                 answer:[ORKAnswerFormat choiceAnswerFormatWithStyle:ORKChoiceAnswerStyleSingleChoice textChoices:choices]];
+    ORKOrderedTask *task = [[ORKOrderedTask alloc] initWithIdentifier:@"task" steps:@[step]];
+    NSError *error = nil;
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:task requiringSecureCoding:YES error:&error];
+    XCTAssertNotNil(data, @"%@", error);
+    return data;
+}
+
+- (NSArray<ORKTextChoice *> *)textChoicesOfTask:(ORKOrderedTask *)task {
+    ORKQuestionStep *step = (ORKQuestionStep *)task.steps.firstObject;
+    return ((ORKTextChoiceAnswerFormat *)step.answerFormat).textChoices;
+}
+
+- (void)testCachedTasksAreEqualButIndependent {
+    ORKTaskDefinitionCache *cache = [[ORKTaskDefinitionCache alloc] init];
+    NSData *data = [self archivedTask];
+    
+    NSError *error = nil;
+    ORKOrderedTask *task1 = [cache orderedTaskWithArchivedData:data error:&error];
+    XCTAssertNotNil(task1, @"%@", error);
+    ORKOrderedTask *task2 = [cache orderedTaskWithArchivedData:[data mutableCopy] error:&error];
+    XCTAssertNotNil(task2, @"%@", error);
+    
+    XCTAssertEqualObjects(task1, task2);
+    XCTAssertNotEqual(task1, task2);
+    XCTAssertNotEqual(task1.steps.firstObject, task2.steps.firstObject);
+    XCTAssertEqual([self textChoicesOfTask:task1].firstObject, [self textChoicesOfTask:task2].firstObject);
+}
+
+- (void)testDecodedTextChoicesAreNotShared {
+    NSData *data = [self archivedTask];
+    ORKOrderedTask *task1 = [NSKeyedUnarchiver unarchivedObjectOfClass:[ORKOrderedTask class] fromData:data error:nil];
+    ORKOrderedTask *task2 = [NSKeyedUnarchiver unarchivedObjectOfClass:[ORKOrderedTask class] fromData:data error:nil];
+    
+    XCTAssertNotEqual(task1, task2);
+    XCTAssertEqualObjects([self textChoicesOfTask:task1], [self textChoicesOfTask:task2]);
+    XCTAssertNotEqual([self textChoicesOfTask:task1][1], [self textChoicesOfTask:task2][1]);
+    
+    // `image` is readwrite, so setting it on one decoded task must not change the other.
+    [self textChoicesOfTask:task1][1].image = [UIImage new];
+    XCTAssertNil([self textChoicesOfTask:task2][1].image);
+}
+
+- (void)testDecodedColorChoicesAreShared {
+    NSArray<ORKColorChoice *> *choices = @[[[ORKColorChoice alloc] initWithColor:UIColor.redColor text:@"Red" detailText:nil value:@"red"]];
+    NSError *error = nil;
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:choices requiringSecureCoding:YES error:&error];
+    XCTAssertNotNil(data, @"%@", error);
+    
+    NSSet *classes = [NSSet setWithObjects:[NSArray class], [ORKColorChoice class], nil];
+    NSArray<ORKColorChoice *> *choices1 = [NSKeyedUnarchiver unarchivedObjectOfClasses:classes fromData:data error:&error];
+    NSArray<ORKColorChoice *> *choices2 = [NSKeyedUnarchiver unarchivedObjectOfClasses:classes fromData:data error:&error];
+    XCTAssertEqualObjects(choices1, choices);
+    XCTAssertEqual(choices1.firstObject, choices2.firstObject);
+}
+
+- (void)testInvalidArchiveReportsError {
+    ORKTaskDefinitionCache *cache = [[ORKTaskDefinitionCache alloc] init];
+    NSError *error = nil;
+    ORKOrderedTask *task = [cache orderedTaskWithArchivedData:[@"not an archive" dataUsingEncoding:NSUTF8StringEncoding] error:&error];
+    XCTAssertNil(task);
+    XCTAssertNotNil(error);
+}
+
+@end
@@ -0,0 +1,136 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+@import ResearchKitActiveTask_Private;
+
+static double ORKMinimumJerkPosition(double tau) {
+    return 10 * pow(tau, 3) - 15 * pow(tau, 4) + 6 * pow(tau, 5);
+}
+
+@interface ORKTouchAbilityFeatureExtractorTests : XCTestCase
+
+@end
+
+@implementation ORKTouchAbilityFeatureExtractorTests
+
+- (void)testConstantVelocityLine {
+    double t[101], x[101], y[101];
+    for (int i = 0; i < 101; i++) {
+        t[i] = i / 100.0;
+        x[i] = 100 * t[i];
+        y[i] = 50;
+    }
+    ORKTouchAbilityKinematicProfile profile = ORKTouchAbilityKinematicProfileMake(t, x, y, 101);
+    XCTAssertEqualWithAccuracy(profile.duration, 1, 1e-9);
+    XCTAssertEqualWithAccuracy(profile.pathLength, 100, 1e-6);
+    XCTAssertEqualWithAccuracy(profile.displacement, 100, 1e-6);
+    XCTAssertEqualWithAccuracy(profile.peakSpeed, 100, 1e-6);
+    XCTAssertEqualWithAccuracy(profile.peakAcceleration, 0, 1e-3);
+    XCTAssertEqual(profile.speedPeakCount, 1);
+}
+
+- (void)testOneDimensionalTrajectory {
+    double t[101], x[101];
+    for (int i = 0; i < 101; i++) {
+        t[i] = i / 100.0;
+        x[i] = t[i] * t[i];
+    }
+    ORKTouchAbilityKinematicProfile profile = ORKTouchAbilityKinematicProfileMake(t, x, NULL, 101);
+    XCTAssertEqualWithAccuracy(profile.pathLength, 1, 1e-9);
+    XCTAssertEqualWithAccuracy(profile.peakSpeed, 1.99, 1e-6);
+    XCTAssertEqualWithAccuracy(profile.peakAcceleration, 2, 1e-6);
+}
+
+- (void)testTremorIsLessSmoothThanMinimumJerkReach {
+    double t[101], smooth[101], tremor[101];
+    for (int i = 0; i < 101; i++) {
+        t[i] = i / 100.0;
+        smooth[i] = 100 * ORKMinimumJerkPosition(t[i]);
+        tremor[i] = smooth[i] + 2 * sin(2 * M_PI * 8 * t[i]);
+    }
+    ORKTouchAbilityKinematicProfile smoothProfile = ORKTouchAbilityKinematicProfileMake(t, smooth, NULL, 101);
+    ORKTouchAbilityKinematicProfile tremorProfile = ORKTouchAbilityKinematicProfileMake(t, tremor, NULL, 101);
+    
+    XCTAssertTrue(smoothProfile.hasLogDimensionlessJerk);
+    XCTAssertTrue(tremorProfile.hasLogDimensionlessJerk);
+    XCTAssertEqualWithAccuracy(smoothProfile.peakSpeed, 187.5, 0.5);
+    XCTAssertEqual(smoothProfile.speedPeakCount, 1);
+    XCTAssertGreaterThan(tremorProfile.speedPeakCount, 1);
+    XCTAssertGreaterThan(smoothProfile.logDimensionlessJerk, tremorProfile.logDimensionlessJerk);
+}
+
+- (void)testSubmovementsAreCounted {
+    double t[201], x[201];
+    for (int i = 0; i < 201; i++) {
+        t[i] = i / 100.0;
+        x[i] = t[i] <= 1 ? 50 * ORKMinimumJerkPosition(t[i]) : 50 + 50 * ORKMinimumJerkPosition(t[i] - 1);
+    }
+    ORKTouchAbilityKinematicProfile profile = ORKTouchAbilityKinematicProfileMake(t, x, NULL, 201);
+    XCTAssertEqual(profile.speedPeakCount, 2);
+    XCTAssertEqualWithAccuracy(profile.pathLength, 100, 1e-6);
+}
+
+- (void)testTooFewSamples {
+    double t[1] = {0}, x[1] = {3}, y[1] = {4};
+    ORKTouchAbilityKinematicProfile profile = ORKTouchAbilityKinematicProfileMake(t, x, y, 1);
+    XCTAssertEqual(profile.pathLength, 0);
+    XCTAssertFalse(profile.hasLogDimensionlessJerk);
+}
+
+- (void)testLinearFit {
+    double x[5] = {0, 1, 2, 3, 4};
+    double line[5] = {1, 3, 5, 7, 9};
+    double constant[5] = {2, 2, 2, 2, 2};
+    double noisy[5] = {0, 2, 1, 3, 2};
+    XCTAssertEqualWithAccuracy(ORKTouchAbilityLinearFitCoefficientOfDetermination(x, line, 5), 1, 1e-12);
+    XCTAssertEqual(ORKTouchAbilityLinearFitCoefficientOfDetermination(x, constant, 5), 1);
+    XCTAssertEqualWithAccuracy(ORKTouchAbilityLinearFitCoefficientOfDetermination(x, noisy, 5), 25.0 / 52.0, 1e-12);
+    XCTAssertTrue(isnan(ORKTouchAbilityLinearFitCoefficientOfDetermination(constant, line, 5)));
+}
+
+- (void)testTrialWithoutTracks {
+    ORKTouchAbilityPinchTrial *trial = [[ORKTouchAbilityPinchTrial alloc] initWithTargetScale:2];
+    trial.resultScale = 1.5;
+    ORKTouchAbilityKinematicFeatures *features = [ORKTouchAbilityFeatureExtractor kinematicFeaturesForTrial:trial trackStore:[ORKTouchAbilityTrackStore new]];
+    XCTAssertEqual(features.pathLength, 0);
+    XCTAssertEqualWithAccuracy(features.targetError.doubleValue, 0.25, 1e-12);
+    XCTAssertNil(features.scaleLinearity);
+    XCTAssertNil(features.rotationSmoothness);
+    
+    NSError *error = nil;
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:features requiringSecureCoding:YES error:&error];
+    XCTAssertNotNil(data, @"%@", error);
+    ORKTouchAbilityKinematicFeatures *decoded = [NSKeyedUnarchiver unarchivedObjectOfClass:[ORKTouchAbilityKinematicFeatures class] fromData:data error:&error];
+    XCTAssertEqualObjects(decoded, features);
+}
+
+@end
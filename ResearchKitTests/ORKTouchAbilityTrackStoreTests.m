@@ -0,0 +1,329 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+@import ResearchKitActiveTask_Private;
+
+@interface ORKTouchAbilityTrackStoreTestsTouch : UITouch
+
+@property (nonatomic) NSTimeInterval mockTimestamp;
+@property (nonatomic) CGPoint mockLocation;
+@property (nonatomic) CGFloat mockForce;
+@property (nonatomic) CGFloat mockMajorRadius;
+@property (nonatomic) UITouchPhase mockPhase;
+
+@end
+
+
+@implementation ORKTouchAbilityTrackStoreTestsTouch
+
+- (NSTimeInterval)timestamp {
+    return self.mockTimestamp;
+}
+
+- (CGPoint)locationInView:(UIView *)view {
+    return self.mockLocation;
+}
+
+- (CGPoint)previousLocationInView:(UIView *)view {
+    return self.mockLocation;
+}
+
+- (CGPoint)preciseLocationInView:(UIView *)view {
+    return self.mockLocation;
+}
+
+- (CGPoint)precisePreviousLocationInView:(UIView *)view {
+    return self.mockLocation;
+}
+
+- (CGFloat)force {
+    return self.mockForce;
+}
+
+- (CGFloat)maximumPossibleForce {
+    return 1;
+}
+
+- (CGFloat)majorRadius {
+    return self.mockMajorRadius;
+}
+
+- (CGFloat)majorRadiusTolerance {
+    return 0;
+}
+
+- (CGFloat)azimuthAngleInView:(UIView *)view {
+    return 0;
+}
+
+- (CGVector)azimuthUnitVectorInView:(UIView *)view {
+    return CGVectorMake(1, 0);
+}
+
+- (CGFloat)altitudeAngle {
+    return M_PI_2;
+}
+
+- (NSUInteger)tapCount {
+    return 1;
+}
+
+- (NSNumber *)estimationUpdateIndex {
+    return nil;
+}
+
+- (UITouchProperties)estimatedProperties {
+    return 0;
+}
+
+- (UITouchProperties)estimatedPropertiesExpectingUpdates {
+    return 0;
+}
+
+- (UITouchPhase)phase {
+    return self.mockPhase;
+}
+
+- (UITouchType)type {
+    return UITouchTypeDirect;
+}
+
+@end
+
+
+// Encodes the keys of a track store archive with arbitrary sample counts and column lengths.
+@interface ORKTouchAbilityTrackStoreTestsArchive : NSObject <NSSecureCoding>
+
+@property (nonatomic, copy) NSArray<NSNumber *> *sampleCounts;
+@property (nonatomic) NSUInteger columnSampleCount;
+
+@end
+
+
+@implementation ORKTouchAbilityTrackStoreTestsArchive
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    [aCoder encodeObject:self.sampleCounts forKey:@"trackSampleCounts"];
+    NSDictionary<NSString *, NSNumber *> *columnSizes = @{
+        @"timestamp": @(sizeof(NSTimeInterval)),
+        @"location": @(sizeof(CGPoint)),
+        @"previousLocation": @(sizeof(CGPoint)),
+        @"preciseLocation": @(sizeof(CGPoint)),
+        @"precisePreviousLocation": @(sizeof(CGPoint)),
+        @"force": @(sizeof(CGFloat)),
+        @"maximumPossibleForce": @(sizeof(CGFloat)),
+        @"majorRadius": @(sizeof(CGFloat)),
+        @"majorRadiusTolerance": @(sizeof(CGFloat)),
+        @"azimuthAngle": @(sizeof(CGFloat)),
+        @"azimuthUnitVector": @(sizeof(CGVector)),
+        @"altitudeAngle": @(sizeof(CGFloat)),
+        @"tapCount": @(sizeof(NSUInteger)),
+        @"estimationUpdateIndex": @(sizeof(int64_t)),
+        @"estimatedProperties": @(sizeof(uint32_t)),
+        @"estimatedPropertiesExpectingUpdates": @(sizeof(uint32_t)),
+        @"phase": @(sizeof(uint8_t)),
+        @"type": @(sizeof(uint8_t)),
+    };
+    [columnSizes enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSNumber *size, BOOL *stop) {
+        [aCoder encodeObject:[NSMutableData dataWithLength:self.columnSampleCount * size.unsignedIntegerValue] forKey:key];
+    }];
+}
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+    return nil;
+}
+
+@end
+
+
+@interface ORKTouchAbilityTrackStoreTests : XCTestCase
+
+@end
+
+
+@implementation ORKTouchAbilityTrackStoreTests
+
+- (ORKTouchAbilityTrackStoreTestsTouch *)touchAtTimestamp:(NSTimeInterval)timestamp location:(CGPoint)location phase:(UITouchPhase)phase {
+    ORKTouchAbilityTrackStoreTestsTouch *touch = [ORKTouchAbilityTrackStoreTestsTouch new];
+    touch.mockTimestamp = timestamp;
+    touch.mockLocation = location;
+    touch.mockForce = timestamp / 10;
+    touch.mockMajorRadius = 20 + timestamp;
+    touch.mockPhase = phase;
+    return touch;
+}
+
+// Records one track of four samples: the began sample, one uncoalesced move and two coalesced moves.
+- (ORKTouchAbilityTrackStore *)storeWithOneTrackForTouch:(ORKTouchAbilityTrackStoreTestsTouch *)touch {
+    ORKTouchAbilityTrackStore *store = [ORKTouchAbilityTrackStore new];
+    [store beginTrackWithTouch:touch];
+    
+    touch.mockTimestamp = 1;
+    touch.mockLocation = CGPointMake(11, 22);
+    touch.mockPhase = UITouchPhaseMoved;
+    [store appendTouch:touch coalescedTouches:nil];
+    
+    NSArray<UITouch *> *coalescedTouches = @[[self touchAtTimestamp:2 location:CGPointMake(12, 24) phase:UITouchPhaseMoved],
+                                             [self touchAtTimestamp:3 location:CGPointMake(13, 26) phase:UITouchPhaseMoved]];
+    touch.mockTimestamp = 3;
+    touch.mockLocation = CGPointMake(13, 26);
+    [store appendTouch:touch coalescedTouches:coalescedTouches];
+    return store;
+}
+
+- (void)testAppendRecordsEverySample {
+    ORKTouchAbilityTrackStoreTestsTouch *touch = [self touchAtTimestamp:0 location:CGPointMake(10, 20) phase:UITouchPhaseBegan];
+    ORKTouchAbilityTrackStore *store = [self storeWithOneTrackForTouch:touch];
+    
+    XCTAssertEqual(store.trackCount, 1);
+    XCTAssertEqual([store sampleCountOfTrackAtIndex:0], 4);
+    
+    const NSTimeInterval *timestamps = [store timestampsOfTrackAtIndex:0];
+    const CGPoint *locations = [store locationsOfTrackAtIndex:0];
+    const CGFloat *forces = [store forcesOfTrackAtIndex:0];
+    const CGFloat *majorRadii = [store majorRadiiOfTrackAtIndex:0];
+    const uint8_t *phases = [store phasesOfTrackAtIndex:0];
+    for (NSUInteger index = 0; index < 4; index++) {
+        // Timestamps are shifted from system uptime to UNIX time by a constant offset.
+        XCTAssertEqualWithAccuracy(timestamps[index] - timestamps[0], index, 1e-9);
+        XCTAssertEqual(locations[index].x, 10 + index);
+        XCTAssertEqual(locations[index].y, 20 + 2 * index);
+        XCTAssertEqual(phases[index], index == 0 ? UITouchPhaseBegan : UITouchPhaseMoved);
+    }
+    XCTAssertEqualWithAccuracy(forces[0], 0, 1e-12);
+    XCTAssertEqualWithAccuracy(forces[3], 0.3, 1e-12);
+    XCTAssertEqualWithAccuracy(majorRadii[0], 20, 1e-12);
+    XCTAssertEqualWithAccuracy(majorRadii[3], 23, 1e-12);
+}
+
+- (void)testEndedTouchClosesItsTrack {
+    ORKTouchAbilityTrackStoreTestsTouch *touch = [self touchAtTimestamp:0 location:CGPointMake(10, 20) phase:UITouchPhaseBegan];
+    ORKTouchAbilityTrackStore *store = [self storeWithOneTrackForTouch:touch];
+    
+    touch.mockTimestamp = 4;
+    touch.mockPhase = UITouchPhaseEnded;
+    [store appendTouch:touch coalescedTouches:nil];
+    XCTAssertEqual([store sampleCountOfTrackAtIndex:0], 5);
+    
+    // Further samples for an ended touch are ignored, as are touches that never began a track.
+    [store appendTouch:touch coalescedTouches:nil];
+    [store appendTouch:[self touchAtTimestamp:5 location:CGPointZero phase:UITouchPhaseMoved] coalescedTouches:nil];
+    XCTAssertEqual(store.trackCount, 1);
+    XCTAssertEqual([store sampleCountOfTrackAtIndex:0], 5);
+    
+    [store beginTrackWithTouch:[self touchAtTimestamp:6 location:CGPointMake(1, 2) phase:UITouchPhaseBegan]];
+    XCTAssertEqual(store.trackCount, 2);
+    XCTAssertEqual([store sampleCountOfTrackAtIndex:1], 1);
+    XCTAssertEqual([store locationsOfTrackAtIndex:1][0].x, 1);
+    
+    [store removeAllTracks];
+    XCTAssertEqual(store.trackCount, 0);
+    XCTAssertEqual(store.tracks.count, 0);
+}
+
+- (void)testTracksMatchColumns {
+    ORKTouchAbilityTrackStoreTestsTouch *touch = [self touchAtTimestamp:0 location:CGPointMake(10, 20) phase:UITouchPhaseBegan];
+    ORKTouchAbilityTrackStore *store = [self storeWithOneTrackForTouch:touch];
+    
+    NSArray<ORKTouchAbilityTouch *> *touches = store.tracks.firstObject.touches;
+    XCTAssertEqual(touches.count, 4);
+    for (NSUInteger index = 0; index < touches.count; index++) {
+        XCTAssertEqual(touches[index].timestamp, [store timestampsOfTrackAtIndex:0][index]);
+        XCTAssertTrue(CGPointEqualToPoint(touches[index].locationInWindow, [store locationsOfTrackAtIndex:0][index]));
+        XCTAssertEqual(touches[index].phase, [store phasesOfTrackAtIndex:0][index]);
+    }
+    
+    // Samples appended after a read are added to a new track object.
+    touch.mockTimestamp = 4;
+    [store appendTouch:touch coalescedTouches:nil];
+    XCTAssertEqual(store.tracks.firstObject.touches.count, 5);
+}
+
+- (void)testSecureCodingRoundTrip {
+    ORKTouchAbilityTrackStoreTestsTouch *touch = [self touchAtTimestamp:0 location:CGPointMake(10, 20) phase:UITouchPhaseBegan];
+    ORKTouchAbilityTrackStore *store = [self storeWithOneTrackForTouch:touch];
+    [store beginTrackWithTouch:[self touchAtTimestamp:6 location:CGPointMake(1, 2) phase:UITouchPhaseBegan]];
+    
+    NSError *error = nil;
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:store requiringSecureCoding:YES error:&error];
+    XCTAssertNotNil(data, @"%@", error);
+    ORKTouchAbilityTrackStore *decoded = [NSKeyedUnarchiver unarchivedObjectOfClass:[ORKTouchAbilityTrackStore class] fromData:data error:&error];
+    XCTAssertNotNil(decoded, @"%@", error);
+    
+    XCTAssertEqual(decoded.trackCount, store.trackCount);
+    for (NSUInteger track = 0; track < store.trackCount; track++) {
+        NSUInteger count = [store sampleCountOfTrackAtIndex:track];
+        XCTAssertEqual([decoded sampleCountOfTrackAtIndex:track], count);
+        XCTAssertEqual(memcmp([decoded timestampsOfTrackAtIndex:track], [store timestampsOfTrackAtIndex:track], count * sizeof(NSTimeInterval)), 0);
+        XCTAssertEqual(memcmp([decoded locationsOfTrackAtIndex:track], [store locationsOfTrackAtIndex:track], count * sizeof(CGPoint)), 0);
+        XCTAssertEqual(memcmp([decoded forcesOfTrackAtIndex:track], [store forcesOfTrackAtIndex:track], count * sizeof(CGFloat)), 0);
+        XCTAssertEqual(memcmp([decoded majorRadiiOfTrackAtIndex:track], [store majorRadiiOfTrackAtIndex:track], count * sizeof(CGFloat)), 0);
+        XCTAssertEqual(memcmp([decoded phasesOfTrackAtIndex:track], [store phasesOfTrackAtIndex:track], count), 0);
+    }
+    XCTAssertEqualObjects(decoded.tracks, store.tracks);
+    
+    // Live touches are not encoded.
+    [decoded appendTouch:touch coalescedTouches:nil];
+    XCTAssertEqual([decoded sampleCountOfTrackAtIndex:0], [store sampleCountOfTrackAtIndex:0]);
+}
+
+- (ORKTouchAbilityTrackStore *)storeDecodedFromArchiveWithSampleCounts:(NSArray<NSNumber *> *)sampleCounts columnSampleCount:(NSUInteger)columnSampleCount {
+    ORKTouchAbilityTrackStoreTestsArchive *archive = [ORKTouchAbilityTrackStoreTestsArchive new];
+    archive.sampleCounts = sampleCounts;
+    archive.columnSampleCount = columnSampleCount;
+    NSKeyedArchiver *archiver = [[NSKeyedArchiver alloc] initRequiringSecureCoding:YES];
+    [archiver setClassName:NSStringFromClass([ORKTouchAbilityTrackStore class]) forClass:[ORKTouchAbilityTrackStoreTestsArchive class]];
+    [archiver encodeObject:archive forKey:NSKeyedArchiveRootObjectKey];
+    [archiver finishEncoding];
+    return [NSKeyedUnarchiver unarchivedObjectOfClass:[ORKTouchAbilityTrackStore class] fromData:archiver.encodedData error:nil];
+}
+
+- (void)testMalformedArchivesAreRejected {
+    XCTAssertNotNil([self storeDecodedFromArchiveWithSampleCounts:@[@2, @1] columnSampleCount:3]);
+    
+    // Column lengths that don't match the sample counts.
+    XCTAssertNil([self storeDecodedFromArchiveWithSampleCounts:@[@2, @1] columnSampleCount:2]);
+    XCTAssertNil([self storeDecodedFromArchiveWithSampleCounts:@[@2, @0] columnSampleCount:2]);
+    
+    // Sample counts whose sum wraps to one sample.
+    uint64_t half = UINT64_C(1) << 63;
+    XCTAssertNil([self storeDecodedFromArchiveWithSampleCounts:@[@(half), @(half + 1)] columnSampleCount:1]);
+    
+    // A sample count whose column length wraps.
+    XCTAssertNil([self storeDecodedFromArchiveWithSampleCounts:@[@(UINT64_C(1) << 61)] columnSampleCount:0]);
+}
+
+@end
@@ -0,0 +1,78 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+@import ResearchKitActiveTask_Private;
+
+@interface ORKTouchSampleCaptureTests : XCTestCase
+
+@end
+
+@implementation ORKTouchSampleCaptureTests
+
+- (NSDictionary *)dictionaryForSample:(ORKTouchSample)sample viewSize:(CGSize)viewSize {
+    NSData *data = [ORKTouchJSONSampleSink JSONDataForSample:&sample viewSize:viewSize];
+    NSError *error = nil;
+    NSDictionary *dictionary = [NSJSONSerialization JSONObjectWithData:data options:0 error:&error];
+    XCTAssertNotNil(dictionary, @"%@", error);
+    return dictionary;
+}
+
+- (void)testActualTouchMatchesLegacyKeys {
+    ORKTouchSample sample = {
+        .timestamp = 123456.789012345,
+        .location = CGPointMake(10.5, 200.25),
+        .index = 7,
+        .phase = UITouchPhaseMoved,
+        .kind = ORKTouchSampleKindActual
+    };
+    NSDictionary *dictionary = [self dictionaryForSample:sample viewSize:CGSizeMake(375, 667)];
+    
+    NSSet *expectedKeys = [NSSet setWithArray:@[@"timestamp", @"phase", @"index", @"x", @"y", @"width", @"height"]];
+    XCTAssertEqualObjects([NSSet setWithArray:dictionary.allKeys], expectedKeys);
+    XCTAssertEqualWithAccuracy([dictionary[@"timestamp"] doubleValue], 123456.789012345, 1e-9);
+    XCTAssertEqual([dictionary[@"phase"] integerValue], UITouchPhaseMoved);
+    XCTAssertEqual([dictionary[@"index"] integerValue], 7);
+    XCTAssertEqualWithAccuracy([dictionary[@"x"] doubleValue], 10.5, 1e-9);
+    XCTAssertEqualWithAccuracy([dictionary[@"y"] doubleValue], 200.25, 1e-9);
+    XCTAssertEqual([dictionary[@"width"] doubleValue], 375);
+    XCTAssertEqual([dictionary[@"height"] doubleValue], 667);
+}
+
+- (void)testCoalescedAndPredictedTouchesAreTagged {
+    ORKTouchSample sample = { .timestamp = 1, .location = CGPointZero, .index = 0, .phase = UITouchPhaseMoved, .kind = ORKTouchSampleKindCoalesced };
+    XCTAssertEqualObjects([self dictionaryForSample:sample viewSize:CGSizeZero][@"type"], @"coalesced");
+    
+    sample.kind = ORKTouchSampleKindPredicted;
+    XCTAssertEqualObjects([self dictionaryForSample:sample viewSize:CGSizeZero][@"type"], @"predicted");
+}
+
+@end
@@ -0,0 +1,118 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <XCTest/XCTest.h>
+
+@import ResearchKitActiveTask_Private;
+
+static const double ORKTremorTestSampleRate = 100;
+static const NSUInteger ORKTremorTestSampleCount = 3000;
+
+@interface ORKTremorSpectrumAnalyzerTests : XCTestCase
+
+@end
+
+@implementation ORKTremorSpectrumAnalyzerTests
+
+- (void)testWindowLength {
+    XCTAssertEqual(ORKTremorSpectrumWindowLengthForSampleRate(10), 64);
+    XCTAssertEqual(ORKTremorSpectrumWindowLengthForSampleRate(50), 128);
+    XCTAssertEqual(ORKTremorSpectrumWindowLengthForSampleRate(100), 256);
+    XCTAssertEqual(ORKTremorSpectrumWindowLengthForSampleRate(100000), 4096);
+}
+
+// A 5 Hz tremor of 0.1 g on x, a 9 Hz tremor of 0.05 g on y, and gravity alone on z.
+- (ORKTremorSpectrumResult *)analyzeSyntheticTremor {
+    ORKTremorSpectrumAnalyzer *analyzer = [[ORKTremorSpectrumAnalyzer alloc] initWithSampleRate:ORKTremorTestSampleRate];
+    for (NSUInteger index = 0; index < ORKTremorTestSampleCount; index++) {
+        double time = index / ORKTremorTestSampleRate;
+        [analyzer addSampleWithTimestamp:100 + time
+                                       x:0.1 * sin(2 * M_PI * 5 * time)
+                                       y:0.05 * sin(2 * M_PI * 9 * time + 0.3)
+                                       z:1];
+    }
+    return [analyzer resultWithIdentifier:@"motion"];
+}
+
+- (void)testAveragedSpectrum {
+    ORKTremorSpectrumResult *result = [self analyzeSyntheticTremor];
+    
+    XCTAssertEqualObjects(result.identifier, @"motion");
+    XCTAssertEqual(result.sampleRate, ORKTremorTestSampleRate);
+    XCTAssertEqual(result.windowLength, 256);
+    
+    // The power of a sine is half its squared amplitude.
+    XCTAssertEqualWithAccuracy(result.x.dominantFrequency, 5, 0.1);
+    XCTAssertEqualWithAccuracy(result.x.bandPower4To6Hz, 0.005, 0.0001);
+    XCTAssertEqualWithAccuracy(result.x.bandPower6To12Hz, 0, 0.0001);
+    XCTAssertEqualWithAccuracy(result.x.totalPower, 0.005, 0.0001);
+    
+    XCTAssertEqualWithAccuracy(result.y.dominantFrequency, 9, 0.1);
+    XCTAssertEqualWithAccuracy(result.y.bandPower4To6Hz, 0, 0.0001);
+    XCTAssertEqualWithAccuracy(result.y.bandPower6To12Hz, 0.00125, 0.00005);
+    XCTAssertEqualWithAccuracy(result.y.totalPower, 0.00125, 0.00005);
+    
+    XCTAssertEqual(result.z.dominantFrequency, 0);
+    XCTAssertEqualWithAccuracy(result.z.totalPower, 0, 1e-12);
+}
+
+- (void)testWindows {
+    ORKTremorSpectrumResult *result = [self analyzeSyntheticTremor];
+    
+    // Half-overlapping windows of 256 samples over 3000 samples.
+    XCTAssertEqual(result.windows.count, 22);
+    XCTAssertEqualWithAccuracy(result.windows.firstObject.startTime, 0, 1e-9);
+    XCTAssertEqualWithAccuracy(result.windows[1].startTime, 1.28, 1e-9);
+    for (ORKTremorSpectrumWindow *window in result.windows) {
+        XCTAssertEqualWithAccuracy(window.x.dominantFrequency, 5, 0.2);
+        XCTAssertEqualWithAccuracy(window.y.dominantFrequency, 9, 0.2);
+    }
+}
+
+- (void)testNoCompleteWindow {
+    ORKTremorSpectrumAnalyzer *analyzer = [[ORKTremorSpectrumAnalyzer alloc] initWithSampleRate:ORKTremorTestSampleRate];
+    for (NSUInteger index = 0; index < 100; index++) {
+        [analyzer addSampleWithTimestamp:index / ORKTremorTestSampleRate x:0 y:0 z:1];
+    }
+    ORKTremorSpectrumResult *result = [analyzer resultWithIdentifier:@"motion"];
+    XCTAssertEqual(result.windows.count, 0);
+    XCTAssertNil(result.x);
+}
+
+- (void)testSecureCoding {
+    ORKTremorSpectrumResult *result = [self analyzeSyntheticTremor];
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:result requiringSecureCoding:YES error:nil];
+    ORKTremorSpectrumResult *decoded = [NSKeyedUnarchiver unarchivedObjectOfClass:[ORKTremorSpectrumResult class] fromData:data error:nil];
+    XCTAssertEqualObjects(decoded, result);
+    XCTAssertEqualObjects([result copy], result);
+}
+
+@end
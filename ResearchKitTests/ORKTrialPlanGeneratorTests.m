@@ -0,0 +1,143 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import XCTest;
+@import ResearchKitActiveTask_Private;
+
+
+@interface ORKTrialPlanGeneratorTests : XCTestCase
+
+@end
+
+
+@implementation ORKTrialPlanGeneratorTests
+
+- (void)testSameSeedGivesSamePlan {
+    ORKTrialPlanResult *plan = [ORKTrialPlanGenerator stroopTrialPlanWithIdentifier:@"stroop" seed:1234 numberOfTrials:20];
+    ORKTrialPlanResult *replay = [ORKTrialPlanGenerator stroopTrialPlanWithIdentifier:@"stroop" seed:1234 numberOfTrials:20];
+    ORKTrialPlanResult *other = [ORKTrialPlanGenerator stroopTrialPlanWithIdentifier:@"stroop" seed:1235 numberOfTrials:20];
+    
+    XCTAssertEqual(plan.seed, 1234);
+    XCTAssertEqualObjects(plan.stimuli, replay.stimuli);
+    XCTAssertNotEqualObjects(plan.stimuli, other.stimuli);
+}
+
+- (void)testZeroSeedIsReplacedAndRecorded {
+    ORKTrialPlanResult *plan = [ORKTrialPlanGenerator PSATTrialPlanWithIdentifier:@"psat" seed:0 seriesLength:30];
+    XCTAssertNotEqual(plan.seed, 0);
+    
+    ORKTrialPlanResult *replay = [ORKTrialPlanGenerator PSATTrialPlanWithIdentifier:@"psat" seed:plan.seed seriesLength:30];
+    XCTAssertEqualObjects(plan.stimuli, replay.stimuli);
+}
+
+- (void)testUniformStaysInRange {
+    ORKTrialRandom random = ORKTrialRandomMake(7);
+    NSUInteger counts[3] = { 0 };
+    for (NSUInteger i = 0; i < 3000; i++) {
+        uint32_t value = ORKTrialRandomUniform(&random, 3);
+        XCTAssertLessThan(value, 3);
+        counts[value]++;
+    }
+    for (NSUInteger i = 0; i < 3; i++) {
+        XCTAssertEqualWithAccuracy((double)counts[i], 1000.0, 100.0);
+    }
+}
+
+- (void)testStroopPlanIsBalanced {
+    NSUInteger numberOfTrials = 4000;
+    ORKTrialPlanResult *plan = [ORKTrialPlanGenerator stroopTrialPlanWithIdentifier:@"stroop" seed:42 numberOfTrials:numberOfTrials];
+    XCTAssertEqual(plan.stimuli.count, numberOfTrials);
+    
+    NSUInteger congruent = 0;
+    for (NSArray<NSNumber *> *stimulus in plan.stimuli) {
+        XCTAssertEqual(stimulus.count, 2);
+        XCTAssertLessThan(stimulus[0].unsignedIntegerValue, 4);
+        XCTAssertLessThan(stimulus[1].unsignedIntegerValue, 4);
+        if ([stimulus[0] isEqualToNumber:stimulus[1]]) {
+            congruent++;
+        }
+    }
+    XCTAssertEqualWithAccuracy((double)congruent / numberOfTrials, 0.5, 0.05);
+}
+
+- (void)testPSATPlanNeverRepeatsADigit {
+    ORKTrialPlanResult *plan = [ORKTrialPlanGenerator PSATTrialPlanWithIdentifier:@"psat" seed:99 seriesLength:60];
+    XCTAssertEqual(plan.stimuli.count, 61);
+    
+    NSInteger previousDigit = 0;
+    for (NSArray<NSNumber *> *stimulus in plan.stimuli) {
+        NSInteger digit = stimulus.firstObject.integerValue;
+        XCTAssertGreaterThanOrEqual(digit, 1);
+        XCTAssertLessThanOrEqual(digit, 9);
+        XCTAssertNotEqual(digit, previousDigit);
+        previousDigit = digit;
+    }
+}
+
+- (void)testSpatialSpanPlanListsGameSeeds {
+    ORKTrialPlanResult *plan = [ORKTrialPlanGenerator spatialSpanTrialPlanWithIdentifier:@"memory" seed:5 numberOfGames:8];
+    XCTAssertEqual(plan.stimuli.count, 8);
+    
+    NSMutableSet<NSNumber *> *seeds = [NSMutableSet set];
+    [plan.stimuli enumerateObjectsUsingBlock:^(NSArray<NSNumber *> *stimulus, NSUInteger gameIndex, BOOL *stop) {
+        uint32_t gameSeed = stimulus.firstObject.unsignedIntValue;
+        XCTAssertNotEqual(gameSeed, 0);
+        XCTAssertEqual(gameSeed, ORKTrialPlanSpatialSpanGameSeed(5, gameIndex));
+        [seeds addObject:stimulus.firstObject];
+    }];
+    XCTAssertEqual(seeds.count, 8);
+}
+
+- (void)testGeneratorRunsInBackground {
+    __block BOOL ranOnMainThread = YES;
+    ORKTrialPlanGenerator *generator = [[ORKTrialPlanGenerator alloc] initWithBlock:^ORKTrialPlanResult *{
+        ranOnMainThread = [NSThread isMainThread];
+        return [ORKTrialPlanGenerator PSATTrialPlanWithIdentifier:@"psat" seed:3 seriesLength:10];
+    }];
+    
+    ORKTrialPlanResult *plan = generator.trialPlan;
+    XCTAssertFalse(ranOnMainThread);
+    XCTAssertEqual(plan.seed, 3);
+    XCTAssertEqualObjects(plan.stimuli, [ORKTrialPlanGenerator PSATTrialPlanWithIdentifier:@"psat" seed:3 seriesLength:10].stimuli);
+}
+
+- (void)testSecureCodingRoundTrip {
+    ORKTrialPlanResult *plan = [ORKTrialPlanGenerator stroopTrialPlanWithIdentifier:@"stroop" seed:8 numberOfTrials:12];
+    NSError *error = nil;
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:plan requiringSecureCoding:YES error:&error];
+    XCTAssertNil(error);
+    
+    ORKTrialPlanResult *decoded = [NSKeyedUnarchiver unarchivedObjectOfClass:[ORKTrialPlanResult class] fromData:data error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(decoded, plan);
+}
+
+@end
@@ -33,6 +33,7 @@
 #import <UIKit/UIKit.h>
 #import <PDFKit/PDFKit.h>
 #import <ResearchKit/ORKDefines.h>
+#import <ResearchKit/ORKStrokeData.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -69,6 +70,13 @@ ORK_CLASS_AVAILABLE
 @property (nonatomic, weak, nullable) id<ORKFreehandDrawingViewDelegate> delegate;
 @property (nonatomic, copy, nullable) NSArray <UIBezierPath *> *freehandDrawingPath;
 
+/**
+ The recorded touch points of the drawing, with pressure and timing, in the compact binary
+ stroke format. Locations are in the view's coordinate space. Setting this property replaces the
+ drawing of a view that is not annotating a PDF view.
+ */
+@property (nonatomic, copy, nullable) ORKStrokeData *freehandDrawingStrokeData;
+
 - (UIImage *)freehandDrawingImage;
 
 @property (nonatomic, readonly) BOOL freehandDrawingExists;
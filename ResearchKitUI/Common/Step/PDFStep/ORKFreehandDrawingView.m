@@ -31,6 +31,8 @@
 
 #import "ORKHelpers_Internal.h"
 #import "ORKFreehandDrawingView.h"
+#import "ORKStrokeRasterCache.h"
+#import "ORKStrokeData_Private.h"
 #import <UIKit/UIGestureRecognizerSubclass.h>
 
 
@@ -106,6 +108,9 @@ static const CGFloat LineWidthStepValue = 0.25f;
     
     PDFView *_pdfView;
     BOOL _touchedOutside;
+    // Touch timestamp that recorded stroke timestamps are relative to.
+    NSTimeInterval _strokeTimeOrigin;
+    BOOL _hasStrokeTimeOrigin;
 }
 
 @property (nonatomic, strong) UIBezierPath *currentPath;
@@ -113,6 +118,8 @@ static const CGFloat LineWidthStepValue = 0.25f;
 
 @property (nonatomic, strong) NSMutableArray *pathArray;
 @property (nonatomic, strong) NSMutableArray *pdfPathArray;
+@property (nonatomic, strong) ORKStrokeRasterCache *rasterCache;
+@property (nonatomic, strong) ORKStrokeDataBuilder *strokeDataBuilder;
 
 @property (nonatomic, strong) ORKFreehandDrawingGestureRecognizer *freehandDrawingGestureRecognizer;
 
@@ -180,6 +187,50 @@ static const CGFloat LineWidthStepValue = 0.25f;
     return _pdfPathArray;
 }
 
+- (ORKStrokeRasterCache *)rasterCache {
+    if (_rasterCache == nil) {
+        _rasterCache = [ORKStrokeRasterCache new];
+    }
+    return _rasterCache;
+}
+
+- (ORKStrokeDataBuilder *)strokeDataBuilder {
+    if (_strokeDataBuilder == nil) {
+        _strokeDataBuilder = [[ORKStrokeDataBuilder alloc] initWithLineWidth:self.lineWidth lineWidthVariation:self.lineWidthVariation];
+    }
+    return _strokeDataBuilder;
+}
+
+- (void)recordStrokePointForTouch:(UITouch *)touch lineWidth:(CGFloat)lineWidth beginsStroke:(BOOL)beginsStroke {
+    if (!_hasStrokeTimeOrigin) {
+        // Strokes recorded after a restored drawing continue its timeline.
+        _strokeTimeOrigin = touch.timestamp - self.strokeDataBuilder.lastTimestamp;
+        _hasStrokeTimeOrigin = YES;
+    }
+    ORKStrokePoint point = {
+        .location = [touch locationInView:self],
+        .pressure = self.lineWidthVariation > 0 ? (lineWidth - self.lineWidth) / self.lineWidthVariation : 0,
+        .timestamp = touch.timestamp - _strokeTimeOrigin
+    };
+    if (beginsStroke) {
+        [self.strokeDataBuilder beginStrokeWithPoint:point];
+    } else {
+        [self.strokeDataBuilder addPoint:point];
+    }
+}
+
+// Rasterizes all committed strokes again if the cache no longer matches them or the view.
+- (void)updateRasterCache {
+    CGSize size = self.bounds.size;
+    CGFloat scale = self.contentScaleFactor;
+    if (![self.rasterCache isValidForCanvasSize:size scale:scale strokeCount:self.pathArray.count]) {
+        [self.rasterCache resetWithCanvasSize:size scale:scale];
+        for (UIBezierPath *path in self.pathArray) {
+            [self.rasterCache addStroke:path];
+        }
+    }
+}
+
 #pragma mark Touch Event Handlers
 
 - (BOOL)isForceTouchAvailable {
@@ -240,6 +291,8 @@ static const CGFloat LineWidthStepValue = 0.25f;
                 previousTouchTime = touch.timestamp;
             }
             
+            [self recordStrokePointForTouch:touch lineWidth:self.lineWidth beginsStroke:YES];
+            
             [self.currentPath moveToPoint:currentPoint];
             
             [self.pdfCurrentPath moveToPoint:[_pdfView convertPoint:currentPoint toPage:_pdfView.currentPage]];
@@ -276,6 +329,8 @@ static const CGFloat LineWidthStepValue = 0.25f;
             previousTouchTime = touch.timestamp;
         }
         
+        [self recordStrokePointForTouch:touch lineWidth:self.lineWidth beginsStroke:YES];
+        
         [self.currentPath moveToPoint:currentPoint];
         [self.currentPath addArcWithCenter:currentPoint radius:0.1 startAngle:0.0 endAngle:2.0 * M_PI clockwise:YES];
         [self gestureTouchesMoved:touches withEvent:event];
@@ -301,6 +356,7 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
             if (proposedLineWidth == CGFLOAT_MIN) {
                 return;
             }
+            [self recordStrokePointForTouch:touch lineWidth:proposedLineWidth beginsStroke:NO];
             
             // Only step the line width up and down by a set value.
             // This prevents the line looking jagged, and adding excessive
@@ -340,6 +396,9 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     else {
 
         CGFloat proposedLineWidth = [self getProposedLineWidthWithTouch:touch WithEvent:event];
+        if (proposedLineWidth != CGFLOAT_MIN) {
+            [self recordStrokePointForTouch:touch lineWidth:proposedLineWidth beginsStroke:NO];
+        }
         
         // Only step the line width up and down by a set value.
         // This prevents the line looking jagged, and adding excessive
@@ -431,6 +490,8 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
 
 - (void)gestureTouchesEnded:(NSSet *)touches withEvent:(UIEvent *)event {
     [self commitCurrentPath];
+    // The stroke is now drawn from the raster cache.
+    self.currentPath = nil;
 }
 
 - (void)commitCurrentPath {
@@ -440,6 +501,9 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     }
     
     [self.pathArray addObject:self.currentPath];
+    if (self.rasterCache.strokeCount + 1 == self.pathArray.count) {
+        [self.rasterCache addStroke:self.currentPath];
+    }
     if (_pdfView) {
         [self.pdfPathArray addObject:self.pdfCurrentPath];
     }
@@ -453,10 +517,9 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     [_backgroundColor setFill];
     CGContextFillRect(UIGraphicsGetCurrentContext(), rect);
     
-    for (UIBezierPath *path in self.pathArray) {
-        [self.lineColor setStroke];
-        [path stroke];
-    }
+    // Committed strokes come from the raster cache; only the live stroke is drawn as a vector.
+    [self updateRasterCache];
+    [self.rasterCache drawInRect:rect color:self.lineColor];
     
     [self.lineColor setStroke];
     [self.currentPath stroke];
@@ -466,10 +529,34 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     return _pdfView ? [self.pdfPathArray copy] : [self.pathArray copy];
 }
 
+- (ORKStrokeData *)freehandDrawingStrokeData {
+    if (self.strokeDataBuilder.strokeCount == 0) {
+        return nil;
+    }
+    self.strokeDataBuilder.canvasSize = self.bounds.size;
+    return [self.strokeDataBuilder strokeData];
+}
+
+- (void)setFreehandDrawingStrokeData:(ORKStrokeData *)freehandDrawingStrokeData {
+    // Page-space paths cannot be restored from view-space strokes, so PDF annotations are not replaced.
+    if (freehandDrawingStrokeData && _pdfView == nil) {
+        _pathArray = [[freehandDrawingStrokeData bezierPaths] mutableCopy];
+        [self.rasterCache removeAllStrokes];
+        [self.strokeDataBuilder removeAllStrokes];
+        [self.strokeDataBuilder appendStrokesFromStrokeData:freehandDrawingStrokeData];
+        _hasStrokeTimeOrigin = NO;
+        [self setNeedsDisplay];
+    }
+}
+
 - (UIImage *)freehandDrawingImage {
     CGSize imageContextSize;
     imageContextSize = (self.bounds.size.width == 0 || self.bounds.size.height == 0) ? CGSizeMake(200, 200) :
     self.bounds.size;
+    if ([self.rasterCache isValidForCanvasSize:imageContextSize scale:self.contentScaleFactor strokeCount:self.pathArray.count]) {
+        return [self.rasterCache imageWithColor:self.lineColor];
+    }
+    
     UIGraphicsBeginImageContext(imageContextSize);
     
     for (UIBezierPath *path in self.pathArray) {
@@ -494,6 +581,9 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
         }
         
         [self.pathArray removeAllObjects];
+        [self.rasterCache removeAllStrokes];
+        [self.strokeDataBuilder removeAllStrokes];
+        _hasStrokeTimeOrigin = NO;
         [self setNeedsDisplayInRect:self.bounds];
     }
     if (_pdfView) {
@@ -270,8 +270,7 @@ NSString * const ORKSignatureViewClearButtonAccessibilityIdentifier = @"ORKSigna
     }
     
     ORKSignatureResult *parentResult = [[ORKSignatureResult alloc] initWithIdentifier:identifier
-                                                                       signatureImage:_signatureView.signatureImage
-                                                                        signaturePath:_signatureView.signaturePath];
+                                                                           strokeData:_signatureView.signatureStrokeData];
     if (_customHeaderView || _customFooterView) {
         NSMutableDictionary *userInfo = [parentResult.userInfo mutableCopy];
         if (!userInfo) {
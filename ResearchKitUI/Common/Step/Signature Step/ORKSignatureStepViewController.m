@@ -210,6 +210,7 @@
 @property (nonatomic, strong, readonly, nullable) ORKSignatureView *signatureView;
 @property (nonatomic, strong) ORKConsentSigningView *signingView;
 @property (nonatomic, strong) NSArray <UIBezierPath *> *originalPath;
+@property (nonatomic, strong) ORKStrokeData *originalStrokeData;
 
 @end
 
@@ -224,7 +225,10 @@
         if ([result isKindOfClass:[ORKStepResult class]]) {
             [[(ORKStepResult *)result results] enumerateObjectsUsingBlock:^(ORKResult * _Nonnull obj, NSUInteger idx, BOOL * _Nonnull stop) {
                 if ([obj isKindOfClass:[ORKSignatureResult class]]) {
-                    _originalPath = [(ORKSignatureResult*)obj signaturePath];
+                    _originalStrokeData = [(ORKSignatureResult*)obj strokeData];
+                    if (_originalStrokeData == nil) {
+                        _originalPath = [(ORKSignatureResult*)obj signaturePath];
+                    }
                     *stop = YES;
                 }
             }];
@@ -237,8 +241,12 @@
 - (void)viewWillAppear:(BOOL)animated {
     [super viewWillAppear:animated];
 
-    // set the original path and update state
-    self.signatureView.signaturePath = self.originalPath;
+    // set the original strokes or path and update state
+    if (self.originalStrokeData) {
+        self.signatureView.signatureStrokeData = self.originalStrokeData;
+    } else {
+        self.signatureView.signaturePath = self.originalPath;
+    }
     [self updateButtonStates];
 }
 
@@ -247,8 +255,7 @@
     
     if (self.signatureView.signatureExists) {
         ORKSignatureResult *sigResult = [[ORKSignatureResult alloc] initWithIdentifier:self.step.identifier
-                                                                        signatureImage:self.signatureView.signatureImage
-                                                                         signaturePath:self.signatureView.signaturePath];
+                                                                            strokeData:self.signatureView.signatureStrokeData];
         parentResult.results = @[sigResult];
     }
     
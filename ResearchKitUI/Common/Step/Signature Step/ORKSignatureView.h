@@ -31,6 +31,7 @@
 
 
 #import <UIKit/UIKit.h>
+#import <ResearchKit/ORKStrokeData.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -79,6 +80,12 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong, nullable) UIGestureRecognizer *signatureGestureRecognizer;
 @property (nonatomic, copy, nullable) NSArray <UIBezierPath *> *signaturePath;
 
+/**
+ The recorded touch points of the signature, with pressure and timing, in the compact binary
+ stroke format. Setting this property replaces the signature.
+ */
+@property (nonatomic, copy, nullable) ORKStrokeData *signatureStrokeData;
+
 - (UIImage *)signatureImage;
 
 @property (nonatomic, readonly) BOOL signatureExists;
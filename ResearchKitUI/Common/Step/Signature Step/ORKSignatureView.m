@@ -33,9 +33,11 @@
 #import "ORKSignatureView.h"
 
 #import "ORKSelectionTitleLabel.h"
+#import "ORKStrokeRasterCache.h"
 
 #import "ORKHelpers_Internal.h"
 #import "ORKSkin.h"
+#import "ORKStrokeData_Private.h"
 
 #import <UIKit/UIGestureRecognizerSubclass.h>
 
@@ -133,10 +135,15 @@ static const CGFloat LineWidthStepValue = 0.25f;
     CGFloat maxPressure;
     // Time used only to calculate speed when force isn't available on the device.
     NSTimeInterval previousTouchTime;
+    // Touch timestamp that recorded stroke timestamps are relative to.
+    NSTimeInterval strokeTimeOrigin;
+    BOOL hasStrokeTimeOrigin;
 }
 
 @property (nonatomic, strong) UIBezierPath *currentPath;
 @property (nonatomic, strong) NSMutableArray *pathArray;
+@property (nonatomic, strong) ORKStrokeRasterCache *rasterCache;
+@property (nonatomic, strong) ORKStrokeDataBuilder *strokeDataBuilder;
 @property (nonatomic, strong) NSArray *backgroundLines;
 @property (nonatomic) BOOL setWidth;
 
@@ -274,6 +281,51 @@ static const CGFloat LineWidthStepValue = 0.25f;
     return _pathArray;
 }
 
+- (ORKStrokeRasterCache *)rasterCache {
+    if (_rasterCache == nil) {
+        _rasterCache = [ORKStrokeRasterCache new];
+    }
+    return _rasterCache;
+}
+
+- (ORKStrokeDataBuilder *)strokeDataBuilder {
+    if (_strokeDataBuilder == nil) {
+        _strokeDataBuilder = [[ORKStrokeDataBuilder alloc] initWithLineWidth:self.lineWidth lineWidthVariation:self.lineWidthVariation];
+    }
+    return _strokeDataBuilder;
+}
+
+- (void)recordStrokePointForTouch:(UITouch *)touch pressure:(CGFloat)pressure beginsStroke:(BOOL)beginsStroke {
+    if (!hasStrokeTimeOrigin) {
+        // Strokes recorded after a restored signature continue its timeline.
+        strokeTimeOrigin = touch.timestamp - self.strokeDataBuilder.lastTimestamp;
+        hasStrokeTimeOrigin = YES;
+    }
+    CGFloat pressureRange = maxPressure - minPressure;
+    ORKStrokePoint point = {
+        .location = [touch locationInView:self],
+        .pressure = pressureRange > 0 ? (pressure - minPressure) / pressureRange : 0,
+        .timestamp = touch.timestamp - strokeTimeOrigin
+    };
+    if (beginsStroke) {
+        [self.strokeDataBuilder beginStrokeWithPoint:point];
+    } else {
+        [self.strokeDataBuilder addPoint:point];
+    }
+}
+
+// Rasterizes all committed strokes again if the cache no longer matches them or the view.
+- (void)updateRasterCache {
+    CGSize size = self.bounds.size;
+    CGFloat scale = self.contentScaleFactor;
+    if (![self.rasterCache isValidForCanvasSize:size scale:scale strokeCount:self.pathArray.count]) {
+        [self.rasterCache resetWithCanvasSize:size scale:scale];
+        for (UIBezierPath *path in self.pathArray) {
+            [self.rasterCache addStroke:path];
+        }
+    }
+}
+
 - (CGFloat)placeholderPoint {
     CGFloat height = self.bounds.size.height;
     CGFloat y1 = height * TopToSigningLineRatio;
@@ -356,6 +408,8 @@ static const CGFloat LineWidthStepValue = 0.25f;
         previousTouchTime = touch.timestamp;
     }
     
+    [self recordStrokePointForTouch:touch pressure:minPressure beginsStroke:YES];
+    
     [self.currentPath moveToPoint:currentPoint];
     [self.currentPath addArcWithCenter:currentPoint radius:0.1 startAngle:0.0 endAngle:2.0 * M_PI clockwise:YES];
     [self gestureTouchesMoved:touches withEvent:event];
@@ -401,6 +455,8 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     pressure = MAX(minPressure, pressure);
     pressure = MIN(maxPressure, pressure);
     
+    [self recordStrokePointForTouch:touch pressure:pressure beginsStroke:NO];
+    
     CGFloat previousLineWidth = self.currentPath.lineWidth;
     CGFloat proposedLineWidth = ((pressure - minPressure) *
                                  self.lineWidthVariation /
@@ -455,6 +511,8 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
 
 - (void)gestureTouchesEnded:(NSSet *)touches withEvent:(UIEvent *)event {
     [self commitCurrentPath];
+    // The stroke is now drawn from the raster cache.
+    self.currentPath = nil;
 }
 
 - (void)gestureTouchesHaveEndedWithTimeInterval {
@@ -470,6 +528,9 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     }
     
     [self.pathArray addObject:self.currentPath];
+    if (self.rasterCache.strokeCount + 1 == self.pathArray.count) {
+        [self.rasterCache addStroke:self.currentPath];
+    }
     
     [self.delegate signatureViewDidEditImage:self];
 }
@@ -481,10 +542,9 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     
     CGContextFillRect(UIGraphicsGetCurrentContext(), rect);
     
-    for (UIBezierPath *path in self.pathArray) {
-        [self.lineColor setStroke];
-        [path stroke];
-    }
+    // Committed strokes come from the raster cache; only the live stroke is drawn as a vector.
+    [self updateRasterCache];
+    [self.rasterCache drawInRect:rect color:self.lineColor];
     
     [self.lineColor setStroke];
     [self.currentPath stroke];
@@ -499,11 +559,41 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
 - (void)setSignaturePath:(NSArray<UIBezierPath *> *)signaturePath {
     if (signaturePath) {
         _pathArray = [signaturePath mutableCopy];
+        [self.rasterCache removeAllStrokes];
+        [self.strokeDataBuilder removeAllStrokes];
+        [self.strokeDataBuilder appendStrokesFromStrokeData:[ORKStrokeData strokeDataWithBezierPaths:signaturePath
+                                                                                         canvasSize:self.bounds.size
+                                                                                          lineWidth:self.lineWidth
+                                                                                 lineWidthVariation:self.lineWidthVariation]];
+        hasStrokeTimeOrigin = NO;
+        [self setNeedsDisplay];
+    }
+}
+
+- (ORKStrokeData *)signatureStrokeData {
+    if (self.strokeDataBuilder.strokeCount == 0) {
+        return nil;
+    }
+    self.strokeDataBuilder.canvasSize = _signatureSize;
+    return [self.strokeDataBuilder strokeData];
+}
+
+- (void)setSignatureStrokeData:(ORKStrokeData *)signatureStrokeData {
+    if (signatureStrokeData) {
+        _pathArray = [[signatureStrokeData bezierPaths] mutableCopy];
+        [self.rasterCache removeAllStrokes];
+        [self.strokeDataBuilder removeAllStrokes];
+        [self.strokeDataBuilder appendStrokesFromStrokeData:signatureStrokeData];
+        hasStrokeTimeOrigin = NO;
         [self setNeedsDisplay];
     }
 }
 
 - (UIImage *)signatureImage {
+    if ([self.rasterCache isValidForCanvasSize:_signatureSize scale:self.contentScaleFactor strokeCount:self.pathArray.count]) {
+        return [self.rasterCache imageWithColor:[UIColor blackColor]];
+    }
+    
     UIGraphicsBeginImageContext(_signatureSize);
 
     for (UIBezierPath *path in self.pathArray) {
@@ -528,6 +618,9 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
         }
         
         [self.pathArray removeAllObjects];
+        [self.rasterCache removeAllStrokes];
+        [self.strokeDataBuilder removeAllStrokes];
+        hasStrokeTimeOrigin = NO;
         [self setNeedsDisplayInRect:self.bounds];
     }
 }
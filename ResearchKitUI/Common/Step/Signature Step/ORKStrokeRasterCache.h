@@ -0,0 +1,96 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <UIKit/UIKit.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ An offscreen raster cache of committed strokes, for drawing views whose redraw cost must not grow
+ with the number of strokes.
+ 
+ The canvas is divided into square tiles that are allocated the first time a stroke touches them.
+ Each stroke is rasterized once, into the tiles it covers, as a coverage mask at the screen scale,
+ keeping its own line width, cap, and join. Drawing fills the masks of the tiles in the dirty
+ rectangle with a color, so the cache stays valid when the line color or the appearance changes.
+ */
+@interface ORKStrokeRasterCache : NSObject
+
+/**
+ Returns a cache with tiles of the given size, in points.
+ */
+- (instancetype)initWithTileSize:(CGFloat)tileSize NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) CGFloat tileSize;
+
+@property (nonatomic, readonly) CGSize canvasSize;
+
+@property (nonatomic, readonly) CGFloat scale;
+
+/**
+ The number of strokes rasterized since the cache was last reset.
+ */
+@property (nonatomic, readonly) NSUInteger strokeCount;
+
+/**
+ Returns whether the cache holds exactly the given number of strokes, for a canvas of the given size and scale.
+ */
+- (BOOL)isValidForCanvasSize:(CGSize)canvasSize scale:(CGFloat)scale strokeCount:(NSUInteger)strokeCount;
+
+/**
+ Discards all tiles, and sets the canvas geometry used by subsequent strokes.
+ */
+- (void)resetWithCanvasSize:(CGSize)canvasSize scale:(CGFloat)scale;
+
+/**
+ Discards all tiles and keeps the canvas geometry.
+ */
+- (void)removeAllStrokes;
+
+/**
+ Rasterizes a stroke into the tiles it covers.
+ */
+- (void)addStroke:(UIBezierPath *)path;
+
+/**
+ Fills the cached strokes that intersect a rectangle with a color, in the current UIKit graphics context.
+ */
+- (void)drawInRect:(CGRect)rect color:(UIColor *)color;
+
+/**
+ Returns an image of the cached strokes filled with a color, at scale 1.
+ */
+- (UIImage *)imageWithColor:(UIColor *)color;
+
+@end
+
+NS_ASSUME_NONNULL_END
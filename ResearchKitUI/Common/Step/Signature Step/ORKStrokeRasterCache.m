@@ -0,0 +1,186 @@
+/*
+ Copyright (c) 2026, Apple Inc. All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKStrokeRasterCache.h"
+
+
+static const CGFloat ORKStrokeRasterCacheDefaultTileSize = 256;
+
+typedef struct {
+    CGContextRef context;
+    CGImageRef mask;
+} ORKStrokeRasterTile;
+
+
+@implementation ORKStrokeRasterCache {
+    ORKStrokeRasterTile *_tiles;
+    NSUInteger _columnCount;
+    NSUInteger _rowCount;
+    size_t _tilePixelSize;
+    CGColorSpaceRef _colorSpace;
+}
+
+- (instancetype)init {
+    return [self initWithTileSize:ORKStrokeRasterCacheDefaultTileSize];
+}
+
+- (instancetype)initWithTileSize:(CGFloat)tileSize {
+    self = [super init];
+    if (self) {
+        _tileSize = tileSize > 0 ? tileSize : ORKStrokeRasterCacheDefaultTileSize;
+        _scale = 1;
+        _colorSpace = CGColorSpaceCreateDeviceGray();
+    }
+    return self;
+}
+
+- (void)dealloc {
+    [self releaseTiles];
+    CGColorSpaceRelease(_colorSpace);
+}
+
+- (void)releaseTiles {
+    NSUInteger tileCount = _columnCount * _rowCount;
+    for (NSUInteger index = 0; index < tileCount; index++) {
+        CGContextRelease(_tiles[index].context);
+        CGImageRelease(_tiles[index].mask);
+    }
+    free(_tiles);
+    _tiles = NULL;
+}
+
+- (BOOL)isValidForCanvasSize:(CGSize)canvasSize scale:(CGFloat)scale strokeCount:(NSUInteger)strokeCount {
+    return (CGSizeEqualToSize(_canvasSize, canvasSize) &&
+            _scale == scale &&
+            _strokeCount == strokeCount);
+}
+
+- (void)resetWithCanvasSize:(CGSize)canvasSize scale:(CGFloat)scale {
+    [self releaseTiles];
+    _canvasSize = CGSizeMake(MAX(canvasSize.width, 0), MAX(canvasSize.height, 0));
+    _scale = scale > 0 ? scale : 1;
+    _columnCount = (NSUInteger)ceil(_canvasSize.width / _tileSize);
+    _rowCount = (NSUInteger)ceil(_canvasSize.height / _tileSize);
+    _tilePixelSize = (size_t)ceil(_tileSize * _scale);
+    _tiles = calloc(MAX(_columnCount * _rowCount, 1), sizeof(ORKStrokeRasterTile));
+    _strokeCount = 0;
+}
+
+- (void)removeAllStrokes {
+    [self resetWithCanvasSize:_canvasSize scale:_scale];
+}
+
+- (CGRect)rectOfTileAtColumn:(NSUInteger)column row:(NSUInteger)row {
+    return CGRectMake(column * _tileSize, row * _tileSize, _tileSize, _tileSize);
+}
+
+// Calls the block for each tile that intersects the rectangle.
+- (void)enumerateTilesInRect:(CGRect)rect usingBlock:(void (^)(ORKStrokeRasterTile *tile, CGRect tileRect))block {
+    rect = CGRectIntersection(rect, CGRectMake(0, 0, _canvasSize.width, _canvasSize.height));
+    if (CGRectIsNull(rect) || CGRectIsEmpty(rect)) {
+        return;
+    }
+    NSUInteger firstColumn = (NSUInteger)floor(CGRectGetMinX(rect) / _tileSize);
+    NSUInteger lastColumn = MIN((NSUInteger)floor(CGRectGetMaxX(rect) / _tileSize), _columnCount - 1);
+    NSUInteger firstRow = (NSUInteger)floor(CGRectGetMinY(rect) / _tileSize);
+    NSUInteger lastRow = MIN((NSUInteger)floor(CGRectGetMaxY(rect) / _tileSize), _rowCount - 1);
+    for (NSUInteger row = firstRow; row <= lastRow; row++) {
+        for (NSUInteger column = firstColumn; column <= lastColumn; column++) {
+            block(&_tiles[row * _columnCount + column], [self rectOfTileAtColumn:column row:row]);
+        }
+    }
+}
+
+- (void)addStroke:(UIBezierPath *)path {
+    CGFloat outset = path.lineWidth + 1;
+    CGRect strokeBounds = CGRectInset(path.bounds, -outset, -outset);
+    size_t pixelSize = _tilePixelSize;
+    CGFloat scale = _scale;
+    CGColorSpaceRef colorSpace = _colorSpace;
+    
+    [self enumerateTilesInRect:strokeBounds usingBlock:^(ORKStrokeRasterTile *tile, CGRect tileRect) {
+        if (tile->context == NULL) {
+            // Zero-filled, that is, fully masked out.
+            tile->context = CGBitmapContextCreate(NULL, pixelSize, pixelSize, 8, 0, colorSpace, (CGBitmapInfo)kCGImageAlphaNone);
+            if (tile->context == NULL) {
+                return;
+            }
+            // Draw in the top-left origin point space of the canvas.
+            CGContextTranslateCTM(tile->context, 0, pixelSize);
+            CGContextScaleCTM(tile->context, scale, -scale);
+            CGContextTranslateCTM(tile->context, -CGRectGetMinX(tileRect), -CGRectGetMinY(tileRect));
+        }
+        UIGraphicsPushContext(tile->context);
+        [[UIColor whiteColor] setStroke];
+        [path stroke];
+        UIGraphicsPopContext();
+        
+        CGImageRelease(tile->mask);
+        tile->mask = NULL;
+    }];
+    _strokeCount += 1;
+}
+
+- (void)drawInRect:(CGRect)rect color:(UIColor *)color {
+    CGContextRef context = UIGraphicsGetCurrentContext();
+    if (context == NULL) {
+        return;
+    }
+    [self enumerateTilesInRect:rect usingBlock:^(ORKStrokeRasterTile *tile, CGRect tileRect) {
+        if (tile->context == NULL) {
+            return;
+        }
+        if (tile->mask == NULL) {
+            tile->mask = CGBitmapContextCreateImage(tile->context);
+        }
+        CGRect maskRect = CGRectMake(0, 0, tileRect.size.width, tileRect.size.height);
+        CGContextSaveGState(context);
+        // Masks are images, which Quartz draws with a bottom-left origin.
+        CGContextTranslateCTM(context, CGRectGetMinX(tileRect), CGRectGetMaxY(tileRect));
+        CGContextScaleCTM(context, 1, -1);
+        CGContextClipToMask(context, maskRect, tile->mask);
+        [color setFill];
+        CGContextFillRect(context, maskRect);
+        CGContextRestoreGState(context);
+    }];
+}
+
+- (UIImage *)imageWithColor:(UIColor *)color {
+    CGSize size = (_canvasSize.width == 0 || _canvasSize.height == 0) ? CGSizeMake(1, 1) : _canvasSize;
+    UIGraphicsBeginImageContext(size);
+    CGContextSetInterpolationQuality(UIGraphicsGetCurrentContext(), kCGInterpolationHigh);
+    [self drawInRect:CGRectMake(0, 0, size.width, size.height) color:color];
+    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    return image;
+}
+
+@end
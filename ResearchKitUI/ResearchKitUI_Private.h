@@ -50,6 +50,7 @@
 #import <ResearchKitUI/ORKStepHeaderView_Internal.h>
 #import <ResearchKitUI/ORKStepViewController_Internal.h>
 #import <ResearchKitUI/ORKStepView_Private.h>
+#import <ResearchKitUI/ORKStrokeRasterCache.h>
 #import <ResearchKitUI/ORKTableContainerView.h>
 #import <ResearchKitUI/ORKTaskViewController_Private.h>
 #import <ResearchKitUI/ORKTaskViewController_Internal.h>